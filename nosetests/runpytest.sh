@@ -40,6 +40,7 @@ if test -z "$TESTS"; then
         test_ring_intracomp.py
         test_ringdemo.py
         test_streamring.py
+        test_haltalk_workers.py
     "
 fi
 
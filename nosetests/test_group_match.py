@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+
+# change detection on a large group, and how long an idle scan takes
+# run with '-s' to see the timing
+
+import random
+import time
+import pytest
+from machinekit import hal
+
+NMEMBERS = 10000
+TYPES = [hal.HAL_BIT, hal.HAL_S32, hal.HAL_U32, hal.HAL_FLOAT]
+LANES = [hal.HAL_BIT, hal.HAL_S32, hal.HAL_U32,
+         hal.HAL_S64, hal.HAL_U64, hal.HAL_FLOAT]
+
+# odd, so the last block of every lane is partial
+NLANE = 37
+
+# per lane: a value to change one member to, then all of them
+CHANGES = {hal.HAL_BIT: (True, False),
+           hal.HAL_S32: (7, -9),
+           hal.HAL_U32: (7, 2**31 + 5),
+           hal.HAL_S64: (7, -2**40),
+           hal.HAL_U64: (7, 2**63 + 5),
+           hal.HAL_FLOAT: (-2.5, 3.25)}
+
+def random_value(type, old):
+    # a new value, or the old one again, or for floats one within epsilon
+    r = random.random()
+    if r < 0.2:
+        return old
+    if type == hal.HAL_BIT:
+        return not old
+    if type == hal.HAL_FLOAT:
+        if r < 0.4:
+            return old + random.choice([-1, 1]) * hal.epsilon[0] * 0.6
+        return random.uniform(-1e6, 1e6)
+    lo, hi = {hal.HAL_S32: (-2**31, 2**31 - 1),
+              hal.HAL_U32: (0, 2**32 - 1),
+              hal.HAL_S64: (-2**63, 2**63 - 1),
+              hal.HAL_U64: (0, 2**64 - 1)}[type]
+    return random.randint(lo, hi)
+
+class ScalarMatch(object):
+    # what hal_cgroup_match() reported when it compared member by member:
+    # a member is changed if it differs from the value last reported,
+    # floats only if by more than the member's epsilon
+    def __init__(self, sigs):
+        self.sigs = sigs
+        self.tracking = dict((s.name, s.get()) for s in sigs)
+
+    def changed(self):
+        result = []
+        for s in self.sigs:
+            old, new = self.tracking[s.name], s.get()
+            if s.type == hal.HAL_FLOAT:
+                differs = abs(new - old) > hal.epsilon[0]
+            else:
+                differs = new != old
+            if differs:
+                self.tracking[s.name] = new
+                result.append(s.name)
+        return sorted(result)
+
+# GROUP_REPORT_ON_CHANGE | GROUP_MONITOR_ALL_MEMBERS | GROUP_REPORT_CHANGED_MEMBERS
+MONITOR_ALL = 7
+
+@pytest.mark.usefixtures("realtime")
+class TestGroupMatch(object):
+    @pytest.fixture
+    def setUp(self):
+        self.g = hal.Group("bigroup", arg1=100, arg2=MONITOR_ALL)
+        self.sigs = []
+        for i in range(NMEMBERS):
+            s = hal.Signal("gm.%d" % i, TYPES[i % len(TYPES)])
+            self.g.member_add(s)
+            self.sigs.append(s)
+
+    def test_group_match(self, setUp):
+        assert len(self.g.members()) == NMEMBERS
+
+        # all signals at default values, nothing changed yet
+        assert self.g.changed() == []
+
+        touched = self.sigs[::997] + self.sigs[1::1499] + self.sigs[-6:]
+        for s in touched:
+            if s.type == hal.HAL_BIT:
+                s.set(True)
+            elif s.type == hal.HAL_FLOAT:
+                s.set(1.5)
+            else:
+                s.set(42)
+        changed = self.g.changed()
+        assert sorted(s.name for s in changed) == \
+            sorted(set(s.name for s in touched))
+
+        # reported once only
+        assert self.g.changed() == []
+
+        # float changes within epsilon are not reported
+        floats = [s for s in self.sigs if s.type == hal.HAL_FLOAT]
+        floats[0].set(floats[0].get() + hal.epsilon[0] / 2)
+        assert self.g.changed() == []
+
+        rounds = 1000
+        start = time.perf_counter()
+        for i in range(rounds):
+            self.g.changed()
+        elapsed = time.perf_counter() - start
+        print("idle scan of %d members: %.1f usec" %
+              (NMEMBERS, elapsed * 1e6 / rounds))
+
+    def test_lane_types(self):
+        # a change at any position in every lane is detected
+        for type in LANES:
+            g = hal.Group("lanes.%d" % type, arg1=100, arg2=MONITOR_ALL)
+            sigs = []
+            for i in range(NLANE):
+                s = hal.Signal("lanes.%d.%d" % (type, i), type)
+                g.member_add(s)
+                sigs.append(s)
+            assert g.changed() == []
+
+            one, every = CHANGES[type]
+            for s in sigs:
+                s.set(one)
+                assert [c.name for c in g.changed()] == [s.name]
+                assert g.changed() == []
+
+            for s in sigs:
+                s.set(every)
+            assert sorted(c.name for c in g.changed()) == \
+                sorted(s.name for s in sigs)
+            assert g.changed() == []
+
+    def test_agrees_with_scalar(self):
+        # random changes to a group mixing all lane types
+        random.seed(4711)
+        g = hal.Group("mixed", arg1=100, arg2=MONITOR_ALL)
+        sigs = []
+        for i in range(6 * NLANE):
+            s = hal.Signal("mixed.%d" % i, LANES[i % len(LANES)])
+            g.member_add(s)
+            sigs.append(s)
+        ref = ScalarMatch(sigs)
+        assert sorted(s.name for s in g.changed()) == ref.changed()
+
+        for round in range(200):
+            for s in random.sample(sigs, random.randint(0, len(sigs))):
+                s.set(random_value(s.type, s.get()))
+            assert sorted(s.name for s in g.changed()) == ref.changed()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# haltalk --workers: groups are reported from worker threads, check
+# that full and incremental updates still reach a subscriber
+import os,time,glob,signal,subprocess
+
+import pytest
+import zmq
+from machinekit import hal,config
+from machinetalk.protobuf.message_pb2 import Container
+from machinetalk.protobuf.types_pb2 import *
+
+from configparser import ConfigParser
+
+GROUPS = ["wgroup1", "wgroup2", "wgroup3"]
+
+def wait_for(sock, mtype, topics, timeout=5.0):
+    # the first message of type mtype on each topic, skipping pings
+    got = {}
+    deadline = time.time() + timeout
+    while len(got) < len(topics) and time.time() < deadline:
+        if not sock.poll(100):
+            continue
+        topic, data = sock.recv_multipart()
+        topic = topic.decode()
+        rx = Container()
+        rx.ParseFromString(data)
+        if rx.type == mtype and topic in topics and topic not in got:
+            got[topic] = rx
+    assert sorted(got.keys()) == sorted(topics)
+    return got
+
+def subscribe(ctx, uri):
+    sock = ctx.socket(zmq.SUB)
+    sock.connect(uri)
+    for g in GROUPS:
+        sock.setsockopt_string(zmq.SUBSCRIBE, g)
+    return sock
+
+def check_full(got, values):
+    handles = {}
+    for g in GROUPS:
+        assert got[g].group[0].name == g
+        for m in got[g].group[0].member:
+            assert m.signal.hals32 == values[m.signal.name]
+            handles[m.signal.handle] = m.signal.name
+    return handles
+
+def check_incremental(got, handles, values):
+    for g in GROUPS:
+        assert len(got[g].signal) > 0
+        for s in got[g].signal:
+            assert s.hals32 == values[handles[s.handle]]
+
+@pytest.mark.usefixtures("realtime")
+class TestHaltalkWorkers(object):
+    def test_groups(self):
+        global values
+        values = {}
+        for g in GROUPS:
+            grp = hal.Group(g)
+            for i in range(2):
+                name = "%s.s%d" % (g, i)
+                s = hal.Signal(name, hal.HAL_S32)
+                s.set(i + 1)
+                values[name] = i + 1
+                grp.member_add(s)
+
+    def test_start_haltalk(self):
+        global haltalk, uri
+        cfg = ConfigParser()
+        cfg.read(os.getenv("MACHINEKIT_INI"))
+        uuid = cfg.get("MACHINEKIT", "MKUUID")
+        pattern = "%s/*.halgroup.%s" % (config.Config().rundir, uuid)
+
+        start = time.time()
+        haltalk = subprocess.Popen(["haltalk", "--workers", "2"])
+        path = None
+        while path is None and time.time() < start + 10.0:
+            time.sleep(0.1)
+            fresh = [p for p in glob.glob(pattern)
+                     if os.path.getmtime(p) >= int(start)]
+            if fresh:
+                path = fresh[0]
+        assert path is not None
+        uri = "ipc://" + path
+        time.sleep(0.5) # until the sockets are up
+
+    def test_full_and_incremental(self):
+        global ctx, handles
+        ctx = zmq.Context()
+        sock = subscribe(ctx, uri)
+
+        got = wait_for(sock, MT_HALGROUP_FULL_UPDATE, GROUPS)
+        handles = check_full(got, values)
+        assert len(handles) == 2 * len(GROUPS)
+
+        for g in GROUPS:
+            name = "%s.s0" % g
+            values[name] = 100 + GROUPS.index(g)
+            hal.Signal(name).set(values[name])
+        got = wait_for(sock, MT_HALGROUP_INCREMENTAL_UPDATE, GROUPS)
+        check_incremental(got, handles, values)
+        sock.close()
+
+    def test_resubscribe(self):
+        # the last unsubscribe stops the groups; subscribing again
+        # restarts them on their workers
+        time.sleep(0.5)
+        sock = subscribe(ctx, uri)
+
+        got = wait_for(sock, MT_HALGROUP_FULL_UPDATE, GROUPS)
+        assert check_full(got, values) == handles
+
+        for g in GROUPS:
+            name = "%s.s1" % g
+            values[name] = -1 - GROUPS.index(g)
+            hal.Signal(name).set(values[name])
+        got = wait_for(sock, MT_HALGROUP_INCREMENTAL_UPDATE, GROUPS)
+        check_incremental(got, handles, values)
+        sock.close()
+
+    def test_stop_haltalk(self):
+        ctx.term()
+        haltalk.send_signal(signal.SIGTERM)
+        assert haltalk.wait(timeout=10) == 0
@@ -57,3 +57,48 @@ class Tests(object):
             nr += 1
             r1.shift()
         assert nr > 0
+
+    def test_ring_wait(self):
+        # drain what is left
+        while r1.read() is not None:
+            r1.shift()
+
+        start = time.time()
+        assert r1.wait(100) == False
+        assert time.time() - start >= 0.09
+
+        # a write by the RT thread wakes the waiter
+        p = hal.Pin("ringwrite.write")
+        p.set(not p.get())
+        assert r1.wait(2000) == True
+        assert r1.read() is not None
+        r1.shift()
+        assert r1.wait_space(64, 0) == True
+
+    def test_mpmc_ring(self):
+        r = hal.Ring("mpmc1", size=5, recsize=16, type=hal.RINGTYPE_MPMC)
+        m = hal.MpmcRing(r)
+        assert m.slots == 8     # rounded up to a power of two
+        assert m.recsize == 16
+        with pytest.raises(IOError):
+            m.write(b"x" * 17)  # exceeds the record size
+
+        for n in range(8):
+            assert m.write("rec%d" % n)
+        assert m.write("full") == False
+        assert m.wait_space(16, 0) == False
+
+        assert m.read() == b"rec0"
+        assert m.write("rec8")
+        got = [m.read() for n in range(8)]
+        assert got == [b"rec%d" % n for n in range(1, 9)]
+        assert m.read() is None
+        assert m.wait(10) == False
+
+        m.write("a")
+        m.write("b")
+        assert m.flush() == 2
+
+        # plain record ring access is refused
+        with pytest.raises(RuntimeError):
+            hal.StreamRing(r)
@@ -0,0 +1,538 @@
+// capture: instantiable, triggered capture of HAL pins
+//
+// a headless counterpart of halscope: each instance captures its pins
+// into a pre/post-trigger buffer kept in the scratchpad of the ring
+// named HALCAPTURE_RING after the instance, and notifies readers
+// through the ring when a capture is complete. See capture.h for the
+// layout and protocol; halsampler -C is the client.
+//
+// usage:
+//   newinst capture cap0 cfg=f4b2 [depth=<samples>] [aggregate=1]
+//   addf cap0.sample servo-thread
+//   setp cap0.trigger-channel 0    # column, -1: trigger at once
+//   setp cap0.trigger-level 0.5    # float, s32, u32, s64, u64 columns
+//   setp cap0.pretrigger 100
+//   halsampler -C cap0 -n 10 -b captures.bin
+//
+// length, pretrigger, decimate and the trigger pins are latched when
+// the client arms a capture. A bit column triggers on its edge, other
+// columns when they cross trigger-level; trigger-rising selects the
+// edge. trigger-force triggers right away. The trigger is checked on
+// every invocation, also those which are decimated away.
+//
+// with decimate > 1, a plain instance records every decimate'th
+// sample. An instance with aggregate=1 records the min, max and mean
+// of every pin over each bucket of decimate samples instead, and the
+// first and last value of bits, so long captures still show spikes.
+
+#include "rtapi.h"
+#include "rtapi_app.h"
+#include "rtapi_atomics.h"
+#include "hal.h"
+#include "hal_priv.h"
+#include "hal_ring.h"
+#include "capture.h"
+
+MODULE_DESCRIPTION("triggered capture of HAL pins of any type");
+MODULE_LICENSE("GPL");
+RTAPI_TAG(HAL, HC_INSTANTIABLE);
+
+static int comp_id;
+static char *compname = "capture";
+
+static char *cfg = "";
+RTAPI_IP_STRING(cfg, "column types, e.g. f4b2, see streamer.h");
+
+static int depth = 16000;
+RTAPI_IP_INT(depth, "capture buffer size in samples");
+
+static int aggregate = 0;
+RTAPI_IP_INT(aggregate, "record min/max/mean per bucket of decimate samples");
+
+#define DONE_RECORDS 16   // completed captures the ring can hold
+
+// aggregation of one pin over a bucket
+typedef struct {
+    void *pin;                  // pin value, registered with HAL
+    hal_data_u min, max;        // bits: first, last
+    hal_float_t sum;
+    __u32 off[3];               // record offsets: min, max, mean
+                                // bits: first, last
+} cap_agg_t;
+
+// aggregates are grouped by type, 64-bit ones first, as in the lanes
+enum { AG_FLOAT, AG_S64, AG_U64, AG_S32, AG_U32, AG_BIT, AG_NTYPES };
+
+struct inst_data {
+    hal_u32_t *length;          // pin: samples per capture
+    hal_u32_t *pretrigger;      // pin: samples before the trigger
+    hal_u32_t *decimate;        // pin: sample every n'th invocation
+    hal_s32_t *trig_chan;       // pin: trigger column, -1 for none
+    hal_float_t *trig_level;    // pin
+    hal_bit_t *trig_rising;     // pin: trigger on the rising edge
+    hal_bit_t *trig_force;      // pin: trigger now
+    hal_s32_t *state;           // pin: capture_state_t
+    hal_u32_t *captures;        // pin: captures completed
+    ringbuffer_t rb;
+    hal_capture_t *cap;         // ring scratchpad
+
+    // latched when armed
+    __u32 clength, pretrig, decim, trig_type, rising;
+    void **trig_pin;            // NULL for none
+    hal_float_t level;
+
+    __u32 countdown;            // invocations until the next record
+    __u32 bucket;               // invocations aggregated so far
+    __u32 start;                // buffer index of the oldest record
+    __u32 samples;              // records in the buffer
+    __u32 trigger;              // record at which the trigger hit
+    __u32 trig_pending;         // trigger hit, not recorded yet
+    __u32 forced;
+    __u32 serial;
+    __u64 sample_num;
+    __u64 first_sample;         // of the current bucket
+    int cmp;                    // last trigger comparison
+    int num_pins;
+    __u32 n[HS_NLANES];         // plain: pins per lane
+    __u32 offset[HS_NLANES];
+    __u32 nagg[AG_NTYPES];      // aggregate: pins per type
+    void ***cell;               // per column: where HAL keeps the pin pointer
+    void **ptr;                 // plain: pin values, ordered by lane
+    cap_agg_t *agg;             // aggregate: ordered by type
+    __u64 storage[0];
+};
+
+static int agg_type(const hal_type_t type)
+{
+    switch (type) {
+    case HAL_FLOAT: return AG_FLOAT;
+    case HAL_S64:   return AG_S64;
+    case HAL_U64:   return AG_U64;
+    case HAL_S32:   return AG_S32;
+    case HAL_U32:   return AG_U32;
+    default:        return AG_BIT;
+    }
+}
+
+// is the trigger column above the trigger level
+static int compare(struct inst_data *ip)
+{
+    void *v = *ip->trig_pin;
+    hal_float_t f;
+
+    switch (ip->trig_type) {
+    case HAL_BIT:   return *(hal_bit_t *)v;
+    case HAL_FLOAT: f = *(hal_float_t *)v; break;
+    case HAL_S32:   f = *(hal_s32_t *)v; break;
+    case HAL_U32:   f = *(hal_u32_t *)v; break;
+    case HAL_S64:   f = *(hal_s64_t *)v; break;
+    case HAL_U64:   f = *(hal_u64_t *)v; break;
+    default:        return 0;
+    }
+    return f > ip->level;
+}
+
+static int triggered(struct inst_data *ip)
+{
+    int prev = ip->cmp;
+
+    if (*(ip->trig_force)) {
+	ip->forced = 1;
+	return 1;
+    }
+    if (ip->trig_pin == NULL)
+	return 1;
+    ip->cmp = compare(ip);
+    return ip->rising ? (ip->cmp && !prev) : (!ip->cmp && prev);
+}
+
+static void arm(struct inst_data *ip)
+{
+    hal_capture_t *cap = ip->cap;
+    int chan = *(ip->trig_chan);
+
+    ip->clength = *(ip->length);
+    if ((ip->clength == 0) || (ip->clength > cap->depth))
+	ip->clength = cap->depth;
+    ip->pretrig = *(ip->pretrigger);
+    if (ip->pretrig >= ip->clength)
+	ip->pretrig = ip->clength - 1;
+    ip->decim = *(ip->decimate) ? *(ip->decimate) : 1;
+    if ((chan >= 0) && (chan < ip->num_pins)) {
+	ip->trig_pin = ip->cell[chan];
+	ip->trig_type = halcapture_pin_type(cap, chan);
+    } else {
+	ip->trig_pin = NULL;
+    }
+    ip->level = *(ip->trig_level);
+    ip->rising = *(ip->trig_rising);
+    ip->start = ip->samples = ip->trigger = 0;
+    ip->trig_pending = ip->forced = 0;
+    ip->bucket = 0;
+    // a bucket covers 'decim' invocations, plain captures start at once
+    ip->countdown = cap->aggregate ? ip->decim - 1 : 0;
+    if (ip->trig_pin)
+	ip->cmp = compare(ip);
+}
+
+// one aggregation loop per type, no per-pin type switch
+#define AGG_UPDATE(type, ctype, field)					\
+    for (i = 0; i < ip->nagg[type]; i++, a++) {				\
+	ctype v = *(ctype *)a->pin;					\
+	if (first) {							\
+	    a->min.field = a->max.field = v;				\
+	    a->sum = v;							\
+	} else {							\
+	    if (v < a->min.field) a->min.field = v;			\
+	    if (v > a->max.field) a->max.field = v;			\
+	    a->sum += v;						\
+	}								\
+    }
+
+static void accumulate(struct inst_data *ip)
+{
+    cap_agg_t *a = ip->agg;
+    int first = (ip->bucket == 0);
+    __u32 i;
+
+    AGG_UPDATE(AG_FLOAT, hal_float_t, f)
+    AGG_UPDATE(AG_S64, hal_s64_t, ls)
+    AGG_UPDATE(AG_U64, hal_u64_t, lu)
+    AGG_UPDATE(AG_S32, hal_s32_t, s)
+    AGG_UPDATE(AG_U32, hal_u32_t, u)
+    for (i = 0; i < ip->nagg[AG_BIT]; i++, a++) {
+	hal_bit_t v = *(hal_bit_t *)a->pin;
+	if (first)
+	    a->min.b = v;
+	a->max.b = v;
+    }
+    if (first)
+	ip->first_sample = ip->sample_num;
+    ip->bucket++;
+}
+
+// write the aggregates of a bucket into a record. min and max keep
+// the type of the pin and are copied bitwise, one loop per width.
+static void emit(struct inst_data *ip, __u8 *rec)
+{
+    cap_agg_t *a = ip->agg;
+    __u32 i, n;
+    hal_data_u mean;
+
+    *(hs_w64_t *)rec = ip->first_sample;
+
+    n = ip->nagg[AG_FLOAT] + ip->nagg[AG_S64] + ip->nagg[AG_U64];
+    for (i = 0; i < n; i++, a++) {
+	mean.f = a->sum / ip->bucket;
+	*(hs_w64_t *)(rec + a->off[0]) = a->min.lu;
+	*(hs_w64_t *)(rec + a->off[1]) = a->max.lu;
+	*(hs_w64_t *)(rec + a->off[2]) = mean.lu;
+    }
+    n = ip->nagg[AG_S32] + ip->nagg[AG_U32];
+    for (i = 0; i < n; i++, a++) {
+	mean.f = a->sum / ip->bucket;
+	*(hs_w32_t *)(rec + a->off[0]) = a->min.u;
+	*(hs_w32_t *)(rec + a->off[1]) = a->max.u;
+	*(hs_w64_t *)(rec + a->off[2]) = mean.lu;
+    }
+    for (i = 0; i < ip->nagg[AG_BIT]; i++, a++) {
+	rec[a->off[0]] = a->min.b;
+	rec[a->off[1]] = a->max.b;
+    }
+    ip->bucket = 0;
+}
+
+static void done(struct inst_data *ip)
+{
+    hal_capture_done_t d = {
+	.serial = ip->serial++,
+	.start = ip->start,
+	.samples = ip->samples,
+	.length = ip->clength,
+	.trigger = ip->trigger,
+	.forced = ip->forced,
+    };
+    // samples before the state
+    rtapi_smp_wmb();
+    rtapi_store_u32(&ip->cap->state, CAPTURE_DONE);
+    // wakes a reader sleeping on the ring; if the ring is full, the
+    // reader still finds the state when it next looks
+    record_write(&ip->rb, &d, sizeof(d));
+    *(ip->captures) += 1;
+}
+
+static int sample(void *arg, const hal_funct_args_t *fa)
+{
+    struct inst_data *ip = arg;
+    hal_capture_t *cap = ip->cap;
+    __u32 state = rtapi_load_u32(&cap->state);
+    __u8 *rec;
+
+    if (state == CAPTURE_ARMED) {
+	arm(ip);
+	state = ip->pretrig ? CAPTURE_PRE_TRIG : CAPTURE_TRIG_WAIT;
+	rtapi_store_u32(&cap->state, state);
+    }
+    if ((state == CAPTURE_IDLE) || (state == CAPTURE_DONE)) {
+	*(ip->state) = state;
+	ip->sample_num++;
+	return 0;
+    }
+    // looked at on every invocation, and recorded with the next record
+    if ((state == CAPTURE_TRIG_WAIT) && !ip->trig_pending && triggered(ip))
+	ip->trig_pending = 1;
+
+    if (cap->aggregate)
+	accumulate(ip);
+    if (ip->countdown) {
+	ip->countdown--;
+	ip->sample_num++;
+	return 0;
+    }
+    ip->countdown = ip->decim - 1;
+
+    rec = halcapture_record(cap, (ip->start + ip->samples) % ip->clength);
+    if (cap->aggregate) {
+	emit(ip, rec);
+    } else {
+	*(hs_w64_t *)rec = ip->sample_num;
+	halstream_gather(rec, ip->ptr, ip->n, ip->offset);
+    }
+    ip->samples++;
+    ip->sample_num++;
+
+    switch (state) {
+    case CAPTURE_PRE_TRIG:
+	if (ip->samples >= ip->pretrig) {
+	    state = CAPTURE_TRIG_WAIT;
+	    if (ip->trig_pin)
+		ip->cmp = compare(ip);
+	}
+	break;
+    case CAPTURE_TRIG_WAIT:
+	if (ip->trig_pending) {
+	    ip->trigger = ip->samples - 1;
+	    state = CAPTURE_POST_TRIG;
+	} else if (ip->samples > ip->pretrig) {
+	    // discard the oldest pre-trigger record
+	    ip->start = (ip->start + 1) % ip->clength;
+	    ip->samples--;
+	}
+	break;
+    }
+    if ((state == CAPTURE_POST_TRIG) && (ip->samples >= ip->clength)) {
+	done(ip);
+	state = CAPTURE_DONE;
+    } else {
+	// does not overwrite a concurrent re-arm, which is only
+	// done from CAPTURE_IDLE or CAPTURE_DONE
+	rtapi_store_u32(&cap->state, state);
+    }
+    *(ip->state) = state;
+    return 0;
+}
+
+static int export_halobjs(struct inst_data *ip, const hal_type_t *type,
+			  int owner_id, const char *name)
+{
+    int i;
+
+    for (i = 0; i < ip->num_pins; i++) {
+	if (hal_pin_newf(type[i], HAL_IN, ip->cell[i],
+			 owner_id, "%s.pin.%d", name, i))
+	    return -1;
+    }
+    if (hal_pin_u32_newf(HAL_IN, &ip->length, owner_id, "%s.length", name) ||
+	hal_pin_u32_newf(HAL_IN, &ip->pretrigger, owner_id, "%s.pretrigger", name) ||
+	hal_pin_u32_newf(HAL_IN, &ip->decimate, owner_id, "%s.decimate", name) ||
+	hal_pin_s32_newf(HAL_IN, &ip->trig_chan, owner_id, "%s.trigger-channel", name) ||
+	hal_pin_float_newf(HAL_IN, &ip->trig_level, owner_id, "%s.trigger-level", name) ||
+	hal_pin_bit_newf(HAL_IN, &ip->trig_rising, owner_id, "%s.trigger-rising", name) ||
+	hal_pin_bit_newf(HAL_IN, &ip->trig_force, owner_id, "%s.trigger-force", name) ||
+	hal_pin_s32_newf(HAL_OUT, &ip->state, owner_id, "%s.state", name) ||
+	hal_pin_u32_newf(HAL_OUT, &ip->captures, owner_id, "%s.captures", name))
+	return -1;
+    *(ip->length) = depth;
+    *(ip->decimate) = 1;
+    *(ip->trig_chan) = -1;
+    *(ip->trig_rising) = 1;
+
+    hal_export_xfunct_args_t xfunct_args = {
+        .type = FS_XTHREADFUNC,
+        .funct.x = sample,
+        .arg = ip,
+        .uses_fp = 1,
+        .reentrant = 0,
+        .owner_id = owner_id
+    };
+    return hal_export_xfunctf(&xfunct_args, "%s.sample", name);
+}
+
+// the record columns of an aggregating instance: min, max and mean of
+// each pin, first and last of bits
+static int expand(const hal_type_t *type, const int num_pins,
+		  hal_type_t *rtype, __u16 *src, __u8 *agg)
+{
+    int i, n = 0;
+
+    for (i = 0; i < num_pins; i++) {
+	if (type[i] == HAL_BIT) {
+	    rtype[n] = HAL_BIT;  src[n] = i; agg[n++] = HS_AGG_FIRST;
+	    rtype[n] = HAL_BIT;  src[n] = i; agg[n++] = HS_AGG_LAST;
+	} else {
+	    rtype[n] = type[i];  src[n] = i; agg[n++] = HS_AGG_MIN;
+	    rtype[n] = type[i];  src[n] = i; agg[n++] = HS_AGG_MAX;
+	    rtype[n] = HAL_FLOAT; src[n] = i; agg[n++] = HS_AGG_MEAN;
+	}
+    }
+    return n;
+}
+
+// hook up the pin pointer cells: lane order for plain instances, type
+// order within the aggregates otherwise
+static void init_cells(struct inst_data *ip, const hal_type_t *type)
+{
+    hal_capture_t *cap = ip->cap;
+    hal_stream_desc_t *desc = &cap->desc;
+    __u32 k[AG_NTYPES];
+    int i, j, t;
+
+    if (!cap->aggregate) {
+	for (i = 0; i < ip->num_pins; i++)
+	    ip->cell[i] = &ip->ptr[halstream_slot(desc, i)];
+	return;
+    }
+    for (i = 0; i < ip->num_pins; i++)
+	ip->nagg[agg_type(type[i])]++;
+    for (t = 0, j = 0; t < AG_NTYPES; t++) {
+	k[t] = j;
+	j += ip->nagg[t];
+    }
+    for (i = 0; i < ip->num_pins; i++) {
+	cap_agg_t *a = &ip->agg[k[agg_type(type[i])]++];
+	ip->cell[i] = &a->pin;
+	for (j = 0; j < desc->num_pins; j++) {
+	    if (desc->col[j].src != i)
+		continue;
+	    switch (desc->col[j].agg) {
+	    case HS_AGG_MIN:
+	    case HS_AGG_FIRST: a->off[0] = desc->col[j].offset; break;
+	    case HS_AGG_MAX:
+	    case HS_AGG_LAST:  a->off[1] = desc->col[j].offset; break;
+	    case HS_AGG_MEAN:  a->off[2] = desc->col[j].offset; break;
+	    }
+	}
+    }
+}
+
+static int instantiate(const int argc, char* const *argv)
+{
+    const char *name = argv[1];
+    hal_type_t type[HALSTREAM_MAX_PINS];
+    hal_type_t rtype[3 * HALSTREAM_MAX_PINS];
+    __u16 src[3 * HALSTREAM_MAX_PINS];
+    __u8 agg[3 * HALSTREAM_MAX_PINS];
+    struct inst_data *ip;
+    hal_capture_t *cap;
+    int i, retval, inst_id, num_pins, num_cols, lane;
+    size_t record_size, sp_size, cells;
+
+    num_pins = halstream_parse_cfg(cfg, type, HALSTREAM_MAX_PINS);
+    if (num_pins <= 0) {
+	HALERR("%s: invalid cfg '%s'", name, cfg);
+	return -EINVAL;
+    }
+    if (depth < 1) {
+	HALERR("%s: invalid depth %d", name, depth);
+	return -EINVAL;
+    }
+    if (aggregate) {
+	num_cols = expand(type, num_pins, rtype, src, agg);
+	cells = num_pins * sizeof(cap_agg_t);
+    } else {
+	for (i = 0; i < num_pins; i++)
+	    rtype[i] = type[i];
+	num_cols = num_pins;
+	cells = num_pins * sizeof(void *);
+    }
+    inst_id = hal_inst_create(name, comp_id,
+			      sizeof(struct inst_data) +
+			      num_pins * sizeof(void **) + cells,
+			      (void **)&ip);
+    if (inst_id < 0)
+	return inst_id;
+    ip->cell = (void ***)ip->storage;
+    ip->ptr = (void **)(ip->cell + num_pins);
+    ip->agg = (cap_agg_t *)(ip->cell + num_pins);
+
+    record_size = halstream_record_size(rtype, num_cols);
+    sp_size = halcapture_sp_size(num_cols, depth, record_size);
+    if ((retval = hal_ring_newf(DONE_RECORDS *
+				record_usage(sizeof(hal_capture_done_t)),
+				sp_size, 0, HALCAPTURE_RING, name)) < 0)
+	return retval;
+    if ((retval = hal_ring_attachf(&ip->rb, NULL, HALCAPTURE_RING, name)) < 0)
+	goto unring;
+    ip->rb.header->writer = inst_id;
+    ip->rb.header->writer_instance = rtapi_instance;
+
+    cap = ip->cap = ip->rb.scratchpad;
+    halstream_layout(&cap->desc, rtype, num_cols);
+    if (aggregate) {
+	for (i = 0; i < num_cols; i++) {
+	    cap->desc.col[i].src = src[i];
+	    cap->desc.col[i].agg = agg[i];
+	}
+    }
+    cap->depth = depth;
+    cap->aggregate = aggregate;
+    cap->num_pins = num_pins;
+    cap->buf_offset = sp_size - depth * record_size;
+    cap->state = CAPTURE_IDLE;
+    cap->magic = HALCAPTURE_MAGIC;
+
+    ip->num_pins = num_pins;
+    for (lane = 0; lane < HS_NLANES; lane++) {
+	ip->n[lane] = cap->desc.lane_count[lane];
+	ip->offset[lane] = cap->desc.lane_offset[lane];
+    }
+    init_cells(ip, type);
+    if ((retval = export_halobjs(ip, type, inst_id, name)))
+	goto undetach;
+
+    HALDBG("%s: %d pins, %d columns, %zu bytes per record, depth %d",
+	   name, num_pins, num_cols, record_size, depth);
+    return 0;
+
+ undetach:
+    hal_ring_detach(&ip->rb);
+ unring:
+    hal_ring_deletef(HALCAPTURE_RING, name);
+    return retval;
+}
+
+static int delete(const char *name, void *inst, const int inst_size)
+{
+    struct inst_data *ip = inst;
+
+    if (ringbuffer_attached(&ip->rb)) {
+	ip->rb.header->writer = 0;
+	hal_ring_detach(&ip->rb);
+	hal_ring_deletef(HALCAPTURE_RING, name);
+    }
+    return 0;
+}
+
+int rtapi_app_main(void)
+{
+    comp_id = hal_xinit(TYPE_RT, 0, 0, instantiate, delete, compname);
+    if (comp_id < 0)
+	return comp_id;
+    hal_ready(comp_id);
+    return 0;
+}
+
+void rtapi_app_exit(void)
+{
+    hal_exit(comp_id);
+}
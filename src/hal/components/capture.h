@@ -0,0 +1,98 @@
+#ifndef HAL_CAPTURE_H
+#define HAL_CAPTURE_H
+/* capture: instantiable, triggered capture of HAL pins, a headless
+   counterpart of halscope.
+
+     newinst capture <name> cfg=<columns> [depth=<samples>] [aggregate=1]
+
+   cfg is as for samplerv2, see streamer.h. Each instance owns the ring
+   HALCAPTURE_RING. Its scratchpad is a hal_capture_t followed by the
+   capture buffer: 'depth' records in the layout given by desc, used
+   as a circular buffer holding the pre-trigger samples until the
+   trigger hits, then filled up with the post-trigger samples.
+
+   A plain instance has one record column per pin, and records every
+   decimate'th sample. An aggregating instance records a bucket of
+   decimate samples per record instead: for every pin its min, max
+   (same type as the pin) and mean (float) over the bucket, and the
+   first and last value for bits. desc.col[].src and .agg tell which
+   pin and aggregate a column holds. The sample number of a record is
+   that of the first sample in the bucket.
+
+   A capture runs like this:
+     - the client sets state to CAPTURE_ARMED
+     - the RT funct latches length, pretrigger and the trigger pins,
+       and fills in the pre-trigger samples
+     - once the trigger condition is met, it captures the rest of
+       'length' samples, sets state to CAPTURE_DONE and writes a
+       hal_capture_done_t record into the ring, which wakes readers
+       sleeping in ring_wait_read()
+     - the client copies the samples out, shifts the record and
+       re-arms.
+   Instances are independent, so any number of captures can be armed
+   at once. halsampler -C <name> is the client.
+*/
+
+#include "streamer.h"
+
+#define HALCAPTURE_RING		"%s.capture"
+#define HALCAPTURE_MAGIC	0x48434150	/* "HCAP" */
+
+typedef enum {
+    CAPTURE_IDLE = 0,		/* not armed */
+    CAPTURE_ARMED,		/* set by the client to start a capture */
+    CAPTURE_PRE_TRIG,		/* acquiring pre-trigger samples */
+    CAPTURE_TRIG_WAIT,		/* waiting for the trigger */
+    CAPTURE_POST_TRIG,		/* acquiring post-trigger samples */
+    CAPTURE_DONE		/* capture complete, waiting for the client */
+} capture_state_t;
+
+typedef struct {
+    __u32 magic;
+    __u32 state;		/* capture_state_t */
+    __u32 depth;		/* records in the capture buffer */
+    __u32 buf_offset;		/* of the capture buffer in the scratchpad */
+    __u32 num_pins;		/* cfg columns */
+    __u32 aggregate;		/* records hold aggregates of buckets */
+    hal_stream_desc_t desc;	/* must be last, followed by desc.col[] */
+} hal_capture_t;
+
+/* one record per completed capture */
+typedef struct {
+    __u32 serial;		/* number of the capture */
+    __u32 start;		/* buffer index of the first sample */
+    __u32 samples;		/* number of records captured */
+    __u32 length;		/* buffer indices wrap at this */
+    __u32 trigger;		/* record at which the trigger hit */
+    __u32 forced;		/* trigger was forced */
+} hal_capture_done_t;
+
+static inline size_t halcapture_sp_size(const int num_cols, const int depth,
+					const size_t record_size)
+{
+    size_t offset = sizeof(hal_capture_t) +
+	num_cols * sizeof(hal_stream_col_t);
+
+    offset = (offset + 7) & ~7;
+    return offset + depth * record_size;
+}
+
+/* type of a pin: that of its first column */
+static inline hal_type_t halcapture_pin_type(const hal_capture_t *cap,
+					     const int pin)
+{
+    int i;
+
+    for (i = 0; i < cap->desc.num_pins; i++)
+	if (cap->desc.col[i].src == pin)
+	    return cap->desc.col[i].type;
+    return HAL_TYPE_UNSPECIFIED;
+}
+
+/* the n'th record of the capture buffer */
+static inline __u8 *halcapture_record(hal_capture_t *cap, const int n)
+{
+    return (__u8 *)cap + cap->buf_offset + n * cap->desc.record_size;
+}
+
+#endif /* HAL_CAPTURE_H */
@@ -0,0 +1,328 @@
+// grouppub: RT change publication for a HAL group
+//
+// each instance watches the monitored members of a group and, in any
+// thread cycle where at least one changed, writes a
+// hal_group_changes_t record into the ring named after the group
+// (GROUP_CHANGES_RING). Readers like haltalk sleep on the ring's
+// scratchpad instead of periodically rescanning the group - see
+// hal_group.h for the record layout and wakeup protocol.
+//
+// usage:
+//   newinst grouppub gp0 group=<group> [ringsize=<bytes>] [wake=0]
+//   addf gp0.funct servo-thread
+//
+// wake=0 suppresses the futex wakeup from the RT thread, e.g. on
+// Xenomai where a Linux syscall would cause a mode switch. Readers
+// then pick up changes at their poll interval.
+
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "rtapi.h"
+#include "rtapi_app.h"
+#include "rtapi_atomics.h"
+#include "hal.h"
+#include "hal_priv.h"
+#include "hal_ring.h"
+#include "hal_group.h"
+
+MODULE_DESCRIPTION("RT change publication for HAL groups");
+MODULE_LICENSE("GPL");
+RTAPI_TAG(HAL, HC_INSTANTIABLE);
+
+static int comp_id;
+static char *compname = "grouppub";
+
+static char *group = "";
+RTAPI_IP_STRING(group, "name of the group to publish");
+
+static int ringsize = 0;
+RTAPI_IP_INT(ringsize, "size of the changes ring in bytes, 0: automatic");
+
+static int wake = 1;
+RTAPI_IP_INT(wake, "wake sleeping readers from the RT thread");
+
+#define MIN_RINGSIZE 16384
+
+typedef struct {
+    hal_data_u *value;     // signal value
+    hal_data_u tracking;   // value last published
+    __u32 index;           // member index within the group
+    __u32 type;
+    int eps_index;
+} gp_member_t;
+
+struct inst_data {
+    hal_u32_t *records;    // pin: records written
+    hal_u32_t *overruns;   // pin: cycles skipped for lack of ring space
+    ringbuffer_t rb;
+    hal_grouppub_t *gp;    // ring scratchpad
+    int wake;
+    int n_monitored;
+    int maxrec;            // size of a record with all members changed
+    char group[HAL_NAME_LEN + 1];
+    gp_member_t member[0];
+};
+
+static inline size_t record_size(const int n)
+{
+    return sizeof(hal_group_changes_t) + n * sizeof(hal_group_change_t);
+}
+
+static inline int monitored(const hal_group_t *grp, const hal_member_t *m)
+{
+    return (m->userarg1 & MEMBER_MONITOR_CHANGE) ||
+	(grp->userarg2 & GROUP_MONITOR_ALL_MEMBERS);
+}
+
+static void wake_readers(hal_grouppub_t *gp)
+{
+    syscall(SYS_futex, &gp->wakeup, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+
+static int publish(void *arg, const hal_funct_args_t *fa)
+{
+    struct inst_data *ip = arg;
+    hal_grouppub_t *gp = ip->gp;
+    hal_group_changes_t *rec;
+    int i, n = 0;
+
+    if (!rtapi_load_u32(&gp->active))
+	return 0;
+
+    // reserve a worst-case record; an unused reservation is just dropped
+    if (record_write_begin(&ip->rb, (void **)&rec, ip->maxrec)) {
+	// tracking values are left alone, so the changes are picked
+	// up once the reader has made room
+	gp->overruns++;
+	*(ip->overruns) += 1;
+	return 0;
+    }
+
+    for (i = 0; i < ip->n_monitored; i++) {
+	gp_member_t *m = &ip->member[i];
+	hal_float_t f;
+
+	switch (m->type) {
+	case HAL_BIT:
+	    if (get_bit_value(m->value) == get_bit_value(&m->tracking))
+		continue;
+	    set_bit_value(&m->tracking, get_bit_value(m->value));
+	    break;
+	case HAL_FLOAT:
+	    f = get_float_value(m->value);
+	    if (HAL_FABS(f - get_float_value(&m->tracking)) <=
+		hal_data->epsilon[m->eps_index])
+		continue;
+	    set_float_value(&m->tracking, f);
+	    break;
+	case HAL_S32:
+	    if (get_s32_value(m->value) == get_s32_value(&m->tracking))
+		continue;
+	    set_s32_value(&m->tracking, get_s32_value(m->value));
+	    break;
+	case HAL_U32:
+	    if (get_u32_value(m->value) == get_u32_value(&m->tracking))
+		continue;
+	    set_u32_value(&m->tracking, get_u32_value(m->value));
+	    break;
+	case HAL_S64:
+	    if (get_s64_value(m->value) == get_s64_value(&m->tracking))
+		continue;
+	    set_s64_value(&m->tracking, get_s64_value(m->value));
+	    break;
+	case HAL_U64:
+	    if (get_u64_value(m->value) == get_u64_value(&m->tracking))
+		continue;
+	    set_u64_value(&m->tracking, get_u64_value(m->value));
+	    break;
+	default:
+	    continue;
+	}
+	rec->change[n].index = m->index;
+	rec->change[n].type = m->type;
+	rec->change[n].value = m->tracking;
+	n++;
+    }
+    if (n == 0)
+	return 0;
+
+    rec->serial = gp->serial++;
+    rec->count = n;
+    record_write_end(&ip->rb, rec, record_size(n));
+    *(ip->records) += 1;
+
+    // pairs with the reader announcing itself in 'waiters'
+    // before rechecking 'wakeup'
+    rtapi_add_u32(&gp->wakeup, 1);
+    rtapi_smp_mb();
+    if (ip->wake && rtapi_load_u32(&gp->waiters))
+	wake_readers(gp);
+    return 0;
+}
+
+static int count_member(hal_object_ptr o, foreach_args_t *args)
+{
+    hal_group_t *grp = args->user_ptr1;
+
+    args->user_arg1++;
+    if (monitored(grp, o.member))
+	args->user_arg2++;
+    return 0;
+}
+
+static int init_member(hal_object_ptr o, foreach_args_t *args)
+{
+    hal_group_t *grp = args->user_ptr1;
+    struct inst_data *ip = args->user_ptr2;
+    hal_member_t *mbr = o.member;
+    int index = args->user_arg1++;
+
+    if (!monitored(grp, mbr))
+	return 0;
+
+    hal_sig_t *sig = SHMPTR(mbr->sig_ptr);
+    gp_member_t *m = &ip->member[ip->n_monitored++];
+    m->value = sig_value(sig);
+    m->tracking = *m->value;
+    m->index = index;
+    m->type = sig_type(sig);
+    m->eps_index = mbr->eps_index;
+    return 0;
+}
+
+static int export_halobjs(struct inst_data *ip, int owner_id, const char *name)
+{
+    if (hal_pin_u32_newf(HAL_OUT, &ip->records, owner_id, "%s.records", name))
+	return -1;
+    if (hal_pin_u32_newf(HAL_OUT, &ip->overruns, owner_id, "%s.overruns", name))
+	return -1;
+
+    hal_export_xfunct_args_t xfunct_args = {
+        .type = FS_XTHREADFUNC,
+        .funct.x = publish,
+        .arg = ip,
+        .uses_fp = 1,
+        .reentrant = 0,
+        .owner_id = owner_id
+    };
+    return hal_export_xfunctf(&xfunct_args, "%s.funct", name);
+}
+
+static int instantiate(const int argc, char* const *argv)
+{
+    const char *name = argv[1];
+    struct inst_data *ip = NULL;
+    int retval, inst_id = -1;
+
+    if ((group == NULL) || (*group == '\0')) {
+	HALERR("%s: missing group=<name>", name);
+	return -EINVAL;
+    }
+    if (strlen(group) + strlen(GROUP_CHANGES_RING) > HAL_NAME_LEN) {
+	HALERR("%s: group name '%s' too long", name, group);
+	return -EINVAL;
+    }
+    // the group must not change while published
+    if ((retval = hal_ref_group(group)) < 0)
+	return retval;
+
+    hal_group_t *grp = halg_find_object_by_name(1, HAL_GROUP, group).group;
+    foreach_args_t args =  {
+	.type = HAL_MEMBER,
+	.owner_id = ho_id(grp),
+	.user_ptr1 = grp,
+    };
+    halg_foreach(1, &args, count_member);
+    int n_members = args.user_arg1;
+    int n_monitored = args.user_arg2;
+
+    if (n_monitored == 0) {
+	HALERR("%s: group '%s' has no members to monitor", name, group);
+	retval = -EINVAL;
+	goto unref;
+    }
+
+    inst_id = hal_inst_create(name, comp_id,
+			      sizeof(struct inst_data) +
+			      n_monitored * sizeof(gp_member_t),
+			      (void **)&ip);
+    if (inst_id < 0) {
+	retval = inst_id;
+	goto unref;
+    }
+
+    rtapi_strxcpy(ip->group, group);
+    ip->wake = wake;
+    ip->maxrec = record_size(n_monitored);
+
+    int size = ringsize;
+    if (size < 4 * ip->maxrec)
+	size = 4 * ip->maxrec;
+    if (size < MIN_RINGSIZE)
+	size = MIN_RINGSIZE;
+
+    if ((retval = hal_ring_newf(size, sizeof(hal_grouppub_t), 0,
+				GROUP_CHANGES_RING, group)) < 0)
+	goto unref;
+    if ((retval = hal_ring_attachf(&ip->rb, NULL, GROUP_CHANGES_RING, group)) < 0)
+	goto unring;
+    ip->rb.header->writer = inst_id;
+    ip->rb.header->writer_instance = rtapi_instance;
+
+    ip->gp = ip->rb.scratchpad;
+    memset(ip->gp, 0, sizeof(hal_grouppub_t));
+    ip->gp->n_members = n_members;
+    ip->gp->n_monitored = n_monitored;
+
+    args.user_arg1 = 0;
+    args.user_ptr2 = ip;
+    halg_foreach(1, &args, init_member);
+
+    if ((retval = export_halobjs(ip, inst_id, name)))
+	goto undetach;
+
+    HALDBG("%s: publishing %d of %d members of group '%s', ring size %d",
+	   name, n_monitored, n_members, group, size);
+    return 0;
+
+ undetach:
+    hal_ring_detach(&ip->rb);
+ unring:
+    hal_ring_deletef(GROUP_CHANGES_RING, group);
+ unref:
+    hal_unref_group(group);
+    if (inst_id >= 0)
+	ip->group[0] = '\0'; // nothing left for delete()
+    return retval;
+}
+
+static int delete(const char *name, void *inst, const int inst_size)
+{
+    struct inst_data *ip = inst;
+
+    if (ringbuffer_attached(&ip->rb)) {
+	ip->rb.header->writer = 0;
+	hal_ring_detach(&ip->rb);
+	hal_ring_deletef(GROUP_CHANGES_RING, ip->group);
+    }
+    if (ip->group[0])
+	hal_unref_group(ip->group);
+    return 0;
+}
+
+int rtapi_app_main(void)
+{
+    comp_id = hal_xinit(TYPE_RT, 0, 0, instantiate, delete, compname);
+    if (comp_id < 0)
+	return comp_id;
+    hal_ready(comp_id);
+    return 0;
+}
+
+void rtapi_app_exit(void)
+{
+    hal_exit(comp_id);
+}
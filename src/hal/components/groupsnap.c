@@ -0,0 +1,221 @@
+// groupsnap: consistent RT snapshots of a HAL group
+//
+// each instance copies the values of all members of a group, every
+// n-th cycle of the thread it is added to, into a triple buffer in the
+// scratchpad of the ring named after the group (GROUP_SNAPSHOT_RING).
+// Readers like haltalk take whole snapshots from there instead of
+// reading the signals while RT threads write them - see hal_group.h
+// for the layout.
+//
+// usage:
+//   newinst groupsnap gs0 group=<group> [every=<n>]
+//   addf gs0.funct servo-thread
+//
+// add the funct after the functs computing the group's signals, so a
+// snapshot holds the values of one and the same cycle.
+
+#include "rtapi.h"
+#include "rtapi_app.h"
+#include "rtapi_atomics.h"
+#include "hal.h"
+#include "hal_priv.h"
+#include "hal_ring.h"
+#include "hal_group.h"
+
+MODULE_DESCRIPTION("RT snapshots of HAL groups");
+MODULE_LICENSE("GPL");
+RTAPI_TAG(HAL, HC_INSTANTIABLE);
+
+static int comp_id;
+static char *compname = "groupsnap";
+
+static char *group = "";
+RTAPI_IP_STRING(group, "name of the group to snapshot");
+
+static int every = 1;
+RTAPI_IP_INT(every, "take a snapshot every n-th cycle");
+
+struct inst_data {
+    hal_u32_t *snapshots;  // pin: snapshots taken
+    ringbuffer_t rb;
+    hal_groupsnap_t *gs;   // ring scratchpad
+    int every;
+    int count;             // cycles until the next snapshot
+    int n_members;
+    char group[HAL_NAME_LEN + 1];
+    hal_data_u *value[0];  // member signal values
+};
+
+static int snapshot(void *arg, const hal_funct_args_t *fa)
+{
+    struct inst_data *ip = arg;
+    hal_groupsnap_t *gs = ip->gs;
+    hal_group_snapshot_t *s;
+    int i;
+
+    if (!rtapi_load_u32(&gs->active))
+	return 0;
+    if (--ip->count > 0)
+	return 0;
+    ip->count = ip->every;
+
+    s = hal_groupsnap_buffer(gs, rtapi_tb_write_idx(&gs->tb));
+    for (i = 0; i < ip->n_members; i++)
+	s->value[i] = *ip->value[i];
+    s->serial = *(ip->snapshots);
+    s->timestamp = fa_thread_start_time(fa);
+
+    // the buffer must be complete before the reader can see it
+    rtapi_smp_wmb();
+    rtapi_tb_flip(&gs->tb);
+    *(ip->snapshots) += 1;
+    return 0;
+}
+
+static int count_member(hal_object_ptr o, foreach_args_t *args)
+{
+    args->user_arg1++;
+    return 0;
+}
+
+static int init_member(hal_object_ptr o, foreach_args_t *args)
+{
+    struct inst_data *ip = args->user_ptr1;
+    hal_sig_t *sig = SHMPTR(o.member->sig_ptr);
+
+    ip->value[args->user_arg1++] = sig_value(sig);
+    return 0;
+}
+
+static int export_halobjs(struct inst_data *ip, int owner_id, const char *name)
+{
+    if (hal_pin_u32_newf(HAL_OUT, &ip->snapshots, owner_id, "%s.snapshots", name))
+	return -1;
+
+    hal_export_xfunct_args_t xfunct_args = {
+        .type = FS_XTHREADFUNC,
+        .funct.x = snapshot,
+        .arg = ip,
+        .uses_fp = 0,
+        .reentrant = 0,
+        .owner_id = owner_id
+    };
+    return hal_export_xfunctf(&xfunct_args, "%s.funct", name);
+}
+
+static int instantiate(const int argc, char* const *argv)
+{
+    const char *name = argv[1];
+    struct inst_data *ip = NULL;
+    int retval, inst_id = -1;
+
+    if ((group == NULL) || (*group == '\0')) {
+	HALERR("%s: missing group=<name>", name);
+	return -EINVAL;
+    }
+    if (strlen(group) + strlen(GROUP_SNAPSHOT_RING) > HAL_NAME_LEN) {
+	HALERR("%s: group name '%s' too long", name, group);
+	return -EINVAL;
+    }
+    if (every < 1) {
+	HALERR("%s: every=%d: must be at least 1", name, every);
+	return -EINVAL;
+    }
+    // the group must not change while snapshots are taken
+    if ((retval = hal_ref_group(group)) < 0)
+	return retval;
+
+    hal_group_t *grp = halg_find_object_by_name(1, HAL_GROUP, group).group;
+    foreach_args_t args =  {
+	.type = HAL_MEMBER,
+	.owner_id = ho_id(grp),
+    };
+    halg_foreach(1, &args, count_member);
+    int n_members = args.user_arg1;
+
+    if (n_members == 0) {
+	HALERR("%s: group '%s' has no members", name, group);
+	retval = -EINVAL;
+	goto unref;
+    }
+
+    inst_id = hal_inst_create(name, comp_id,
+			      sizeof(struct inst_data) +
+			      n_members * sizeof(hal_data_u *),
+			      (void **)&ip);
+    if (inst_id < 0) {
+	retval = inst_id;
+	goto unref;
+    }
+
+    rtapi_strxcpy(ip->group, group);
+    ip->every = every;
+    ip->count = 1;  // the first cycle after activation takes one
+    ip->n_members = n_members;
+
+    // the ring only serves as a named container for the scratchpad
+    int bufsize = hal_group_snapshot_size(n_members);
+    if ((retval = hal_ring_newf(0, sizeof(hal_groupsnap_t) + 3 * bufsize, 0,
+				GROUP_SNAPSHOT_RING, group)) < 0)
+	goto unref;
+    if ((retval = hal_ring_attachf(&ip->rb, NULL, GROUP_SNAPSHOT_RING, group)) < 0)
+	goto unring;
+    ip->rb.header->writer = inst_id;
+    ip->rb.header->writer_instance = rtapi_instance;
+
+    ip->gs = ip->rb.scratchpad;
+    memset(ip->gs, 0, sizeof(hal_groupsnap_t) + 3 * bufsize);
+    ip->gs->n_members = n_members;
+    ip->gs->every = every;
+    ip->gs->bufsize = bufsize;
+    rtapi_tb_init(&ip->gs->tb);
+
+    args.user_arg1 = 0;
+    args.user_ptr1 = ip;
+    halg_foreach(1, &args, init_member);
+
+    if ((retval = export_halobjs(ip, inst_id, name)))
+	goto undetach;
+
+    HALDBG("%s: snapshots of %d members of group '%s' every %d cycles",
+	   name, n_members, group, every);
+    return 0;
+
+ undetach:
+    hal_ring_detach(&ip->rb);
+ unring:
+    hal_ring_deletef(GROUP_SNAPSHOT_RING, group);
+ unref:
+    hal_unref_group(group);
+    if (inst_id >= 0)
+	ip->group[0] = '\0'; // nothing left for delete()
+    return retval;
+}
+
+static int delete(const char *name, void *inst, const int inst_size)
+{
+    struct inst_data *ip = inst;
+
+    if (ringbuffer_attached(&ip->rb)) {
+	ip->rb.header->writer = 0;
+	hal_ring_detach(&ip->rb);
+	hal_ring_deletef(GROUP_SNAPSHOT_RING, ip->group);
+    }
+    if (ip->group[0])
+	hal_unref_group(ip->group);
+    return 0;
+}
+
+int rtapi_app_main(void)
+{
+    comp_id = hal_xinit(TYPE_RT, 0, 0, instantiate, delete, compname);
+    if (comp_id < 0)
+	return comp_id;
+    hal_ready(comp_id);
+    return 0;
+}
+
+void rtapi_app_exit(void)
+{
+    hal_exit(comp_id);
+}
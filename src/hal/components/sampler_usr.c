@@ -20,11 +20,25 @@
 
     Invoking:
 
-    halsampler [-c chan_num] [-n num_samples] [-t]
+    halsampler [-c chan_num | -r instance | -C instance] [-n num_samples]
+               [-t] [-b] [-B bytes] [file]
 
     'chan_num', if present, specifies the sampler channel to use.
     The default is channel zero.
 
+    '-r instance' reads from a samplerv2 instance instead, which may
+    have any number of columns of all HAL types, see streamer.h.
+    Columns are printed in cfg order.
+
+    '-C instance' is the client of a capture instance, see capture.h.
+    Columns are printed in record order, which for an aggregating
+    instance is min, max and mean of each pin, first and last of bits.
+    It arms a capture, waits for it to complete, writes it out and
+    re-arms; '-n' then counts captures. In text mode, a 'trigger' line
+    precedes the sample at which the trigger hit, and an empty line
+    ends each capture. In binary mode each capture is a complete
+    sample file, with the trigger row in the header's channel field.
+
     'num_samples', if present, specifies the number of samples
     to be printed, after which the program will exit.  If ommitted
     it will print continuously until killed.
@@ -32,6 +46,16 @@
     '-t' tells sampler to print the sample number at the start
     of each line.
 
+    '-b' writes a binary file instead of text, see streamer.h for the
+    format. Rows always carry the sample number, and overruns are
+    reported on stderr instead of in the data.
+
+    '-B bytes' sets the size of the output buffer, default 64k.
+
+    Each time it wakes up, halsampler copies all samples in the fifo
+    at once, so the fifo depth only needs to cover the 10 mS it sleeps
+    when the fifo is empty, plus any disk latency.
+
 */
 
 /** This program is free software; you can redistribute it and/or
@@ -62,6 +86,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <errno.h>
 #include <string.h>
 #include <unistd.h>
 #include <signal.h>
@@ -69,10 +94,15 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <endian.h>
 
 #include "rtapi.h"		/* RTAPI realtime OS API */
+#include "rtapi_atomics.h"
 #include "hal.h"                /* HAL public API decls */
+#include "hal_priv.h"		/* signal_of() */
+#include "hal_ring.h"
 #include "streamer.h"
+#include "capture.h"
 
 /***********************************************************************
 *                  LOCAL FUNCTION DECLARATIONS                         *
@@ -87,6 +117,12 @@ int shmem_id = -1;
 int exitval = 1;	/* program return code - 1 means error */
 int ignore_sig = 0;	/* used to flag critical regions */
 char comp_name[HAL_NAME_LEN+1];	/* name for this instance of sampler */
+ringbuffer_t rb;		/* samplerv2 or capture ring, -r and -C modes */
+
+/* binary output buffer, flushed when full or the fifo runs empty */
+static char *obuf;
+static size_t obuf_size = 65536;
+static volatile size_t obuf_len;	/* complete rows only */
 
 /***********************************************************************
 *                            MAIN PROGRAM                              *
@@ -98,38 +134,526 @@ static void quit(int sig)
     if ( ignore_sig ) {
 	return;
     }
+    /* don't lose buffered binary rows */
+    if ( obuf_len ) {
+	if ( write(1, obuf, obuf_len) ) {}
+    }
     if ( shmem_id >= 0 ) {
 	rtapi_shmem_delete(shmem_id, comp_id);
     }
+    if ( ringbuffer_attached(&rb) ) {
+	hal_ring_detach(&rb);
+    }
     if ( comp_id >= 0 ) {
 	hal_exit(comp_id);
     }
     exit(exitval);
 }
 
-#define BUF_SIZE 4000
+static int write_all(const char *p, size_t len)
+{
+    ssize_t n;
+
+    while ( len > 0 ) {
+	n = write(1, p, len);
+	if ( n < 0 ) {
+	    fprintf(stderr, "ERROR: write failed: %s\n", strerror(errno));
+	    return -1;
+	}
+	p += n;
+	len -= n;
+    }
+    return 0;
+}
+
+static int flush_binary(void)
+{
+    size_t len = obuf_len;
+
+    /* quit() must not write these rows again */
+    obuf_len = 0;
+    return write_all(obuf, len);
+}
+
+/* copy all samples currently in the fifo to 'rows', updating 'out'.
+   Returns the number of samples copied.
+   When the fifo is full, the RT side moves 'out' past the oldest
+   sample before overwriting it, so samples which 'out' moved past
+   while they were being copied are dropped. */
+static int drain_fifo(fifo_t *fifo, shmem_data_t *rows)
+{
+    int rowlen = fifo->num_pins + 1;
+    size_t rowsize = rowlen * sizeof(shmem_data_t);
+    int in, out, newout, n, first, skip;
+
+    out = fifo->out;
+    in = fifo->in;
+    n = in - out;
+    if ( n < 0 ) {
+	n += fifo->depth;
+    }
+    if ( n == 0 ) {
+	return 0;
+    }
+    rtapi_smp_rmb();
+    first = fifo->depth - out;
+    if ( first > n ) {
+	first = n;
+    }
+    memcpy(rows, &fifo->data[out * rowlen], first * rowsize);
+    memcpy(rows + first * rowlen, fifo->data, (n - first) * rowsize);
+    rtapi_smp_rmb();
+    newout = fifo->out;
+    skip = newout - out;
+    if ( skip < 0 ) {
+	skip += fifo->depth;
+    }
+    if ( skip >= n ) {
+	/* all of it was overwritten, try again */
+	return 0;
+    }
+    if ( skip ) {
+	memmove(rows, rows + skip * rowlen, (n - skip) * rowsize);
+	n -= skip;
+    }
+    fifo->out = in;
+    return n;
+}
+
+/* the name of a column: the signal linked to the sampler pin,
+   or the pin name itself. Columns of an aggregating capture get the
+   aggregate appended, as in 'sig.max' */
+static void column_name(const char *prefix, int n, const hal_stream_col_t *col,
+			char *buf, size_t size)
+{
+    static const char *agg[] = {
+	[HS_AGG_MIN] = ".min", [HS_AGG_MAX] = ".max", [HS_AGG_MEAN] = ".mean",
+	[HS_AGG_FIRST] = ".first", [HS_AGG_LAST] = ".last",
+    };
+    hal_pin_t *pin;
+    hal_sig_t *sig;
+    size_t len;
+
+    snprintf(buf, size, "%s.pin.%d", prefix, col ? col->src : n);
+    {
+	WITH_HAL_MUTEX();
+	pin = halpr_find_pin_by_name(buf);
+	if ( pin && (sig = signal_of(pin)) ) {
+	    snprintf(buf, size, "%s", ho_name(sig));
+	}
+    }
+    if ( col && (col->agg != HS_AGG_NONE) ) {
+	len = strlen(buf);
+	snprintf(buf + len, size - len, "%s", agg[col->agg]);
+    }
+}
+
+/* 'prefix' names the sampler pins: "sampler.<channel>" or the
+   samplerv2 or capture instance. 'channel' is -1 for a samplerv2
+   instance. 'cols' describes the columns of an aggregating capture,
+   NULL if each column is a pin */
+static int write_header(const char *prefix, int channel, int num_pins,
+			const hal_type_t *types, const hal_stream_col_t *cols,
+			size_t row_size)
+{
+    halsample_header_t hdr;
+    char *names;
+    __u32 *type;
+    size_t names_size = 0;
+    int n, retval = -1;
+
+    names = malloc(num_pins * (HAL_NAME_LEN + 8));
+    type = malloc(num_pins * sizeof(__u32));
+    if ( (names == NULL) || (type == NULL) ) {
+	fprintf(stderr, "ERROR: out of memory\n");
+	goto out;
+    }
+    for ( n = 0 ; n < num_pins ; n++ ) {
+	type[n] = htole32(types[n]);
+	column_name(prefix, n, cols ? &cols[n] : NULL,
+		    names + names_size, HAL_NAME_LEN + 8);
+	names_size += strlen(names + names_size) + 1;
+    }
+    memset(&hdr, 0, sizeof(hdr));
+    strncpy(hdr.magic, HALSAMPLE_MAGIC, sizeof(hdr.magic));
+    hdr.version = htole32(HALSAMPLE_VERSION);
+    hdr.header_size = htole32(sizeof(hdr) + num_pins * sizeof(__u32) +
+			      names_size);
+    hdr.num_pins = htole32(num_pins);
+    hdr.row_size = htole32(row_size);
+    hdr.names_size = htole32(names_size);
+    hdr.channel = htole32(channel);
+    if ( write_all((char *)&hdr, sizeof(hdr)) ||
+	 write_all((char *)type, num_pins * sizeof(__u32)) ||
+	 write_all(names, names_size) ) {
+	goto out;
+    }
+    retval = 0;
+out:
+    free(names);
+    free(type);
+    return retval;
+}
+
+/* encode one value of the given type at 'p', returns the end of it.
+   'v' need not be aligned */
+static char *encode_value(char *p, hal_type_t type, const void *v)
+{
+    __u32 u32;
+    __u64 u64;
+
+    switch ( type ) {
+    case HAL_BIT:
+	*p++ = *(const __u8 *)v ? 1 : 0;
+	break;
+    case HAL_S32:
+    case HAL_U32:
+	memcpy(&u32, v, sizeof(u32));
+	u32 = htole32(u32);
+	memcpy(p, &u32, sizeof(u32));
+	p += sizeof(u32);
+	break;
+    default: /* HAL_FLOAT, HAL_S64, HAL_U64 */
+	memcpy(&u64, v, sizeof(u64));
+	u64 = htole64(u64);
+	memcpy(p, &u64, sizeof(u64));
+	p += sizeof(u64);
+	break;
+    }
+    return p;
+}
+
+static int print_value(hal_type_t type, const void *v)
+{
+    __u32 u32;
+    __u64 u64;
+    double d;
+
+    switch ( type ) {
+    case HAL_FLOAT:
+	memcpy(&d, v, sizeof(d));
+	printf ( "%f ", d);
+	break;
+    case HAL_BIT:
+	if ( *(const __u8 *)v ) {
+	    printf ( "1 " );
+	} else {
+	    printf ( "0 " );
+	}
+	break;
+    case HAL_U32:
+	memcpy(&u32, v, sizeof(u32));
+	printf ( "%lu ", (unsigned long)u32);
+	break;
+    case HAL_S32:
+	memcpy(&u32, v, sizeof(u32));
+	printf ( "%ld ", (long)(__s32)u32);
+	break;
+    case HAL_U64:
+	memcpy(&u64, v, sizeof(u64));
+	printf ( "%llu ", (unsigned long long)u64);
+	break;
+    case HAL_S64:
+	memcpy(&u64, v, sizeof(u64));
+	printf ( "%lld ", (long long)(__s64)u64);
+	break;
+    default:
+	/* better not happen */
+	return -1;
+    }
+    return 0;
+}
+
+/* encode one sample at 'p', returns the end of the row */
+static char *encode_row(char *p, fifo_t *fifo, const shmem_data_t *row)
+{
+    int n;
+
+    p = encode_value(p, HAL_U32, &row[fifo->num_pins].u);
+    for ( n = 0 ; n < fifo->num_pins ; n++ ) {
+	p = encode_value(p, fifo->type[n], &row[n]);
+    }
+    return p;
+}
+
+static int print_row(fifo_t *fifo, const shmem_data_t *row, int tag)
+{
+    int n;
+
+    if ( tag ) {
+	printf ( "%lu ", (unsigned long)row[fifo->num_pins].u );
+    }
+    for ( n = 0 ; n < fifo->num_pins ; n++ ) {
+	if ( print_value(fifo->type[n], &row[n]) ) {
+	    return -1;
+	}
+    }
+    printf ( "\n" );
+    return 0;
+}
+
+#define RING_BATCH 256
+
+/* -r mode: read samples from a samplerv2 instance's ring */
+static int sample_ring(const char *inst, long int samples, int tag, int binary)
+{
+    hal_stream_desc_t *desc;
+    hal_type_t *type;
+    ringvec_t rv[RING_BATCH];
+    size_t row_size;
+    __u64 this_sample, next_sample = 0;
+    __u32 u32;
+    int i, n, col, first = 1, retval = -1;
+
+    if ( hal_ring_attachf(&rb, NULL, HALSTREAM_RING, inst) < 0 ) {
+	fprintf(stderr, "ERROR: no samplerv2 instance '%s'\n", inst );
+	return -1;
+    }
+    desc = rb.scratchpad;
+    if ( (ring_scratchpad_size(&rb) < sizeof(*desc)) ||
+	 (desc->magic != HALSTREAM_MAGIC) ) {
+	fprintf(stderr, "ERROR: '%s' is not a samplerv2 instance\n", inst );
+	return -1;
+    }
+    type = malloc(desc->num_pins * sizeof(hal_type_t));
+    if ( type == NULL ) {
+	fprintf(stderr, "ERROR: out of memory\n");
+	return -1;
+    }
+    row_size = sizeof(__u32);
+    for ( col = 0 ; col < desc->num_pins ; col++ ) {
+	type[col] = desc->col[col].type;
+	row_size += halsample_width(type[col]);
+    }
+    if ( binary ) {
+	if ( obuf_size < row_size ) {
+	    obuf_size = row_size;
+	}
+	obuf = malloc(obuf_size);
+	if ( obuf == NULL ) {
+	    fprintf(stderr, "ERROR: out of memory\n");
+	    goto out;
+	}
+	if ( write_header(inst, -1, desc->num_pins, type, NULL, row_size) ) {
+	    goto out;
+	}
+    } else {
+	setvbuf(stdout, NULL, _IOFBF, obuf_size);
+    }
+    while ( samples != 0 ) {
+	n = record_read_batch(&rb, rv, RING_BATCH);
+	if ( n == 0 ) {
+	    /* ring empty, push out what we have and wait for more */
+	    if ( binary ) {
+		if ( flush_binary() ) {
+		    goto out;
+		}
+	    } else {
+		fflush(stdout);
+	    }
+	    ring_wait_read(&rb, 100);
+	    continue;
+	}
+	if ( (samples > 0) && (n > samples) ) {
+	    n = samples;
+	}
+	for ( i = 0 ; i < n ; i++ ) {
+	    const char *rec = rv[i].rv_base;
+
+	    memcpy(&this_sample, rec, sizeof(this_sample));
+	    if ( !first && (this_sample != next_sample) ) {
+		if ( binary ) {
+		    fprintf(stderr, "overrun: %llu samples lost\n",
+			    (unsigned long long)(this_sample - next_sample));
+		} else {
+		    printf ( "overrun\n" );
+		}
+	    }
+	    first = 0;
+	    next_sample = this_sample + 1;
+	    if ( binary ) {
+		char *p;
+		if ( obuf_len + row_size > obuf_size ) {
+		    if ( flush_binary() ) {
+			goto out;
+		    }
+		}
+		u32 = this_sample;
+		p = encode_value(obuf + obuf_len, HAL_U32, &u32);
+		for ( col = 0 ; col < desc->num_pins ; col++ ) {
+		    p = encode_value(p, type[col], rec + desc->col[col].offset);
+		}
+		obuf_len = p - obuf;
+	    } else {
+		if ( tag ) {
+		    printf ( "%llu ", (unsigned long long)this_sample );
+		}
+		for ( col = 0 ; col < desc->num_pins ; col++ ) {
+		    print_value(type[col], rec + desc->col[col].offset);
+		}
+		printf ( "\n" );
+	    }
+	}
+	record_shift_batch(&rb, n);
+	if ( samples > 0 ) {
+	    samples -= n;
+	}
+    }
+    if ( binary && flush_binary() ) {
+	goto out;
+    }
+    retval = 0;
+out:
+    free(type);
+    return retval;
+}
+
+/* write one completed capture */
+static int write_capture(const char *inst, hal_capture_t *cap,
+			 const hal_capture_done_t *d, const hal_type_t *type,
+			 size_t row_size, int tag, int binary)
+{
+    const hal_stream_desc_t *desc = &cap->desc;
+    const __u8 *rec;
+    __u64 this_sample;
+    __u32 u32;
+    char *p;
+    int i, col;
+
+    if ( binary && write_header(inst, d->trigger, desc->num_pins, type,
+				cap->aggregate ? desc->col : NULL, row_size) ) {
+	return -1;
+    }
+    for ( i = 0 ; i < d->samples ; i++ ) {
+	rec = halcapture_record(cap, (d->start + i) % d->length);
+	memcpy(&this_sample, rec, sizeof(this_sample));
+	if ( binary ) {
+	    if ( obuf_len + row_size > obuf_size ) {
+		if ( flush_binary() ) {
+		    return -1;
+		}
+	    }
+	    u32 = this_sample;
+	    p = encode_value(obuf + obuf_len, HAL_U32, &u32);
+	    for ( col = 0 ; col < desc->num_pins ; col++ ) {
+		p = encode_value(p, type[col], rec + desc->col[col].offset);
+	    }
+	    obuf_len = p - obuf;
+	    continue;
+	}
+	if ( i == d->trigger ) {
+	    printf ( d->forced ? "trigger forced\n" : "trigger\n" );
+	}
+	if ( tag ) {
+	    printf ( "%llu ", (unsigned long long)this_sample );
+	}
+	for ( col = 0 ; col < desc->num_pins ; col++ ) {
+	    print_value(type[col], rec + desc->col[col].offset);
+	}
+	printf ( "\n" );
+    }
+    if ( binary ) {
+	return flush_binary();
+    }
+    printf ( "\n" );
+    fflush(stdout);
+    return 0;
+}
+
+/* -C mode: arm, wait for and write out captures of a capture instance */
+static int capture_ring(const char *inst, long int captures, int tag,
+			int binary)
+{
+    hal_capture_t *cap;
+    hal_capture_done_t d;
+    hal_type_t *type;
+    const void *data;
+    ringsize_t size;
+    size_t row_size;
+    __u32 state;
+    int col, retval = -1;
+
+    if ( hal_ring_attachf(&rb, NULL, HALCAPTURE_RING, inst) < 0 ) {
+	fprintf(stderr, "ERROR: no capture instance '%s'\n", inst );
+	return -1;
+    }
+    cap = rb.scratchpad;
+    if ( (ring_scratchpad_size(&rb) < sizeof(*cap)) ||
+	 (cap->magic != HALCAPTURE_MAGIC) ) {
+	fprintf(stderr, "ERROR: '%s' is not a capture instance\n", inst );
+	return -1;
+    }
+    type = malloc(cap->desc.num_pins * sizeof(hal_type_t));
+    if ( type == NULL ) {
+	fprintf(stderr, "ERROR: out of memory\n");
+	return -1;
+    }
+    row_size = sizeof(__u32);
+    for ( col = 0 ; col < cap->desc.num_pins ; col++ ) {
+	type[col] = cap->desc.col[col].type;
+	row_size += halsample_width(type[col]);
+    }
+    if ( binary ) {
+	if ( obuf_size < row_size ) {
+	    obuf_size = row_size;
+	}
+	obuf = malloc(obuf_size);
+	if ( obuf == NULL ) {
+	    fprintf(stderr, "ERROR: out of memory\n");
+	    goto out;
+	}
+    }
+    /* captures completed before we came along */
+    while ( record_read(&rb, &data, &size) == 0 ) {
+	record_shift(&rb);
+    }
+    while ( captures != 0 ) {
+	state = rtapi_load_u32(&cap->state);
+	if ( (state == CAPTURE_IDLE) || (state == CAPTURE_DONE) ) {
+	    rtapi_store_u32(&cap->state, CAPTURE_ARMED);
+	}
+	while ( record_read(&rb, &data, &size) ) {
+	    ring_wait_read(&rb, 100);
+	}
+	memcpy(&d, data, sizeof(d));
+	rtapi_smp_rmb();
+	if ( write_capture(inst, cap, &d, type, row_size, tag, binary) ) {
+	    goto out;
+	}
+	record_shift(&rb);
+	if ( captures > 0 ) {
+	    captures--;
+	}
+    }
+    retval = 0;
+out:
+    free(type);
+    return retval;
+}
 
 int main(int argc, char **argv)
 {
-    int n, channel, retval, size, tag;
+    int n, i, channel, retval, size, tag, binary, rowlen;
     long int samples;
-    unsigned long this_sample;
+    unsigned long this_sample, lost;
+    size_t row_size;
     char  *cp2;
-    char *name = NULL;
+    char prefix[HAL_NAME_LEN + 1];
+    char *name = NULL, *inst = NULL, *capinst = NULL;
     void *shmem_ptr;
     fifo_t *fifo;
-    shmem_data_t *data, *dptr, buf[MAX_PINS];
-    int tmpout, newout;
+    shmem_data_t *rows = NULL, *row;
     struct timespec delay;
 
     /* set return code to "fail", clear it later if all goes well */
     exitval = 1;
     channel = 0;
     tag = 0;
+    binary = 0;
     samples = -1;  /* -1 means run forever */
     int  opt;
 
-    while ((opt = getopt(argc, argv, "tn:c:N:")) != -1) {
+    while ((opt = getopt(argc, argv, "tbB:n:c:r:C:N:")) != -1) {
 	switch (opt) {
 	case 'c':
 	    channel = strtol(optarg, &cp2, 10);
@@ -145,19 +669,39 @@ int main(int argc, char **argv)
 		exit(1);
 	    }
 	    break;
+	case 'r':
+	    inst = optarg;
+	    break;
+	case 'C':
+	    capinst = optarg;
+	    break;
 	case 'N':
 	    name = optarg;
 	    break;
 	case 't':
 	    tag = 1;
 	    break;
+	case 'b':
+	    binary = 1;
+	    break;
+	case 'B':
+	    obuf_size = strtol(optarg, &cp2, 10);
+	    if (( *cp2 ) || ( (long)obuf_size <= 0 )) {
+		fprintf(stderr, "ERROR: invalid buffer size '%s'\n", optarg );
+		exit(1);
+	    }
+	    break;
 	default: /* '?' */
 	    fprintf(stderr,"ERROR: unknown option '%c'\n", opt);
 	    fprintf(stderr,"valid options are:\n" );
 	    fprintf(stderr,"\t-t\t\ttag values with sample number\n" );
 	    fprintf(stderr,"\t-c <int>\t channel number\n" );
+	    fprintf(stderr,"\t-r <name>\t samplerv2 instance\n" );
+	    fprintf(stderr,"\t-C <name>\t capture instance\n" );
 	    fprintf(stderr,"\t-n <int>\t sample count\n" );
 	    fprintf(stderr,"\t-N <name>\t set HAL component name\n" );
+	    fprintf(stderr,"\t-b\t\twrite binary rows, see streamer.h\n" );
+	    fprintf(stderr,"\t-B <bytes>\t output buffer size\n" );
 	    exit(1);
 	    exit(EXIT_FAILURE);
 	}
@@ -169,7 +713,7 @@ int main(int argc, char **argv)
 	    exit(1);
 	}
 	// make stdout be the named file
-	fd = open(argv[optind], O_WRONLY | O_CREAT, 0666);
+	fd = open(argv[optind], O_WRONLY | O_CREAT | (binary ? O_TRUNC : 0), 0666);
 	close(1);
 	dup2(fd, 1);
     }
@@ -195,6 +739,18 @@ int main(int argc, char **argv)
 	goto out;
     }
     hal_ready(comp_id);
+    if ( inst ) {
+	if ( sample_ring(inst, samples, tag, binary) == 0 ) {
+	    exitval = 0;
+	}
+	goto out;
+    }
+    if ( capinst ) {
+	if ( capture_ring(capinst, samples, tag, binary) == 0 ) {
+	    exitval = 0;
+	}
+	goto out;
+    }
     /* open shmem for user/RT comms (fifo) */
     /* initial size is unknown, assume only the fifo structure */
     shmem_id = rtapi_shmem_new(SAMPLER_SHMEM_KEY+channel, comp_id, sizeof(fifo_t));
@@ -227,78 +783,94 @@ int main(int argc, char **argv)
 	goto out;
     }
     fifo = shmem_ptr;
-    data = fifo->data;
+
+    /* room to drain the whole fifo at once */
+    rowlen = fifo->num_pins + 1;
+    rows = malloc(fifo->depth * rowlen * sizeof(shmem_data_t));
+    if ( rows == NULL ) {
+	fprintf(stderr, "ERROR: out of memory\n");
+	goto out;
+    }
+    row_size = sizeof(__u32);
+    for ( n = 0 ; n < fifo->num_pins ; n++ ) {
+	row_size += halsample_width(fifo->type[n]);
+    }
+    if ( binary ) {
+	if ( obuf_size < row_size ) {
+	    obuf_size = row_size;
+	}
+	obuf = malloc(obuf_size);
+	if ( obuf == NULL ) {
+	    fprintf(stderr, "ERROR: out of memory\n");
+	    goto out;
+	}
+	snprintf(prefix, sizeof(prefix), "sampler.%d", channel);
+	if ( write_header(prefix, channel, fifo->num_pins, fifo->type, NULL,
+			  row_size) ) {
+	    goto out;
+	}
+    } else {
+	setvbuf(stdout, NULL, _IOFBF, obuf_size);
+    }
     while ( samples != 0 ) {
-	while ( fifo->in == fifo->out ) {
-            /* fifo empty, sleep for 10mS */
+	n = drain_fifo(fifo, rows);
+	if ( n == 0 ) {
+	    /* fifo empty, push out what we have and sleep for 10mS */
+	    if ( binary ) {
+		if ( flush_binary() ) {
+		    goto out;
+		}
+	    } else {
+		fflush(stdout);
+	    }
 	    delay.tv_sec = 0;
 	    delay.tv_nsec = 10000000;
 	    nanosleep(&delay,NULL);
-	}
-	/* make pointer to fifo entry */
-	tmpout = fifo->out;
-	newout = tmpout + 1;
-	if ( newout >= fifo->depth ) {
-	    newout = 0;
-	}
-	dptr = &data[tmpout * (fifo->num_pins+1)];
-	/* read data from shmem into buffer */
-	for ( n = 0 ; n < fifo->num_pins ; n++ ) {
-	    buf[n] = *(dptr++);
-	}
-	/* and read sample number */
-	this_sample = dptr->u;
-	if ( fifo->out != tmpout ) {
-	    /* the sample was overwritten while we were reading it */
-	    /* so ignore it */
 	    continue;
-	} else {
-	    /* update 'out' for next sample */
-	    fifo->out = newout;
-	}
-	if ( this_sample != ++(fifo->last_sample) ) {
-	    printf ( "overrun\n" );
-	    fifo->last_sample = this_sample;
 	}
-	if ( tag ) {
-	    printf ( "%ld ", this_sample );
-	}
-	for ( n = 0 ; n < fifo->num_pins ; n++ ) {
-	    switch ( fifo->type[n] ) {
-	    case HAL_FLOAT:
-		printf ( "%f ", buf[n].f);
-		break;
-	    case HAL_BIT:
-		if ( buf[n].b ) {
-		    printf ( "1 " );
+	for ( i = 0 ; (i < n) && (samples != 0) ; i++ ) {
+	    row = rows + i * rowlen;
+	    this_sample = row[fifo->num_pins].u;
+	    if ( this_sample != ++(fifo->last_sample) ) {
+		lost = this_sample - fifo->last_sample;
+		if ( binary ) {
+		    fprintf(stderr, "overrun: %lu samples lost\n", lost);
 		} else {
-		    printf ( "0 " );
+		    printf ( "overrun\n" );
+		}
+		fifo->last_sample = this_sample;
+	    }
+	    if ( binary ) {
+		if ( obuf_len + row_size > obuf_size ) {
+		    if ( flush_binary() ) {
+			goto out;
+		    }
 		}
-		break;
-	    case HAL_U32:
-		printf ( "%lu ", (unsigned long)buf[n].u);
-		break;
-	    case HAL_S32:
-		printf ( "%ld ", (long)buf[n].s);
-		break;
-	    default:
-		/* better not happen */
+		obuf_len = encode_row(obuf + obuf_len, fifo, row) - obuf;
+	    } else if ( print_row(fifo, row, tag) ) {
 		goto out;
 	    }
-	}
-	printf ( "\n" );
-	if ( samples > 0 ) {
-	    samples--;
+	    if ( samples > 0 ) {
+		samples--;
+	    }
 	}
     }
+    if ( binary && flush_binary() ) {
+	goto out;
+    }
     /* run was succesfull */
     exitval = 0;
 
 out:
     ignore_sig = 1;
+    fflush(stdout);
+    free(rows);
     if ( shmem_id >= 0 ) {
 	rtapi_shmem_delete(shmem_id, comp_id);
     }
+    if ( ringbuffer_attached(&rb) ) {
+	hal_ring_detach(&rb);
+    }
     if ( comp_id >= 0 ) {
 	hal_exit(comp_id);
     }
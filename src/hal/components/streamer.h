@@ -9,6 +9,9 @@
 * Copyright (c) 2006 All rights reserved.
 *
 ********************************************************************/
+#ifndef STREAMER_H
+#define STREAMER_H
+
 #include "rtapi_shmkeys.h"
 
 #define MAX_STREAMERS		8
@@ -40,6 +43,50 @@ typedef struct {
     shmem_data_t data[];
 } fifo_t;
 
+/* binary sample files, as written by 'halsampler -b'
+
+   all values are little-endian:
+
+   halsample_header_t
+   __u32 type[num_pins]      hal_type_t of each column
+   char names[names_size]    one NUL-terminated name per column: the
+                             signal linked to the sampler pin, or the
+                             pin name if not linked
+   rows of row_size bytes, each:
+     __u32 sample number
+     one value per column, packed:
+       HAL_BIT 1 byte, HAL_S32 and HAL_U32 4 bytes,
+       HAL_S64 and HAL_U64 8 bytes, HAL_FLOAT 8 byte IEEE 754 double
+*/
+
+#define HALSAMPLE_MAGIC		"HALSMPL"	/* 8 bytes with NUL */
+#define HALSAMPLE_VERSION	1
+
+typedef struct {
+    char magic[8];
+    __u32 version;
+    __u32 header_size;	/* file offset of the first row */
+    __u32 num_pins;
+    __u32 row_size;
+    __u32 names_size;
+    __u32 channel;	/* sampler channel, -1 for samplerv2, or for a
+			   capture the row at which the trigger hit */
+} halsample_header_t;
+
+/* bytes per value of a column in a sample file, 0 if not supported */
+static inline int halsample_width(const hal_type_t type)
+{
+    switch (type) {
+    case HAL_BIT:	return 1;
+    case HAL_S32:
+    case HAL_U32:	return 4;
+    case HAL_FLOAT:
+    case HAL_S64:
+    case HAL_U64:	return 8;
+    default:		return 0;
+    }
+}
+
 /* this struct lives in HAL shared memory */
 
 typedef union {
@@ -49,3 +96,214 @@ typedef union {
     hal_s32_t *hs32;
 } pin_data_t;
 
+
+/* samplerv2 and streamerv2: instantiable, ring-backed sampler and
+   streamer for any number of pins of all HAL types.
+
+     newinst samplerv2 <name> cfg=<columns> [depth=<samples>]
+     newinst streamerv2 <name> cfg=<columns> [depth=<samples>]
+
+   cfg has one letter per column, each optionally followed by a repeat
+   count:  b bit, f float, s s32, u u32, S s64, U u64
+   e.g. cfg=f12b8U2 is 12 floats, 8 bits and 2 u64's.
+
+   Samples go through the record ring named HALSTREAM_RING, one record
+   of desc->record_size bytes per sample. The ring's scratchpad is a
+   hal_stream_desc_t. A record is
+     __u64 sample number
+     the 64-bit columns (float, s64, u64), 8 bytes each
+     the 32-bit columns (s32, u32), 4 bytes each
+     the bit columns, 1 byte each
+   padded to a multiple of 8 bytes. Grouping columns by width into
+   lanes lets the RT side copy a lane with a plain loop instead of
+   switching on the type of each pin. desc->col[n] tells where cfg
+   column n is kept.
+*/
+
+/* record data in a ring is only 4-byte aligned */
+typedef __u64 hs_w64_t __attribute__((aligned(4), may_alias));
+typedef __u32 hs_w32_t __attribute__((may_alias));
+
+#define HALSTREAM_RING		"%s.samples"
+#define HALSTREAM_MAGIC		0x48535632	/* "HSV2" */
+#define HALSTREAM_MAX_PINS	1024
+
+typedef enum {
+    HS_W64,
+    HS_W32,
+    HS_W8,
+    HS_NLANES
+} hs_lane_t;
+
+/* what a record column holds. Aggregating capture instances keep
+   several columns per pin, see capture.h */
+typedef enum {
+    HS_AGG_NONE,		/* the pin value */
+    HS_AGG_MIN,			/* over a bucket of samples */
+    HS_AGG_MAX,
+    HS_AGG_MEAN,
+    HS_AGG_FIRST,		/* bits */
+    HS_AGG_LAST
+} hs_agg_t;
+
+typedef struct {
+    __u8 type;			/* hal_type_t */
+    __u8 lane;			/* hs_lane_t */
+    __u16 index;		/* position within the lane */
+    __u32 offset;		/* byte offset within a record */
+    __u16 src;			/* pin the column is taken from */
+    __u8 agg;			/* hs_agg_t */
+    __u8 pad;
+} hal_stream_col_t;
+
+typedef struct {
+    __u32 magic;
+    __u32 num_pins;
+    __u32 record_size;
+    __u32 lane_offset[HS_NLANES];
+    __u32 lane_count[HS_NLANES];
+    hal_stream_col_t col[];
+} hal_stream_desc_t;
+
+static inline int halstream_lane(const hal_type_t type)
+{
+    switch (type) {
+    case HAL_FLOAT:
+    case HAL_S64:
+    case HAL_U64:	return HS_W64;
+    case HAL_S32:
+    case HAL_U32:	return HS_W32;
+    case HAL_BIT:	return HS_W8;
+    default:		return -1;
+    }
+}
+
+static inline size_t halstream_desc_size(const int num_pins)
+{
+    return sizeof(hal_stream_desc_t) + num_pins * sizeof(hal_stream_col_t);
+}
+
+/* parse a cfg string into at most 'max' column types.
+   returns the number of columns, or -1 on a syntax error or overflow */
+static inline int halstream_parse_cfg(const char *cfg, hal_type_t *type,
+				      const int max)
+{
+    int n = 0, count;
+    hal_type_t t;
+
+    while (*cfg) {
+	switch (*cfg++) {
+	case 'b': t = HAL_BIT; break;
+	case 'f': t = HAL_FLOAT; break;
+	case 's': t = HAL_S32; break;
+	case 'u': t = HAL_U32; break;
+	case 'S': t = HAL_S64; break;
+	case 'U': t = HAL_U64; break;
+	default: return -1;
+	}
+	count = 0;
+	while ((*cfg >= '0') && (*cfg <= '9')) {
+	    count = count * 10 + (*cfg++ - '0');
+	    if (count > max)
+		return -1;
+	}
+	if (count == 0)
+	    count = 1;
+	if (n + count > max)
+	    return -1;
+	while (count--)
+	    type[n++] = t;
+    }
+    return n;
+}
+
+/* bytes per record for columns of the given types */
+static inline size_t halstream_record_size(const hal_type_t *type,
+					   const int num_pins)
+{
+    static const int width[HS_NLANES] = { 8, 4, 1 };
+    size_t size = sizeof(__u64);
+    int i;
+
+    for (i = 0; i < num_pins; i++)
+	size += width[halstream_lane(type[i])];
+    return (size + 7) & ~7;
+}
+
+/* fill in the record layout for columns of the given types */
+static inline void halstream_layout(hal_stream_desc_t *desc,
+				    const hal_type_t *type, const int num_pins)
+{
+    static const int width[HS_NLANES] = { 8, 4, 1 };
+    __u32 offset = sizeof(__u64);	/* sample number */
+    int i, lane;
+
+    desc->magic = HALSTREAM_MAGIC;
+    desc->num_pins = num_pins;
+    for (lane = 0; lane < HS_NLANES; lane++)
+	desc->lane_count[lane] = 0;
+    for (i = 0; i < num_pins; i++) {
+	lane = halstream_lane(type[i]);
+	desc->col[i].type = type[i];
+	desc->col[i].lane = lane;
+	desc->col[i].index = desc->lane_count[lane]++;
+	desc->col[i].src = i;
+	desc->col[i].agg = HS_AGG_NONE;
+    }
+    for (lane = 0; lane < HS_NLANES; lane++) {
+	desc->lane_offset[lane] = offset;
+	offset += desc->lane_count[lane] * width[lane];
+    }
+    for (i = 0; i < num_pins; i++)
+	desc->col[i].offset = desc->lane_offset[desc->col[i].lane] +
+	    desc->col[i].index * width[desc->col[i].lane];
+    desc->record_size = (offset + 7) & ~7;
+}
+
+/* position of column 'col' in a pin pointer array ordered by lane */
+static inline int halstream_slot(const hal_stream_desc_t *desc, const int col)
+{
+    int lane, slot = desc->col[col].index;
+
+    for (lane = 0; lane < desc->col[col].lane; lane++)
+	slot += desc->lane_count[lane];
+    return slot;
+}
+
+/* copy the pin values at p[] into a record, and back. p[] holds one
+   pointer per column ordered by lane, n[] and offset[] are the lane
+   counts and offsets of the desc. One loop per lane, no per-pin type
+   switch. */
+static inline void halstream_gather(__u8 *rec, void * const *p,
+				    const __u32 *n, const __u32 *offset)
+{
+    hs_w64_t *w64 = (hs_w64_t *)(rec + offset[HS_W64]);
+    hs_w32_t *w32 = (hs_w32_t *)(rec + offset[HS_W32]);
+    __u8 *w8 = rec + offset[HS_W8];
+    __u32 i;
+
+    for (i = 0; i < n[HS_W64]; i++)
+	w64[i] = *(hs_w64_t *)*p++;
+    for (i = 0; i < n[HS_W32]; i++)
+	w32[i] = *(hs_w32_t *)*p++;
+    for (i = 0; i < n[HS_W8]; i++)
+	w8[i] = *(hal_bit_t *)*p++;
+}
+
+static inline void halstream_scatter(const __u8 *rec, void * const *p,
+				     const __u32 *n, const __u32 *offset)
+{
+    const hs_w64_t *w64 = (const hs_w64_t *)(rec + offset[HS_W64]);
+    const hs_w32_t *w32 = (const hs_w32_t *)(rec + offset[HS_W32]);
+    const __u8 *w8 = rec + offset[HS_W8];
+    __u32 i;
+
+    for (i = 0; i < n[HS_W64]; i++)
+	*(hs_w64_t *)*p++ = w64[i];
+    for (i = 0; i < n[HS_W32]; i++)
+	*(hs_w32_t *)*p++ = w32[i];
+    for (i = 0; i < n[HS_W8]; i++)
+	*(hal_bit_t *)*p++ = (w8[i] != 0);
+}
+
+#endif /* STREAMER_H */
@@ -20,10 +20,22 @@
 
     Invoking:
 
-    halstreamer [chan_num]
+    halstreamer [-c chan_num | -r instance] [-b] [file]
 
     'chan_num', if present, specifies the streamer channel to use.
-    The default is channel zero.  Since hal_streamer takes its data
+    The default is channel zero.
+
+    '-r instance' feeds a streamerv2 instance instead, which may have
+    any number of columns of all HAL types, see streamer.h. Lines have
+    one value per column, in cfg order.
+
+    '-b' reads a binary sample file, as written by 'halsampler -b',
+    instead of text. The column types in the header must match the
+    streamer's. A regular file is mmap'd and copied to the fifo or
+    ring as many rows at a time as there is room for; pipes are read
+    in chunks. The sample numbers in the file are ignored.
+
+    Since hal_streamer takes its data
     from stdin, it will almost always either need to have stdin 
     redirected from a file, or have data piped into it from some
     other program.
@@ -64,10 +76,12 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
-
+#include <endian.h>
+#include <sys/mman.h>
 
 #include "rtapi.h"		/* RTAPI realtime OS API */
 #include "hal.h"                /* HAL public API decls */
+#include "hal_ring.h"
 #include "streamer.h"
 
 /***********************************************************************
@@ -84,6 +98,7 @@ int exitval = 1;	/* program return code - 1 means error */
 int ignore_sig = 0;	/* used to flag critical regions */
 int linenumber=0;	/* used to print linenumber on errors */
 char comp_name[HAL_NAME_LEN+1];	/* name for this instance of streamer */
+ringbuffer_t rb;		/* streamerv2 ring, -r mode */
 
 /***********************************************************************
 *                            MAIN PROGRAM                              *
@@ -98,6 +113,9 @@ static void quit(int sig)
     if ( shmem_id >= 0 ) {
 	rtapi_shmem_delete(shmem_id, comp_id);
     }
+    if ( ringbuffer_attached(&rb) ) {
+	hal_ring_detach(&rb);
+    }
     if ( comp_id >= 0 ) {
 	hal_exit(comp_id);
     }
@@ -106,11 +124,416 @@ static void quit(int sig)
 
 #define BUF_SIZE 4000
 
+/* parse one value of the given type at 'cp' into 'dst', which need
+   not be aligned. Sets '*end' behind the value, returns an error
+   message or NULL */
+static const char *parse_value(hal_type_t type, char *cp, char **end,
+			       void *dst)
+{
+    const char *errmsg = NULL;
+    double d;
+    __u32 u32;
+    __u64 u64;
+    __u8 b;
+
+    switch ( type ) {
+    case HAL_FLOAT:
+	d = strtod(cp, end);
+	memcpy(dst, &d, sizeof(d));
+	break;
+    case HAL_BIT:
+	if ( *cp == '0' ) {
+	    b = 0;
+	    *end = cp + 1;
+	} else if ( *cp == '1' ) {
+	    b = 1;
+	    *end = cp + 1;
+	} else {
+	    errmsg = "bit value not 0 or 1";
+	    *end = cp;
+	    break;
+	}
+	memcpy(dst, &b, sizeof(b));
+	break;
+    case HAL_U32:
+	u32 = strtoul(cp, end, 10);
+	memcpy(dst, &u32, sizeof(u32));
+	break;
+    case HAL_S32:
+	u32 = (__s32)strtol(cp, end, 10);
+	memcpy(dst, &u32, sizeof(u32));
+	break;
+    case HAL_U64:
+	u64 = strtoull(cp, end, 10);
+	memcpy(dst, &u64, sizeof(u64));
+	break;
+    case HAL_S64:
+	u64 = (__s64)strtoll(cp, end, 10);
+	memcpy(dst, &u64, sizeof(u64));
+	break;
+    default:
+	*end = cp;
+	return "unsupported type";
+    }
+    if ( errmsg == NULL ) {
+	/* whitespace separates fields, and there is a newline
+	   at the end... so if there is not space or newline at
+	   the end of a field, something is wrong. */
+	if ( **end == '\0' ) {
+	    errmsg = "premature end of line";
+	} else if ( ! isspace(**end) ) {
+	    errmsg = "bad character";
+	}
+    }
+    return errmsg;
+}
+
+/* binary input, see 'halsampler -b' and streamer.h */
+
+#define CHUNK_ROWS 4096		/* rows per read() from a pipe */
+
+typedef struct {
+    size_t row_size;
+    char *map;			/* whole file, if mmap'd */
+    size_t map_len;
+    size_t pos;			/* next row in map */
+    char *buf;			/* otherwise rows read() so far */
+    size_t buf_len;
+} bininput_t;
+
+static int read_all(void *p, size_t len)
+{
+    ssize_t n;
+
+    while ( len > 0 ) {
+	n = read(0, p, len);
+	if ( n <= 0 ) {
+	    return -1;
+	}
+	p = (char *)p + n;
+	len -= n;
+    }
+    return 0;
+}
+
+/* read and check the header against the types expected by the
+   streamer, and get ready to hand out rows */
+static int open_binary(bininput_t *in, int num_pins, const hal_type_t *types)
+{
+    halsample_header_t hdr;
+    struct stat st;
+    __u32 type;
+    size_t row_size, skip;
+    int n;
+    char c;
+
+    memset(in, 0, sizeof(*in));
+    if ( read_all(&hdr, sizeof(hdr)) ||
+	 strncmp(hdr.magic, HALSAMPLE_MAGIC, sizeof(hdr.magic)) ) {
+	fprintf(stderr, "ERROR: input is not a sample file\n");
+	return -1;
+    }
+    if ( le32toh(hdr.version) != HALSAMPLE_VERSION ) {
+	fprintf(stderr, "ERROR: sample file version %u not supported\n",
+		le32toh(hdr.version));
+	return -1;
+    }
+    if ( le32toh(hdr.num_pins) != num_pins ) {
+	fprintf(stderr, "ERROR: sample file has %u columns, streamer has %d\n",
+		le32toh(hdr.num_pins), num_pins);
+	return -1;
+    }
+    row_size = sizeof(__u32);
+    for ( n = 0 ; n < num_pins ; n++ ) {
+	if ( read_all(&type, sizeof(type)) ) {
+	    fprintf(stderr, "ERROR: short sample file header\n");
+	    return -1;
+	}
+	if ( le32toh(type) != types[n] ) {
+	    fprintf(stderr, "ERROR: column %d: sample file type %u, streamer type %d\n",
+		    n, le32toh(type), types[n]);
+	    return -1;
+	}
+	row_size += halsample_width(types[n]);
+    }
+    if ( le32toh(hdr.row_size) != row_size ) {
+	fprintf(stderr, "ERROR: sample file row size %u, expected %zu\n",
+		le32toh(hdr.row_size), row_size);
+	return -1;
+    }
+    in->row_size = row_size;
+    skip = le32toh(hdr.header_size) - sizeof(hdr) - num_pins * sizeof(__u32);
+
+    if ( (fstat(0, &st) == 0) && S_ISREG(st.st_mode) &&
+	 (st.st_size > le32toh(hdr.header_size)) ) {
+	in->map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, 0, 0);
+	if ( in->map != MAP_FAILED ) {
+	    madvise(in->map, st.st_size, MADV_SEQUENTIAL);
+	    in->map_len = st.st_size;
+	    in->pos = le32toh(hdr.header_size);
+	    return 0;
+	}
+	in->map = NULL;
+    }
+    /* not a regular file, skip the column names */
+    while ( skip-- ) {
+	if ( read_all(&c, 1) ) {
+	    fprintf(stderr, "ERROR: short sample file header\n");
+	    return -1;
+	}
+    }
+    in->buf = malloc(CHUNK_ROWS * row_size);
+    if ( in->buf == NULL ) {
+	fprintf(stderr, "ERROR: out of memory\n");
+	return -1;
+    }
+    return 0;
+}
+
+/* point 'rows' at the next run of complete rows, return their
+   number; 0 at the end of the input */
+static size_t next_rows(bininput_t *in, const char **rows)
+{
+    size_t n;
+    ssize_t len;
+
+    if ( in->map ) {
+	n = (in->map_len - in->pos) / in->row_size;
+	*rows = in->map + in->pos;
+	in->pos += n * in->row_size;
+	return n;
+    }
+    /* keep a partial row from the last read */
+    n = in->buf_len / in->row_size;
+    in->buf_len -= n * in->row_size;
+    memmove(in->buf, in->buf + n * in->row_size, in->buf_len);
+    while ( in->buf_len < in->row_size ) {
+	len = read(0, in->buf + in->buf_len,
+		   CHUNK_ROWS * in->row_size - in->buf_len);
+	if ( len <= 0 ) {
+	    return 0;
+	}
+	in->buf_len += len;
+    }
+    *rows = in->buf;
+    return in->buf_len / in->row_size;
+}
+
+static void close_binary(bininput_t *in)
+{
+    size_t rest;
+
+    rest = in->map ? in->map_len - in->pos : in->buf_len;
+    if ( rest % in->row_size ) {
+	fprintf(stderr, "WARNING: %zu bytes of a partial row ignored\n",
+		rest % in->row_size);
+    }
+    if ( in->map ) {
+	munmap(in->map, in->map_len);
+    }
+    free(in->buf);
+}
+
+/* decode one value of a row into 'dst', which need not be aligned.
+   returns the end of the value */
+static const char *decode_value(const char *p, hal_type_t type, void *dst)
+{
+    __u32 u32;
+    __u64 u64;
+
+    switch ( halsample_width(type) ) {
+    case 1:
+	*(__u8 *)dst = (*p != 0);
+	return p + 1;
+    case 4:
+	memcpy(&u32, p, sizeof(u32));
+	u32 = le32toh(u32);
+	memcpy(dst, &u32, sizeof(u32));
+	return p + sizeof(u32);
+    default:
+	memcpy(&u64, p, sizeof(u64));
+	u64 = le64toh(u64);
+	memcpy(dst, &u64, sizeof(u64));
+	return p + sizeof(u64);
+    }
+}
+
+/* binary input to the fifo: copy as many rows as there is room for,
+   then publish them with one update of 'in' */
+static int stream_fifo_binary(fifo_t *fifo)
+{
+    bininput_t in;
+    const char *rows, *p;
+    size_t n, i;
+    int col, tmpin, space;
+    shmem_data_t *dptr;
+    struct timespec delay;
+
+    if ( open_binary(&in, fifo->num_pins, fifo->type) ) {
+	return -1;
+    }
+    while ( (n = next_rows(&in, &rows)) > 0 ) {
+	for ( i = 0 ; i < n ; ) {
+	    tmpin = fifo->in;
+	    space = fifo->out - tmpin - 1;
+	    if ( space < 0 ) {
+		space += fifo->depth;
+	    }
+	    if ( space == 0 ) {
+		/* fifo full, sleep for 10mS */
+		delay.tv_sec = 0;
+		delay.tv_nsec = 10000000;
+		nanosleep(&delay,NULL);
+		continue;
+	    }
+	    for ( ; space && (i < n) ; space--, i++ ) {
+		p = rows + i * in.row_size + sizeof(__u32);
+		dptr = &fifo->data[tmpin * fifo->num_pins];
+		for ( col = 0 ; col < fifo->num_pins ; col++ ) {
+		    p = decode_value(p, fifo->type[col], &dptr[col]);
+		}
+		if ( ++tmpin >= fifo->depth ) {
+		    tmpin = 0;
+		}
+	    }
+	    /* rows before the index */
+	    rtapi_smp_wmb();
+	    fifo->in = tmpin;
+	}
+    }
+    close_binary(&in);
+    return 0;
+}
+
+/* binary input to a streamerv2 ring: write rows in batches, and sleep
+   on the ring while it is full */
+static int stream_ring_binary(hal_stream_desc_t *desc)
+{
+    bininput_t in;
+    ringbatch_t b;
+    hal_type_t *types;
+    const char *rows, *p;
+    __u8 *rec;
+    __u64 sample = 0;
+    size_t n, i;
+    int col, retval = -1;
+
+    types = malloc(desc->num_pins * sizeof(hal_type_t));
+    if ( types == NULL ) {
+	fprintf(stderr, "ERROR: out of memory\n");
+	return -1;
+    }
+    for ( col = 0 ; col < desc->num_pins ; col++ ) {
+	types[col] = desc->col[col].type;
+    }
+    if ( open_binary(&in, desc->num_pins, types) ) {
+	goto out;
+    }
+    while ( (n = next_rows(&in, &rows)) > 0 ) {
+	record_batch_begin(&rb, &b);
+	for ( i = 0 ; i < n ; ) {
+	    retval = record_batch_write_begin(&b, (void **)&rec,
+					      desc->record_size);
+	    if ( retval == EAGAIN ) {
+		/* hand over what we have, wait for room */
+		record_batch_commit(&b);
+		ring_wait_write(&rb, desc->record_size, 100);
+		record_batch_begin(&rb, &b);
+		continue;
+	    }
+	    if ( retval ) {
+		fprintf(stderr, "ERROR: record of %d bytes does not fit the ring\n",
+			desc->record_size );
+		goto close;
+	    }
+	    memset(rec, 0, desc->record_size);
+	    memcpy(rec, &sample, sizeof(sample));
+	    sample++;
+	    p = rows + i * in.row_size + sizeof(__u32);
+	    for ( col = 0 ; col < desc->num_pins ; col++ ) {
+		p = decode_value(p, types[col], rec + desc->col[col].offset);
+	    }
+	    record_batch_write_end(&b, rec, desc->record_size);
+	    i++;
+	}
+	record_batch_commit(&b);
+    }
+    retval = 0;
+close:
+    close_binary(&in);
+out:
+    free(types);
+    return retval;
+}
+
+/* -r mode: parse lines straight into records of a streamerv2 ring */
+static int stream_ring(const char *inst, int binary)
+{
+    hal_stream_desc_t *desc;
+    char buf[BUF_SIZE];
+    char *cp, *cp2;
+    const char *errmsg;
+    __u8 *rec;
+    __u64 sample = 0;
+    int n, line, retval;
+
+    if ( hal_ring_attachf(&rb, NULL, HALSTREAM_RING, inst) < 0 ) {
+	fprintf(stderr, "ERROR: no streamerv2 instance '%s'\n", inst );
+	return -1;
+    }
+    desc = rb.scratchpad;
+    if ( (ring_scratchpad_size(&rb) < sizeof(*desc)) ||
+	 (desc->magic != HALSTREAM_MAGIC) ) {
+	fprintf(stderr, "ERROR: '%s' is not a streamerv2 instance\n", inst );
+	return -1;
+    }
+    if ( binary ) {
+	return stream_ring_binary(desc);
+    }
+    line = 1;
+    while ( fgets(buf, BUF_SIZE, stdin) ) {
+	/* wait until there is space in the ring */
+	while ( (retval = record_write_begin(&rb, (void **)&rec,
+					     desc->record_size)) == EAGAIN ) {
+	    ring_wait_write(&rb, desc->record_size, 100);
+	}
+	if ( retval ) {
+	    fprintf(stderr, "ERROR: record of %d bytes does not fit the ring\n",
+		    desc->record_size );
+	    return -1;
+	}
+	memset(rec, 0, desc->record_size);
+	cp = buf;
+	errmsg = NULL;
+	for ( n = 0 ; n < desc->num_pins ; n++ ) {
+	    while ( isspace(*cp) ) {
+		cp++;
+	    }
+	    errmsg = parse_value(desc->col[n].type, cp, &cp2,
+				 rec + desc->col[n].offset);
+	    if ( errmsg != NULL ) {
+		break;
+	    }
+	    cp = cp2;
+	}
+	if ( errmsg != NULL ) {
+	    /* the reservation is simply not committed */
+	    fprintf (stderr, "line %d, field %d: %s, skipping the line\n", line, n, errmsg );
+	} else {
+	    memcpy(rec, &sample, sizeof(sample));
+	    sample++;
+	    record_write_end(&rb, rec, desc->record_size);
+	}
+	line++;
+    }
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
-    int n, channel, retval, size, line;
+    int n, channel, retval, size, line, binary;
     char *cp,*cp2;
-    char *name = NULL;
+    char *name = NULL, *inst = NULL;
     void *shmem_ptr;
     fifo_t *fifo;
     shmem_data_t *data, *dptr;
@@ -122,8 +545,9 @@ int main(int argc, char **argv)
     /* set return code to "fail", clear it later if all goes well */
     exitval = 1;
     channel = 0;
+    binary = 0;
     int  opt;
-    while ((opt = getopt(argc, argv, "c:N:")) != -1) {
+    while ((opt = getopt(argc, argv, "bc:r:N:")) != -1) {
 	switch (opt) {
         case 'c':
 	    channel = strtol(optarg, &cp2, 10);
@@ -132,6 +556,12 @@ int main(int argc, char **argv)
                 exit(1);
             }
             break;
+	case 'r':
+	    inst = optarg;
+	    break;
+	case 'b':
+	    binary = 1;
+	    break;
 	case 'N':
 	    name = optarg;
 	    break;
@@ -139,6 +569,8 @@ int main(int argc, char **argv)
 	    fprintf(stderr,"ERROR: unknown option '%c'\n", opt);
 	    fprintf(stderr,"valid options are:\n" );
 	    fprintf(stderr,"\t-c <int>\t channel number\n" );
+	    fprintf(stderr,"\t-r <name>\t streamerv2 instance\n" );
+	    fprintf(stderr,"\t-b\t\tread a binary sample file, see streamer.h\n" );
 	    fprintf(stderr,"\t-N <name>\t set HAL component name\n" );
 	    exit(EXIT_FAILURE);
         }
@@ -183,6 +615,12 @@ int main(int argc, char **argv)
 	goto out;
     }
     hal_ready(comp_id);
+    if ( inst ) {
+	if ( stream_ring(inst, binary) == 0 ) {
+	    exitval = 0;
+	}
+	goto out;
+    }
     /* open shmem for user/RT comms (fifo) */
     /* initial size is unknown, assume only the fifo structure */
     shmem_id = rtapi_shmem_new(STREAMER_SHMEM_KEY+channel, comp_id, sizeof(fifo_t));
@@ -214,8 +652,14 @@ int main(int argc, char **argv)
 	fprintf(stderr, "ERROR: couldn't re-map user/RT shared memory\n");
 	goto out;
     }
-    line = 1;
     fifo = shmem_ptr;
+    if ( binary ) {
+	if ( stream_fifo_binary(fifo) == 0 ) {
+	    exitval = 0;
+	}
+	goto out;
+    }
+    line = 1;
     data = fifo->data;
     while ( fgets(buf, BUF_SIZE, stdin) ) {
 	/* calculate _next_ value for in */
@@ -241,43 +685,7 @@ int main(int argc, char **argv)
 	    while ( isspace(*cp) ) {
 		cp++;
 	    }
-	    switch ( fifo->type[n] ) {
-	    case HAL_FLOAT:
-		dptr->f = strtod(cp, &cp2);
-		break;
-	    case HAL_BIT:
-		if ( *cp == '0' ) {
-		    dptr->b = 0;
-		    cp2 = cp + 1;
-		} else if ( *cp == '1' ) {
-		    dptr->b = 1;
-		    cp2 = cp + 1;
-		} else {
-		    errmsg = "bit value not 0 or 1";
-		    cp2 = cp;
-		}
-		break;
-	    case HAL_U32:
-		dptr->u = strtoul(cp, &cp2, 10);
-		break;
-	    case HAL_S32:
-		dptr->s = strtol(cp, &cp2, 10);
-		break;
-	    default:
-		/* better not happen */
-		goto out;
-	    }
-	    if ( errmsg == NULL ) {
-		/* no error yet, check for other possibilties */
-		/* whitespace separates fields, and there is a newline
-		   at the end... so if there is not space or newline at
-		   the end of a field, something is wrong. */
-		if ( *cp2 == '\0' ) {
-		    errmsg = "premature end of line";
-		} else if ( ! isspace(*cp2) ) {
-		    errmsg = "bad character";
-		}
-	    }
+	    errmsg = parse_value(fifo->type[n], cp, &cp2, dptr);
 	    /* test for any error */
 	    if ( errmsg != NULL ) {
 		/* abort loop on error */
@@ -306,6 +714,9 @@ out:
     if ( shmem_id >= 0 ) {
 	rtapi_shmem_delete(shmem_id, comp_id);
     }
+    if ( ringbuffer_attached(&rb) ) {
+	hal_ring_detach(&rb);
+    }
     if ( comp_id >= 0 ) {
 	hal_exit(comp_id);
     }
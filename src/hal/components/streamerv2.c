@@ -0,0 +1,187 @@
+// streamerv2: instantiable, ring-backed streamer
+//
+// each instance reads one record per invocation from the ring named
+// HALSTREAM_RING after the instance, fed by halstreamer -r, and drives
+// its pins from it. Columns of all HAL types are supported, see
+// streamer.h for the cfg syntax and the record layout.
+//
+// usage:
+//   newinst streamerv2 s0 cfg=f12b8U2 [depth=<samples>] [decimate=<n>]
+//   addf s0.update servo-thread
+//   halstreamer -r s0 < data
+//
+// a record is consumed every 'decimate' invocations of the funct. When
+// the ring is empty, the pins keep their values and 'underruns' counts.
+
+#include "rtapi.h"
+#include "rtapi_app.h"
+#include "hal.h"
+#include "hal_priv.h"
+#include "hal_ring.h"
+#include "streamer.h"
+
+MODULE_DESCRIPTION("ring-backed streamer for HAL pins of any type");
+MODULE_LICENSE("GPL");
+RTAPI_TAG(HAL, HC_INSTANTIABLE);
+
+static int comp_id;
+static char *compname = "streamerv2";
+
+static char *cfg = "";
+RTAPI_IP_STRING(cfg, "column types, e.g. f12b8U2, see streamer.h");
+
+static int depth = 1024;
+RTAPI_IP_INT(depth, "ring capacity in samples");
+
+static int decimate = 1;
+RTAPI_IP_INT(decimate, "initial value of the decimate pin");
+
+struct inst_data {
+    hal_bit_t *enable;      // pin: consume samples
+    hal_u32_t *decimate;    // pin: consume every n'th invocation
+    hal_bit_t *empty;       // pin: no sample was available
+    hal_u32_t *underruns;   // pin: invocations without a sample
+    hal_u64_t *sample_num;  // pin: number of the last sample
+    ringbuffer_t rb;
+    __u32 countdown;        // invocations until the next sample
+    __u32 n[HS_NLANES];     // pins per lane
+    __u32 offset[HS_NLANES];
+    void *ptr[0];           // pin values, ordered by lane
+};
+
+static int update(void *arg, const hal_funct_args_t *fa)
+{
+    struct inst_data *ip = arg;
+    const __u8 *rec;
+    ringsize_t size;
+
+    if (!*(ip->enable))
+	return 0;
+    if (ip->countdown) {
+	ip->countdown--;
+	return 0;
+    }
+    ip->countdown = *(ip->decimate) ? *(ip->decimate) - 1 : 0;
+
+    if (record_read(&ip->rb, (const void **)&rec, &size)) {
+	*(ip->underruns) += 1;
+	*(ip->empty) = 1;
+	return 0;
+    }
+    *(ip->empty) = 0;
+    *(ip->sample_num) = *(const hs_w64_t *)rec;
+
+    halstream_scatter(rec, ip->ptr, ip->n, ip->offset);
+    record_shift(&ip->rb);
+    return 0;
+}
+
+static int export_halobjs(struct inst_data *ip, const hal_stream_desc_t *desc,
+			  int owner_id, const char *name)
+{
+    int i;
+
+    for (i = 0; i < desc->num_pins; i++) {
+	if (hal_pin_newf(desc->col[i].type, HAL_OUT,
+			 &ip->ptr[halstream_slot(desc, i)],
+			 owner_id, "%s.pin.%d", name, i))
+	    return -1;
+    }
+    if (hal_pin_bit_newf(HAL_IN, &ip->enable, owner_id, "%s.enable", name) ||
+	hal_pin_u32_newf(HAL_IN, &ip->decimate, owner_id, "%s.decimate", name) ||
+	hal_pin_bit_newf(HAL_OUT, &ip->empty, owner_id, "%s.empty", name) ||
+	hal_pin_u32_newf(HAL_OUT, &ip->underruns, owner_id, "%s.underruns", name) ||
+	hal_pin_u64_newf(HAL_OUT, &ip->sample_num, owner_id, "%s.sample-num", name))
+	return -1;
+    *(ip->enable) = 1;
+    *(ip->decimate) = decimate;
+
+    hal_export_xfunct_args_t xfunct_args = {
+        .type = FS_XTHREADFUNC,
+        .funct.x = update,
+        .arg = ip,
+        .uses_fp = 0,
+        .reentrant = 0,
+        .owner_id = owner_id
+    };
+    return hal_export_xfunctf(&xfunct_args, "%s.update", name);
+}
+
+static int instantiate(const int argc, char* const *argv)
+{
+    const char *name = argv[1];
+    hal_type_t type[HALSTREAM_MAX_PINS];
+    struct inst_data *ip;
+    hal_stream_desc_t *desc;
+    int retval, inst_id, num_pins, lane;
+
+    num_pins = halstream_parse_cfg(cfg, type, HALSTREAM_MAX_PINS);
+    if (num_pins <= 0) {
+	HALERR("%s: invalid cfg '%s'", name, cfg);
+	return -EINVAL;
+    }
+    if ((depth < 1) || (decimate < 0)) {
+	HALERR("%s: invalid depth %d or decimate %d", name, depth, decimate);
+	return -EINVAL;
+    }
+    inst_id = hal_inst_create(name, comp_id,
+			      sizeof(struct inst_data) +
+			      num_pins * sizeof(void *),
+			      (void **)&ip);
+    if (inst_id < 0)
+	return inst_id;
+
+    size_t size = (depth + 1) * record_usage(halstream_record_size(type, num_pins));
+    if ((retval = hal_ring_newf(size, halstream_desc_size(num_pins), 0,
+				HALSTREAM_RING, name)) < 0)
+	return retval;
+    if ((retval = hal_ring_attachf(&ip->rb, NULL, HALSTREAM_RING, name)) < 0)
+	goto unring;
+    desc = ip->rb.scratchpad;
+    halstream_layout(desc, type, num_pins);
+    ip->rb.header->reader = inst_id;
+    ip->rb.header->reader_instance = rtapi_instance;
+
+    for (lane = 0; lane < HS_NLANES; lane++) {
+	ip->n[lane] = desc->lane_count[lane];
+	ip->offset[lane] = desc->lane_offset[lane];
+    }
+    if ((retval = export_halobjs(ip, desc, inst_id, name)))
+	goto undetach;
+
+    HALDBG("%s: %d columns, %d bytes per sample, depth %d",
+	   name, num_pins, desc->record_size, depth);
+    return 0;
+
+ undetach:
+    hal_ring_detach(&ip->rb);
+ unring:
+    hal_ring_deletef(HALSTREAM_RING, name);
+    return retval;
+}
+
+static int delete(const char *name, void *inst, const int inst_size)
+{
+    struct inst_data *ip = inst;
+
+    if (ringbuffer_attached(&ip->rb)) {
+	ip->rb.header->reader = 0;
+	hal_ring_detach(&ip->rb);
+	hal_ring_deletef(HALSTREAM_RING, name);
+    }
+    return 0;
+}
+
+int rtapi_app_main(void)
+{
+    comp_id = hal_xinit(TYPE_RT, 0, 0, instantiate, delete, compname);
+    if (comp_id < 0)
+	return comp_id;
+    hal_ready(comp_id);
+    return 0;
+}
+
+void rtapi_app_exit(void)
+{
+    hal_exit(comp_id);
+}
@@ -5,6 +5,7 @@ from libc.stdint cimport uint8_t
 cdef extern from "hal_group.h" :
 
     int GROUP_REPORT_ON_CHANGE
+    int GROUP_REPORT_PACKED
 
     ctypedef struct hal_member_t:
         halhdr_t hdr
@@ -26,7 +27,6 @@ cdef extern from "hal_group.h" :
         hal_member_t  **member
         rtapi_atomic_type *changed
         int n_monitored
-        hal_data_u    *tracking
         unsigned long user_flags
         void *user_data
 
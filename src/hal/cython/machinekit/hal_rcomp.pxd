@@ -4,6 +4,7 @@ from hal_priv cimport hal_data_u, hal_pin_t
 
 cdef extern from "hal_rcomp.h":
     int RCOMP_ACCEPT_VALUES_ON_BIND
+    int RCOMP_REPORT_PACKED
 
     ctypedef struct hal_compiled_comp_t:
         int n_pins
@@ -1,6 +1,6 @@
 #
 
-from hal_rcomp cimport RCOMP_ACCEPT_VALUES_ON_BIND
+from hal_rcomp cimport RCOMP_ACCEPT_VALUES_ON_BIND, RCOMP_REPORT_PACKED
 from os import strerror
 
 
@@ -9,12 +9,14 @@ class CompiledComponent(Component):
         pass
 
 class RemoteComponent(Component):
-    def __new__(cls, name, timer=100, acceptdefaults=False, noexit=True, **kwargs):
+    def __new__(cls, name, timer=100, acceptdefaults=False, packed=False, noexit=True, **kwargs):
         compargs = 0
         if acceptdefaults:
             compargs |= RCOMP_ACCEPT_VALUES_ON_BIND
+        if packed:
+            compargs |= RCOMP_REPORT_PACKED
         return Component.__new__(cls, name, mode=TYPE_REMOTE, noexit=noexit,
                                      userarg1=timer, userarg2=compargs, **kwargs)
 
-    def __init__(self, name, timer=100, acceptdefaults=False, noexit=True):
+    def __init__(self, name, timer=100, acceptdefaults=False, packed=False, noexit=True):
         pass
@@ -17,6 +17,12 @@ cdef extern from "hal_ring.h":
                                const int sp_size,
                                const int mode,
                                const char *fmt)
+    hal_ring_t *halg_ring_new_mpmcf(const int use_hal_mutex,
+                                    const int nslots,
+                                    const int recsize,
+                                    const int sp_size,
+                                    const int mode,
+                                    const char *fmt)
     int halg_ring_deletef(const int use_hal_mutex,const char *fmt)
     int halg_ring_attachf(const int use_hal_mutex,
                           ringbuffer_t *rb,
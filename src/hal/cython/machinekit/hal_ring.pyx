@@ -6,7 +6,7 @@
 # predefine ring flags bits in ring.pxd, export
 # use the halpr_foreach_ring() iterator to create ring namelist
 
-from libc.errno cimport EAGAIN
+from libc.errno cimport EAGAIN, EINTR, ETIMEDOUT
 from libc.string cimport memcpy
 from libc.stdint cimport uint32_t
 from buffer cimport PyBuffer_FillInfo
@@ -23,17 +23,31 @@ from ring cimport (
     record_write_space, record_next_size,
     record_iter_init, record_iter_read, record_iter_shift,
     ring_scratchpad_size,
-    ring_use_rmutex, ring_use_wmutex,
+    ring_use_rmutex, ring_use_wmutex, ring_wait_read, ring_wait_write,
+    mpmc_read_begin, mpmc_read_end, mpmc_write, mpmc_flush,
+    mpmc_record_max, mpmc_slots,
     stream_write_space, stream_flush, stream_read_space, stream_read_advance,
     stream_write, stream_get_read_vector,
     frame_readv, frame_shift, frame_write,
     )
 from hal_ring cimport (
-    halg_ring_newf, halg_ring_attachf, halpr_find_ring_by_name,
+    halg_ring_newf, halg_ring_new_mpmcf, halg_ring_attachf, halpr_find_ring_by_name,
     halg_ring_detach,
     )
 
 
+cdef _wait(ringbuffer_t *rb, ringsize_t size, int timeout, bint write):
+    cdef int r
+    with nogil:
+        if write:
+            r = ring_wait_write(rb, size, timeout)
+        else:
+            r = ring_wait_read(rb, timeout)
+    if r in (0, ETIMEDOUT, EINTR):
+        return r == 0
+    raise IOError(f"ring wait failed: {r} - {strerror(r)}")
+
+
 cdef class Ring:
     cdef ringbuffer_t _rb
     cdef hal_ring_t *_hr
@@ -45,7 +59,10 @@ cdef class Ring:
                   int type = RINGTYPE_RECORD,
                   bool use_rmutex = False,
                   bool use_wmutex = False,
-                  bool in_halmem = False):
+                  bool in_halmem = False,
+                  int recsize = 0):
+        # for type=RINGTYPE_MPMC, size is the number of slots
+        # of recsize bytes each
         self._hr = NULL
         self.flags = (type & RINGTYPE_MASK)
         if use_rmutex: self.flags |= USE_RMUTEX;
@@ -53,7 +70,10 @@ cdef class Ring:
         if in_halmem:  self.flags |= ALLOC_HALMEM;
 
         hal_required()
-        if size:
+        if size and (self.flags & RINGTYPE_MASK) == RINGTYPE_MPMC:
+            if halg_ring_new_mpmcf(1, size, recsize, scratchpad_size, self.flags, name.encode()) == NULL:
+                raise RuntimeError(f"hal_ring_new_mpmc({name}) failed: {hal_lasterror()}")
+        elif size:
             if halg_ring_newf(1, size, scratchpad_size, self.flags, name.encode()) == NULL:
                 raise RuntimeError(f"hal_ring_new({name}) failed: {hal_lasterror()}")
         if halg_ring_attachf(1, &self._rb, &self.aflags, name.encode()):
@@ -100,6 +120,16 @@ cdef class Ring:
     def shift(self):
         record_shift(&self._rb)
 
+    def wait(self, int timeout = -1):
+        """block until a record can be read, or timeout msec passed
+        (-1: forever). Returns True if a record is available."""
+        return _wait(&self._rb, 0, timeout, False)
+
+    def wait_space(self, int size, int timeout = -1):
+        """block until a record of size bytes can be written, or timeout
+        msec passed (-1: forever). Returns True if there is space."""
+        return _wait(&self._rb, size, timeout, True)
+
     def __iter__(self):
         return RingIter(self)
 
@@ -229,6 +259,16 @@ cdef class StreamRing:
         """returns the number of bytes readable or 0 if no data is available."""
         return stream_read_space(self._rb.header)
 
+    def wait(self, int timeout = -1):
+        """block until data can be read, or timeout msec passed
+        (-1: forever). Returns True if data is available."""
+        return _wait(self._rb, 0, timeout, False)
+
+    def wait_space(self, int nbytes, int timeout = -1):
+        """block until nbytes can be written, or timeout msec passed
+        (-1: forever). Returns True if there is space."""
+        return _wait(self._rb, nbytes, timeout, True)
+
     def write(self, s):
         """write to ring. Returns 0 on success.
         nozero return value indicates the number
@@ -255,6 +295,65 @@ cdef class StreamRing:
         return None
 
 
+cdef class MpmcRing:
+    """access to an MPMC ring, which any number of threads and
+    processes may read and write concurrently. read() consumes."""
+    cdef ringbuffer_t *_rb
+    cdef hal_ring_t *_hr
+    cdef object _pyring
+
+    def __cinit__(self, ring):
+        self._pyring = ring
+        self._rb = &(<Ring>ring)._rb
+        self._hr = (<Ring>ring)._hr
+        if self._rb.header.type != RINGTYPE_MPMC:
+            raise RuntimeError(f"ring '{self.name}' not an MPMC ring: type={self._rb.header.type}")
+
+    def write(self, s):
+        """write a record. Returns False if all slots are in use."""
+        if isinstance(s, str):
+            s = s.encode()
+        cdef int r = mpmc_write(self._rb, PyBytes_AsString(s), PyBytes_Size(s))
+        if r:
+            if r != EAGAIN:
+                raise IOError(f"Ring {self.name} write failed: {r} - {strerror(r)}")
+            return False
+        return True
+
+    def read(self):
+        """consume the oldest record and return it as bytes, or None."""
+        cdef const void *ptr
+        cdef ringsize_t size
+        if mpmc_read_begin(self._rb, &ptr, &size):
+            return None
+        b = PyBytes_FromStringAndSize(<const char *>ptr, size)
+        mpmc_read_end(self._rb, ptr)
+        return b
+
+    def flush(self):
+        """consume all records, return their number."""
+        return mpmc_flush(self._rb)
+
+    def wait(self, int timeout = -1):
+        """block until a record can be read, or timeout msec passed
+        (-1: forever). Returns True if a record is available."""
+        return _wait(self._rb, 0, timeout, False)
+
+    def wait_space(self, int size, int timeout = -1):
+        """block until a record of size bytes can be written, or timeout
+        msec passed (-1: forever). Returns True if a slot is free."""
+        return _wait(self._rb, size, timeout, True)
+
+    property recsize:
+        def __get__(self): return mpmc_record_max(self._rb.header)
+
+    property slots:
+        def __get__(self): return mpmc_slots(self._rb.header)
+
+    property name:
+        def __get__(self): return bytes(hh_get_name(&self._hr.hdr)).decode()
+
+
 cdef class MultiframeRing:
     cdef msgbuffer_t _rb
     cdef object _pyring
@@ -8,6 +8,7 @@ cdef extern from "ring.h":
     int RINGTYPE_RECORD
     int RINGTYPE_MULTIPART
     int RINGTYPE_STREAM
+    int RINGTYPE_MPMC
     int RINGTYPE_MASK
 
     int USE_RMUTEX
@@ -33,6 +34,7 @@ cdef extern from "ring.h":
         ringsize_t trailer_size
         ringsize_t size_mask
         ringsize_t size
+        ringsize_t slot_size
         uint64_t  generation
         ringsize_t head
         uint8_t *buf
@@ -82,6 +84,20 @@ cdef extern from "ring.h":
     int record_shift(ringbuffer_t *ring)
     int record_flush(ringbuffer_t *ring)
 
+    # batched writes and reads: one ring update for several records
+    ctypedef struct ringbatch_t:
+        ringbuffer_t *ring
+        ringsize_t tail
+        int count
+
+    void record_batch_begin(ringbuffer_t *ring, ringbatch_t *b)
+    int record_batch_write_begin(ringbatch_t *b, void **data, ringsize_t size)
+    int record_batch_write_end(ringbatch_t *b, const void *data, ringsize_t size)
+    int record_batch_write(ringbatch_t *b, const void *data, ringsize_t size)
+    int record_batch_commit(ringbatch_t *b)
+    int record_read_batch(const ringbuffer_t *ring, ringvec_t *vec, int n)
+    int record_shift_batch(ringbuffer_t *ring, int n)
+
     int record_iter_init(const ringbuffer_t *ring, ringiter_t *iter)
     int record_iter_invalid(const ringiter_t *iter)
     int record_iter_shift(ringiter_t *iter)
@@ -92,6 +108,26 @@ cdef extern from "ring.h":
     int ring_use_wmutex(ringbuffer_t *ring)
     int ring_use_rmutex(ringbuffer_t *ring)
 
+    # MPMC ring operations: any number of readers and writers
+    ringsize_t mpmc_ring_size(ringsize_t nslots, ringsize_t recsize)
+    ringsize_t mpmc_record_max(const ringheader_t *h)
+    ringsize_t mpmc_slots(const ringheader_t *h)
+    void ringheader_init_mpmc(ringheader_t *ringheader, int flags,
+                              ringsize_t nslots, ringsize_t recsize,
+                              ringsize_t sp_size)
+    int mpmc_write_begin(ringbuffer_t *ring, void **data, ringsize_t size)
+    int mpmc_write_end(ringbuffer_t *ring, void *data, ringsize_t size)
+    int mpmc_write(ringbuffer_t *ring, const void *data, ringsize_t size)
+    int mpmc_read_begin(ringbuffer_t *ring, const void **data, ringsize_t *size)
+    int mpmc_read_end(ringbuffer_t *ring, const void *data)
+    int mpmc_read(ringbuffer_t *ring, void *buf, ringsize_t bufsize, ringsize_t *size)
+    int mpmc_flush(ringbuffer_t *ring)
+    int ring_ismpmc(ringbuffer_t *ring)
+
+    # blocking waits - return 0, ETIMEDOUT, EINTR or ERANGE
+    int ring_wait_read(ringbuffer_t *ring, int timeout_ms) nogil
+    int ring_wait_write(ringbuffer_t *ring, ringsize_t size, int timeout_ms) nogil
+
     # character-oriented ring operations - pretty much a pipe:
     size_t stream_get_read_vector(const ringbuffer_t *ring, ringvec_t *vec)
     void stream_get_write_vector(const ringbuffer_t *ring, ringvec_t *vec)
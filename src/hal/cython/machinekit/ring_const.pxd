@@ -3,6 +3,7 @@ cdef extern from "ring.h":
         RINGTYPE_RECORD
         RINGTYPE_MULTIPART
         RINGTYPE_STREAM
+        RINGTYPE_MPMC
         RINGTYPE_MASK
 
     ctypedef enum ring_mode_flags_t:
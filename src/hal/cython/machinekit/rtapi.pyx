@@ -188,9 +188,10 @@ class RTAPIcommand:
             raise RuntimeError("cant connect to rtapi: %s" % strerror(-r))
 
     def newthread(self, str name, int period, instance=0, fp=0, cpu=-1,
-                  cgname="", flags=0):
+                  cgname="", flags=0, workers=0):
         c_cgname = cgname.encode()
-        r = rtapi_newthread(instance, name.encode(), period, cpu, c_cgname, fp, flags)
+        r = rtapi_newthread(instance, name.encode(), period, cpu, c_cgname, fp, flags,
+                            workers)
         if r:
             raise RuntimeError(f"rtapi_newthread failed:  {strerror(-r)}")
 
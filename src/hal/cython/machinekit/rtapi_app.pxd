@@ -7,7 +7,8 @@ cdef extern from "halcmd_rtapiapp.h":
     int rtapi_shutdown(int instance)
     int rtapi_ping(int instance)
     int rtapi_newthread(int instance, const char *name,
-                        int period, int cpu, char *cgname, int use_fp, int flags)
+                        int period, int cpu, char *cgname, int use_fp, int flags,
+                        int workers)
     int rtapi_delthread(int instance, const char *name)
     int rtapi_callfunc(int instance, const char *func, const char **args)
     int rtapi_newinst(int instance, const char *comp, const char *instname, const char **args)
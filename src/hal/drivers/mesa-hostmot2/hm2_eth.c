@@ -97,6 +97,12 @@ RTAPI_MP_ARRAY_STRING(config, MAX_ETH_BOARDS, "config string for the AnyIO board
 int debug = 0;
 RTAPI_MP_INT(debug, "Developer/debug use only!  Enable debug logging.");
 
+static char *transport[MAX_ETH_BOARDS];
+RTAPI_MP_ARRAY_STRING(transport, MAX_ETH_BOARDS, "transport per board: udp (default) or ring (packet socket with mmap()ed rings)");
+
+static int busy_poll = 0;
+RTAPI_MP_INT(busy_poll, "udp transport: SO_BUSY_POLL time in usec for receives, 0 to disable");
+
 static int boards_count = 0;
 
 int comm_active = 0;
@@ -112,8 +118,8 @@ static hm2_eth_t boards[MAX_ETH_BOARDS];
 
 /// ethernet io functions
 
-static int eth_socket_send(int sockfd, const void *buffer, int len, int flags);
-static int eth_socket_recv(int sockfd, void *buffer, int len, int flags);
+static int eth_socket_send(hm2_eth_t *board, const void *buffer, int len, int flags);
+static int eth_socket_recv(hm2_eth_t *board, void *buffer, int len, int flags);
 
 #define IPTABLES "/sbin/iptables"
 #define CHAIN "hm2-eth-rules-output"
@@ -289,16 +295,16 @@ static int install_iptables_perinterface(const char *ifbuf) {
     return 0;
 }
 
-static int fetch_hwaddr(const char *board_ip, int sockfd, unsigned char buf[6]) {
+static int fetch_hwaddr(const char *board_ip, hm2_eth_t *board, unsigned char buf[6]) {
     lbp16_cmd_addr packet;
     unsigned char response[6];
     LBP16_INIT_PACKET4(packet, 0x4983, 0x0002);
-    int res = eth_socket_send(sockfd, &packet, sizeof(packet), 0);
+    int res = eth_socket_send(board, &packet, sizeof(packet), 0);
     if (res < 0) return -errno;
 
     int i=0;
     do {
-        res = eth_socket_recv(sockfd, &response, sizeof(response), 0);
+        res = eth_socket_recv(board, &response, sizeof(response), 0);
     } while (++i < 10 && res < 0 && errno == EAGAIN);
     if (res < 0) return -errno;
 
@@ -373,6 +379,7 @@ static void decrement_soft_error(hm2_eth_t *board) {
 static int init_board(hm2_eth_t *board, const char *board_ip) {
     int ret;
 
+    board->ring.fd = -1;
     board->sockfd = socket(PF_INET, SOCK_DGRAM, IPPROTO_IP);
     if (board->sockfd < 0) {
         LL_PRINT("ERROR: can't open socket: %s\n", strerror(errno));
@@ -415,6 +422,14 @@ static int init_board(hm2_eth_t *board, const char *board_ip) {
         return -errno;
     }
 
+    // with busy polling, a receive spins on the NIC queue instead of
+    // sleeping until the interrupt for the reply is handled
+    if (busy_poll > 0 && !board->use_ring) {
+        ret = setsockopt(board->sockfd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll));
+        if (ret < 0)
+            LL_PRINT("WARNING: can't enable busy polling: %s\n", strerror(errno));
+    }
+
     // Manually create an ARP entry over to the mesa board so the IP stack doesn't need to
     // figure that out.
 
@@ -427,7 +442,7 @@ static int init_board(hm2_eth_t *board, const char *board_ip) {
 
     board->req.arp_ha.sa_family = AF_LOCAL;
     board->req.arp_flags = ATF_PERM | ATF_COM;
-    ret = fetch_hwaddr( board_ip, board->sockfd, (void*)&board->req.arp_ha.sa_data );
+    ret = fetch_hwaddr( board_ip, board, (void*)&board->req.arp_ha.sa_data );
     if (ret < 0) {
         LL_PRINT("ERROR: %s: Could not retrieve mac address\n", board_ip);
         return ret;
@@ -448,6 +463,17 @@ static int init_board(hm2_eth_t *board, const char *board_ip) {
         if (ret < 0) return ret;
     }
 
+    if (board->use_ring) {
+        char ifbuf[64];
+        if (!fetch_ifname(board->sockfd, ifbuf, sizeof(ifbuf))) {
+            LL_PRINT("ERROR: %s: can't determine interface for packet ring\n", board_ip);
+            return -ENODEV;
+        }
+        ret = hm2_eth_ring_open(&board->ring, board->sockfd, ifbuf,
+                                (void*)&board->req.arp_ha.sa_data);
+        if (ret < 0) return ret;
+    }
+
     board->write_packet_ptr = board->write_packet;
     board->read_packet_ptr = board->read_packet;
 
@@ -459,6 +485,9 @@ static int close_board(hm2_eth_t *board) {
     if (board->sockfd != -1) {
         if (use_iptables()) clear_iptables();
 
+        if (board->ring.fd != -1)
+            hm2_eth_ring_close(&board->ring);
+
         if (board->req.arp_flags & ATF_PERM) {
             ret = ioctl(board->sockfd, SIOCDARP, &board->req);
             if (ret < 0) perror("ioctl SIOCDARP");
@@ -477,22 +506,59 @@ static int close_board(hm2_eth_t *board) {
     return ret;
 }
 
-static int eth_socket_send(int sockfd, const void *buffer, int len, int flags) {
-    return send(sockfd, buffer, len, flags);
+static int eth_socket_send(hm2_eth_t *board, const void *buffer, int len, int flags) {
+    if (board->ring.fd != -1) {
+        int res = hm2_eth_ring_send(&board->ring, buffer, len);
+        if (res < 0) {
+            errno = -res;
+            return -1;
+        }
+        return res;
+    }
+    return send(board->sockfd, buffer, len, flags);
 }
 
-static int eth_socket_recv(int sockfd, void *buffer, int len, int flags) {
-    return recv(sockfd, buffer, len, flags);
+// receive a reply. *data is set to where the reply is: 'buffer' for the
+// udp transport, the rx frame for the ring transport, which stays valid
+// until the next receive or eth_socket_release(). Like recv() on the udp
+// socket, this waits for up to RECV_TIMEOUT_US.
+static int eth_socket_recv_ptr(hm2_eth_t *board, const u8 **data, void *buffer, int len, int flags) {
+    if (board->ring.fd != -1) {
+        int res = hm2_eth_ring_recv(&board->ring, data,
+                                    rtapi_get_time() + RECV_TIMEOUT_US * 1000);
+        if (res < 0) {
+            errno = -res;
+            return -1;
+        }
+        return res;
+    }
+    *data = buffer;
+    return recv(board->sockfd, buffer, len, flags);
 }
 
-static int eth_socket_recv_loop(int sockfd, void *buffer, int len, int flags, long timeout_ns) {
+static void eth_socket_release(hm2_eth_t *board) {
+    if (board->ring.fd != -1)
+        hm2_eth_ring_release(&board->ring);
+}
+
+static int eth_socket_recv(hm2_eth_t *board, void *buffer, int len, int flags) {
+    const u8 *data;
+    int res = eth_socket_recv_ptr(board, &data, buffer, len, flags);
+    if (res > 0 && data != buffer) {
+        memcpy(buffer, data, res < len ? res : len);
+        eth_socket_release(board);
+    }
+    return res;
+}
+
+static int eth_socket_recv_loop(hm2_eth_t *board, void *buffer, int len, int flags, long timeout_ns) {
     // Seems like this should be using rtapi_get_time() and not rtapi_get_clocks()
     // since the timeout is specified in nanos.
     // Changed it.
     long long end = rtapi_get_time() + timeout_ns;
     int result;
     do {
-        result = eth_socket_recv(sockfd, buffer, len, flags);
+        result = eth_socket_recv(board, buffer, len, flags);
     } while (result < 0 && rtapi_get_time() < end);
     return result;
 }
@@ -527,7 +593,7 @@ static int hm2_eth_read(hm2_lowlevel_io_t *this, u32 addr, void *buffer, int siz
 
     LBP16_INIT_PACKET4(read_packet, CMD_READ_HOSTMOT2_ADDR32_INCR(size/4), addr & 0xFFFF);
 
-    send = eth_socket_send(board->sockfd, (void*) &read_packet, sizeof(read_packet), 0);
+    send = eth_socket_send(board, (void*) &read_packet, sizeof(read_packet), 0);
     if (send < 0) {
         LL_PRINT("ERROR: sending packet: %s\n", strerror(errno));
         if (record_soft_error(board))
@@ -546,7 +612,7 @@ static int hm2_eth_read(hm2_lowlevel_io_t *this, u32 addr, void *buffer, int siz
         // This will block for up to RECV_TIMEOUT_US - which is 100,000 nanoseconds.
         // The hard coded timeout deadline below is 200,000,000 nanoseconds or 200 milliseconds.
         // An immense amount of time, not sure why that was picked...
-        recv = eth_socket_recv(board->sockfd, (void*) &tmp_buffer, size, 0);
+        recv = eth_socket_recv(board, (void*) &tmp_buffer, size, 0);
 
         t2 = rtapi_get_time();
 
@@ -624,7 +690,7 @@ static int hm2_eth_send_queued_reads(hm2_lowlevel_io_t *this) {
         board->read_entry_count++;
         board->total_read_buffer_size += 8;
 
-        send = eth_socket_send(board->sockfd, (void*) &board->read_packet, board->read_packet_ptr - board->read_packet, 0);
+        send = eth_socket_send(board, (void*) &board->read_packet, board->read_packet_ptr - board->read_packet, 0);
         if (send < 0) {
             LL_PRINT("ERROR: sending packet: %s\n", strerror(errno));
             if (record_soft_error(board))
@@ -646,6 +712,7 @@ static int hm2_eth_receive_queued_reads(hm2_lowlevel_io_t *this) {
     hm2_eth_t *board = this->private;
     int recv, attempts = 0;
     u8 tmp_buffer[board->total_read_buffer_size];
+    const u8 *data;
     long long t1, t2, before_recv_time;
     long int deltat;
     t1 = rtapi_get_time();
@@ -688,7 +755,7 @@ do_recv_packet:
         // of the timeout above anyway.  And we pulled out the rtapi_delay thing which was really just
         // a busy wait since it had no discernable benefit.
         errno = 0;
-        recv = eth_socket_recv(board->sockfd, (void*) &tmp_buffer, board->total_read_buffer_size, 0);
+        recv = eth_socket_recv_ptr(board, &data, (void*) &tmp_buffer, board->total_read_buffer_size, 0);
         t2 = rtapi_get_time();
 
         // Capture the max time we are ever stuck inside recv calls
@@ -706,6 +773,7 @@ do_recv_packet:
 
     if (recv != board->total_read_buffer_size) {
         // We must have timed out
+        eth_socket_release(board);
         board->read_packet_ptr = board->read_packet;
         board->read_entry_count = 0;
         board->total_read_buffer_size = 0;
@@ -717,12 +785,13 @@ do_recv_packet:
 
     LL_PRINT_IF(debug, "enqueue_read(%d) : PACKET RECV [SIZE: %d | TRIES: %d | TIME: %llu]\n", board->read_cnt, recv, attempts, t2 - t1);
 
-    // Now that we have the data, copy it from the local stack buffer to the final destinations that we tracked using
-    // the array of hm2_read_entry_t structs.
+    // Now that we have the data, copy it from the local stack buffer (or the rx frame of the packet ring) to the
+    // final destinations that we tracked using the array of hm2_read_entry_t structs.
     int ii;
     for (ii = 0; ii < board->read_entry_count; ii++) {
-        memcpy(board->read_entries[ii].buffer, &tmp_buffer[board->read_entries[ii].received_data_offset], board->read_entries[ii].size);
+        memcpy(board->read_entries[ii].buffer, &data[board->read_entries[ii].received_data_offset], board->read_entries[ii].size);
     }
+    eth_socket_release(board);
 
     // This appears to be a "do-over" because the UDP packet "sequence" number wasn't what we wanted
     // and there is more time left to read.
@@ -762,21 +831,34 @@ do_recv_packet:
 }
 
 // Returns 0 on failure, !0 on success
+// LBP16 commands transfer at most LBP16_MAX_PACKET_DATA_SIZE words, so
+// larger (coalesced TRAM) transfers are split into several commands
+static inline int lbp16_cmd_count(int size) {
+    return (size/4 + LBP16_MAX_PACKET_DATA_SIZE - 1) / LBP16_MAX_PACKET_DATA_SIZE;
+}
+
 static int hm2_eth_enqueue_read(hm2_lowlevel_io_t *this, u32 addr, void *buffer, int size) {
     hm2_eth_t *board = this->private;
+    int ncmds = lbp16_cmd_count(size);
     if (comm_active == 0) return 1;     // Fake success
     if (size == 0) return 1;            // Fake success
 
     // Check for possible read packet buffer overflow
-    if ((board->read_packet_ptr + sizeof(lbp16_cmd_addr)) > board->read_packet + sizeof(board->read_packet)) {
+    if ((board->read_packet_ptr + ncmds * sizeof(lbp16_cmd_addr)) > board->read_packet + sizeof(board->read_packet)) {
         LL_PRINT("ERROR: read buffer overflow error in hm2_eth_enqueue_read\n");
         return 0;
     } else if (board->read_entry_count >= MAX_ETH_READS) {
         LL_PRINT("ERROR: reached max queued reads already of %d in hm2_eth_enqueue_read\n", MAX_ETH_READS);
         return 0;
     } else {
-        LBP16_INIT_PACKET4(*(lbp16_cmd_addr*)board->read_packet_ptr, CMD_READ_HOSTMOT2_ADDR32_INCR(size/4), addr);
-        board->read_packet_ptr += sizeof(lbp16_cmd_addr);
+        int words, left;
+        // the replies to the commands arrive back to back, so one read
+        // entry covers all of them
+        for (left = size/4; left > 0; left -= words, addr += words*4) {
+            words = left > LBP16_MAX_PACKET_DATA_SIZE ? LBP16_MAX_PACKET_DATA_SIZE : left;
+            LBP16_INIT_PACKET4(*(lbp16_cmd_addr*)board->read_packet_ptr, CMD_READ_HOSTMOT2_ADDR32_INCR(words), addr);
+            board->read_packet_ptr += sizeof(lbp16_cmd_addr);
+        }
 
         board->read_entries[board->read_entry_count].buffer = buffer;
         board->read_entries[board->read_entry_count].size = size;
@@ -810,7 +892,7 @@ static int hm2_eth_write(hm2_lowlevel_io_t *this, u32 addr, const void *buffer,
     memcpy(packet.tmp_buffer, buffer, size);
     LBP16_INIT_PACKET4(packet.wr_packet, CMD_WRITE_HOSTMOT2_ADDR32_INCR(size/4), addr & 0xFFFF);
 
-    send = eth_socket_send(board->sockfd, (void*) &packet, sizeof(lbp16_cmd_addr) + size, 0);
+    send = eth_socket_send(board, (void*) &packet, sizeof(lbp16_cmd_addr) + size, 0);
     if (send < 0) {
         LL_PRINT("ERROR: sending packet: %s\n", strerror(errno));
         record_soft_error(board);
@@ -844,7 +926,7 @@ static int hm2_eth_send_queued_writes(hm2_lowlevel_io_t *this) {
         board->write_packet_size += (sizeof(*packet) + 4);
 
         t0 = rtapi_get_time();
-        send = eth_socket_send(board->sockfd, (void*) &board->write_packet, board->write_packet_size, 0);
+        send = eth_socket_send(board, (void*) &board->write_packet, board->write_packet_size, 0);
         if (send < 0) {
             LL_PRINT("ERROR: sending packet: %s\n", strerror(errno));
             record_soft_error(board);
@@ -861,20 +943,26 @@ static int hm2_eth_send_queued_writes(hm2_lowlevel_io_t *this) {
 /// Documented to return 0 on failure.  !0 on success.
 static int hm2_eth_enqueue_write(hm2_lowlevel_io_t *this, u32 addr, const void *buffer, int size) {
     hm2_eth_t *board = this->private;
+    int ncmds = lbp16_cmd_count(size);
     if (comm_active == 0) return 1;     // Fake success
     if (size == 0) return 1;            // Fake success
 
     // Check for possible write packet buffer overflow
-    if ((board->write_packet_ptr + sizeof(lbp16_cmd_addr) + size) > board->write_packet + sizeof(board->write_packet)) {
+    if ((board->write_packet_ptr + ncmds * sizeof(lbp16_cmd_addr) + size) > board->write_packet + sizeof(board->write_packet)) {
         LL_PRINT("ERROR: write buffer overflow error in hm2_eth_enqueue_write\n");
         return 0;
     } else {
-        lbp16_cmd_addr *packet = (lbp16_cmd_addr *) board->write_packet_ptr;
-        LBP16_INIT_PACKET4_PTR(packet, CMD_WRITE_HOSTMOT2_ADDR32_INCR(size/4), addr);
-        board->write_packet_ptr += sizeof(*packet);
-        memcpy(board->write_packet_ptr, buffer, size);
-        board->write_packet_ptr += size;
-        board->write_packet_size += (sizeof(*packet) + size);
+        int words, left;
+        const u8 *data = buffer;
+        for (left = size/4; left > 0; left -= words, addr += words*4, data += words*4) {
+            lbp16_cmd_addr *packet = (lbp16_cmd_addr *) board->write_packet_ptr;
+            words = left > LBP16_MAX_PACKET_DATA_SIZE ? LBP16_MAX_PACKET_DATA_SIZE : left;
+            LBP16_INIT_PACKET4_PTR(packet, CMD_WRITE_HOSTMOT2_ADDR32_INCR(words), addr);
+            board->write_packet_ptr += sizeof(*packet);
+            memcpy(board->write_packet_ptr, data, words*4);
+            board->write_packet_ptr += words*4;
+            board->write_packet_size += (sizeof(*packet) + words*4);
+        }
         return 1;
     }
 }
@@ -921,12 +1009,12 @@ static int hm2_eth_probe(hm2_eth_t *board) {
     char llio_name[16] = {0, };
 
     LBP16_INIT_PACKET4(read_packet, CMD_READ_BOARD_INFO_ADDR16_INCR(16/2), 0);
-    send = eth_socket_send(board->sockfd, (void*) &read_packet, sizeof(read_packet), 0);
+    send = eth_socket_send(board, (void*) &read_packet, sizeof(read_packet), 0);
     if (send < 0) {
         LL_PRINT("ERROR: sending packet: %s\n", strerror(errno));
         return -errno;
     }
-    recv = eth_socket_recv_loop(board->sockfd, (void*) &board_name, 16, 0,
+    recv = eth_socket_recv_loop(board, (void*) &board_name, 16, 0,
                 200 * 1000 * 1000);
     if (recv < 0) {
         LL_PRINT("ERROR: receiving packet: %s\n", strerror(errno));
@@ -1183,6 +1271,15 @@ int rtapi_app_main(void) {
     if (use_iptables()) clear_iptables();
 
     for (i = 0, ret = 0; ret == 0 && i<MAX_ETH_BOARDS && board_ip[i] && *board_ip[i]; i++) {
+        if (transport[i] && *transport[i] && strcmp(transport[i], "udp")) {
+            if (strcmp(transport[i], "ring")) {
+                LL_PRINT("ERROR: invalid transport '%s' for board %s\n", transport[i], board_ip[i]);
+                board_ip[i] = 0;
+                ret = -EINVAL;
+                break;
+            }
+            boards[i].use_ring = 1;
+        }
         ret = init_board(&boards[i], board_ip[i]);
         if (ret < 0) board_ip[i] = 0;
     }
@@ -21,6 +21,7 @@
 #define __INCLUDE_HM2_ETH_H
 
 #include "lbp16.h"
+#include "hm2_eth_ring.h"
 
 #define MAX_ETH_BOARDS 4
 
@@ -54,6 +55,8 @@ typedef struct {
     hm2_lowlevel_io_t llio;
 
     int sockfd;
+    int use_ring;               // transport=ring: LBP16 packets go through 'ring'
+    hm2_eth_ring_t ring;
     struct sockaddr_in local_addr;
     struct sockaddr_in server_addr;
 
@@ -0,0 +1,307 @@
+/*    This is a component of Machinekit
+ *
+ *    This program is free software; you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation; either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// packet socket transport for hm2_eth, see hm2_eth_ring.h
+
+#include "config.h"
+#include "config_module.h"
+#include RTAPI_INC_STRING_H
+
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <net/if.h>
+#include <net/if_arp.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <linux/filter.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "rtapi.h"
+
+#include "hal.h"
+
+#include "hostmot2-lowlevel.h"
+#include "hm2_eth.h"
+#include "hm2_eth_ring.h"
+
+#define TX_DATA_OFFSET TPACKET_ALIGN(sizeof(struct tpacket2_hdr))
+
+static inline struct tpacket2_hdr *frame(uint8_t *ring, unsigned n) {
+    return (struct tpacket2_hdr *)(ring + n * HM2_ETH_RING_FRAME_SIZE);
+}
+
+static inline uint32_t frame_status(struct tpacket2_hdr *h) {
+    return __atomic_load_n(&h->tp_status, __ATOMIC_ACQUIRE);
+}
+
+static inline void set_frame_status(struct tpacket2_hdr *h, uint32_t status) {
+    __atomic_store_n(&h->tp_status, status, __ATOMIC_RELEASE);
+}
+
+static uint16_t ip_checksum(const uint8_t *ip, int len) {
+    uint32_t sum = 0;
+    int i;
+    for (i = 0; i < len; i += 2)
+        sum += (ip[i] << 8) | ip[i+1];
+    while (sum >> 16)
+        sum = (sum & 0xffff) + (sum >> 16);
+    return ~sum & 0xffff;
+}
+
+static inline void put16(uint8_t *p, uint16_t v) {
+    p[0] = v >> 8;
+    p[1] = v & 0xff;
+}
+
+// pass IPv4/UDP from board:LBP16_UDP_PORT to local_port, unfragmented
+static int attach_filter(int fd, uint32_t board_ip, uint16_t local_port) {
+    struct sock_filter code[] = {
+        BPF_STMT(BPF_LD  | BPF_H   | BPF_ABS, 12),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ETH_P_IP, 0, 11),
+        BPF_STMT(BPF_LD  | BPF_B   | BPF_ABS, 23),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, IPPROTO_UDP, 0, 9),
+        BPF_STMT(BPF_LD  | BPF_W   | BPF_ABS, 26),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, board_ip, 0, 7),
+        BPF_STMT(BPF_LD  | BPF_H   | BPF_ABS, 20),
+        BPF_JUMP(BPF_JMP | BPF_JSET | BPF_K, 0x1fff, 5, 0),
+        BPF_STMT(BPF_LDX | BPF_B   | BPF_MSH, 14),
+        BPF_STMT(BPF_LD  | BPF_H   | BPF_IND, 14),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, LBP16_UDP_PORT, 0, 2),
+        BPF_STMT(BPF_LD  | BPF_H   | BPF_IND, 16),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, local_port, 1, 0),
+        BPF_STMT(BPF_RET | BPF_K, 0),
+        BPF_STMT(BPF_RET | BPF_K, 0xffff),
+    };
+    struct sock_fprog prog = {
+        .len = sizeof(code) / sizeof(code[0]),
+        .filter = code,
+    };
+    if (setsockopt(fd, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)) < 0)
+        return -errno;
+    return 0;
+}
+
+// the replies now also reach the UDP socket, where nobody reads them.
+// Drop them before they are queued: a filter passing nothing, and as
+// little buffer as the kernel allows should it be detached
+static int mute_udp(int sockfd) {
+    struct sock_filter code[] = {
+        BPF_STMT(BPF_RET | BPF_K, 0),
+    };
+    struct sock_fprog prog = {
+        .len = 1,
+        .filter = code,
+    };
+    int val = 0;
+    char buf[1];
+
+    if (setsockopt(sockfd, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)) < 0)
+        return -errno;
+    // clamped to the minimum; not fatal
+    setsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &val, sizeof(val));
+    // replies which made it in before
+    while (recv(sockfd, buf, sizeof(buf), MSG_DONTWAIT) >= 0)
+        ;
+    if (shutdown(sockfd, SHUT_RD) < 0)
+        return -errno;
+    return 0;
+}
+
+int hm2_eth_ring_open(hm2_eth_ring_t *r, int sockfd, const char *ifname,
+                      const unsigned char board_mac[6]) {
+    struct sockaddr_in srcaddr, dstaddr;
+    struct sockaddr_ll ll;
+    struct tpacket_req req;
+    struct ifreq ifr;
+    socklen_t addrlen;
+    int ret, val;
+
+    memset(r, 0, sizeof(*r));
+    r->fd = -1;
+
+    addrlen = sizeof(srcaddr);
+    if (getsockname(sockfd, (struct sockaddr *)&srcaddr, &addrlen) < 0)
+        return -errno;
+    addrlen = sizeof(dstaddr);
+    if (getpeername(sockfd, (struct sockaddr *)&dstaddr, &addrlen) < 0)
+        return -errno;
+
+    // only the rx ring is to receive anything, so the protocol is set
+    // when binding once the filter is in place
+    r->fd = socket(AF_PACKET, SOCK_RAW, 0);
+    if (r->fd < 0) {
+        ret = -errno;
+        LL_PRINT("ERROR: can't open packet socket: %s\n", strerror(errno));
+        return ret;
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    rtapi_snprintf(ifr.ifr_name, sizeof(ifr.ifr_name), "%s", ifname);
+    if (ioctl(r->fd, SIOCGIFINDEX, &ifr) < 0)
+        goto fail;
+    memset(&ll, 0, sizeof(ll));
+    ll.sll_family = AF_PACKET;
+    ll.sll_protocol = htons(ETH_P_IP);
+    ll.sll_ifindex = ifr.ifr_ifindex;
+    if (ioctl(r->fd, SIOCGIFHWADDR, &ifr) < 0)
+        goto fail;
+
+    if ((ret = attach_filter(r->fd, ntohl(dstaddr.sin_addr.s_addr),
+                             ntohs(srcaddr.sin_port))) < 0) {
+        errno = -ret;
+        goto fail;
+    }
+
+    val = TPACKET_V2;
+    if (setsockopt(r->fd, SOL_PACKET, PACKET_VERSION, &val, sizeof(val)) < 0)
+        goto fail;
+    val = 1;
+    // not fatal: older kernels just go through the qdisc
+    setsockopt(r->fd, SOL_PACKET, PACKET_QDISC_BYPASS, &val, sizeof(val));
+
+    req.tp_block_size = HM2_ETH_RING_BLOCK_SIZE;
+    req.tp_block_nr = HM2_ETH_RING_BLOCKS;
+    req.tp_frame_size = HM2_ETH_RING_FRAME_SIZE;
+    req.tp_frame_nr = HM2_ETH_RING_BLOCKS *
+        (HM2_ETH_RING_BLOCK_SIZE / HM2_ETH_RING_FRAME_SIZE);
+    if (setsockopt(r->fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0)
+        goto fail;
+    if (setsockopt(r->fd, SOL_PACKET, PACKET_TX_RING, &req, sizeof(req)) < 0)
+        goto fail;
+    r->frame_nr = req.tp_frame_nr;
+
+    // the rx ring comes first in the mapping, followed by the tx ring
+    r->map_size = 2 * req.tp_block_size * req.tp_block_nr;
+    r->map = mmap(NULL, r->map_size, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_LOCKED, r->fd, 0);
+    if (r->map == MAP_FAILED) {
+        r->map = NULL;
+        goto fail;
+    }
+    r->rx = r->map;
+    r->tx = r->map + r->map_size / 2;
+
+    if (bind(r->fd, (struct sockaddr *)&ll, sizeof(ll)) < 0)
+        goto fail;
+
+    if ((ret = mute_udp(sockfd)) < 0) {
+        errno = -ret;
+        goto fail;
+    }
+
+    // header template; lengths, id and checksum are filled in per packet
+    uint8_t *h = r->hdr;
+    memcpy(h, board_mac, 6);
+    memcpy(h + 6, ifr.ifr_hwaddr.sa_data, 6);
+    put16(h + 12, ETH_P_IP);
+    h += 14;
+    h[0] = 0x45;                  // IPv4, 20 byte header
+    put16(h + 6, 0x4000);         // don't fragment
+    h[8] = 64;                    // ttl
+    h[9] = IPPROTO_UDP;
+    memcpy(h + 12, &srcaddr.sin_addr.s_addr, 4);
+    memcpy(h + 16, &dstaddr.sin_addr.s_addr, 4);
+    h += 20;
+    memcpy(h, &srcaddr.sin_port, 2);
+    memcpy(h + 2, &dstaddr.sin_port, 2);
+    // UDP checksum 0: none
+
+    LL_PRINT("%s: using packet ring transport, %d frames\n", ifname, r->frame_nr);
+    return 0;
+
+ fail:
+    ret = -errno;
+    LL_PRINT("ERROR: %s: setting up packet ring: %s\n", ifname, strerror(errno));
+    hm2_eth_ring_close(r);
+    return ret;
+}
+
+void hm2_eth_ring_close(hm2_eth_ring_t *r) {
+    if (r->map)
+        munmap(r->map, r->map_size);
+    if (r->fd >= 0)
+        close(r->fd);
+    r->map = NULL;
+    r->held = NULL;
+    r->fd = -1;
+}
+
+int hm2_eth_ring_send(hm2_eth_ring_t *r, const void *buf, int len) {
+    struct tpacket2_hdr *f = frame(r->tx, r->tx_head);
+    int size = HM2_ETH_RING_HDR_SIZE + len;
+
+    if (TX_DATA_OFFSET + size > HM2_ETH_RING_FRAME_SIZE)
+        return -EMSGSIZE;
+
+    // the frame is still owned by the kernel if a previous send has not
+    // completed, which with 16 frames means the link is not draining
+    if (frame_status(f) & (TP_STATUS_SEND_REQUEST | TP_STATUS_SENDING))
+        return -ENOBUFS;
+
+    uint8_t *data = (uint8_t *)f + TX_DATA_OFFSET;
+    uint8_t *ip = data + 14;
+    memcpy(data, r->hdr, HM2_ETH_RING_HDR_SIZE);
+    memcpy(data + HM2_ETH_RING_HDR_SIZE, buf, len);
+    put16(ip + 2, 20 + 8 + len);
+    put16(ip + 4, r->ip_id++);
+    put16(ip + 10, ip_checksum(ip, 20));
+    put16(ip + 20 + 4, 8 + len);
+
+    f->tp_len = size;
+    set_frame_status(f, TP_STATUS_SEND_REQUEST);
+    r->tx_head = (r->tx_head + 1) % r->frame_nr;
+
+    if (send(r->fd, NULL, 0, MSG_DONTWAIT) < 0 && errno != EAGAIN)
+        return -errno;
+    return len;
+}
+
+int hm2_eth_ring_recv(hm2_eth_ring_t *r, const uint8_t **payload,
+                      long long deadline) {
+    struct tpacket2_hdr *f;
+
+    hm2_eth_ring_release(r);
+    f = frame(r->rx, r->rx_head);
+    while (!(frame_status(f) & TP_STATUS_USER)) {
+        if (rtapi_get_time() >= deadline)
+            return -EAGAIN;
+    }
+    r->held = f;
+    r->rx_head = (r->rx_head + 1) % r->frame_nr;
+
+    // the filter only lets through unfragmented UDP, so only the IP
+    // header length varies
+    const uint8_t *ip = (uint8_t *)f + f->tp_net;
+    int ihl = (ip[0] & 0xf) * 4;
+    int udp_len = (ip[ihl + 4] << 8) | ip[ihl + 5];
+    if (udp_len < 8 || f->tp_net + ihl + udp_len > f->tp_snaplen + f->tp_mac) {
+        hm2_eth_ring_release(r);
+        return -EBADMSG;
+    }
+    *payload = ip + ihl + 8;
+    return udp_len - 8;
+}
+
+void hm2_eth_ring_release(hm2_eth_ring_t *r) {
+    if (r->held) {
+        set_frame_status(r->held, TP_STATUS_KERNEL);
+        r->held = NULL;
+    }
+}
@@ -0,0 +1,79 @@
+/*    This is a component of Machinekit
+ *
+ *    This program is free software; you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation; either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __INCLUDE_HM2_ETH_RING_H
+#define __INCLUDE_HM2_ETH_RING_H
+
+// packet socket transport for hm2_eth (transport=ring)
+//
+// The UDP socket of a board stays open: it is still used for setup
+// (ARP entry, iptables rules, interface lookup) and its local port
+// identifies our traffic. Its receive side is shut down and filtered,
+// so the replies are not queued on it as well. Once set up, LBP16 packets go through an
+// AF_PACKET socket with mmap()ed TPACKET_V2 rx and tx rings instead:
+//
+//  - tx: the Ethernet, IPv4 and UDP headers are built from a template
+//    in the tx frame, behind which the LBP16 payload is placed. The
+//    qdisc layer is bypassed.
+//  - rx: a socket filter passes only UDP from the board to our port.
+//    Replies are awaited by polling the status word of the next rx
+//    frame from userland, so waiting for a reply costs no system calls
+//    and the payload is read in place.
+
+#include <stdint.h>
+#include <linux/if_packet.h>
+
+#define HM2_ETH_RING_FRAME_SIZE  2048
+#define HM2_ETH_RING_BLOCK_SIZE  4096
+#define HM2_ETH_RING_BLOCKS      8     // per ring: 16 frames each for rx and tx
+
+// Ethernet + IPv4 + UDP
+#define HM2_ETH_RING_HDR_SIZE (14 + 20 + 8)
+
+typedef struct {
+    int fd;                     // -1 if the ring transport is not in use
+    uint8_t *map;
+    size_t map_size;
+    uint8_t *rx, *tx;           // ring bases within map
+    unsigned frame_nr;          // frames per ring
+    unsigned rx_head, tx_head;
+    struct tpacket2_hdr *held;  // rx frame handed out by hm2_eth_ring_recv()
+    uint16_t ip_id;
+    uint8_t hdr[HM2_ETH_RING_HDR_SIZE]; // header template
+} hm2_eth_ring_t;
+
+// set up the ring transport for the connected UDP socket 'sockfd' on
+// interface 'ifname'. board_mac is the hardware address of the board.
+// returns 0 or -errno.
+int hm2_eth_ring_open(hm2_eth_ring_t *r, int sockfd, const char *ifname,
+                      const unsigned char board_mac[6]);
+void hm2_eth_ring_close(hm2_eth_ring_t *r);
+
+// send len bytes of LBP16 payload. returns len or -errno.
+int hm2_eth_ring_send(hm2_eth_ring_t *r, const void *buf, int len);
+
+// wait until rtapi_get_time() passes 'deadline' for a reply. On success
+// *payload points to the UDP payload within the rx frame and its length
+// is returned; the frame stays valid until the next recv or release.
+// returns -EAGAIN on timeout.
+int hm2_eth_ring_recv(hm2_eth_ring_t *r, const uint8_t **payload,
+                      long long deadline);
+
+// hand the held rx frame back to the kernel
+void hm2_eth_ring_release(hm2_eth_ring_t *r);
+
+#endif
@@ -421,6 +421,7 @@ static int hm2_parse_config_string(hostmot2_t *hm2, char *config_string) {
     hm2->config.enable_adc = 0;
     hm2->config.num_capsensors = -1;
     hm2->config.firmware = NULL;
+    hm2->config.tram_refresh = 0;
 
     if (config_string == NULL) return 0;
 
@@ -544,6 +545,10 @@ static int hm2_parse_config_string(hostmot2_t *hm2, char *config_string) {
 	} else if (strncmp(token, "nofwid", 6) == 0) {
             hm2->config.skip_fwid = 1;
 
+        } else if (strncmp(token, "tram_refresh=", 13) == 0) {
+            token += 13;
+            hm2->config.tram_refresh = simple_strtol(token, NULL, 0);
+
         } else if (strncmp(token, "firmware=", 9) == 0) {
             // FIXME: we leak this in hm2_register
             hm2->config.firmware = kstrdup(token + 9, GFP_KERNEL);
@@ -578,6 +583,7 @@ static int hm2_parse_config_string(hostmot2_t *hm2, char *config_string) {
     HM2_DBG("    num_uarts=%d\n", hm2->config.num_uarts);
     HM2_DBG("    num_pktuarts=%d\n", hm2->config.num_pktuarts);
     HM2_DBG("    num_dplls=%d\n",    hm2->config.num_dplls);
+    HM2_DBG("    tram_refresh=%d\n", hm2->config.tram_refresh);
     HM2_DBG("    num_leds=%d\n",    hm2->config.num_leds);
     HM2_DBG("    enable_raw=%d\n",   hm2->config.enable_raw);
     HM2_DBG("    enable_adc=%d\n",   hm2->config.enable_adc);
@@ -1916,6 +1922,7 @@ void rtapi_app_exit(void) {
 
 // this pushes our idea of what things are like into the FPGA's poor little mind
 void hm2_force_write(hostmot2_t *hm2) {
+    hm2->tram_refresh_count = 0;  // and all of the TRAM on the next write
     hm2_watchdog_force_write(hm2);
     hm2_ioport_force_write(hm2);
     hm2_encoder_force_write(hm2, &hm2->encoder);
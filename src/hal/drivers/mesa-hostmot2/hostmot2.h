@@ -1160,13 +1160,29 @@ typedef struct {
 // this struct hold an entry in our Translation RAM region list
 //
 
+// region flags
+#define HM2_TRAM_STATE 0x1  // rewriting unchanged contents has no effect,
+                            // see hm2_register_tram_write_state_region()
+
 typedef struct {
     u16 addr;
     u16 size;
+    u16 flags;
     u32 **buffer;
     struct list_head list;
 } hm2_tram_entry_t;
 
+//
+// adjacent regions are merged into bursts, one llio access each
+//
+
+typedef struct {
+    u16 addr;
+    u16 size;
+    u16 offset;  // into the TRAM read or write buffer
+    u16 flags;
+} hm2_tram_burst_t;
+
 
 
 
@@ -1200,6 +1216,8 @@ typedef struct {
         int num_capsensors;
         char *firmware;
 	int skip_fwid;  // skip applying the fwid proto message if set
+        int tram_refresh;  // >0: write state regions only if changed, and all
+                           // of them at least every tram_refresh cycles
     } config;
 
     char config_name[HM2_CONFIGNAME_LENGTH + 1];
@@ -1228,6 +1246,13 @@ typedef struct {
     u32 *tram_write_buffer;
     u16 tram_write_size;
 
+    hm2_tram_burst_t *tram_read_bursts;
+    int num_tram_read_bursts;
+    hm2_tram_burst_t *tram_write_bursts;
+    int num_tram_write_bursts;
+    u32 *tram_write_shadow;   // last written contents, with tram_refresh
+    int tram_refresh_count;   // cycles until all regions are written again
+
     // the hostmot2 "Functions"
     hm2_encoder_t encoder;
     hm2_encoder_t muxed_encoder;
@@ -1303,6 +1328,7 @@ int hm2_get_pktuart(hostmot2_t **hm2, char *name);
 
 int hm2_register_tram_read_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buffer);
 int hm2_register_tram_write_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buffer);
+int hm2_register_tram_write_state_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buffer);
 int hm2_allocate_tram_regions(hostmot2_t *hm2);
 int hm2_tram_read(hostmot2_t *hm2);
 
@@ -43,7 +43,7 @@
 // in the future this function will inform the Translation RAM
 //
 
-int hm2_register_tram_read_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buffer) {
+static int hm2_register_tram_region(hostmot2_t *hm2, struct list_head *entries, u16 addr, u16 size, u16 flags, u32 **buffer) {
     hm2_tram_entry_t *tram_entry;
 
     tram_entry = kmalloc(sizeof(hm2_tram_entry_t), GFP_KERNEL);
@@ -54,29 +54,92 @@ int hm2_register_tram_read_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buf
 
     tram_entry->addr = addr;
     tram_entry->size = size;
+    tram_entry->flags = flags;
     tram_entry->buffer = buffer;
 
-    list_add_tail(&tram_entry->list, &hm2->tram_read_entries);
+    list_add_tail(&tram_entry->list, entries);
 
     return 0;
 }
 
 
+int hm2_register_tram_read_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buffer) {
+    return hm2_register_tram_region(hm2, &hm2->tram_read_entries, addr, size, 0, buffer);
+}
+
+
 int hm2_register_tram_write_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buffer) {
-    hm2_tram_entry_t *tram_entry;
+    return hm2_register_tram_region(hm2, &hm2->tram_write_entries, addr, size, 0, buffer);
+}
 
-    tram_entry = kmalloc(sizeof(hm2_tram_entry_t), GFP_KERNEL);
-    if (tram_entry == NULL) {
-        HM2_ERR("out of memory!\n");
+
+//
+// Like hm2_register_tram_write_region(), for registers that just hold
+// a value: writing the value they already have is a no-op.  With the
+// tram_refresh config option, these are only written when they change.
+// Registers with side effects on write (FIFOs, command registers, the
+// watchdog reset) must not be registered this way.
+//
+
+int hm2_register_tram_write_state_region(hostmot2_t *hm2, u16 addr, u16 size, u32 **buffer) {
+    return hm2_register_tram_region(hm2, &hm2->tram_write_entries, addr, size, HM2_TRAM_STATE, buffer);
+}
+
+
+//
+// Merge the regions into as few llio accesses as possible.  Only regions
+// registered one after the other and exactly adjacent in the address
+// space are merged, so every register is still accessed exactly once
+// and in registration order.  Regions are not merged across gaps, since
+// reading or writing the registers in the gap may have side effects.
+//
+
+static int hm2_build_tram_bursts(hostmot2_t *hm2, struct list_head *entries, hm2_tram_burst_t **bursts, int *num_bursts) {
+    struct list_head *ptr;
+    hm2_tram_burst_t *b = NULL;
+    int n = 0;
+    u16 offset = 0;
+
+    list_for_each(ptr, entries) {
+        n ++;
+    }
+
+    if (n == 0) {
+        if (*bursts != NULL) kfree(*bursts);
+        *bursts = NULL;
+        *num_bursts = 0;
+        return 0;
+    }
+
+    *bursts = (hm2_tram_burst_t *)krealloc(*bursts, n * sizeof(hm2_tram_burst_t), GFP_KERNEL);
+    if (*bursts == NULL) {
+        HM2_ERR("Error while (re)allocating Translation RAM bursts (%d regions)\n", n);
+        *num_bursts = 0;
         return -ENOMEM;
     }
 
-    tram_entry->addr = addr;
-    tram_entry->size = size;
-    tram_entry->buffer = buffer;
+    n = 0;
+    list_for_each(ptr, entries) {
+        hm2_tram_entry_t *tram_entry = list_entry(ptr, hm2_tram_entry_t, list);
 
-    list_add_tail(&tram_entry->list, &hm2->tram_write_entries);
+        if (
+            (b != NULL)
+            && (tram_entry->flags == b->flags)
+            && (tram_entry->addr == b->addr + b->size)
+            && (b->size + tram_entry->size <= 0xffff)
+        ) {
+            b->size += tram_entry->size;
+        } else {
+            b = &(*bursts)[n++];
+            b->addr = tram_entry->addr;
+            b->size = tram_entry->size;
+            b->offset = offset;
+            b->flags = tram_entry->flags;
+        }
+        offset += tram_entry->size;
+    }
 
+    *num_bursts = n;
     return 0;
 }
 
@@ -141,19 +204,43 @@ int hm2_allocate_tram_regions(hostmot2_t *hm2) {
         HM2_DBG("    addr=0x%04x, size=%d, buffer=%p\n", tram_entry->addr, tram_entry->size, *tram_entry->buffer);
     }
 
+    if (hm2_build_tram_bursts(hm2, &hm2->tram_read_entries, &hm2->tram_read_bursts, &hm2->num_tram_read_bursts) < 0) {
+        return -ENOMEM;
+    }
+    if (hm2_build_tram_bursts(hm2, &hm2->tram_write_entries, &hm2->tram_write_bursts, &hm2->num_tram_write_bursts) < 0) {
+        return -ENOMEM;
+    }
+    HM2_DBG(
+        "Translation RAM accesses per cycle: %d reads, %d writes\n",
+        hm2->num_tram_read_bursts,
+        hm2->num_tram_write_bursts
+    );
+
+    if (hm2->config.tram_refresh > 0) {
+        // the shadow starts out zero, and the first write after
+        // (re)allocating writes everything
+        hm2->tram_write_shadow = (u32 *)krealloc(hm2->tram_write_shadow, hm2->tram_write_size, GFP_KERNEL);
+        if (hm2->tram_write_shadow == NULL) {
+            HM2_ERR("Error while (re)allocating Translation RAM write shadow (%d bytes)\n", hm2->tram_write_size);
+            return -ENOMEM;
+        }
+        memset(hm2->tram_write_shadow, 0, hm2->tram_write_size);
+        hm2->tram_refresh_count = 0;
+    }
+
     return 0;
 }
 
 
 static u32 tram_read_iteration = 0;
 int hm2_tram_read(hostmot2_t *hm2) {
-    struct list_head *ptr;
+    int i;
 
-    list_for_each(ptr, &hm2->tram_read_entries) {
-        hm2_tram_entry_t *tram_entry = list_entry(ptr, hm2_tram_entry_t, list);
+    for (i = 0; i < hm2->num_tram_read_bursts; i ++) {
+        hm2_tram_burst_t *b = &hm2->tram_read_bursts[i];
 
-        if (!hm2->llio->queue_read(hm2->llio, tram_entry->addr, *tram_entry->buffer, tram_entry->size)) {
-            HM2_ERR("TRAM read error! (addr=0x%04x, size=%d, iter=%u)\n", tram_entry->addr, tram_entry->size, tram_read_iteration);
+        if (!hm2->llio->queue_read(hm2->llio, b->addr, (u8*)hm2->tram_read_buffer + b->offset, b->size)) {
+            HM2_ERR("TRAM read error! (addr=0x%04x, size=%d, iter=%u)\n", b->addr, b->size, tram_read_iteration);
             return -EIO;
         }
     }
@@ -191,15 +278,35 @@ int hm2_finish_read(hostmot2_t *hm2) {
 
 static u32 tram_write_iteration = 0;
 int hm2_tram_write(hostmot2_t *hm2) {
-    struct list_head *ptr;
+    int i;
+    int refresh = 1;
+
+    // with tram_refresh, unchanged state regions are skipped except
+    // every tram_refresh cycles, which bounds how long a lost write
+    // can go unnoticed
+    if ((hm2->config.tram_refresh > 0) && (hm2->tram_write_shadow != NULL)) {
+        refresh = (hm2->tram_refresh_count <= 0);
+        if (refresh) hm2->tram_refresh_count = hm2->config.tram_refresh;
+        hm2->tram_refresh_count --;
+    }
 
-    list_for_each(ptr, &hm2->tram_write_entries) {
-        hm2_tram_entry_t *tram_entry = list_entry(ptr, hm2_tram_entry_t, list);
+    for (i = 0; i < hm2->num_tram_write_bursts; i ++) {
+        hm2_tram_burst_t *b = &hm2->tram_write_bursts[i];
+        u8 *data = (u8*)hm2->tram_write_buffer + b->offset;
+
+        if (!refresh && (b->flags & HM2_TRAM_STATE)) {
+            u8 *shadow = (u8*)hm2->tram_write_shadow + b->offset;
+            if (memcmp(data, shadow, b->size) == 0) continue;
+        }
 
-        if (!hm2->llio->queue_write(hm2->llio, tram_entry->addr, *tram_entry->buffer, tram_entry->size)) {
-            HM2_ERR("TRAM write error! (addr=0x%04x, size=%d, iter=%u)\n", tram_entry->addr, tram_entry->size, tram_write_iteration);
+        if (!hm2->llio->queue_write(hm2->llio, b->addr, data, b->size)) {
+            HM2_ERR("TRAM write error! (addr=0x%04x, size=%d, iter=%u)\n", b->addr, b->size, tram_write_iteration);
             return -EIO;
         }
+
+        if ((hm2->tram_write_shadow != NULL) && (b->flags & HM2_TRAM_STATE)) {
+            memcpy((u8*)hm2->tram_write_shadow + b->offset, data, b->size);
+        }
     }
     tram_write_iteration ++;
 
@@ -235,5 +342,9 @@ void hm2_tram_cleanup(hostmot2_t *hm2) {
     // free the tram buffers
     if (hm2->tram_read_buffer != NULL) kfree(hm2->tram_read_buffer);
     if (hm2->tram_write_buffer != NULL) kfree(hm2->tram_write_buffer);
+    if (hm2->tram_write_shadow != NULL) kfree(hm2->tram_write_shadow);
+
+    if (hm2->tram_read_bursts != NULL) kfree(hm2->tram_read_bursts);
+    if (hm2->tram_write_bursts != NULL) kfree(hm2->tram_write_bursts);
 }
 
@@ -1012,6 +1012,8 @@ typedef struct {
     int cpu_id;
     rtapi_thread_flags_t flags;
     char cgname[RTAPI_LINELEN];
+    int workers;   // > 0: run independent functs in parallel on this many
+                   // extra tasks, pinned to cpu_id+1.. if cpu_id >= 0
 } hal_threadargs_t;
 
 #ifdef RTAPI
@@ -1086,6 +1088,9 @@ int hal_export_functf(void (*funct) (void *, long),
     hal_threadargs_t struct.  The struct contains the same data as
     the hal_create_thread() function, and also passes an integer cpu_id
     CPU affinity number (-1 for any) and rtapi_thread_flags_t flags.
+    If 'workers' is non-zero, the thread's functs are partitioned
+    into stages of functs which do not share signals or an owner; the
+    functs of a stage run in parallel on the thread and its workers.
 */
 
 int hal_create_xthread(const hal_threadargs_t *args);
@@ -569,6 +569,10 @@ int init_hal_data(void)
     rtapi_heap_setflags(&hal_data->heap, global_data->hal_heap_flags);
     hal_heap_addmem((size_t) (global_data->hal_size / HAL_HEAP_INITIAL));
 
+    // the name and id lookup indices live on the HAL heap
+    if (hal_objindex_init())
+	return -1;
+
     return 0;
 }
 #endif
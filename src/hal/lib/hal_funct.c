@@ -5,6 +5,7 @@
 #include "hal.h"		/* HAL public API decls */
 #include "hal_priv.h"		/* HAL private decls */
 #include "hal_internal.h"
+#include "hal_profile.h"
 
 static hal_funct_entry_t *alloc_funct_entry_struct(void);
 
@@ -123,6 +124,7 @@ static int halg_export_xfunctfv(const int use_hal_mutex,
 	nf->arg = xf->arg;
 	nf->type = xf->type;
 	nf->funct.l = xf->funct.l; // a bit of a cheat really
+	nf->batch = (xf->type == FS_XTHREADFUNC) ? xf->batch : NULL;
 
 	halg_add_object(false, (hal_object_ptr)nf);
     }
@@ -289,6 +291,12 @@ int hal_add_funct_to_thread(const char *funct_name,
 	if (funct_entry == 0)
 	    NOMEM("thread->function link");
 
+	// a histogram if the thread is profiled
+	if (hal_funct_entry_profile_init(thread, funct_entry)) {
+	    free_funct_entry_struct(funct_entry);
+	    return _halerrno;
+	}
+
 	/* init struct contents */
 	funct_entry->funct_ptr = SHMOFF(funct);
 	funct_entry->arg = funct->arg;
@@ -301,6 +309,14 @@ int hal_add_funct_to_thread(const char *funct_name,
 	dlist_add_after((hal_list_t *) funct_entry, list_entry);
 	/* update the function usage count */
 	funct->users++;
+
+	// and run it from the next cycle on
+	if (hal_thread_schedule(thread)) {
+	    dlist_remove_entry((hal_list_t *) funct_entry);
+	    free_funct_entry_struct(funct_entry);
+	    hal_thread_schedule(thread);
+	    return _halerrno;
+	}
     }
     return 0;
 }
@@ -355,7 +371,8 @@ int hal_del_funct_from_thread(const char *funct_name, const char *thread_name)
 		dlist_remove_entry(list_entry);
 		/* and delete it */
 		free_funct_entry_struct(funct_entry);
-		/* done */
+		/* done - on failure the thread walks the funct list */
+		hal_thread_schedule(thread);
 		return 0;
 	    }
 	    /* try next one */
@@ -381,6 +398,8 @@ static hal_funct_entry_t *alloc_funct_entry_struct(void)
 	p = shmalloc_rt(sizeof(hal_funct_entry_t));
 	l = (hal_list_t *) p;
 	dlist_init_entry(l);
+	if (p)
+	    p->profile_ptr = 0;
     }
     if (p) {
 	/* make sure it's empty */
@@ -435,6 +454,8 @@ static int thread_cb(hal_object_ptr o, foreach_args_t *args)
 	    list_entry = dlist_next(list_entry);
 	}
     }
+    // on failure the thread walks the funct list, carry on
+    hal_thread_schedule(thread);
     return 0;
 }
 
@@ -5,6 +5,7 @@
 #include "hal_priv.h"		/* HAL private decls */
 #include "hal_internal.h"
 #include "hal_group.h"		/* HAL group decls */
+#include "hal_vmatch.h"		/* vectorized change detection */
 
 #if defined(ULAPI)
 #include <stdlib.h>		/* malloc()/free() */
@@ -262,10 +263,29 @@ int halpr_group_compile(const char *name, hal_compiled_group_t **cgroup)
     // to cause a report, or only changed members should be included in a periodic report
     if ((grp->userarg2 & (GROUP_REPORT_ON_CHANGE|GROUP_REPORT_CHANGED_MEMBERS)) ||
 	(tc->n_monitored  > 0)) {
-	if ((tc->tracking =
-	     malloc(sizeof(hal_data_u) * tc->n_monitored )) == NULL)
+	hal_vmatch_src_t *vs;
+	int i, m = 0;
+
+	if ((vs = malloc(sizeof(hal_vmatch_src_t) * tc->n_monitored)) == NULL)
 	    NOMEM("allocating tracking values");
-	memset(tc->tracking, 0, sizeof(hal_data_u) * tc->n_monitored);
+	for (i = 0; i < tc->n_members; i++) {
+	    hal_member_t *mbr = tc->member[i];
+	    hal_sig_t *sig;
+
+	    if (!((mbr->userarg1 & MEMBER_MONITOR_CHANGE) ||
+		  (grp->userarg2 & GROUP_MONITOR_ALL_MEMBERS)))
+		continue;
+	    sig = SHMPTR(mbr->sig_ptr);
+	    vs[m].type = sig_type(sig);
+	    vs[m].index = i;
+	    vs[m].src = sig;
+	    vs[m].eps_index = &mbr->eps_index;
+	    m++;
+	}
+	tc->vm = hal_vmatch_new(vs, m, 0);
+	free(vs);
+	if (tc->vm == NULL)
+	    return _halerrno;
 	if ((tc->changed =
 	     malloc(RTAPI_BITMAP_BYTES(tc->n_members))) == NULL)
 	    NOMEM("allocating change bitmap");
@@ -273,7 +293,7 @@ int halpr_group_compile(const char *name, hal_compiled_group_t **cgroup)
     } else {
 	// nothing to track
 	tc->n_monitored = 0;
-	tc->tracking = NULL;
+	tc->vm = NULL;
 	tc->changed = NULL;
     }
 
@@ -289,13 +309,7 @@ int halpr_group_compile(const char *name, hal_compiled_group_t **cgroup)
 
 int hal_cgroup_match(hal_compiled_group_t *cg)
 {
-    int i, monitor, nchanged = 0, m = 0;
-    hal_object_ptr ho;
-    //    hal_sig_t *sig;
-    hal_bit_t halbit;
-    hal_s32_t hals32;
-    hal_u32_t halu32;
-    hal_float_t halfloat,delta;
+    int monitor;
 
     HAL_ASSERT(cg->magic == CGROUP_MAGIC);
 
@@ -303,61 +317,28 @@ int hal_cgroup_match(hal_compiled_group_t *cg)
     monitor = (cg->group->userarg2 & (GROUP_REPORT_ON_CHANGE|GROUP_REPORT_CHANGED_MEMBERS))
 	|| (cg->n_monitored > 0);
 
-    // walk the group if either the whole group is to be monitored for changes
-    // to cause a report, or only changed members should be included in a periodic
-    // report.
+    // scan the monitored members if either the whole group is to be monitored
+    // for changes to cause a report, or only changed members should be
+    // included in a periodic report.
     if (monitor) {
 	RTAPI_ZERO_BITMAP(cg->changed, cg->n_members);
-	for (i = 0; i < cg->n_members; i++) {
-	    if (!((cg->member[i]->userarg1 &  MEMBER_MONITOR_CHANGE) ||
-		  (cg->group->userarg2 &  GROUP_MONITOR_ALL_MEMBERS)))
-		continue;
-	    ho.any = SHMPTR(cg->member[i]->sig_ptr);
-	    switch (sig_type(ho.sig)) {
-	    case HAL_BIT:
-		halbit = _get_bit_sig(ho.sig);
-		if (get_bit_value(&cg->tracking[m]) != halbit) {
-		    nchanged++;
-		    RTAPI_BIT_SET(cg->changed, i);
-		    set_bit_value(&cg->tracking[m], halbit);
-		}
-		break;
-	    case HAL_FLOAT:
-		halfloat = _get_float_sig(ho.sig);
-		delta = HAL_FABS(halfloat - get_float_value(&cg->tracking[m]));
-		if (delta > hal_data->epsilon[cg->member[i]->eps_index]) {
-		    nchanged++;
-		    RTAPI_BIT_SET(cg->changed, i);
-		    set_float_value(&cg->tracking[m], halfloat);
-		}
-		break;
-	    case HAL_S32:
-		hals32 = _get_s32_sig(ho.sig);
-		if (get_s32_value(&cg->tracking[m]) != hals32) {
-		    nchanged++;
-		    RTAPI_BIT_SET(cg->changed, i);
-		    set_s32_value(&cg->tracking[m], hals32);
-		}
-		break;
-	    case HAL_U32:
-		halu32 = _get_u32_sig(ho.sig);
-		if (get_u32_value(&cg->tracking[m]) != halu32) {
-		    nchanged++;
-		    RTAPI_BIT_SET(cg->changed, i);
-		    set_u32_value(&cg->tracking[m], halu32);
-		}
-		break;
-	    default:
-		HALFAIL_RC(EINVAL, "BUG: detect_changes(%s): invalid type for signal %s: %d",
-		       ho_name(cg->group), ho_name(ho.sig), sig_type(ho.sig));
-	    }
-	    m++;
-	}
-	return nchanged;
+	return hal_vmatch_scan(cg->vm, cg->changed);
     } else
 	  return 1; // by default match
 }
 
+int hal_cgroup_match_values(hal_compiled_group_t *cg, const hal_data_u *values)
+{
+    HAL_ASSERT(cg->magic == CGROUP_MAGIC);
+
+    // same as hal_cgroup_match(), except for where values come from
+    if (cg->vm) {
+	RTAPI_ZERO_BITMAP(cg->changed, cg->n_members);
+	return hal_vmatch_scan_values(cg->vm, values, cg->changed);
+    } else
+	  return 1;
+}
+
 
 int hal_cgroup_report(hal_compiled_group_t *cg,
 		      group_report_callback_t report_cb,
@@ -378,6 +359,8 @@ int hal_cgroup_report(hal_compiled_group_t *cg,
 	!(cg->group->userarg2 & GROUP_REPORT_CHANGED_MEMBERS);
 
     for (i = 0; i < cg->n_members; i++) {
+	// lets the callback find the member, e.g. in a snapshot
+	cg->mbr_index = i;
 	if (reportall || RTAPI_BIT_TEST(cg->changed, i))
 	    if ((retval = report_cb(REPORT_SIGNAL, cg,
 				    SHMPTR(cg->member[i]->sig_ptr),
@@ -391,8 +374,7 @@ int hal_cgroup_free(hal_compiled_group_t *cgroup)
 {
     if (cgroup == NULL)
 	HALFAIL_RC(ENOENT, "null cgroup");
-    if (cgroup->tracking)
-	free(cgroup->tracking);
+    hal_vmatch_free(cgroup->vm);
     if (cgroup->changed)
 	free(cgroup->changed);
     if (cgroup->member)
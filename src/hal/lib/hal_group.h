@@ -3,6 +3,8 @@
 
 #include <rtapi.h>
 #include <hal_priv.h>
+#include <rtapi_bitops.h>
+#include <triple-buffer.h>
 
 RTAPI_BEGIN_DECLS
 
@@ -26,6 +28,8 @@ typedef struct hal_member {
     __u8 eps_index;             // index into haldata->epsilon[]; default 0
 } hal_member_t;
 
+struct hal_vmatch; // see hal_vmatch.h
+
 #define CGROUP_MAGIC  0xbeef7411
 typedef struct hal_compiled_group {
     int magic;
@@ -36,7 +40,7 @@ typedef struct hal_compiled_group {
     hal_member_t  **member;      // all members (nesting resolved)
     unsigned long *changed;      // bitmap
     int n_monitored;             // count of pins to monitor for change
-    hal_data_u    *tracking;     // tracking values of monitored pins
+    struct hal_vmatch *vm;       // tracking values of monitored members
     unsigned long user_flags;    // uninterpreted by HAL code
     void *user_data;             // uninterpreted by HAL code
 } hal_compiled_group_t;
@@ -99,9 +103,14 @@ static inline int hal_cgroup_timer(hal_compiled_group_t *cgroup)
 }
 extern int halpr_group_compile(const char *name, hal_compiled_group_t **cgroup);
 extern int hal_cgroup_match(hal_compiled_group_t *cgroup);
+// like hal_cgroup_match(), but matches values[i] for member[i] instead
+// of the signal values, e.g. those of a hal_group_snapshot_t
+extern int hal_cgroup_match_values(hal_compiled_group_t *cgroup,
+				   const hal_data_u *values);
 
 // given a cgroup which returned a non-zero value from hal_cgroup_match(),
 // generate a report.
+// during REPORT_SIGNAL, cgroup->mbr_index is the index of the member.
 // the report callback is called for the following phases:
 typedef enum {
     REPORT_BEGIN,
@@ -152,6 +161,11 @@ int demo_report(int phase, hal_compiled_group_t *cgroup, hal_sig_t *sig,
 #define GROUP_REPORT_CHANGED_MEMBERS 4
 // halcmd keyword: reportchanged reportall
 
+//              bit 3=1..haltalk sends MT_HALGROUP_PACKED_UPDATE messages
+//                     ..instead of per-signal updates, see message.proto
+#define GROUP_REPORT_PACKED 8
+// halcmd keyword: packed
+
 // the following combination of attributes makes no sense and will
 // cause an error message by hal_compile_group():
 // - the GROUP_REPORT_ON_CHANGE bit is set in group.arg2
@@ -184,6 +198,102 @@ int demo_report(int phase, hal_compiled_group_t *cgroup, hal_sig_t *sig,
 //                 (abs(value - previous-value) > hal_data->epsilon[eps_index]
 
 
+// RT change publication:
+//
+// instead of having the reporting entity poll and rescan a group with
+// hal_cgroup_match(), an instance of the grouppub RT component
+//
+//   newinst grouppub <instname> group=<group>
+//
+// does change detection in a thread funct, and writes one record per
+// cycle with changes into the record ring named GROUP_CHANGES_RING.
+// the ring's scratchpad is a hal_grouppub_t.
+//
+// change detection uses the same member selection and epsilon rules as
+// hal_cgroup_match(). The member index in a change refers to the
+// order of a HAL_MEMBER walk of the group, which is the order of
+// hal_compiled_group_t.member[]. The group is referenced while the
+// instance exists so it cannot change.
+//
+// wakeup: after publishing a record, the RT side bumps 'wakeup'. If
+// 'waiters' is nonzero it also issues a FUTEX_WAKE on 'wakeup', which
+// does not block. A reader announces itself in 'waiters', rechecks
+// 'wakeup', and FUTEX_WAITs on it.
+
+#define GROUP_CHANGES_RING "%s.changes"
+
+typedef struct {
+    __u32 active;        // set by the reader; scanning is skipped if zero
+    __u32 waiters;       // number of readers sleeping on 'wakeup'
+    __u32 wakeup;        // futex word, bumped after each record
+    __u32 serial;        // number of records written
+    __u32 overruns;      // cycles with changes the ring had no space for
+    __s32 n_members;     // members in the group
+    __s32 n_monitored;   // members scanned for change
+} hal_grouppub_t;
+
+typedef struct {
+    __u32 index;         // into hal_compiled_group_t.member[]
+    __u32 type;          // hal_type_t of the signal
+    hal_data_u value;    // value at the time of the change
+} hal_group_change_t;
+
+typedef struct {
+    __u32 serial;        // hal_grouppub_t.serial of this record
+    __u32 count;         // number of changes following
+    hal_group_change_t change[0];
+} hal_group_changes_t;
+
+// RT snapshots:
+//
+// hal_cgroup_match() reads the member signals one by one while RT
+// threads write them, so a report may mix values of different cycles.
+// An instance of the groupsnap RT component
+//
+//   newinst groupsnap <instname> group=<group> [every=<n>]
+//
+// copies all members of the group in a thread funct, every n-th cycle,
+// into a triple buffer in the scratchpad of the ring named
+// GROUP_SNAPSHOT_RING. The ring itself carries no records. A reader
+// takes the latest complete snapshot with rtapi_tb_snapshot() and
+// never waits for, or holds up, the RT side. Members written by other
+// threads are of course only as consistent as those threads make them.
+//
+// value[i] of a snapshot is the value of hal_compiled_group_t.member[i],
+// the order of a HAL_MEMBER walk of the group. The group is referenced
+// while the instance exists so it cannot change.
+
+#define GROUP_SNAPSHOT_RING "%s.snapshot"
+
+typedef struct {
+    __u32 serial;        // snapshot number, from 0
+    __u32 pad;
+    __s64 timestamp;     // fa_thread_start_time() of the cycle
+    hal_data_u value[0]; // member values
+} hal_group_snapshot_t;
+
+typedef struct {
+    __u32 active;        // set by the reader; copying is skipped if zero
+    __s32 n_members;     // members in the group
+    __u32 every;         // a snapshot every n-th cycle
+    __u32 bufsize;       // bytes per hal_group_snapshot_t, cache aligned
+    TB_FLAG_FAST(tb);    // triple buffer flag
+    char buf[0] __attribute__((aligned(RTAPI_CACHELINE)));
+                         // three buffers of bufsize bytes
+} hal_groupsnap_t;
+
+static inline size_t hal_group_snapshot_size(const int n_members)
+{
+    size_t size = sizeof(hal_group_snapshot_t) + n_members * sizeof(hal_data_u);
+    return RTAPI_CACHE_ALIGN(size);
+}
+
+static inline hal_group_snapshot_t *hal_groupsnap_buffer(hal_groupsnap_t *gs,
+							 const int idx)
+{
+    return (hal_group_snapshot_t *)(gs->buf + idx * gs->bufsize);
+}
+
 static inline hal_group_t *halpr_find_group_by_name(const char *name){
     return halg_find_object_by_name(0, HAL_GROUP, name).group;
 }
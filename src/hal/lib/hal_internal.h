@@ -55,6 +55,17 @@ void free_group_struct(hal_group_t * group);
 int pin_by_signal_callback(hal_object_ptr o, foreach_args_t *args);
 
 void free_thread_struct(hal_thread_t * thread);
+
+// compile a thread's funct list into the schedule run by thread_task()
+// must be called with the HAL mutex held
+int hal_thread_schedule(hal_thread_t *thread);
+int hal_thread_schedule_all(void);
+// partition a schedule of a thread with workers into stages, see hal_parallel.c
+int hal_schedule_stages(hal_schedule_t *sched);
+// refuse linking a pin whose stages are in use, see hal_parallel.c
+int hal_parallel_link_check(const hal_pin_t *pin);
+// recompute the stages a pin was unlinked from
+void hal_parallel_unlinked(const hal_pin_t *pin);
 extern int lib_module_id;
 extern int lib_mem_id;
 
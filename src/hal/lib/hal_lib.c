@@ -63,6 +63,7 @@
 #include "hal_priv.h"		/* HAL private decls */
 #include "hal_internal.h"
 #include "hal_iring.h"
+#include "hal_profile.h"
 
 #include "rtapi_string.h"
 #include "rtapi_flavor.h"       // flavor_descriptor
@@ -465,6 +466,12 @@ EXPORT_SYMBOL(hal_thread_delete);
 EXPORT_SYMBOL(hal_start_threads);
 EXPORT_SYMBOL(hal_stop_threads);
 
+// hal_profile.c:
+EXPORT_SYMBOL(halg_thread_profile);
+EXPORT_SYMBOL(halg_thread_profile_reset);
+EXPORT_SYMBOL(hal_profhist_snapshot);
+EXPORT_SYMBOL(hal_profhist_percentile);
+
 // hal_inst.c:
 EXPORT_SYMBOL(halg_inst_create);
 EXPORT_SYMBOL(halg_inst_delete);
@@ -155,6 +155,8 @@ void report_heapstatus(const char *tag,  struct rtapi_heap *h)
 	       hs.requested, hs.allocated, hs.freed,
 	       hs.allocated ?
 	       (hs.allocated - hs.requested)*100/hs.allocated : 0);
+	HALDBG("  slabs: carved=%zu avail=%zu\n",
+	       hs.slab_carved, hs.slab_avail);
 }
 
 void report_memory_usage(void)
@@ -177,6 +179,14 @@ void report_memory_usage(void)
 	       hal_data->hal_malloced);
 	HALDBG("  unused:   %ld\n",
 	       (long)( hal_data->shmem_top - hal_data->shmem_bot));
+	HALDBG("  name index: entries=%u buckets=%u resizes=%u\n",
+	       hal_data->name_index.entries,
+	       hal_data->name_index.nbuckets,
+	       hal_data->name_index.resizes);
+	HALDBG("  id index:   entries=%u buckets=%u resizes=%u\n",
+	       hal_data->id_index.entries,
+	       hal_data->id_index.nbuckets,
+	       hal_data->id_index.resizes);
 
 }
 
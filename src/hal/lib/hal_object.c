@@ -164,41 +164,178 @@ void *halg_create_objectfv(const bool use_hal_mutex,
 }
 
 
-// iterator callback for halg_add_object()
-// determines insertion point
-static int find_previous(hal_object_ptr o, foreach_args_t *args)
+// object indices - see hal_objindex_t in hal_object.h
+//
+// bucket arrays and chain links are shm offsets, so the indices are
+// usable from any process which has the HAL segment attached.
+
+#define NAME_LINK offsetof(halhdr_t, _name_next)
+#define ID_LINK   offsetof(halhdr_t, _id_next)
+
+typedef __u32 (*hh_hash_t)(const halhdr_t *hh);
+
+// FNV-1a over the name, seeded with the object type
+static inline __u32 name_hash(const int type, const char *name)
+{
+    __u32 h = (2166136261U ^ (__u32) type) * 16777619U;
+    while (*name) {
+	h ^= (unsigned char) *name++;
+	h *= 16777619U;
+    }
+    return h;
+}
+
+// ids are handed out sequentially by rtapi_next_handle(),
+// a multiplicative hash spreads them well enough
+static inline __u32 id_hash(const int id)
+{
+    return (__u32) id * 2654435761U;
+}
+
+static __u32 hh_name_hash(const halhdr_t *hh)
+{
+    return name_hash(hh_get_object_type(hh), hh_get_name(hh));
+}
+
+static __u32 hh_id_hash(const halhdr_t *hh)
+{
+    return id_hash(hh_get_id(hh));
+}
+
+static inline shmoff_t *hh_link(const halhdr_t *hh, const size_t link)
+{
+    return (shmoff_t *)((char *)hh + link);
+}
+
+static inline shmoff_t *objindex_bucket(const hal_objindex_t *oi,
+					const __u32 hash)
+{
+    shmoff_t *buckets = SHMPTR(oi->buckets);
+    return &buckets[hash & (oi->nbuckets - 1)];
+}
+
+// append hh at the tail of chain at *pos - this keeps insertion order
+static void chain_append(shmoff_t *pos, const size_t link, halhdr_t *hh)
+{
+    while (*pos)
+	pos = hh_link(SHMPTR(*pos), link);
+    *hh_link(hh, link) = 0;
+    *pos = SHMOFF(hh);
+}
+
+static int objindex_alloc(hal_objindex_t *oi, const __u32 nbuckets)
+{
+    shmoff_t *buckets = shmalloc_desc(nbuckets * sizeof(shmoff_t));
+    if (buckets == NULL)
+	return -ENOMEM;
+    oi->buckets = SHMOFF(buckets);
+    oi->nbuckets = nbuckets;
+    return 0;
+}
+
+// rehash into a bucket array of nbuckets size.
+// on allocation failure keep the current array - chains just get longer.
+static void objindex_resize(hal_objindex_t *oi,
+			    const size_t link,
+			    const hh_hash_t hash,
+			    const __u32 nbuckets)
+{
+    hal_objindex_t old = *oi;
+    shmoff_t *obuckets = SHMPTR(old.buckets);
+    __u32 i;
+
+    if (objindex_alloc(oi, nbuckets)) {
+	HALDBG("index resize to %u buckets failed, keeping %u",
+	       nbuckets, old.nbuckets);
+	*oi = old;
+	return;
+    }
+    for (i = 0; i < old.nbuckets; i++) {
+	shmoff_t next = obuckets[i];
+	while (next) {
+	    halhdr_t *hh = SHMPTR(next);
+	    next = *hh_link(hh, link);
+	    chain_append(objindex_bucket(oi, hash(hh)), link, hh);
+	}
+    }
+    oi->resizes++;
+    shmfree_desc(obuckets);
+}
+
+static void objindex_insert(hal_objindex_t *oi,
+			    const size_t link,
+			    const hh_hash_t hash,
+			    halhdr_t *hh)
+{
+    if (oi->buckets == 0)
+	return;
+    chain_append(objindex_bucket(oi, hash(hh)), link, hh);
+    oi->entries++;
+    if (oi->entries > oi->nbuckets)
+	objindex_resize(oi, link, hash, oi->nbuckets * 2);
+}
+
+// remove hh from an index. Objects which never were added are ignored.
+static void objindex_remove(hal_objindex_t *oi,
+			    const size_t link,
+			    const hh_hash_t hash,
+			    halhdr_t *hh)
+{
+    if (oi->buckets == 0)
+	return;
+    shmoff_t *pos = objindex_bucket(oi, hash(hh));
+    while (*pos) {
+	if (*pos == SHMOFF(hh)) {
+	    *pos = *hh_link(hh, link);
+	    *hh_link(hh, link) = 0;
+	    oi->entries--;
+	    return;
+	}
+	pos = hh_link(SHMPTR(*pos), link);
+    }
+}
+
+int hal_objindex_init(void)
 {
-    hal_object_ptr new = (hal_object_ptr) args->user_ptr1;
-
-    // compare the name of the current object to the name of
-    // the object to be inserted:
-    int ret = strcmp(hh_get_name(new.hdr), hh_get_name(o.hdr));
-    if (ret < 0) {
-	// advance point of insertion:
-	args->user_ptr2 = (void *)&o.hdr->list;
-	return 1; // stop iteration
+    if (objindex_alloc(&hal_data->name_index, HAL_OBJINDEX_INITIAL) ||
+	objindex_alloc(&hal_data->id_index, HAL_OBJINDEX_INITIAL)) {
+	HALFAIL_RC(ENOMEM, "cant allocate object indices");
     }
-    return 0; // continue iteration
+    return 0;
 }
 
+
 void halg_add_object(const bool use_hal_mutex,
 		     hal_object_ptr o)
 {
-    // args.user_ptr2 is the potential point of insertion
-    // for the new object within the object list.
-    // start at head, and iterate over objects of the same type.
-    foreach_args_t args =  {
-	// visit objects of the same type as the one to be inserted:
-	.type = hh_get_object_type(o.hdr),
-	// object to be inserted
-	.user_ptr1 = o.any,
-	// current head
-	.user_ptr2 = OBJECTLIST,
-    };
-    halg_foreach(0, &args, find_previous);
-    // insert new object after the new insertion point.
-    // if nothing found, insert after head.
-    dlist_add_before(&o.hdr->list, args.user_ptr2);
+    // all objects of the same type are kept sorted by name.
+    // find the insertion point by walking backwards from the tail:
+    // objects are mostly created in ascending name order, so this
+    // usually terminates after a few steps instead of visiting
+    // the whole list.
+    const __u32 type = hh_get_object_type(o.hdr);
+    const char *name = hh_get_name(o.hdr);
+    hal_list_t *where = OBJECTLIST;  // default: at tail
+    hal_list_t *pos;
+
+    for (pos = dlist_prev(OBJECTLIST);
+	 pos != OBJECTLIST;
+	 pos = dlist_prev(pos)) {
+	halhdr_t *hh = (halhdr_t *) pos;  // list is first member
+
+	if (!hh_is_valid(hh) || (hh_get_object_type(hh) != type))
+	    continue;
+	if (strcmp(name, hh_get_name(hh)) >= 0)
+	    break;
+	where = pos;
+    }
+    // insert new object before the first one of
+    // the same type whose name compares greater
+    dlist_add_before(&o.hdr->list, where);
+
+    // enter into the lookup indices
+    objindex_insert(&hal_data->name_index, NAME_LINK, hh_name_hash, o.hdr);
+    objindex_insert(&hal_data->id_index, ID_LINK, hh_id_hash, o.hdr);
 
     // make sure all values visible everywhere
     rtapi_smp_mb();
@@ -216,6 +353,10 @@ int halg_free_object(const bool use_hal_mutex,
 		   hh_get_refcnt(o.hdr));
     }
 
+    // drop from the lookup indices while name and id are still intact
+    objindex_remove(&hal_data->name_index, NAME_LINK, hh_name_hash, o.hdr);
+    objindex_remove(&hal_data->id_index, ID_LINK, hh_id_hash, o.hdr);
+
     // zap the header, including valid bit
     // marks object for garbage collection by halg_sweep()
     hh_clear_hdr(o.hdr);
@@ -428,6 +569,10 @@ int halg_object_setbarriers(const int use_hal_mutex,
 	// if setting barriers on signal, propagate to pins:
 	if (hh_get_object_type(o.hdr) == HAL_SIGNAL)
 	    halg_signal_propagate_barriers(0, o.sig);
+
+	// funct barriers are compiled into thread schedules
+	if ((hh_get_object_type(o.hdr) == HAL_FUNCT) && o.funct->users)
+	    hal_thread_schedule_all();
     }
     return 0;
 }
@@ -436,12 +581,30 @@ hal_object_ptr halg_find_object_by_name(const int use_hal_mutex,
 					const int type,
 					const char *name)
 {
-    foreach_args_t args =  {
-	.type = type,
-	.name = (char *)name,
-    };
-    if (halg_foreach(use_hal_mutex, &args, yield_match))
-	return (hal_object_ptr) args.user_ptr1;
+    // untyped lookups are not indexed, walk the list
+    if ((type == 0) || (name == NULL) || (hal_data->name_index.buckets == 0)) {
+	foreach_args_t args =  {
+	    .type = type,
+	    .name = (char *)name,
+	};
+	if (halg_foreach(use_hal_mutex, &args, yield_match))
+	    return (hal_object_ptr) args.user_ptr1;
+	return HO_NULL;
+    }
+    {
+	WITH_HAL_MUTEX_IF(use_hal_mutex);
+
+	shmoff_t next = *objindex_bucket(&hal_data->name_index,
+					 name_hash(type, name));
+	while (next) {
+	    halhdr_t *hh = SHMPTR(next);
+	    if (hh_is_valid(hh) &&
+		(hh_get_object_type(hh) == type) &&
+		!strcmp(hh_get_name(hh), name))
+		return (hal_object_ptr) hh;
+	    next = hh->_name_next;
+	}
+    }
     return HO_NULL;
 }
 
@@ -449,11 +612,27 @@ hal_object_ptr halg_find_object_by_id(const int use_hal_mutex,
 				      const int type,
 				      const int id)
 {
-    foreach_args_t args =  {
-	.type = type,
-	.id = id
-    };
-    if (halg_foreach(use_hal_mutex, &args, yield_match) == 1)
-	return (hal_object_ptr) args.user_ptr1;
+    if ((id == 0) || (hal_data->id_index.buckets == 0)) {
+	foreach_args_t args =  {
+	    .type = type,
+	    .id = id
+	};
+	if (halg_foreach(use_hal_mutex, &args, yield_match) == 1)
+	    return (hal_object_ptr) args.user_ptr1;
+	return HO_NULL;
+    }
+    {
+	WITH_HAL_MUTEX_IF(use_hal_mutex);
+
+	shmoff_t next = *objindex_bucket(&hal_data->id_index, id_hash(id));
+	while (next) {
+	    halhdr_t *hh = SHMPTR(next);
+	    if (hh_is_valid(hh) &&
+		(hh_get_id(hh) == id) &&
+		((type == 0) || (hh_get_object_type(hh) == type)))
+		return (hal_object_ptr) hh;
+	    next = hh->_id_next;
+	}
+    }
     return HO_NULL;
 }
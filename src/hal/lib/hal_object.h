@@ -52,10 +52,41 @@ typedef struct halhdr {
                                        // operating on this object
     __u32    _wmb    : 1;              // issue a writer barrier after
                                        // operating on this object
+
+    // hash chain links of the object indices (see hal_objindex_t below)
+    // offsets of the next halhdr_t in the same bucket, 0 terminates the chain
+    shmoff_t _name_next;
+    shmoff_t _id_next;
 } halhdr_t;
 
 #define OBJECTLIST (&hal_data->halobjects)  // head of all named HAL objects
 
+// hashed indices over the object list.
+//
+// halg_find_object_by_name() and halg_find_object_by_id() used to walk
+// the complete OBJECTLIST doing a strcmp() on every header, which made
+// config loading with tens of thousands of pins quadratic.
+//
+// Objects are entered into two offset-based hash tables living in the
+// HAL heap as they are added by halg_add_object(), and removed
+// by halg_free_object() (before the header - including the id - is zapped):
+//
+//  - the name index is keyed on (object type, name)
+//  - the id index is keyed on the object id only
+//
+// chains preserve insertion order, so with duplicate names the object
+// found is the same one a list walk would have found first.
+// The bucket array doubles when the load factor exceeds one.
+// As everything else in HAL, access is protected by the HAL mutex.
+#define HAL_OBJINDEX_INITIAL   256    // initial number of buckets, power of 2
+
+typedef struct hal_objindex {
+    shmoff_t buckets;       // offset of shmoff_t[nbuckets] on HAL heap
+    __u32    nbuckets;      // always a power of 2
+    __u32    entries;       // current number of objects indexed
+    __u32    resizes;       // number of rehash operations so far
+} hal_objindex_t;
+
 // accessors for common HAL object attributes
 // no locking - caller is expected to aquire the HAL mutex with WITH_HAL_MUTEX()
 
@@ -161,16 +192,22 @@ static inline void *halg_create_objectf(const bool use_hal_mutex,
 
 // adds a HAL object into the object list with partial ordering:
 // all objects of the same type will be kept sorted by name.
+// also enters the object into the name and id indices.
 void halg_add_object(const bool use_hal_mutex,  hal_object_ptr o);
 
 // free a HAL object
-// invalidates the object, and marks it for deletion by halg_sweep().
+// removes it from the indices, invalidates the object,
+// and marks it for deletion by halg_sweep().
 // returns -EBUSY if reference count not zero.
 int halg_free_object(const bool use_hal_mutex, hal_object_ptr o);
 
 // HAL objects garbage collector. Run every now and then.
 int hal_sweep(void);
 
+// allocate the initial bucket arrays of the object indices.
+// called once by init_hal_data() with the HAL mutex held.
+int hal_objindex_init(void);
+
 // set barriers on an aribtrary HAL object
 int halg_object_setbarriers(const int use_hal_mutex,
 			    hal_object_ptr o,
@@ -0,0 +1,301 @@
+// HAL parallel threads: partition a thread schedule into stages
+//
+// functs do not declare what they read or write, so dependencies are
+// derived from the pins owned by the funct's owner (instance or legacy
+// comp): IN pins read, OUT pins write, IO pins do both the signal they
+// are linked to. A funct is placed in the first stage after every
+// earlier funct in the thread it conflicts with:
+//  - same owner (functs of an instance share its state)
+//  - it reads a signal an earlier funct writes
+//  - it writes a signal an earlier funct reads or writes
+// functs within a stage are independent and may run concurrently,
+// and keep their relative thread order.
+//
+// stages are computed when threads are started, and when the funct
+// list of a running thread changes; a stopped thread runs serially.
+// Linking a pin adds a dependency the stages of a running thread do
+// not reflect, so it is refused while a thread with workers runs a
+// funct of the pin's owner - see hal_parallel_link_check(). Unlinking
+// only removes one, the stages are recomputed.
+
+#include "config.h"
+#include "rtapi.h"		/* RTAPI realtime OS API */
+#include "hal.h"		/* HAL public API decls */
+#include "hal_priv.h"		/* HAL private decls */
+#include "hal_internal.h"
+
+#include <stdlib.h>		/* malloc()/free()/qsort() */
+
+typedef struct {
+    int sig;        // signal offset
+    int owner;      // index into owner table
+    int dir;        // HAL_IN, HAL_OUT, HAL_IO
+} access_t;
+
+typedef struct {
+    int sig;
+    int last_read;  // highest stage reading the signal so far, -1: none
+    int last_write; // highest stage writing the signal so far, -1: none
+} sigstage_t;
+
+typedef struct {
+    int owner_id;
+    int last;       // highest stage of a funct of this owner so far
+    int first;      // first access of this owner after bucketing
+    int naccess;
+} ownerstage_t;
+
+typedef struct {
+    ownerstage_t *owners;
+    int nowners;
+    int *owner_map;  // owner id - min_id -> index into owners, -1: none
+    int min_id, max_id;
+    access_t *access;
+    int naccess;
+} scan_t;
+
+static int owner_index(const scan_t *sc, const int owner_id)
+{
+    if ((owner_id < sc->min_id) || (owner_id > sc->max_id))
+	return -1;
+    return sc->owner_map[owner_id - sc->min_id];
+}
+
+static int access_by_sig(const void *a, const void *b)
+{
+    const access_t *aa = a, *ab = b;
+    return (aa->sig > ab->sig) - (aa->sig < ab->sig);
+}
+
+// collect the signal accesses of the pins owned by a funct owner
+static int scan_pin(hal_object_ptr o, foreach_args_t *args)
+{
+    scan_t *sc = args->user_ptr1;
+    hal_pin_t *pin = o.pin;
+
+    if (pin->_signal == 0)
+	return 0;
+    int owner = owner_index(sc, ho_owner_id(pin));
+    if (owner < 0)
+	return 0;
+    if (sc->access) {
+	access_t *a = &sc->access[sc->naccess];
+	a->sig = pin->_signal;
+	a->owner = owner;
+	a->dir = pin->dir;
+    }
+    sc->naccess++;
+    return 0;
+}
+
+static int max(const int a, const int b)
+{
+    return a > b ? a : b;
+}
+
+// reorder the entries of a schedule compiled in thread order into stages
+// and fill in the stage ends. must be called with the HAL mutex held.
+// the scratch arrays are process-local, only the schedule is in HAL memory.
+int hal_schedule_stages(hal_schedule_t *sched)
+{
+    const int n = sched->nfuncts;
+    scan_t sc = {};
+    access_t *bucketed = NULL;
+    sigstage_t *sigs = NULL;
+    int *stage = NULL, *funct_owner = NULL;
+    hal_sched_entry_t *copy = NULL;
+    int i, j, k, nsigs = 0, retval = -ENOMEM;
+
+    sched->nstages = 0;
+    if (n == 0)
+	return 0;
+    if (n > PAR_MAX_FUNCTS)
+	HALFAIL_RC(E2BIG, "too many functs for a parallel thread: %d", n);
+
+    sc.owners = malloc(n * sizeof(ownerstage_t));
+    funct_owner = malloc(n * sizeof(int));
+    stage = malloc(n * sizeof(int));
+    copy = malloc(n * sizeof(hal_sched_entry_t));
+    if (!sc.owners || !funct_owner || !stage || !copy)
+	goto out;
+
+    // object ids are handed out sequentially, so the owner ids of a
+    // thread span at most the ids issued so far: map them directly
+    for (i = 0; i < n; i++) {
+	hal_funct_t *funct = SHMPTR(sched->entry[i].funct_ptr);
+	funct_owner[i] = ho_owner_id(funct);
+	if ((i == 0) || (funct_owner[i] < sc.min_id))
+	    sc.min_id = funct_owner[i];
+	if ((i == 0) || (funct_owner[i] > sc.max_id))
+	    sc.max_id = funct_owner[i];
+    }
+    sc.owner_map = malloc((sc.max_id - sc.min_id + 1) * sizeof(int));
+    if (!sc.owner_map)
+	goto out;
+    for (i = 0; i <= sc.max_id - sc.min_id; i++)
+	sc.owner_map[i] = -1;
+
+    // from here on: index into owners
+    for (i = 0; i < n; i++) {
+	int id = funct_owner[i];
+	int o = owner_index(&sc, id);
+	if (o < 0) {
+	    o = sc.nowners++;
+	    sc.owners[o].owner_id = id;
+	    sc.owners[o].last = -1;
+	    sc.owners[o].naccess = 0;
+	    sc.owner_map[id - sc.min_id] = o;
+	}
+	funct_owner[i] = o;
+    }
+
+    // count, then collect signal accesses of the funct owners
+    foreach_args_t args =  {
+	.type = HAL_PIN,
+	.user_ptr1 = &sc,
+    };
+    halg_foreach(0, &args, scan_pin);
+    if (sc.naccess) {
+	sc.access = malloc(sc.naccess * sizeof(access_t));
+	bucketed = malloc(sc.naccess * sizeof(access_t));
+	sigs = malloc(sc.naccess * sizeof(sigstage_t));
+	if (!sc.access || !bucketed || !sigs)
+	    goto out;
+	sc.naccess = 0;
+	halg_foreach(0, &args, scan_pin);
+    }
+
+    // map signals to stage records: sorted by signal, accesses to the
+    // same signal are adjacent
+    if (sc.naccess)
+	qsort(sc.access, sc.naccess, sizeof(access_t), access_by_sig);
+    for (i = 0; i < sc.naccess; i++) {
+	access_t *a = &sc.access[i];
+	if ((nsigs == 0) || (a->sig != sigs[nsigs - 1].sig)) {
+	    sigs[nsigs].sig = a->sig;
+	    sigs[nsigs].last_read = sigs[nsigs].last_write = -1;
+	    nsigs++;
+	}
+	a->sig = nsigs - 1; // from here on: index into sigs
+    }
+
+    // bucket accesses by owner
+    for (i = 0; i < sc.naccess; i++)
+	sc.owners[sc.access[i].owner].naccess++;
+    for (i = 0, k = 0; i < sc.nowners; i++) {
+	sc.owners[i].first = k;
+	k += sc.owners[i].naccess;
+	sc.owners[i].naccess = 0;
+    }
+    for (i = 0; i < sc.naccess; i++) {
+	access_t *a = &sc.access[i];
+	ownerstage_t *os = &sc.owners[a->owner];
+	bucketed[os->first + os->naccess++] = *a;
+    }
+
+    // assign stages in thread order
+    for (i = 0; i < n; i++) {
+	ownerstage_t *os = &sc.owners[funct_owner[i]];
+	access_t *a = &bucketed[os->first];
+	access_t *end = a + os->naccess;
+	int s = os->last + 1;
+
+	for (; a < end; a++) {
+	    sigstage_t *sg = &sigs[a->sig];
+	    s = max(s, sg->last_write + 1);
+	    if (a->dir != HAL_IN)
+		s = max(s, sg->last_read + 1);
+	}
+	stage[i] = s;
+	os->last = max(os->last, s);
+	for (a = &bucketed[os->first]; a < end; a++) {
+	    sigstage_t *sg = &sigs[a->sig];
+	    if (a->dir != HAL_OUT)
+		sg->last_read = max(sg->last_read, s);
+	    if (a->dir != HAL_IN)
+		sg->last_write = max(sg->last_write, s);
+	}
+	sched->nstages = max(sched->nstages, s + 1);
+    }
+
+    // stable reorder by stage
+    int *stage_end = schedule_stage_end(sched);
+    memcpy(copy, sched->entry, n * sizeof(hal_sched_entry_t));
+    for (k = 0, j = 0; k < sched->nstages; k++) {
+	for (i = 0; i < n; i++)
+	    if (stage[i] == k)
+		sched->entry[j++] = copy[i];
+	stage_end[k] = j;
+    }
+    HALDBG("%d functs in %d stages, %d signal accesses",
+	   n, sched->nstages, sc.naccess);
+    retval = 0;
+
+ out:
+    if (retval)
+	sched->nstages = 0;
+    free(sc.owners);
+    free(sc.owner_map);
+    free(sc.access);
+    free(bucketed);
+    free(sigs);
+    free(funct_owner);
+    free(stage);
+    free(copy);
+    if (retval)
+	HALFAIL_RC(ENOMEM, "insufficient memory for stage analysis");
+    return 0;
+}
+
+static int owner_funct_cb(hal_object_ptr o, foreach_args_t *args)
+{
+    hal_thread_t *thread = o.thread;
+    hal_list_t *list_root = &(thread->funct_list);
+    hal_list_t *list_entry;
+
+    if (!thread->parallel_ptr)
+	return 0;
+    for (list_entry = dlist_next(list_root);
+	 list_entry != list_root;
+	 list_entry = dlist_next(list_entry)) {
+	hal_funct_t *funct =
+	    SHMPTR(((hal_funct_entry_t *) list_entry)->funct_ptr);
+	if (ho_owner_id(funct) == args->user_arg1) {
+	    args->user_ptr1 = thread;
+	    return 1;
+	}
+    }
+    return 0;
+}
+
+// the thread with workers running a funct of the owner of pin, if any
+static hal_thread_t *parallel_thread_of(const hal_pin_t *pin)
+{
+    foreach_args_t args =  {
+	.type = HAL_THREAD,
+	.user_arg1 = ho_owner_id(pin),
+    };
+    if (!hal_data->threads_running)
+	return NULL;
+    halg_foreach(0, &args, owner_funct_cb);
+    return args.user_ptr1;
+}
+
+int hal_parallel_link_check(const hal_pin_t *pin)
+{
+    hal_thread_t *thread = parallel_thread_of(pin);
+
+    if (thread) {
+	HALFAIL_RC(EBUSY, "pin '%s': cannot link while thread '%s' "
+		   "with workers is running", ho_name(pin), ho_name(thread));
+    }
+    return 0;
+}
+
+void hal_parallel_unlinked(const hal_pin_t *pin)
+{
+    hal_thread_t *thread = parallel_thread_of(pin);
+
+    if (thread)
+	hal_thread_schedule(thread);
+}
@@ -198,6 +198,8 @@ typedef struct {
     int shmem_top;		/* top of free shmem (1 past last free) */
 
     hal_list_t halobjects;       // list of all named HAL objects
+    hal_objindex_t name_index;   // hashed by (type, name), see hal_object.h
+    hal_objindex_t id_index;     // hashed by object id
     hal_list_t threads;          // list of threads in ascending priority
     hal_list_t funct_entry_free; // list of free funct entry structs
 
@@ -537,6 +539,13 @@ typedef void (*legacy_funct_t) (void *, long);
 typedef int  (*xthread_funct_t) (void *, const hal_funct_args_t *);
 typedef int  (*userland_funct_t) (const hal_funct_args_t *);
 
+// optional companion of an FS_XTHREADFUNC funct: does what n calls of
+// the funct with args[0..n-1] would do. Adjacent functs of a serial
+// thread sharing the same batch funct are run by a single call of it,
+// see hal_thread_schedule(). fa->funct is the first funct of the batch.
+typedef int  (*batch_funct_t) (void * const *args, const int n,
+			       const hal_funct_args_t *fa);
+
 typedef union {
     legacy_funct_t   l;       // FS_LEGACY_THREADFUNC
     xthread_funct_t  x;       // FS_XTHREADFUNC
@@ -551,6 +560,7 @@ typedef struct hal_export_xfunct_args {
     int uses_fp;
     int reentrant;
     int owner_id;
+    batch_funct_t batch;        // optional, FS_XTHREADFUNC only
 } hal_export_xfunct_args_t;
 
 int hal_export_xfunctf( const hal_export_xfunct_args_t *xf, const char *fmt, ...);
@@ -569,6 +579,7 @@ typedef struct hal_funct {
     int uses_fp;		/* floating point flag */
     int reentrant;		/* non-zero if function is re-entrant */
     int users;			/* number of threads using function */
+    batch_funct_t batch;        // NULL: cannot be batched
 } hal_funct_t;
 
 typedef struct hal_funct_entry {
@@ -580,8 +591,70 @@ typedef struct hal_funct_entry {
     void *arg;			/* argument for function */
     hal_funct_u funct;          // ptr to function code
     int funct_ptr;		/* pointer to function */
+    int profile_ptr;            // hal_profhist_t if thread profiled, else 0
+                                // stays with the entry when recycled
 } hal_funct_entry_t;
 
+// the funct list of a thread compiled into a contiguous array which
+// thread_task() runs down, instead of chasing the funct_list links.
+// rebuilt by hal_thread_schedule() whenever the funct list or funct
+// barriers change, and swapped in atomically.
+#define SE_RMB  1   // issue a read barrier before calling this funct
+#define SE_WMB  2   // issue a write barrier after calling this funct
+
+typedef struct hal_sched_entry {
+    hal_funct_u funct;          // ptr to function code
+    void *arg;			/* argument for function */
+    __u8 type;                  // hal_funct_signature_t
+    __u8 flags;                 // SE_RMB, SE_WMB
+    __u16 nbatch;               // > 1: first of nbatch entries run by batch
+    int funct_ptr;		// hal_funct_t, for timing pins
+    int entry_ptr;		// hal_funct_entry_t, for profiling
+    batch_funct_t batch;        // nbatch > 1 only
+    int batch_ptr;              // nbatch > 1: the args of the batch
+} hal_sched_entry_t;
+
+#define SE_MAX_BATCH 0xffff
+
+// in a thread with workers, entries are ordered by stage and followed
+// by an int array of nstages stage end indices, see schedule_stage_end().
+// functs within a stage may run concurrently, stages run in order.
+typedef struct hal_schedule {
+    int nfuncts;
+    int nstages;                // 0: serial thread
+    hal_sched_entry_t entry[0] __attribute__((aligned(RTAPI_CACHELINE)));
+} hal_schedule_t;
+
+static inline int *schedule_stage_end(hal_schedule_t *sched)
+{
+    return (int *)(sched->entry + sched->nfuncts);
+}
+
+// shared state of a thread with workers (hal_threadargs_t.workers > 0).
+// per cycle the thread opens one stage after another by setting the
+// claim word; thread and workers claim entries by CAS on it and count
+// completed entries in 'done'. A stage is opened only once all entries
+// of the previous stage are done.
+#define HAL_MAX_WORKERS   16
+#define PAR_MAX_FUNCTS    0xffff
+#define PAR_CLAIM(limit, next) (((limit) << 16) | (next))
+#define PAR_LIMIT(claim)  ((claim) >> 16)
+#define PAR_NEXT(claim)   ((claim) & PAR_MAX_FUNCTS)
+
+typedef struct hal_parallel {
+    __u32 claim;                // PAR_CLAIM(end of open stage, next entry)
+    __u32 done;                 // entries completed this cycle
+    __u32 gen;                  // bumped at cycle start, futex word
+    __u32 waiters;              // workers sleeping on gen
+    __u32 nfuncts;              // entries this cycle
+    int sched_ptr;              // hal_schedule_t of this cycle
+    int profile_ptr;            // hal_thread_profile_t if enabled, else 0
+    int timing;                 // per-funct timing this cycle
+    long long int cycle_start;  // thread_start_time of this cycle
+    int nworkers;
+    int task_id[HAL_MAX_WORKERS];
+} hal_parallel_t;
+
 typedef struct hal_thread {
     halhdr_t hdr;
     int uses_fp;		/* floating point flag */
@@ -600,6 +673,15 @@ typedef struct hal_thread {
     int cpu_id;                 /* cpu to bind on, or -1 */
     rtapi_thread_flags_t flags;             // eg Posix, nowait
     char cgname[RTAPI_LINELEN];       // libcgroup name
+    int profile_ptr;            // hal_thread_profile_t, 0 if never profiled
+                                // see hal_profile.h
+    int schedule_ptr;           // hal_schedule_t run by thread_task(),
+                                // 0: walk funct_list instead
+    int schedule_inuse;         // schedule_ptr thread_task() is running,
+                                // 0 between cycles
+    int schedule_retired;       // previous schedule, freed when unused
+    bit_pin_ptr funct_timing;   // measure execution time of each funct
+    int parallel_ptr;           // hal_parallel_t if thread has workers, else 0
 } hal_thread_t;
 
 
@@ -679,7 +761,7 @@ typedef struct hal_vtable {
    meaningfull error messages in case of a mismatch.
 */
 #include "rtapi_shmkeys.h"
-#define HAL_VER   13	/* version code */
+#define HAL_VER   20	/* version code */
 
 
 /***********************************************************************
@@ -0,0 +1,178 @@
+// HAL thread profiling - see hal_profile.h
+
+#include "config.h"
+#include "rtapi.h"		/* RTAPI realtime OS API */
+#include "rtapi_atomics.h"
+#include "hal.h"		/* HAL public API decls */
+#include "hal_priv.h"		/* HAL private decls */
+#include "hal_internal.h"
+#include "hal_profile.h"
+
+// allocate the histograms of a thread and all its funct entries.
+// must be called with the HAL mutex held.
+static int profile_alloc(hal_thread_t *thread)
+{
+    hal_list_t *list_root, *list_entry;
+
+    if (thread->profile_ptr == 0) {
+	hal_thread_profile_t *tp = shmalloc_desc(sizeof(hal_thread_profile_t));
+	if (tp == NULL)
+	    NOMEM("profile for thread '%s'", ho_name(thread));
+	memset(tp, 0, sizeof(hal_thread_profile_t));
+	rtapi_smp_wmb();
+	thread->profile_ptr = SHMOFF(tp);
+    }
+    list_root = &(thread->funct_list);
+    list_entry = dlist_next(list_root);
+    while (list_entry != list_root) {
+	hal_funct_entry_t *fe = (hal_funct_entry_t *) list_entry;
+	if (fe->profile_ptr == 0) {
+	    hal_profhist_t *h = shmalloc_desc(sizeof(hal_profhist_t));
+	    if (h == NULL)
+		NOMEM("profile for thread '%s'", ho_name(thread));
+	    memset(h, 0, sizeof(hal_profhist_t));
+	    rtapi_smp_wmb();
+	    fe->profile_ptr = SHMOFF(h);
+	}
+	list_entry = dlist_next(list_entry);
+    }
+    return 0;
+}
+
+static int profile_thread_cb(hal_object_ptr o, foreach_args_t *args)
+{
+    hal_thread_t *thread = o.thread;
+    hal_thread_profile_t *tp;
+    int enable = args->user_arg1;
+
+    if (enable) {
+	int retval = profile_alloc(thread);
+	if (retval)
+	    return retval;
+    }
+    tp = thread_profile(thread);
+    if (tp == NULL)
+	return 0; // never profiled, nothing to turn off
+
+    if (enable && !tp->enabled) {
+	// start with fresh histograms
+	tp->reset_req++;
+	rtapi_smp_wmb();
+    }
+    tp->enabled = enable;
+    HALDBG("profiling %s on thread '%s'",
+	   enable ? "enabled" : "disabled", ho_name(thread));
+    return 0;
+}
+
+static int reset_thread_cb(hal_object_ptr o, foreach_args_t *args)
+{
+    hal_thread_profile_t *tp = thread_profile(o.thread);
+
+    if (tp) {
+	tp->reset_req++;
+	rtapi_smp_wmb();
+    }
+    return 0;
+}
+
+int halg_thread_profile(const int use_hal_mutex,
+			const char *name,
+			const int enable)
+{
+    CHECK_HALDATA();
+    CHECK_LOCK(HAL_LOCK_CONFIG);
+    {
+	WITH_HAL_MUTEX_IF(use_hal_mutex);
+
+	foreach_args_t args =  {
+	    .type = HAL_THREAD,
+	    .name = (char *)name,
+	    .user_arg1 = enable,
+	};
+	int ret = halg_foreach(0, &args, profile_thread_cb);
+	if (ret < 0)
+	    return ret;
+	if (name && (ret == 0)) {
+	    HALFAIL_RC(EINVAL, "thread '%s' not found", name);
+	}
+    }
+    return 0;
+}
+
+int halg_thread_profile_reset(const int use_hal_mutex, const char *name)
+{
+    CHECK_HALDATA();
+    {
+	WITH_HAL_MUTEX_IF(use_hal_mutex);
+
+	foreach_args_t args =  {
+	    .type = HAL_THREAD,
+	    .name = (char *)name,
+	};
+	int ret = halg_foreach(0, &args, reset_thread_cb);
+	if (name && (ret == 0)) {
+	    HALFAIL_RC(EINVAL, "thread '%s' not found", name);
+	}
+    }
+    return 0;
+}
+
+int hal_funct_entry_profile_init(const hal_thread_t *thread,
+				 hal_funct_entry_t *fe)
+{
+    hal_profhist_t *h = funct_entry_profile(fe);
+
+    // a recycled entry may carry a histogram from a previous use
+    if (h != NULL) {
+	memset(h, 0, sizeof(hal_profhist_t));
+	return 0;
+    }
+    if (thread->profile_ptr == 0)
+	return 0;
+
+    h = shmalloc_desc(sizeof(hal_profhist_t));
+    if (h == NULL)
+	NOMEM("profile for thread '%s'", ho_name(thread));
+    memset(h, 0, sizeof(hal_profhist_t));
+    fe->profile_ptr = SHMOFF(h);
+    return 0;
+}
+
+int hal_profhist_snapshot(const hal_profhist_t *h, hal_profhist_t *copy)
+{
+    int retries = 100;
+
+    while (retries--) {
+	__u32 seq = rtapi_load_u32(&h->seq);
+	if (seq & 1)
+	    continue; // writer active
+	rtapi_smp_rmb();
+	memcpy(copy, h, sizeof(hal_profhist_t));
+	rtapi_smp_rmb();
+	if (rtapi_load_u32(&h->seq) == seq)
+	    return 0;
+    }
+    return -EAGAIN;
+}
+
+hal_s32_t hal_profhist_percentile(const hal_profhist_t *h, const double q)
+{
+    hal_u64_t target, sum = 0;
+    int i;
+
+    if (h->count == 0)
+	return 0;
+    target = (hal_u64_t)(q * h->count + 0.5);
+    if (target == 0)
+	target = 1;
+    for (i = 0; i < HAL_PROF_NBUCKETS; i++) {
+	sum += h->bucket[i];
+	if (sum >= target) {
+	    hal_s32_t upper = (i + 1 < HAL_PROF_NBUCKETS) ?
+		hal_prof_bucket_low(i + 1) - 1 : h->max;
+	    return upper > h->max ? h->max : upper;
+	}
+    }
+    return h->max;
+}
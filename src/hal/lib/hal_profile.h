@@ -0,0 +1,141 @@
+#ifndef HAL_PROFILE_H
+#define HAL_PROFILE_H
+
+// opt-in HAL thread profiling
+//
+// when enabled on a thread, thread_task() records into HAL shared memory:
+//  - a latency histogram per funct entry (execution time of each funct)
+//  - a histogram of the thread runtime per cycle
+//  - a histogram of the period jitter (|actual - nominal period|)
+//  - the number of overruns (cycles where runtime exceeded the period)
+//
+// histograms are log-linear: each power of two is split into
+// 2^HAL_PROF_SUBBITS linear sub-buckets, so percentiles derived from them
+// are accurate to within 25%.
+//
+// the RT thread is the only writer. Readers (halcmd, haltalk) take
+// a consistent copy with hal_profhist_snapshot() which is guarded by a
+// per-histogram sequence counter, so reading never stops or delays
+// a thread. Resetting is done by the RT thread itself on request.
+
+#include <rtapi.h>
+#include <rtapi_atomics.h>
+#include <hal.h>
+#include <hal_priv.h>
+
+RTAPI_BEGIN_DECLS
+
+#define HAL_PROF_SUBBITS   2
+#define HAL_PROF_SUBBUCKETS (1 << HAL_PROF_SUBBITS)
+// values up to 2^31 ns
+#define HAL_PROF_NBUCKETS  ((31 - HAL_PROF_SUBBITS + 1) * HAL_PROF_SUBBUCKETS)
+
+typedef struct hal_profhist {
+    __u32     seq;          // odd while the RT writer updates
+    __u32     pad;
+    hal_u64_t count;        // number of samples
+    hal_u64_t sum;          // sum of samples, nsec
+    hal_s32_t min;
+    hal_s32_t max;
+    hal_u32_t bucket[HAL_PROF_NBUCKETS];
+} hal_profhist_t;
+
+typedef struct hal_thread_profile {
+    int       enabled;      // profiling on/off, set by halg_thread_profile()
+    __u32     reset_req;    // bumped by readers to request a reset
+    __u32     reset_ack;    // set to reset_req by the RT thread after reset
+    hal_u64_t overruns;     // cycles where runtime > period
+    hal_profhist_t runtime; // thread runtime per cycle
+    hal_profhist_t jitter;  // |actual period - nominal period|
+} hal_thread_profile_t;
+
+// map a sample value to its bucket index
+static inline int hal_prof_bucket(const hal_s32_t value)
+{
+    if (value < HAL_PROF_SUBBUCKETS)
+	return value < 0 ? 0 : value;
+    int msb = 31 - __builtin_clz((__u32) value);
+    int sub = (value >> (msb - HAL_PROF_SUBBITS)) & (HAL_PROF_SUBBUCKETS - 1);
+    return (msb - HAL_PROF_SUBBITS + 1) * HAL_PROF_SUBBUCKETS + sub;
+}
+
+// smallest value falling into a bucket
+static inline hal_s32_t hal_prof_bucket_low(const int index)
+{
+    if (index < HAL_PROF_SUBBUCKETS)
+	return index;
+    int msb = index / HAL_PROF_SUBBUCKETS + HAL_PROF_SUBBITS - 1;
+    int sub = index % HAL_PROF_SUBBUCKETS;
+    return (hal_s32_t)((HAL_PROF_SUBBUCKETS + sub) << (msb - HAL_PROF_SUBBITS));
+}
+
+// RT side: record a sample. Single writer only.
+static inline void hal_profhist_add(hal_profhist_t *h, const hal_s32_t value)
+{
+    h->seq++;
+    rtapi_smp_wmb();
+    if (h->count == 0) {
+	h->min = h->max = value;
+    } else {
+	if (value < h->min)
+	    h->min = value;
+	if (value > h->max)
+	    h->max = value;
+    }
+    h->count++;
+    h->sum += value;
+    h->bucket[hal_prof_bucket(value)]++;
+    rtapi_smp_wmb();
+    h->seq++;
+}
+
+// RT side: clear a histogram. Single writer only.
+static inline void hal_profhist_clear(hal_profhist_t *h)
+{
+    h->seq++;
+    rtapi_smp_wmb();
+    memset(&h->count, 0, sizeof(*h) - offsetof(hal_profhist_t, count));
+    rtapi_smp_wmb();
+    h->seq++;
+}
+
+static inline hal_thread_profile_t *thread_profile(const hal_thread_t *thread)
+{
+    if (thread->profile_ptr == 0)
+	return NULL;
+    return (hal_thread_profile_t *) SHMPTR(thread->profile_ptr);
+}
+
+static inline hal_profhist_t *funct_entry_profile(const hal_funct_entry_t *fe)
+{
+    if (fe->profile_ptr == 0)
+	return NULL;
+    return (hal_profhist_t *) SHMPTR(fe->profile_ptr);
+}
+
+// enable (1) or disable (0) profiling on a named thread, or all threads
+// if name is NULL. Enabling allocates the histograms on first use.
+int halg_thread_profile(const int use_hal_mutex,
+			const char *name,
+			const int enable);
+
+// request a reset of all histograms of a named thread (all if NULL).
+// the reset is executed by the thread in its next cycle.
+int halg_thread_profile_reset(const int use_hal_mutex, const char *name);
+
+// allocate the histogram of a funct entry if the thread is profiled.
+// called by hal_add_funct_to_thread() before linking the entry.
+int hal_funct_entry_profile_init(const hal_thread_t *thread,
+				 hal_funct_entry_t *fe);
+
+// readers: take a consistent copy of a histogram written by a running thread.
+// returns 0 on success, -EAGAIN if the writer kept interfering.
+int hal_profhist_snapshot(const hal_profhist_t *h, hal_profhist_t *copy);
+
+// readers: value below which the fraction q (0..1) of samples fall,
+// as the upper bound of the respective bucket, clipped to the maximum seen.
+hal_s32_t hal_profhist_percentile(const hal_profhist_t *h, const double q);
+
+RTAPI_END_DECLS
+
+#endif // HAL_PROFILE_H
@@ -5,6 +5,7 @@
 #include "hal_priv.h"		/* HAL private decls */
 #include "hal_rcomp.h"		/* HAL remote component decls */
 #include "hal_group.h"		/* common defs - REPORT_* */
+#include "hal_vmatch.h"		/* vectorized change detection */
 
 
 
@@ -201,17 +202,12 @@ int halg_compile_comp(const int use_hal_mutex,
        // alloc pin array
        if ((tc->pin = malloc(sizeof(hal_pin_t *) * tc->n_pins)) == NULL)
 	   NOMEM("allocating a pin reference array");
-       // alloc tracking value array
-       if ((tc->tracking =
-	    malloc(sizeof(hal_data_u) * tc->n_pins )) == NULL)
-	   NOMEM("allocating a array of tracking values");
        // alloc change bitmap
        if ((tc->changed =
 	    malloc(RTAPI_BITMAP_BYTES(tc->n_pins))) == NULL)
 	   NOMEM("allocating change bitmap");
 
        memset(tc->pin, 0, sizeof(hal_pin_t *) * tc->n_pins);
-       memset(tc->tracking, 0, sizeof(hal_data_u) * tc->n_pins);
        RTAPI_ZERO_BITMAP(tc->changed,tc->n_pins);
 
        // fill in pin array
@@ -222,6 +218,24 @@ int halg_compile_comp(const int use_hal_mutex,
        halg_foreach(0, &args, fill_pin_array);
 
        assert(args.user_arg1 == tc->n_pins);
+
+       // set up change detection. pins are resolved on every match
+       // since they may be linked and unlinked after compiling.
+       hal_vmatch_src_t *vs;
+       int i;
+
+       if ((vs = malloc(sizeof(hal_vmatch_src_t) * tc->n_pins)) == NULL)
+	   NOMEM("allocating a array of tracking values");
+       for (i = 0; i < tc->n_pins; i++) {
+	   vs[i].type = pin_type(tc->pin[i]);
+	   vs[i].index = i;
+	   vs[i].src = tc->pin[i];
+	   vs[i].eps_index = &tc->pin[i]->eps_index;
+       }
+       tc->vm = hal_vmatch_new(vs, tc->n_pins, 1);
+       free(vs);
+       if (tc->vm == NULL)
+	   return _halerrno;
        tc->magic = CCOMP_MAGIC;
        *ccomp = tc;
    }
@@ -231,61 +245,9 @@ int halg_compile_comp(const int use_hal_mutex,
 
 int hal_ccomp_match(hal_compiled_comp_t *cc)
 {
-    int i, nchanged = 0;
-    hal_bit_t halbit;
-    hal_s32_t hals32;
-    hal_u32_t halu32;
-    hal_float_t halfloat,delta;
-    const hal_pin_t *hp;
-
     assert(cc->magic ==  CCOMP_MAGIC);
     RTAPI_ZERO_BITMAP(cc->changed, cc->n_pins);
-
-    for (i = 0; i < cc->n_pins; i++) {
-	hp = cc->pin[i];
-
-	switch (pin_type(hp)) {
-	case HAL_BIT:
-	    halbit = _get_bit_pin(hp);
-	    if (get_bit_value(&cc->tracking[i]) != halbit) {
-		nchanged++;
-		RTAPI_BIT_SET(cc->changed, i);
-		set_bit_value(&cc->tracking[i], halbit);
-	    }
-	    break;
-
-	case HAL_FLOAT:
-	    halfloat = _get_float_pin(hp);
-	    delta = HAL_FABS(halfloat - get_float_value(&cc->tracking[i]));
-	    if (delta > hal_data->epsilon[hp->eps_index]) {
-		nchanged++;
-		RTAPI_BIT_SET(cc->changed, i);
-		set_float_value(&cc->tracking[i], halfloat);
-	    }
-	    break;
-	case HAL_S32:
-	    hals32 = _get_s32_pin(hp);
-	    if (get_s32_value(&cc->tracking[i]) != hals32) {
-		nchanged++;
-		RTAPI_BIT_SET(cc->changed, i);
-		set_s32_value(&cc->tracking[i],hals32);
-	    }
-	    break;
-	case HAL_U32:
-	    halu32 = _get_u32_pin(hp);
-	    if (get_u32_value(&cc->tracking[i]) != halu32) {
-		nchanged++;
-		RTAPI_BIT_SET(cc->changed, i);
-		set_u32_value(&cc->tracking[i],halu32);
-	    }
-	    break;
-
-	default:
-	    HALFAIL_RC(EINVAL, "BUG: hal_ccomp_match(%s): invalid type for pin %s: %d",
-		   ho_name(cc->comp), ho_name(hp), pin_type(hp));
-	}
-    }
-    return nchanged;
+    return hal_vmatch_scan(cc->vm, cc->changed);
 }
 
 int hal_ccomp_report(hal_compiled_comp_t *cc,
@@ -318,8 +280,7 @@ int hal_ccomp_free(hal_compiled_comp_t *cc)
     if (cc == NULL)
 	return 0;
     assert(cc->magic ==  CCOMP_MAGIC);
-    if (cc->tracking)
-	free(cc->tracking);
+    hal_vmatch_free(cc->vm);
     if (cc->changed)
 	free(cc->changed);
     if (cc->pin)
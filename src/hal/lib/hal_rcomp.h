@@ -5,6 +5,8 @@
 
 RTAPI_BEGIN_DECLS
 
+struct hal_vmatch; // see hal_vmatch.h
+
 // compiled component support
 #define CCOMP_MAGIC  0xbeef0815
 typedef struct {
@@ -13,7 +15,7 @@ typedef struct {
     int n_pins;
     hal_pin_t  **pin;
     unsigned long *changed;      // bitmap
-    hal_data_u    *tracking;     // tracking values of monitored pins
+    struct hal_vmatch *vm;       // tracking values of monitored pins
     void *user_data;             // uninterpreted by HAL code
     unsigned long user_flags;    // uninterpreted by HAL code
 } hal_compiled_comp_t;
@@ -31,6 +33,11 @@ typedef enum {
     // values to be accepted.
 
     RCOMP_ACCEPT_VALUES_ON_BIND = 1,
+
+    // newcomp motorctrl timer=100 packed
+    // haltalk sends pin changes as MT_HALRCOMP_PACKED_UPDATE
+    // messages instead of per-pin updates, see message.proto.
+    RCOMP_REPORT_PACKED = 2,
 } rcompflags_t;
 
 typedef int(*comp_report_callback_t)(const int phase,
@@ -8,21 +8,29 @@
 
 static int next_ring_id(void);
 static int free_ring_id(const int id);
-static char *ringtypes[] = {
-    "record",
-    "multi",
-    "stream",
-    "any",
-};
+static const char *ringtype(const unsigned type)
+{
+    switch (type) {
+    case RINGTYPE_RECORD:    return "record";
+    case RINGTYPE_MULTIPART: return "multi";
+    case RINGTYPE_STREAM:    return "stream";
+    case RINGTYPE_ANY:       return "any";
+    case RINGTYPE_MPMC:      return "mpmc";
+    }
+    return "invalid";
+}
 /***********************************************************************
 *                     Public HAL ring functions                        *
 ************************************************************************/
-hal_ring_t *halg_ring_newfv(const int use_hal_mutex,
-			    const int size,
-			    const int sp_size,
-			    const int mode,
-			    const char *fmt,
-			    va_list ap)
+// common to halg_ring_newfv() and halg_ring_new_mpmcfv():
+// for MPMC rings, size is the number of slots
+static hal_ring_t *ring_newfv(const int use_hal_mutex,
+			      const int size,
+			      const int recsize,
+			      const int sp_size,
+			      const int mode,
+			      const char *fmt,
+			      va_list ap)
 {
     PCHECK_HALDATA();
     PCHECK_LOCK(HAL_LOCK_LOAD);
@@ -56,6 +64,9 @@ hal_ring_t *halg_ring_newfv(const int use_hal_mutex,
 	    case RINGTYPE_STREAM:
 		newfmt = "stream-%d";
 		break;
+	    case RINGTYPE_MPMC:
+		newfmt = "mpmc-%d";
+		break;
 	    default:
 		HALFAIL(EINVAL, "invalid ring type: 0x%x", mode & RINGTYPE_MASK);
 		goto FAIL;
@@ -86,7 +97,12 @@ hal_ring_t *halg_ring_newfv(const int use_hal_mutex,
 	rptr->ring_id = ring_id;
 
 	// make total allocation fit ringheader, ringbuffer and scratchpad
-	rptr->total_size = ring_memsize( rptr->flags, size, sp_size);
+	if ((mode & RINGTYPE_MASK) == RINGTYPE_MPMC)
+	    rptr->total_size = ring_memsize(rptr->flags,
+					    mpmc_ring_size(size, recsize),
+					    sp_size);
+	else
+	    rptr->total_size = ring_memsize( rptr->flags, size, sp_size);
 
 	if (rptr->flags & ALLOC_HALMEM) {
 	    void *ringmem = shmalloc_desc_aligned(rptr->total_size,
@@ -126,7 +142,10 @@ hal_ring_t *halg_ring_newfv(const int use_hal_mutex,
 	       name, (rptr->flags & ALLOC_HALMEM) ? "halmem" : "shm",
 	       rptr->total_size);
 
-	ringheader_init(rhptr, rptr->flags, size, sp_size);
+	if ((mode & RINGTYPE_MASK) == RINGTYPE_MPMC)
+	    ringheader_init_mpmc(rhptr, rptr->flags, size, recsize, sp_size);
+	else
+	    ringheader_init(rhptr, rptr->flags, size, sp_size);
 	rhptr->refcount = 0; // on hal_ring_attach: increase; on hal_ring_detach: decrease
 
 	// make it visible
@@ -143,6 +162,35 @@ hal_ring_t *halg_ring_newfv(const int use_hal_mutex,
     } // automatic unlock by scope exit
 }
 
+hal_ring_t *halg_ring_newfv(const int use_hal_mutex,
+			    const int size,
+			    const int sp_size,
+			    const int mode,
+			    const char *fmt,
+			    va_list ap)
+{
+    if ((mode & RINGTYPE_MASK) == RINGTYPE_MPMC)
+	HALFAIL_NULL(EINVAL, "MPMC rings need a record size - "
+		     "use halg_ring_new_mpmcf()");
+    return ring_newfv(use_hal_mutex, size, 0, sp_size, mode, fmt, ap);
+}
+
+hal_ring_t *halg_ring_new_mpmcfv(const int use_hal_mutex,
+				 const int nslots,
+				 const int recsize,
+				 const int sp_size,
+				 const int mode,
+				 const char *fmt,
+				 va_list ap)
+{
+    if (nslots < 1)
+	HALFAIL_NULL(EINVAL, "MPMC ring: invalid number of slots %d", nslots);
+    if (recsize < 0)
+	HALFAIL_NULL(EINVAL, "MPMC ring: invalid record size %d", recsize);
+    return ring_newfv(use_hal_mutex, nslots, recsize, sp_size,
+		      (mode & ~RINGTYPE_MASK) | RINGTYPE_MPMC, fmt, ap);
+}
+
 
 int free_ring_struct(hal_ring_t *hrptr)
 {
@@ -378,7 +426,7 @@ hal_plug_t *halg_plug_new(const int use_hal_mutex,
 	if ((wanted != RINGTYPE_ANY) &&
 	    (wanted != ring_is)) {
 	    HALFAIL(ENOENT, "ring types incompatible: plug wants '%s', ring is '%s'",
-		   ringtypes[wanted], ringtypes[ring_is]);
+		   ringtype(wanted), ringtype(ring_is));
 	    goto FAIL;
 	}
 
@@ -419,7 +467,7 @@ hal_plug_t *halg_plug_new(const int use_hal_mutex,
 	halg_add_object(false, (hal_object_ptr)plug);
 
 	HALDBG("created plug '%s' type %s ",
-	       hh_get_name(&plug->hdr), ringtypes[plug->rb.header->type]);
+	       hh_get_name(&plug->hdr), ringtype(plug->rb.header->type));
 
 	return plug;
 
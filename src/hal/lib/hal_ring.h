@@ -104,6 +104,7 @@ int halg_plug_delete(const int use_hal_mutex,
 // #define RINGTYPE_RECORD    0
 // #define RINGTYPE_MULTIPART RTAPI_BIT(0)
 // #define RINGTYPE_STREAM    RTAPI_BIT(1)
+// #define RINGTYPE_MPMC      RTAPI_BIT(5)  - create with halg_ring_new_mpmcf()
 
 // mode flags passed in by ring_new
 // exposed in ringheader_t.{use_rmutex, use_wmutex, alloc_halmem}
@@ -154,6 +155,47 @@ static inline int hal_ring_newf(const int size,
     return _halerrno;
 }
 
+// create a multi-producer, multi-consumer ring of nslots records of
+// up to recsize bytes each, see 'MPMC rings' in ring.h.
+// nslots is rounded up to a power of two. The RINGTYPE bits of mode
+// are ignored; the mode flags apply as for halg_ring_newfv().
+hal_ring_t *halg_ring_new_mpmcfv(const int use_hal_mutex,
+				 const int nslots,
+				 const int recsize,
+				 const int sp_size,
+				 const int mode,
+				 const char *fmt,
+				 va_list ap);
+
+static inline hal_ring_t *halg_ring_new_mpmcf(const int use_hal_mutex,
+					      const int nslots,
+					      const int recsize,
+					      const int sp_size,
+					      const int mode,
+					      const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    hal_ring_t *rp = halg_ring_new_mpmcfv(use_hal_mutex, nslots, recsize,
+					  sp_size, mode, fmt, ap);
+    va_end(ap);
+    return rp;
+}
+
+static inline int hal_ring_new_mpmcf(const int nslots,
+				     const int recsize,
+				     const int sp_size,
+				     const int mode,
+				     const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    hal_ring_t *rp = halg_ring_new_mpmcfv(1, nslots, recsize,
+					  sp_size, mode, fmt, ap);
+    va_end(ap);
+    if (rp) return 0;
+    return _halerrno;
+}
+
 // delete a ring buffer.
 // will fail if the refcount is > 0 (meaning the ring is still attached somewhere).
 //int halg_ring_delete(const int use_hal_mutex, const char *name);
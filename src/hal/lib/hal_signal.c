@@ -254,6 +254,8 @@ int halg_link(const int use_hal_mutex,
 	if ((pin->dir == HAL_IO) && (sig->writers > 0)) {
 	    HALFAIL_RC(EINVAL, "signal '%s' already has output pin", sig_name);
 	}
+	if (hal_parallel_link_check(pin))
+	    return _halerrno;
         /* everything is OK, make the new link */
 	if (hh_get_legacy(&pin->hdr)) {
 	    hal_comp_t *comp = halpr_find_owning_comp(ho_owner_id(pin));
@@ -357,6 +359,7 @@ int halg_unlink(const int use_hal_mutex,
 
 	/* found pin, unlink it */
 	unlink_pin(pin);
+	hal_parallel_unlinked(pin);
 	return 0;
     }
 }
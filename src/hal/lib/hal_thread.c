@@ -6,12 +6,221 @@
 #include "hal.h"		/* HAL public API decls */
 #include "hal_priv.h"		/* HAL private decls */
 #include "hal_internal.h"
+#include "hal_profile.h"
 
 #ifdef RTAPI
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+// workers sleep on hal_parallel_t.gen between cycles. As with rings,
+// the wakeup is a syscall only if a worker sleeps, and causes a mode
+// switch of the thread on Xenomai.
+static inline long par_futex(__u32 *uaddr, const int op, const __u32 val,
+			     const struct timespec *timeout)
+{
+    return syscall(SYS_futex, uaddr, op, val, timeout, NULL, 0);
+}
+
+// executed by the thread itself, so the histograms have a single writer
+static void thread_profile_reset(hal_thread_t *thread,
+				 hal_thread_profile_t *tp)
+{
+    hal_list_t *list_root = &(thread->funct_list);
+    hal_list_t *list_entry = dlist_next(list_root);
+
+    while (list_entry != list_root) {
+	hal_profhist_t *h = funct_entry_profile((hal_funct_entry_t *) list_entry);
+	if (h)
+	    hal_profhist_clear(h);
+	list_entry = dlist_next(list_entry);
+    }
+    hal_profhist_clear(&tp->runtime);
+    hal_profhist_clear(&tp->jitter);
+    tp->overruns = 0;
+    rtapi_smp_wmb();
+    tp->reset_ack = rtapi_load_u32(&tp->reset_req);
+}
+
+// update the execution time pins of a funct, and its histogram if profiled
+static inline void funct_timing(hal_funct_t *funct,
+				hal_funct_entry_t *funct_entry,
+				const hal_thread_profile_t *tp,
+				const hal_s32_t delta)
+{
+    hal_profhist_t *fh;
+
+    set_s32_pin(funct->f_runtime, delta);
+    if ( delta > get_s32_pin(funct->f_maxtime)) {
+	set_s32_pin(funct->f_maxtime, delta);
+#ifdef ENABLE_TMAX_INC
+	set_bit_pin(funct->f_maxtime_increased, 1);
+    } else {
+	set_bit_pin(funct->f_maxtime_increased, 0);
+#endif
+    }
+    if (tp && (fh = funct_entry_profile(funct_entry)) != NULL)
+	hal_profhist_add(fh, delta);
+}
+
+static inline void call_funct(const int type,
+			      const hal_funct_u funct,
+			      void *arg,
+			      hal_funct_args_t *fa)
+{
+    switch (type) {
+    case FS_LEGACY_THREADFUNC:
+	funct.l(arg, fa->thread->period);
+	break;
+    case FS_XTHREADFUNC:
+	funct.x(arg, fa);
+	break;
+    default:
+	// bad - a mistyped funct
+	;
+    }
+}
+
+// run a schedule entry of a thread with workers, on thread or worker
+static inline void parallel_run_entry(hal_sched_entry_t *se,
+				      hal_funct_args_t *fa,
+				      const hal_parallel_t *par)
+{
+    long long int end_time;
+
+    fa->funct = SHMPTR(se->funct_ptr);
+    if (se->flags & SE_RMB)
+	rtapi_smp_rmb();
+    if (par->timing)
+	fa->start_time = rtapi_get_time();
+
+    call_funct(se->type, se->funct, se->arg, fa);
+
+    if (par->timing) {
+	end_time = rtapi_get_time();
+	funct_timing(fa->funct, SHMPTR(se->entry_ptr),
+		     par->profile_ptr ? SHMPTR(par->profile_ptr) : NULL,
+		     end_time - fa->start_time);
+    }
+    if (se->flags & SE_WMB)
+	rtapi_smp_wmb();
+}
+
+// claim and run entries of the open stage until it is drained.
+// the thread returns then to wait for the stage to complete, workers
+// keep going for the next stage until all entries of the cycle are claimed.
+static void parallel_claim(hal_parallel_t *par,
+			   hal_funct_args_t *fa,
+			   const int worker)
+{
+    while (1) {
+	__u32 claim = rtapi_load_u32(&par->claim);
+	__u32 next = PAR_NEXT(claim);
+
+	if (next >= PAR_LIMIT(claim)) {
+	    if (!worker || (next >= rtapi_load_u32(&par->nfuncts)))
+		return;
+	    rtapi_cpu_relax();
+	    continue; // wait for the thread to open the next stage
+	}
+	if (!rtapi_cas_u32(&par->claim, claim, claim + 1))
+	    continue;
+
+	// entry 'next' is ours, the schedule cannot change before it is done
+	hal_schedule_t *sched = SHMPTR(rtapi_load_s32(&par->sched_ptr));
+	parallel_run_entry(&sched->entry[next], fa, par);
+	rtapi_add_u32(&par->done, 1);
+    }
+}
+
+// run a staged schedule on the thread and its workers
+static void parallel_cycle(hal_thread_t *thread,
+			   hal_schedule_t *sched,
+			   hal_funct_args_t *fa,
+			   hal_thread_profile_t *tp,
+			   const int timing)
+{
+    hal_parallel_t *par = SHMPTR(thread->parallel_ptr);
+    int *stage_end = schedule_stage_end(sched);
+    int k, begin = 0;
+
+    par->sched_ptr = SHMOFF(sched);
+    par->profile_ptr = tp ? SHMOFF(tp) : 0;
+    par->timing = timing;
+    par->cycle_start = fa->thread_start_time;
+    rtapi_store_u32(&par->nfuncts, sched->nfuncts);
+    rtapi_store_u32(&par->done, 0);
+    rtapi_smp_wmb();
+
+    for (k = 0; k < sched->nstages; k++) {
+	rtapi_store_u32(&par->claim, PAR_CLAIM(stage_end[k], begin));
+	if (k == 0) {
+	    rtapi_add_u32(&par->gen, 1); // workers go
+	    // pairs with the barrier in worker_task()
+	    rtapi_smp_mb();
+	    if (rtapi_load_u32(&par->waiters))
+		par_futex(&par->gen, FUTEX_WAKE, INT_MAX, NULL);
+	}
+
+	parallel_claim(par, fa, 0);
+
+	// stage barrier
+	while (rtapi_load_u32(&par->done) < stage_end[k])
+	    rtapi_cpu_relax();
+	rtapi_smp_rmb();
+	begin = stage_end[k];
+    }
+}
+
+// a worker task of a thread: helps with the stages of each thread cycle
+static void worker_task(void *arg)
+{
+    hal_thread_t *thread = arg;
+    hal_parallel_t *par = SHMPTR(thread->parallel_ptr);
+    __u32 gen, seen = rtapi_load_u32(&par->gen);
+    struct timespec ts = {
+	.tv_sec = thread->period / 1000000000L,
+	.tv_nsec = thread->period % 1000000000L,
+    };
+
+    hal_funct_args_t fa = {
+	.thread = thread,
+	.argc = 0,
+	.argv = NULL,
+    };
+
+    while (1) {
+	if (hal_data->threads_running > 0) {
+	    // workers are released about when the thread is; sleep at
+	    // most a period for its next cycle to start. Announce the
+	    // sleep, then recheck: either the thread sees the waiter
+	    // after bumping gen, or we see the bump.
+	    if ((gen = rtapi_load_u32(&par->gen)) == seen) {
+		rtapi_add_u32(&par->waiters, 1);
+		rtapi_smp_mb();
+		par_futex(&par->gen, FUTEX_WAIT, seen, &ts);
+		rtapi_add_u32(&par->waiters, (__u32) -1);
+		gen = rtapi_load_u32(&par->gen);
+	    }
+	    if (gen != seen) {
+		seen = gen;
+		rtapi_smp_rmb();
+		fa.thread_start_time = fa.last_start_time = par->cycle_start;
+		fa.start_time = par->cycle_start;
+		parallel_claim(par, &fa, 1);
+	    }
+	}
+	// also a cancellation point, unlike the futex wait
+	rtapi_wait(thread->flags);
+    }
+}
 
 /** 'thread_task()' is a function that is invoked as a realtime task.
-    It implements a thread, by running down the thread's function list
-    and calling each function in turn.
+    It implements a thread, by running down the thread's compiled
+    schedule (or its function list if there is none) and calling
+    each function in turn.
 */
 static void thread_task(void *arg)
 {
@@ -19,6 +228,8 @@ static void thread_task(void *arg)
     hal_funct_entry_t *funct_root, *funct_entry;
     long long int end_time;
     hal_s32_t delta, act_period;
+    hal_thread_profile_t *tp;
+    int sched_ptr, timing;
 
     thread->cycles = 0;
     thread->mean = 0.0;
@@ -35,9 +246,13 @@ static void thread_task(void *arg)
     while (1) {
 	if (hal_data->threads_running > 0) {
 
-	    /* point at first function on function list */
-	    funct_root = (hal_funct_entry_t *) & (thread->funct_list);
-	    funct_entry = SHMPTR(funct_root->links.next);
+	    // pick up the current schedule and announce it is in use,
+	    // so hal_thread_schedule() does not free it under our feet
+	    do {
+		sched_ptr = rtapi_load_s32(&thread->schedule_ptr);
+		thread->schedule_inuse = sched_ptr;
+		rtapi_smp_mb();
+	    } while (rtapi_load_s32(&thread->schedule_ptr) != sched_ptr);
 
 	    // the thread release point
 	    fa.start_time = rtapi_get_time();
@@ -46,63 +261,117 @@ static void thread_task(void *arg)
 	    act_period = fa.start_time - fa.last_start_time;
 	    set_s32_pin(thread->curr_period, act_period);
 
-	    fa.last_start_time = fa.thread_start_time = fa.start_time;
-
-	    /* run thru function list */
-	    while (funct_entry != funct_root) {
-		/* point to function structure */
-		fa.funct = SHMPTR(funct_entry->funct_ptr);
-
-		// issue a read barrier if set in funct_entry or
-		// funct object header
-		if (funct_entry->rmb || ho_rmb(fa.funct)) {
-		    rtapi_smp_rmb();
+	    // profiling is opt-in, see hal_profile.h
+	    tp = thread_profile(thread);
+	    if (tp && !tp->enabled)
+		tp = NULL;
+	    if (tp) {
+		if (rtapi_load_u32(&tp->reset_req) != tp->reset_ack)
+		    thread_profile_reset(thread, tp);
+		else if (fa.last_start_time > 0) {
+		    hal_s32_t jitter = act_period - thread->period;
+		    hal_profhist_add(&tp->jitter, jitter < 0 ? -jitter : jitter);
 		}
+	    }
+	    // per-funct timing costs two clock reads per funct
+	    timing = get_bit_pin(thread->funct_timing) || (tp != NULL);
 
-		/* call the function */
-		switch (funct_entry->type) {
-		case FS_LEGACY_THREADFUNC:
-		    funct_entry->funct.l(funct_entry->arg, thread->period);
-		    break;
-		case FS_XTHREADFUNC:
-		    funct_entry->funct.x(funct_entry->arg, &fa);
-		    break;
-		default:
-		    // bad - a mistyped funct
-		    ;
-		}
-		// capture execution time of this funct
-		end_time = rtapi_get_time();
+	    fa.last_start_time = fa.thread_start_time = fa.start_time;
+	    end_time = fa.start_time;
 
-		/* update execution time data */
-		delta = end_time - fa.start_time;
-		set_s32_pin(fa.funct->f_runtime, delta);
-		if ( delta > get_s32_pin(fa.funct->f_maxtime)) {
-		    set_s32_pin(fa.funct->f_maxtime, delta);
-#ifdef ENABLE_TMAX_INC
-		    set_bit_pin(fa.funct->f_maxtime_increased, 1);
-		} else {
-		    set_bit_pin(fa.funct->f_maxtime_increased, 0);
-#endif
+	    if (sched_ptr && ((hal_schedule_t *)SHMPTR(sched_ptr))->nstages) {
+		/* run the stages on this thread and its workers */
+		parallel_cycle(thread, SHMPTR(sched_ptr), &fa, tp, timing);
+		end_time = rtapi_get_time();
+	    } else if (sched_ptr) {
+		/* run thru the compiled schedule */
+		hal_schedule_t *sched = SHMPTR(sched_ptr);
+		hal_sched_entry_t *se = sched->entry;
+		hal_sched_entry_t *last = se + sched->nfuncts;
+
+		for (; se < last; se++) {
+		    hal_sched_entry_t *first = se;
+
+		    fa.funct = SHMPTR(se->funct_ptr);
+
+		    if (se->flags & SE_RMB)
+			rtapi_smp_rmb();
+
+		    if (se->nbatch) {
+			// runs this and the next nbatch - 1 entries
+			se->batch(SHMPTR(se->batch_ptr), se->nbatch, &fa);
+			se += se->nbatch - 1;
+		    } else
+			call_funct(se->type, se->funct, se->arg, &fa);
+
+		    if (timing) {
+			// a batch is timed as one unit, its functs are
+			// charged an equal share
+			end_time = rtapi_get_time();
+			delta = (end_time - fa.start_time) / (se - first + 1);
+			for (; first <= se; first++)
+			    funct_timing(SHMPTR(first->funct_ptr),
+					 SHMPTR(first->entry_ptr), tp, delta);
+			fa.start_time = end_time;
+		    }
+		    if (se->flags & SE_WMB)
+			rtapi_smp_wmb();
 		}
-
-		// issue a write barrier if set in funct_entry or
-		// funct object header
-		if (funct_entry->wmb || ho_wmb(fa.funct)) {
-		    rtapi_smp_wmb();
+		if (!timing)
+		    end_time = rtapi_get_time();
+	    } else {
+		/* no schedule: run thru function list */
+		funct_root = (hal_funct_entry_t *) & (thread->funct_list);
+		funct_entry = SHMPTR(funct_root->links.next);
+
+		while (funct_entry != funct_root) {
+		    /* point to function structure */
+		    fa.funct = SHMPTR(funct_entry->funct_ptr);
+
+		    // issue a read barrier if set in funct_entry or
+		    // funct object header
+		    if (funct_entry->rmb || ho_rmb(fa.funct)) {
+			rtapi_smp_rmb();
+		    }
+
+		    /* call the function */
+		    call_funct(funct_entry->type, funct_entry->funct,
+			       funct_entry->arg, &fa);
+
+		    // capture execution time of this funct
+		    end_time = rtapi_get_time();
+
+		    /* update execution time data */
+		    delta = end_time - fa.start_time;
+		    funct_timing(fa.funct, funct_entry, tp, delta);
+
+		    // issue a write barrier if set in funct_entry or
+		    // funct object header
+		    if (funct_entry->wmb || ho_wmb(fa.funct)) {
+			rtapi_smp_wmb();
+		    }
+
+		    /* point to next next entry in list */
+		    funct_entry = SHMPTR(funct_entry->links.next);
+		    /* prepare to measure time for next funct */
+		    fa.start_time = end_time;
 		}
-
-		/* point to next next entry in list */
-		funct_entry = SHMPTR(funct_entry->links.next);
-		/* prepare to measure time for next funct */
-		fa.start_time = end_time;
 	    }
+	    // done with the schedule for this cycle
+	    rtapi_smp_mb();
+	    thread->schedule_inuse = 0;
+
 	    // update thread execution time in this period
 	    hal_s32_t rt = (end_time - fa.thread_start_time);
 	    set_s32_pin(thread->runtime, rt);
 	    if (rt > get_s32_pin(thread->maxtime)) {
 		set_s32_pin(thread->maxtime, rt);
 	    }
+	    if (tp) {
+		hal_profhist_add(&tp->runtime, rt);
+		if (rt > thread->period)
+		    tp->overruns++;
+	    }
 	} else {
 	    // threads_running flag false:
 
@@ -137,6 +406,53 @@ static void thread_task(void *arg)
     }
 }
 
+// create and start the worker tasks of a thread
+static int create_workers(hal_thread_t *thread, const hal_threadargs_t *args)
+{
+    hal_parallel_t *par;
+    char name[HAL_NAME_LEN + 1];
+    int i, retval;
+
+    if (args->workers > HAL_MAX_WORKERS) {
+	HALFAIL_RC(EINVAL, "thread %s: at most %d workers",
+		   args->name, HAL_MAX_WORKERS);
+    }
+    if ((par = shmalloc_desc(sizeof(hal_parallel_t))) == NULL)
+	NOMEM("workers of thread '%s'", args->name);
+    thread->parallel_ptr = SHMOFF(par);
+
+    for (i = 0; i < args->workers; i++) {
+	rtapi_snprintf(name, sizeof(name), "%s.w%d", args->name, i);
+
+	rtapi_task_args_t rargs = {
+	    .taskcode = worker_task,
+	    .arg = thread,
+	    .prio = thread->priority,
+	    .owner = lib_module_id,
+	    .stacksize = global_data->hal_thread_stack_size,
+	    .uses_fp = thread->uses_fp,
+	    .cpu_id = (thread->cpu_id < 0) ? -1 : thread->cpu_id + 1 + i,
+	    .name = name,
+	    .flags = thread->flags,
+	    .cgname = {0},
+	};
+	strncpy(rargs.cgname, thread->cgname, RTAPI_LINELEN);
+	retval = rtapi_task_new(&rargs);
+	if (retval < 0) {
+	    HALFAIL_RC(EINVAL, "could not create worker %d for thread %s",
+		       i, args->name);
+	}
+	par->task_id[par->nworkers++] = retval;
+
+	retval = rtapi_task_start(retval, thread->period);
+	if (retval < 0) {
+	    HALFAIL_RC(EINVAL, "could not start worker %d for thread %s: %d",
+		       i, args->name, retval);
+	}
+    }
+    return 0;
+}
+
 // HAL threads - public API
 
 int hal_create_xthread(const hal_threadargs_t *args)
@@ -258,15 +574,22 @@ int hal_create_xthread(const hal_threadargs_t *args)
 	new->curr_period.sp = hal_off_safe(halg_pin_newf(0, HAL_S32, HAL_OUT, NULL,
 							 lib_module_id,
 							 "%s.curr-period", args->name));
+	new->funct_timing.bp = hal_off_safe(halg_pin_newf(0, HAL_BIT, HAL_IO, NULL,
+							  lib_module_id,
+							  "%s.funct-timing", args->name));
 
 	// expose nominal period for a start
 	set_s32_pin(new->curr_period, new->period);
+	// per-funct execution times on by default
+	set_bit_pin(new->funct_timing, 1);
 
 	/* start task */
 	retval = rtapi_task_start(new->task_id, new->period);
 	if (retval < 0) {
 	    HALFAIL_RC(EINVAL, "could not start task for thread %s: %d", args->name, retval);
 	}
+	if ((args->workers > 0) && create_workers(new, args))
+	    return _halerrno;
 	/* insert new structure at head of list */
 	dlist_add_before(&new->thread, &hal_data->threads);
 
@@ -276,8 +599,8 @@ int hal_create_xthread(const hal_threadargs_t *args)
     } // exit block protected by scoped lock
 
 
-    HALDBG("thread %s id %d created prio=%d",
-	   args->name, new->task_id, new->priority);
+    HALDBG("thread %s id %d created prio=%d workers=%d",
+	   args->name, new->task_id, new->priority, args->workers);
     return 0;
 }
 
@@ -299,6 +622,7 @@ static int delete_thread_cb(hal_object_ptr o, foreach_args_t *args)
     free_pin_struct(hal_ptr(o.thread->runtime.sp));
     free_pin_struct(hal_ptr(o.thread->maxtime.sp));
     free_pin_struct(hal_ptr(o.thread->curr_period.sp));
+    free_pin_struct(hal_ptr(o.thread->funct_timing.bp));
     free_thread_struct(o.thread);
     return 0;
 }
@@ -341,13 +665,146 @@ int hal_exit_threads(void)
 #endif /* RTAPI */
 
 
+// free a schedule no longer published unless thread_task() is still
+// running it, in which case it is kept until the next swap.
+static void schedule_retire(hal_thread_t *thread, const int old)
+{
+    rtapi_smp_mb();
+    int inuse = rtapi_load_s32(&thread->schedule_inuse);
+
+    // at most one of retired and old can be in use
+    if (thread->schedule_retired && (thread->schedule_retired != inuse)) {
+	shmfree_desc(SHMPTR(thread->schedule_retired));
+	thread->schedule_retired = 0;
+    }
+    if (old == 0)
+	return;
+    if (old != inuse)
+	shmfree_desc(SHMPTR(old));
+    else
+	thread->schedule_retired = old;
+}
+
+// let a single call of their batch funct run adjacent entries sharing
+// one, unless a barrier separates them. The batch args follow the
+// entries. When timing, thread_task() charges each an equal share.
+static void schedule_batches(hal_schedule_t *sched)
+{
+    void **args = (void **)(sched->entry + sched->nfuncts);
+    int i, j;
+
+    for (i = 0; i < sched->nfuncts; i = j) {
+	hal_sched_entry_t *first = &sched->entry[i];
+	hal_funct_t *funct = SHMPTR(first->funct_ptr);
+
+	args[i] = first->arg;
+	for (j = i + 1; (j < sched->nfuncts) && (j - i < SE_MAX_BATCH); j++) {
+	    hal_sched_entry_t *se = &sched->entry[j];
+
+	    if ((funct->batch == NULL) ||
+		(((hal_funct_t *)SHMPTR(se->funct_ptr))->batch != funct->batch) ||
+		(se->flags & SE_RMB) || (se[-1].flags & SE_WMB))
+		break;
+	    args[j] = se->arg;
+	}
+	if (j - i > 1) {
+	    first->nbatch = j - i;
+	    first->batch = funct->batch;
+	    first->batch_ptr = SHMOFF(&args[i]);
+	}
+    }
+}
+
+// compile the funct list of a thread into a schedule and swap it in.
+// must be called with the HAL mutex held.
+int hal_thread_schedule(hal_thread_t *thread)
+{
+    hal_list_t *list_root = &(thread->funct_list);
+    hal_list_t *list_entry;
+    hal_schedule_t *sched;
+    int old, n = 0;
+
+    for (list_entry = dlist_next(list_root);
+	 list_entry != list_root;
+	 list_entry = dlist_next(list_entry))
+	n++;
+
+    // followed by the stage ends, or the batch args of a serial thread
+    sched = shmalloc_desc_aligned(sizeof(hal_schedule_t) +
+				  n * sizeof(hal_sched_entry_t) +
+				  (thread->parallel_ptr ? n * sizeof(int) :
+				   n * sizeof(void *)),
+				  RTAPI_CACHELINE);
+    if (sched == NULL) {
+	// thread_task() falls back to walking the funct list
+	old = thread->schedule_ptr;
+	rtapi_store_s32(&thread->schedule_ptr, 0);
+	schedule_retire(thread, old);
+	NOMEM("schedule for thread '%s'", ho_name(thread));
+    }
+
+    sched->nfuncts = n;
+    hal_sched_entry_t *se = sched->entry;
+    for (list_entry = dlist_next(list_root);
+	 list_entry != list_root;
+	 list_entry = dlist_next(list_entry), se++) {
+	hal_funct_entry_t *fe = (hal_funct_entry_t *) list_entry;
+	hal_funct_t *funct = SHMPTR(fe->funct_ptr);
+
+	se->funct = fe->funct;
+	se->arg = fe->arg;
+	se->type = fe->type;
+	se->flags = ((fe->rmb || ho_rmb(funct)) ? SE_RMB : 0) |
+	    ((fe->wmb || ho_wmb(funct)) ? SE_WMB : 0);
+	se->funct_ptr = fe->funct_ptr;
+	se->entry_ptr = SHMOFF(fe);
+	se->nbatch = 0;
+    }
+    if (!thread->parallel_ptr)
+	schedule_batches(sched);
+    // stages are computed when threads start, see hal_parallel.c.
+    // on failure a thread with workers runs its schedule serially
+    if (thread->parallel_ptr && hal_data->threads_running &&
+	hal_schedule_stages(sched))
+	HALWARN("thread '%s' runs serially", ho_name(thread));
+    // schedule contents visible before the schedule itself
+    rtapi_smp_wmb();
+
+    old = thread->schedule_ptr;
+    rtapi_store_s32(&thread->schedule_ptr, SHMOFF(sched));
+    schedule_retire(thread, old);
+    return 0;
+}
+
+static int schedule_thread_cb(hal_object_ptr o, foreach_args_t *args)
+{
+    return hal_thread_schedule(o.thread);
+}
+
+int hal_thread_schedule_all(void)
+{
+    foreach_args_t args =  {
+	.type = HAL_THREAD,
+    };
+    int ret = halg_foreach(0, &args, schedule_thread_cb);
+    return ret < 0 ? ret : 0;
+}
+
 int hal_start_threads(void)
 {
     CHECK_HALDATA();
     CHECK_LOCK(HAL_LOCK_RUN);
 
     HALDBG("starting threads");
-    hal_data->threads_running = 1;
+    {
+	WITH_HAL_MUTEX();
+
+	// threads run their current schedules until recompiled, now
+	// with stages for threads with workers - or in case one could
+	// not be built before
+	hal_data->threads_running = 1;
+	hal_thread_schedule_all();
+    }
     return 0;
 }
 
@@ -374,6 +831,30 @@ void free_thread_struct(hal_thread_t * thread)
     /* and stop the task associated with this thread */
     rtapi_task_pause(thread->task_id);
     rtapi_task_delete(thread->task_id);
+    if (thread->parallel_ptr) {
+	hal_parallel_t *par = SHMPTR(thread->parallel_ptr);
+	int i;
+	for (i = 0; i < par->nworkers; i++) {
+	    rtapi_task_pause(par->task_id[i]);
+	    rtapi_task_delete(par->task_id[i]);
+	}
+	shmfree_desc(par);
+	thread->parallel_ptr = 0;
+    }
+
+    // no task left to run the schedules
+    if (thread->schedule_ptr)
+	shmfree_desc(SHMPTR(thread->schedule_ptr));
+    if (thread->schedule_retired)
+	shmfree_desc(SHMPTR(thread->schedule_retired));
+    thread->schedule_ptr = thread->schedule_inuse = thread->schedule_retired = 0;
+
+    // the task is gone, so the profile has no writer left.
+    // funct entry histograms stay with the recycled entries.
+    if (thread->profile_ptr) {
+	shmfree_desc(SHMPTR(thread->profile_ptr));
+	thread->profile_ptr = 0;
+    }
 
     /* clear the function entry list */
     list_root = &(thread->funct_list);
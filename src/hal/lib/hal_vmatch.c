@@ -0,0 +1,280 @@
+// vectorized change detection for compiled groups and comps
+// see hal_vmatch.h for the layout.
+
+#include "config.h"
+#include "rtapi.h"		/* RTAPI realtime OS API */
+#include "rtapi_bitops.h"
+#include "hal.h"		/* HAL public API decls */
+#include "hal_priv.h"		/* HAL private decls */
+#include "hal_vmatch.h"
+
+#if defined(ULAPI)
+#include <stdlib.h>		/* posix_memalign()/free() */
+
+typedef __u8   vm_u8v  __attribute__((vector_size(VM_VBYTES)));
+typedef __u32  vm_u32v __attribute__((vector_size(VM_VBYTES)));
+typedef __u64  vm_u64v __attribute__((vector_size(VM_VBYTES)));
+typedef double vm_f64v __attribute__((vector_size(VM_VBYTES)));
+
+static const size_t lane_size[VM_NLANES] = {
+    [VM_BIT]   = sizeof(__u8),
+    [VM_W32]   = sizeof(__u32),
+    [VM_W64]   = sizeof(__u64),
+    [VM_FLOAT] = sizeof(double),
+};
+
+static int vm_lane(const hal_type_t type)
+{
+    switch (type) {
+    case HAL_BIT:   return VM_BIT;
+    case HAL_S32:
+    case HAL_U32:   return VM_W32;
+    case HAL_S64:
+    case HAL_U64:   return VM_W64;
+    case HAL_FLOAT: return VM_FLOAT;
+    default:        return -1;
+    }
+}
+
+// number of vectors covering a lane
+static inline int vm_nvec(const hal_vlane_t *l, const size_t size)
+{
+    return (l->n * size + VM_VBYTES - 1) / VM_VBYTES;
+}
+
+// true if any bit in a comparison mask is set
+static inline int vm_any(const vm_u64v m)
+{
+    __u64 any = 0;
+    int i;
+    for (i = 0; i < VM_VBYTES / sizeof(__u64); i++)
+	any |= m[i];
+    return any != 0;
+}
+
+static void *vm_alloc(const int n, const size_t size)
+{
+    size_t bytes = ((n * size + VM_VBYTES - 1) / VM_VBYTES) * VM_VBYTES;
+    void *p;
+
+    if (posix_memalign(&p, VM_VBYTES, bytes))
+	return NULL;
+    memset(p, 0, bytes);
+    return p;
+}
+
+// snapshot all lanes. The value accessor is a parameter so the
+// signal and pin variants each get a loop without a per-value branch.
+#define VM_GATHER(name, value)						\
+    static void name(const hal_vmatch_t *vm)				\
+    {									\
+	const hal_float_t *epsilon = hal_data->epsilon;			\
+	const hal_vlane_t *l;						\
+	int i;								\
+									\
+	l = &vm->lane[VM_BIT];						\
+	for (i = 0; i < l->n; i++)					\
+	    ((__u8 *)l->cur)[i] = get_bit_value(value(l->src[i]));	\
+									\
+	l = &vm->lane[VM_W32];						\
+	for (i = 0; i < l->n; i++)					\
+	    ((__u32 *)l->cur)[i] = get_u32_value(value(l->src[i]));	\
+									\
+	l = &vm->lane[VM_W64];						\
+	for (i = 0; i < l->n; i++)					\
+	    ((__u64 *)l->cur)[i] = get_u64_value(value(l->src[i]));	\
+									\
+	/* epsilons may be changed at any time, so refresh them too */	\
+	l = &vm->lane[VM_FLOAT];					\
+	for (i = 0; i < l->n; i++) {					\
+	    ((double *)l->cur)[i] = get_float_value(value(l->src[i]));	\
+	    l->eps[i] = epsilon[*l->eps_index[i]];			\
+	}								\
+    }
+
+VM_GATHER(gather_sigs, sig_value)
+VM_GATHER(gather_pins, pin_value)
+
+// the same from an array of values, such as a group snapshot,
+// indexed like the changed bitmap
+static void gather_values(const hal_vmatch_t *vm, const hal_data_u *values)
+{
+    const hal_float_t *epsilon = hal_data->epsilon;
+    const hal_vlane_t *l;
+    int i;
+
+    l = &vm->lane[VM_BIT];
+    for (i = 0; i < l->n; i++)
+	((__u8 *)l->cur)[i] = get_bit_value(&values[l->index[i]]);
+
+    l = &vm->lane[VM_W32];
+    for (i = 0; i < l->n; i++)
+	((__u32 *)l->cur)[i] = get_u32_value(&values[l->index[i]]);
+
+    l = &vm->lane[VM_W64];
+    for (i = 0; i < l->n; i++)
+	((__u64 *)l->cur)[i] = get_u64_value(&values[l->index[i]]);
+
+    l = &vm->lane[VM_FLOAT];
+    for (i = 0; i < l->n; i++) {
+	((double *)l->cur)[i] = get_float_value(&values[l->index[i]]);
+	l->eps[i] = epsilon[*l->eps_index[i]];
+    }
+}
+
+// exact comparison of an integer lane: find blocks with differences
+// a vector at a time, then resolve those value by value.
+#define VM_SCAN_EQ(name, type, vtype)					\
+    static int name(hal_vlane_t *l, unsigned long *changed)		\
+    {									\
+	const vtype *cv = l->cur, *tv = l->trk;				\
+	type *cur = l->cur, *trk = l->trk;				\
+	const int per = VM_VBYTES / sizeof(type);			\
+	const int nvec = vm_nvec(l, sizeof(type));			\
+	int v, j, nchanged = 0;						\
+									\
+	for (v = 0; v < nvec; v++) {					\
+	    if (!vm_any((vm_u64v)(cv[v] != tv[v])))			\
+		continue;						\
+	    for (j = v * per; (j < (v + 1) * per) && (j < l->n); j++) {	\
+		if (cur[j] != trk[j]) {					\
+		    trk[j] = cur[j];					\
+		    RTAPI_BIT_SET(changed, l->index[j]);		\
+		    nchanged++;						\
+		}							\
+	    }								\
+	}								\
+	return nchanged;						\
+    }
+
+VM_SCAN_EQ(scan_bit, __u8,  vm_u8v)
+VM_SCAN_EQ(scan_w32, __u32, vm_u32v)
+VM_SCAN_EQ(scan_w64, __u64, vm_u64v)
+
+// a float has changed iff |value - tracking value| > epsilon.
+// the tracking value is only updated on change, so slow drift
+// is caught once it exceeds epsilon.
+static int scan_float(hal_vlane_t *l, unsigned long *changed)
+{
+    const vm_f64v *cv = l->cur, *tv = l->trk, *ev = (vm_f64v *)l->eps;
+    double *cur = l->cur, *trk = l->trk, *eps = (double *)l->eps;
+    const int per = VM_VBYTES / sizeof(double);
+    const int nvec = vm_nvec(l, sizeof(double));
+    int v, j, nchanged = 0;
+
+    for (v = 0; v < nvec; v++) {
+	vm_f64v d = cv[v] - tv[v];
+	if (!vm_any((vm_u64v)((d > ev[v]) | (-d > ev[v]))))
+	    continue;
+	for (j = v * per; (j < (v + 1) * per) && (j < l->n); j++) {
+	    double delta = cur[j] - trk[j];
+	    if (HAL_FABS(delta) > eps[j]) {
+		trk[j] = cur[j];
+		RTAPI_BIT_SET(changed, l->index[j]);
+		nchanged++;
+	    }
+	}
+    }
+    return nchanged;
+}
+
+static inline int scan_lanes(hal_vmatch_t *vm, unsigned long *changed)
+{
+    return scan_bit(&vm->lane[VM_BIT], changed) +
+	scan_w32(&vm->lane[VM_W32], changed) +
+	scan_w64(&vm->lane[VM_W64], changed) +
+	scan_float(&vm->lane[VM_FLOAT], changed);
+}
+
+int hal_vmatch_scan(hal_vmatch_t *vm, unsigned long *changed)
+{
+    if (vm->pins)
+	gather_pins(vm);
+    else
+	gather_sigs(vm);
+    return scan_lanes(vm, changed);
+}
+
+int hal_vmatch_scan_values(hal_vmatch_t *vm, const hal_data_u *values,
+			   unsigned long *changed)
+{
+    gather_values(vm, values);
+    return scan_lanes(vm, changed);
+}
+
+void hal_vmatch_free(hal_vmatch_t *vm)
+{
+    int i;
+
+    if (vm == NULL)
+	return;
+    for (i = 0; i < VM_NLANES; i++) {
+	hal_vlane_t *l = &vm->lane[i];
+	free(l->index);
+	free(l->src);
+	free(l->eps_index);
+	free(l->cur);
+	free(l->trk);
+	free(l->eps);
+    }
+    free(vm);
+}
+
+hal_vmatch_t *hal_vmatch_new(const hal_vmatch_src_t *src, const int n,
+			     const int pins)
+{
+    hal_vmatch_t *vm;
+    int i, lane;
+
+    if ((vm = calloc(1, sizeof(hal_vmatch_t))) == NULL)
+	HALFAIL_NULL(ENOMEM, "allocating a matcher for %d values", n);
+    vm->pins = pins;
+
+    // size the lanes
+    for (i = 0; i < n; i++) {
+	if ((lane = vm_lane(src[i].type)) < 0) {
+	    hal_vmatch_free(vm);
+	    HALFAIL_NULL(EINVAL, "invalid type %d for value %d",
+			 src[i].type, src[i].index);
+	}
+	vm->lane[lane].n++;
+    }
+    for (i = 0; i < VM_NLANES; i++) {
+	hal_vlane_t *l = &vm->lane[i];
+	if (l->n == 0)
+	    continue;
+	l->index = malloc(l->n * sizeof(int));
+	l->src = malloc(l->n * sizeof(void *));
+	l->cur = vm_alloc(l->n, lane_size[i]);
+	l->trk = vm_alloc(l->n, lane_size[i]);
+	if (!l->index || !l->src || !l->cur || !l->trk)
+	    goto nomem;
+	if (i == VM_FLOAT) {
+	    l->eps_index = malloc(l->n * sizeof(__u8 *));
+	    l->eps = vm_alloc(l->n, sizeof(double));
+	    if (!l->eps_index || !l->eps)
+		goto nomem;
+	}
+	l->n = 0; // refilled below
+    }
+
+    // distribute the values
+    for (i = 0; i < n; i++) {
+	hal_vlane_t *l = &vm->lane[vm_lane(src[i].type)];
+	l->index[l->n] = src[i].index;
+	l->src[l->n] = src[i].src;
+	if (l->eps_index)
+	    l->eps_index[l->n] = src[i].eps_index;
+	l->n++;
+    }
+    HALDBG("%d values: %d bit, %d 32bit, %d 64bit, %d float", n,
+	   vm->lane[VM_BIT].n, vm->lane[VM_W32].n,
+	   vm->lane[VM_W64].n, vm->lane[VM_FLOAT].n);
+    return vm;
+
+ nomem:
+    hal_vmatch_free(vm);
+    HALFAIL_NULL(ENOMEM, "allocating a matcher for %d values", n);
+}
+
+#endif // ULAPI
@@ -0,0 +1,79 @@
+#ifndef HAL_VMATCH_H
+#define HAL_VMATCH_H
+
+// vectorized change detection for compiled groups and comps (ULAPI only)
+//
+// hal_cgroup_match() and hal_ccomp_match() used to walk their members
+// one by one, switching on the type of each. Instead, values are
+// segregated by type into lanes at compile time:
+//   - bits as one byte each
+//   - s32 and u32 as 32-bit words (compared for equality only)
+//   - s64 and u64 as 64-bit words
+//   - floats, compared against a per-value epsilon
+// A match gathers the current values into a contiguous per-lane
+// snapshot and compares it against the tracking values VM_VBYTES at a
+// time with GCC vector extensions, which map onto SSE2/NEON as
+// available and fall back to scalar code otherwise. Only blocks with
+// a difference are looked at value by value, so scanning large and
+// mostly idle groups is cheap.
+
+#include <rtapi.h>
+#include <hal.h>
+#include <hal_priv.h>
+
+RTAPI_BEGIN_DECLS
+
+#define VM_VBYTES 16   // bytes compared per vector operation
+
+typedef enum {
+    VM_BIT,
+    VM_W32,
+    VM_W64,
+    VM_FLOAT,
+    VM_NLANES
+} vm_lane_t;
+
+typedef struct {
+    int n;                    // values in this lane
+    int *index;               // bit in the changed bitmap, per value
+    void **src;               // hal_sig_t * or hal_pin_t *, per value
+    const __u8 **eps_index;   // VM_FLOAT only: epsilon selector, per value
+    void *cur;                // snapshot, padded to a multiple of VM_VBYTES
+    void *trk;                // tracking values, same layout
+    hal_float_t *eps;         // VM_FLOAT only: epsilon, same layout
+} hal_vlane_t;
+
+typedef struct hal_vmatch {
+    int pins;                 // src are pins: resolve data_ptr on every scan
+    hal_vlane_t lane[VM_NLANES];
+} hal_vmatch_t;
+
+// a value to watch, as passed to hal_vmatch_new()
+typedef struct {
+    hal_type_t type;
+    int index;                // bit to set in the changed bitmap
+    void *src;                // hal_sig_t * or hal_pin_t *
+    const __u8 *eps_index;    // floats: selects hal_data->epsilon[]
+} hal_vmatch_src_t;
+
+// build a matcher for n values. pins: src refer to pins, else signals.
+// tracking values start out zero, as they did with per-member tracking.
+// returns NULL and sets the HAL error on failure.
+hal_vmatch_t *hal_vmatch_new(const hal_vmatch_src_t *src, const int n,
+			     const int pins);
+
+// take a snapshot, set the bits of changed values in 'changed' (which
+// is not cleared) and update their tracking values.
+// returns the number of changed values.
+int hal_vmatch_scan(hal_vmatch_t *vm, unsigned long *changed);
+
+// the same, taking the current values from values[index] instead of
+// the signals or pins, e.g. from a group snapshot
+int hal_vmatch_scan_values(hal_vmatch_t *vm, const hal_data_u *values,
+			   unsigned long *changed);
+
+void hal_vmatch_free(hal_vmatch_t *vm);
+
+RTAPI_END_DECLS
+
+#endif // HAL_VMATCH_H
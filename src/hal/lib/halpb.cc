@@ -123,6 +123,22 @@ int halpr_describe_funct(hal_funct_t *funct, machinetalk::Function *pbfunct)
     return 0;
 }
 
+static void describe_profhist(const hal_profhist_t *h,
+			      machinetalk::ProfileStats *pbstats)
+{
+    hal_profhist_t copy;
+
+    if (hal_profhist_snapshot(h, &copy))
+	return;
+    pbstats->set_count(copy.count);
+    pbstats->set_min(copy.min);
+    pbstats->set_max(copy.max);
+    pbstats->set_mean(copy.count ? copy.sum / copy.count : 0);
+    pbstats->set_p50(hal_profhist_percentile(&copy, 0.5));
+    pbstats->set_p99(hal_profhist_percentile(&copy, 0.99));
+    pbstats->set_p999(hal_profhist_percentile(&copy, 0.999));
+}
+
 int halpr_describe_thread(hal_thread_t *thread, machinetalk::Thread *pbthread)
 {
     pbthread->set_name(ho_name(thread));
@@ -143,6 +159,26 @@ int halpr_describe_thread(hal_thread_t *thread, machinetalk::Thread *pbthread)
 	pbthread->add_function(hh_get_name(&funct->hdr));
 	list_entry = (hal_list_t *)dlist_next(list_entry);
     }
+
+    hal_thread_profile_t *tp = thread_profile(thread);
+    if (tp == NULL)
+	return 0;
+    describe_profhist(&tp->runtime, pbthread->mutable_runtime_profile());
+    describe_profhist(&tp->jitter, pbthread->mutable_jitter_profile());
+    pbthread->set_overruns(tp->overruns);
+
+    list_entry = (hal_list_t *) dlist_next(list_root);
+    while (list_entry != list_root) {
+	hal_funct_entry_t *fentry = (hal_funct_entry_t *) list_entry;
+	hal_funct_t *funct = (hal_funct_t *) SHMPTR(fentry->funct_ptr);
+	hal_profhist_t *h = funct_entry_profile(fentry);
+	if (h) {
+	    machinetalk::ProfileStats *pbstats = pbthread->add_function_profile();
+	    pbstats->set_name(hh_get_name(&funct->hdr));
+	    describe_profhist(h, pbstats);
+	}
+	list_entry = (hal_list_t *)dlist_next(list_entry);
+    }
     return 0;
 }
 
@@ -222,6 +222,7 @@ struct halcmd_command halcmd_commands[] = {
     {"delthread",  FUNCT(do_delthread_cmd),  A_ONE },
     {"getp",    FUNCT(do_getp_cmd),    A_ONE },
     {"gets",    FUNCT(do_gets_cmd),    A_ONE },
+    {"profile", FUNCT(do_profile_cmd), A_ONE | A_OPTIONAL | A_PLUS },
     {"ptype",   FUNCT(do_ptype_cmd),   A_ONE },
     {"stype",   FUNCT(do_stype_cmd),   A_ONE },
     {"help",    FUNCT(do_help_cmd),    A_ONE | A_OPTIONAL },
@@ -47,6 +47,7 @@
 #include "hal_ring.h"	        /* ringbuffer declarations */
 #include "hal_group.h"	        /* group/member declarations */
 #include "hal_rcomp.h"	        /* remote component declarations */
+#include "hal_profile.h"	/* thread profiling */
 #include "halcmd_commands.h"
 #include "halcmd_rtapiapp.h"
 #include "rtapi_hexdump.h"
@@ -1624,6 +1625,91 @@ int do_shutdown_cmd(void)
     return retval;
 }
 
+static void print_profile_row(const char *name, const hal_profhist_t *h)
+{
+    hal_profhist_t copy;
+
+    if (hal_profhist_snapshot(h, &copy)) {
+	halcmd_output("  %-40s (busy, try again)\n", name);
+	return;
+    }
+    halcmd_output("  %-40s %10llu %8d %8d %8d %8d %8d %8llu\n",
+		  name,
+		  (unsigned long long) copy.count,
+		  copy.min,
+		  hal_profhist_percentile(&copy, 0.5),
+		  hal_profhist_percentile(&copy, 0.99),
+		  hal_profhist_percentile(&copy, 0.999),
+		  copy.max,
+		  (unsigned long long) (copy.count ? copy.sum / copy.count : 0));
+}
+
+static int print_profile_entry(hal_object_ptr o, foreach_args_t *args)
+{
+    hal_thread_t *tptr = o.thread;
+    hal_thread_profile_t *tp = thread_profile(tptr);
+    char **patterns = args->user_ptr1;
+
+    if (!match(patterns, ho_name(tptr)))
+	return 0;
+
+    if (tp == NULL) {
+	halcmd_output("Thread %s: not profiled\n\n", ho_name(tptr));
+	return 0;
+    }
+    halcmd_output("Thread %s: profiling %s, cycles=%u overruns=%llu%s\n",
+		  ho_name(tptr),
+		  tp->enabled ? "on" : "off",
+		  tptr->cycles,
+		  (unsigned long long) tp->overruns,
+		  tp->reset_req != tp->reset_ack ? " (reset pending)" : "");
+    halcmd_output("  %-40s %10s %8s %8s %8s %8s %8s %8s\n",
+		  "nsec", "count", "min", "p50", "p99", "p99.9", "max", "mean");
+    print_profile_row("runtime", &tp->runtime);
+    print_profile_row("jitter", &tp->jitter);
+
+    hal_list_t *list_root = &(tptr->funct_list);
+    hal_list_t *list_entry = dlist_next(list_root);
+    while (list_entry != list_root) {
+	hal_funct_entry_t *fentry = (hal_funct_entry_t *) list_entry;
+	hal_funct_t *funct = SHMPTR(fentry->funct_ptr);
+	hal_profhist_t *h = funct_entry_profile(fentry);
+	if (h)
+	    print_profile_row(ho_name(funct), h);
+	list_entry = dlist_next(list_entry);
+    }
+    halcmd_output("\n");
+    return 0;
+}
+
+int do_profile_cmd(char *action, char **patterns)
+{
+    int retval = 0;
+    // profile on/off/reset take a single optional thread name
+    char *name = (patterns && patterns[0] && strlen(patterns[0])) ?
+	patterns[0] : NULL;
+
+    if ((action == NULL) || (strcmp(action, "show") == 0)) {
+	foreach_args_t args =  {
+	    .type = HAL_THREAD,
+	    .user_ptr1 = patterns
+	};
+	halg_foreach(true, &args, print_profile_entry);
+    } else if (strcmp(action, "on") == 0) {
+	retval = halg_thread_profile(1, name, 1);
+    } else if (strcmp(action, "off") == 0) {
+	retval = halg_thread_profile(1, name, 0);
+    } else if (strcmp(action, "reset") == 0) {
+	retval = halg_thread_profile_reset(1, name);
+    } else {
+	halcmd_error("Unknown 'profile' action '%s'\n", action);
+	return -1;
+    }
+    if (retval)
+	halcmd_error("profile %s failed: %s\n", action, hal_lasterror());
+    return retval;
+}
+
 int do_sweep_cmd(char *flags)
 {
     bool log = (flags && strlen(flags));
@@ -2468,8 +2554,10 @@ static int print_heap(char **patterns)
     if (MMAP_OK(hal_data)) {
 	struct rtapi_heap_stat hs;
 	rtapi_heap_status(&hal_data->heap, &hs);
-	halcmd_output("total_avail=%zu fragments=%zu largest=%zu\n",
-		      hs.total_avail, hs.fragments, hs.largest);
+	halcmd_output("total_avail=%zu fragments=%zu largest=%zu"
+		      " slab_carved=%zu slab_avail=%zu\n",
+		      hs.total_avail, hs.fragments, hs.largest,
+		      hs.slab_carved, hs.slab_avail);
     }
     return 0;
 }
@@ -2482,6 +2570,26 @@ static void print_thread_stats(hal_thread_t *tptr)
     flavor_task_print_thread_stats_hook(NULL, tptr->task_id);
 }
 
+// the stage of a funct in the schedule of a thread with workers,
+// -1 if it has no stages (serial, or not started yet)
+static int funct_stage(hal_thread_t *tptr, hal_funct_entry_t *fentry)
+{
+    int i, k;
+
+    if (!tptr->parallel_ptr || !tptr->schedule_ptr)
+	return -1;
+    hal_schedule_t *sched = SHMPTR(tptr->schedule_ptr);
+    int *stage_end = schedule_stage_end(sched);
+
+    for (i = 0; i < sched->nfuncts; i++)
+	if (sched->entry[i].entry_ptr == SHMOFF(fentry))
+	    break;
+    for (k = 0; k < sched->nstages; k++)
+	if (i < stage_end[k])
+	    return k;
+    return -1;
+}
+
 static int print_thread_entry(hal_object_ptr o, foreach_args_t *args)
 {
     hal_thread_t *tptr = o.thread;
@@ -2492,10 +2600,15 @@ static int print_thread_entry(hal_object_ptr o, foreach_args_t *args)
     if (match(patterns, ho_name(tptr))) {
 	// note that the scriptmode format string has no \n
 	// TODO FIXME add thread runtime and max runtime to this print
-	    char flags[100];
-	    snprintf(flags, sizeof(flags),"%s%s",
+	    char flags[100], workers[20] = "";
+	    if (tptr->parallel_ptr) {
+		hal_parallel_t *par = SHMPTR(tptr->parallel_ptr);
+		snprintf(workers, sizeof(workers), " workers=%d", par->nworkers);
+	    }
+	    snprintf(flags, sizeof(flags),"%s%s%s",
 		     tptr->flags & TF_NONRT ? "posix ":"",
-		     tptr->flags & TF_NOWAIT ? "nowait":"");
+		     tptr->flags & TF_NOWAIT ? "nowait":"",
+		     workers);
 	halcmd_output(((scriptmode == 0) ?
 		       "%11ld  %-3s %-2d   %-40s  %8u, %8u %3ld%% %3ld%%  +/-%5.2f%% %s\n" :
 		       "%ld %s %d %s %u %u %3ld%% %3ld%% %.2f"),
@@ -2521,8 +2634,13 @@ static int print_thread_entry(hal_object_ptr o, foreach_args_t *args)
 	    /* scriptmode only uses one line per thread, which contains:
 	       thread period, FP flag, name, then all functs separated by spaces  */
 	    if (scriptmode == 0) {
-		halcmd_output("                   %2d %s\n", n,
-			      ho_name(funct));
+		int stage = funct_stage(tptr, fentry);
+		if (stage < 0)
+		    halcmd_output("                   %2d %s\n", n,
+				  ho_name(funct));
+		else
+		    halcmd_output("                   %2d %-40s stage %d\n", n,
+				  ho_name(funct), stage);
 	    } else {
 		halcmd_output(" %s", ho_name(funct));
 	    }
@@ -2707,6 +2825,15 @@ static void print_mem_status()
 	halcmd_output("  heap: requested=%zu allocated=%zu freed=%zu waste=%zu%%\n",
 		      hs.requested, hs.allocated, hs.freed,
 		      (hs.allocated - hs.requested)*100/hs.allocated);
+    halcmd_output("  heap: slabs carved=%zu avail=%zu\n",
+		  hs.slab_carved, hs.slab_avail);
+    int c;
+    for (c = 0; c < RTAPI_HEAP_NCLASSES; c++) {
+	struct rtapi_slab_stat *ss = &hs.slab[c];
+	if (ss->carved)
+	    halcmd_output("    size %4zu: carved=%zu inuse=%zu hiwater=%zu\n",
+			  ss->size, ss->carved, ss->inuse, ss->hiwater);
+    }
 
     halcmd_output("  hal_malloc():   %zu, mostly by comps\n",
 		  hal_data->hal_malloced);
@@ -2720,6 +2847,14 @@ static void print_mem_status()
 		  hal_data->str_alloc - hal_data->str_freed);
     halcmd_output("  unused:   %ld\n",
 		  (long)( hal_data->shmem_top - hal_data->shmem_bot));
+    halcmd_output("  name index: entries=%u buckets=%u resizes=%u\n",
+		  hal_data->name_index.entries,
+		  hal_data->name_index.nbuckets,
+		  hal_data->name_index.resizes);
+    halcmd_output("  id index:   entries=%u buckets=%u resizes=%u\n",
+		  hal_data->id_index.entries,
+		  hal_data->id_index.nbuckets,
+		  hal_data->id_index.resizes);
 
     halcmd_output("HAL objects\n");
 
@@ -3041,6 +3176,8 @@ int do_newg_cmd(char *group,char **opt)
 			arg2 |= GROUP_REPORT_CHANGED_MEMBERS;
 		    } else if (!strcmp(s1, "reportall")) {
 			arg2 &= ~GROUP_REPORT_CHANGED_MEMBERS;
+		    } else if (!strcmp(s1, "packed")) {
+			arg2 |= GROUP_REPORT_PACKED;
 		    } else {
 			// try to convert from integer
 			arg2 = 	strtol(s1, &cp, 0);
@@ -3254,6 +3391,7 @@ static int print_ring_entry(hal_object_ptr o, foreach_args_t *args)
 	case RINGTYPE_RECORD:    rtype = "record"; break;
 	case RINGTYPE_MULTIPART: rtype = "multi"; break;
 	case RINGTYPE_STREAM:    rtype = "stream"; break;
+	case RINGTYPE_MPMC:      rtype = "mpmc"; break;
 	}
 	halcmd_output("%-5d %-40.40s %-10u %-6.6s %d/%d %d/%d %-3d",
 		      ho_id(rptr),
@@ -3271,6 +3409,9 @@ static int print_ring_entry(hal_object_ptr o, foreach_args_t *args)
 	if (rh->type == RINGTYPE_STREAM)
 	    halcmd_output(" free:%u ",
 			  stream_write_space(rh));
+	else if (rh->type == RINGTYPE_MPMC)
+	    halcmd_output(" slots:%u recmax:%u ",
+			  mpmc_slots(rh), mpmc_record_max(rh));
 	else
 	    halcmd_output(" recmax:%u ",
 			  record_write_space(rh));
@@ -3309,6 +3450,7 @@ int do_newring_cmd(char *ring, char *ring_size, char **opt)
 {
     int size = -1;
     int spsize = 0;
+    int recsize = -1;
     char *r = ring_size;
     size_t rmax = 50000000;  // XXX: make MAX_RINGSIZE
     char *s;
@@ -3319,6 +3461,7 @@ int do_newring_cmd(char *ring, char *ring_size, char **opt)
 
 
 #define SCRATCHPAD "scratchpad="
+#define RECSIZE "recsize="
 #define ENCODINGS "encodings="
 #define PAIRED "paired="
 #define ZMQTYPE "zmq="
@@ -3346,6 +3489,18 @@ int do_newring_cmd(char *ring, char *ring_size, char **opt)
 	    mode |=  RINGTYPE_STREAM;
 	} else if  (!strcasecmp(s,"multi")) {
 	    mode |=  RINGTYPE_MULTIPART;
+	} else if  (!strcasecmp(s,"mpmc")) {
+	    mode |=  RINGTYPE_MPMC;
+	} else if (!strncasecmp(s, RECSIZE, strlen(RECSIZE))) {
+	    recsize = strtol(strchr(s,'=') + 1, &cp, 0);
+	    if ((*cp != '\0') && (!isspace(*cp))) {
+		halcmd_error("string '%s' invalid for record size\n", s);
+		return(-EINVAL);
+	    }
+	    if ((recsize < 0) || (recsize > rmax)) {
+		halcmd_error("record size out of bounds (0..%zu)\n", rmax);
+		return(-EINVAL);
+	    }
 	} else if (!strncasecmp(s, SCRATCHPAD, strlen(SCRATCHPAD))) {
 	    spsize = strtol(strchr(s,'=') + 1, &cp, 0);
 	    if ((*cp != '\0') && (!isspace(*cp))) {
@@ -3360,10 +3515,27 @@ int do_newring_cmd(char *ring, char *ring_size, char **opt)
 
 	} else {
 	    halcmd_error("newring: invalid option '%s' (use one or several of: record stream multi"
-			 " rtapi hal rmutex wmutex scratchpad=<size>)\n",s);
+			 " mpmc rtapi hal rmutex wmutex scratchpad=<size> recsize=<size>)\n",s);
 	    return -EINVAL;
 	}
     }
+    // MPMC rings: the size argument is the number of slots
+    if ((mode & RINGTYPE_MASK) == RINGTYPE_MPMC) {
+	if (recsize < 0) {
+	    halcmd_error("newring: mpmc ring %s needs recsize=<size>\n", ring);
+	    return -EINVAL;
+	}
+	if (halg_ring_new_mpmcf(1, size, recsize, spsize, mode, ring) == NULL) {
+	    halcmd_error("newring: failed to create new ring %s: %s\n",
+			 ring, hal_lasterror());
+	    retval =  _halerrno;
+	}
+	return retval;
+    }
+    if (recsize >= 0) {
+	halcmd_error("newring: recsize=<size> applies to mpmc rings only\n");
+	return -EINVAL;
+    }
     // this will happen under hal_data->mutex locked
     if (halg_ring_newf(1, size, spsize, mode, ring) == NULL) {
 	halcmd_error("newring: failed to create new ring %s: %s\n",
@@ -3423,6 +3595,14 @@ static int ringdump(const char *name, ringbuffer_t *rb, void *arg)
     int result;
 
     switch (rh->type) {
+    case RINGTYPE_MPMC:
+	// reading an MPMC ring consumes, so just report the fill level
+	halcmd_output("%s: mpmc ring, %u of %u slots in use\n", name,
+		      rtapi_load_u32(&rb->trailer->tail) -
+		      rtapi_load_u32(&rh->head),
+		      mpmc_slots(rh));
+	break;
+
     default:
 	halcmd_output("%s: %s ring\n", name, rh->type == RINGTYPE_RECORD? "record" : "multi");
 
@@ -3627,6 +3807,24 @@ static int ringwrite(const char *name, ringbuffer_t *rb, void *arg)
 		halcmd_error("%s: '%s' - space only for %zu out of %zu bytes\n",
 			     name, data, size, wsize);
 	    }
+	    break;
+	case RINGTYPE_MPMC:
+	    if (have_flag) {
+		halcmd_error("flag %d has no meaning for mpmc ring '%s'\n",
+			     flags, name);
+		break;
+	    }
+	    retval = mpmc_write(rb, data, wsize);
+	    switch (retval) {
+	    case EAGAIN:
+		halcmd_error("%s: no free slot\n", name);
+		break;
+	    case ERANGE:
+		halcmd_error("%s: write size %zu exceeds record size %u\n",
+			     name, wsize, mpmc_record_max(rh));
+		break;
+	    default: ; // success
+	    }
 	}
     }
     switch (rh->type) {
@@ -3663,6 +3861,10 @@ static int ringflush(const char *name, ringbuffer_t *rb, void *arg)
 	n = stream_flush(rb);
 	halcmd_output("%s: %zu bytes flushed\n", name, n);
 	break;
+    case RINGTYPE_MPMC:
+	result = mpmc_flush(rb);
+	halcmd_output("%s: %d records flushed\n", name, result);
+	break;
     }
     return 0;
 }
@@ -3711,6 +3913,8 @@ int do_newcomp_cmd(char *comp, char *opt[])
 		    // handle keyword-only arguments
 		    if (!strcmp(s1, "acceptdefaults")) {
 			arg2 |=RCOMP_ACCEPT_VALUES_ON_BIND;
+		    } else if (!strcmp(s1, "packed")) {
+			arg2 |= RCOMP_REPORT_PACKED;
 #if 0 // handle more keywords like so:
 		    } else if (!strcmp(s1, "thatflag")) {
 			arg2 |= RCOMP_THATFLAG;
@@ -4337,6 +4541,7 @@ int do_newthread_cmd(char *name, char *args[])
     char *s;
     int per = 1000000;
     int flags = 0;
+    int workers = 0;
 
     for (i = 0; ((s = args[i]) != NULL) && strlen(s); i++) {
 	if (sscanf(s, "cpu=%d", &cpu) == 1)
@@ -4359,6 +4564,8 @@ int do_newthread_cmd(char *name, char *args[])
 	}
 	if (sscanf(s, "cgname=%s", cgname) == 1)
             continue;
+	if (sscanf(s, "workers=%d", &workers) == 1)
+	    continue;
 	char *cp = s;
 	per = strtol(s, &cp, 0);
 	if ((*cp != '\0') && (!isspace(*cp))) {
@@ -4374,7 +4581,7 @@ int do_newthread_cmd(char *name, char *args[])
     }
 
     retval = rtapi_newthread(rtapi_instance, name, per, cpu, cgname,
-                             (int)use_fp, flags);
+                             (int)use_fp, flags, workers);
     if (retval)
 	halcmd_error("rc=%d: %s\n",retval,rtapi_rpcerror());
 
@@ -4537,6 +4744,13 @@ int do_help_cmd(char *command)
 	printf("  'type' is 'lock', 'mem', or 'all'. \n");
 	printf("  If 'type' is omitted, it assumes\n");
 	printf("  'all'.\n");
+    } else if (strcmp(command, "profile") == 0) {
+	printf("profile [on|off|reset|show] [thread ...]\n");
+	printf("  Controls the execution profiler of realtime threads.\n");
+	printf("  'on' and 'off' enable or disable profiling, 'reset' clears\n");
+	printf("  the histograms. Without a thread name all threads are used.\n");
+	printf("  'show' (default) prints count, min, percentiles, max and\n");
+	printf("  mean in nsec of thread runtime, period jitter and each funct.\n");
     } else if (strcmp(command, "save") == 0) {
 	printf("save [type] [filename]\n");
 	printf("  Prints HAL state to 'filename' (or stdout), as a series\n");
@@ -4612,6 +4826,7 @@ static void print_help_commands(void)
     printf("  status              Display status information\n");
     printf("  save                Print config as commands\n");
     printf("  start, stop         Start/stop realtime threads\n");
+    printf("  profile             Profile realtime thread execution times\n");
     printf("  alias, unalias      Add or remove pin or parameter name aliases\n");
     printf("  echo, unecho        Echo commands from stdin to stderr\n");
     printf("  quit, exit          Exit from halcmd\n");
@@ -124,6 +124,7 @@ extern bool inst_name_exists(const int use_halmutex, char *name);
 extern int do_shutdown_cmd(void);
 // HAL object garbage collector
 extern int do_sweep_cmd(char *flags);
+extern int do_profile_cmd(char *action, char **patterns);
 // ping the RTAPI stack
 extern int do_ping_cmd(void);
 // create a new named RT thread
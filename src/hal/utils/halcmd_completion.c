@@ -54,7 +54,7 @@ static const char *command_table[] = {
     "linkps", "linksp", "linkpp", "unlinkp",
     "net", "newsig", "delsig", "getp", "gets", "setp", "sets", "sete", "ptype", "stype",
     "addf", "call", "delf", "show", "list", "status", "save", "source","sweep",
-    "start", "stop", "quit", "exit", "help",
+    "start", "stop", "profile", "quit", "exit", "help",
     "newg"," delg", "newm", "delm",
     "newring","delring","ringdump","ringwrite","ringflush",
     "newcomp","newpin","ready","waitbound", "waitunbound", "waitexists",
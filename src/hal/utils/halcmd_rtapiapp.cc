@@ -196,7 +196,7 @@ int rtapi_ping(int instance)
 
 int rtapi_newthread(
     int instance, const char *name, int period, int cpu,
-    char *cgname, int use_fp, int flags)
+    char *cgname, int use_fp, int flags, int workers)
 {
     machinetalk::RTAPICommand *cmd;
     command.Clear();
@@ -209,6 +209,7 @@ int rtapi_newthread(
     cmd->set_use_fp(use_fp);
     cmd->set_flags(flags);
     cmd->set_cgname(cgname);
+    cmd->set_workers(workers);
 
     int retval = rtapi_rpc(z_command, command, reply);
     if (retval)
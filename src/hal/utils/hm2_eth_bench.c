@@ -0,0 +1,287 @@
+/********************************************************************
+* Description:  hm2_eth_bench.c
+*               Round trip benchmark for LBP16 over UDP, against a
+*               Mesa ethernet board or hm2_eth_emu.
+*
+*               Each cycle does what hm2_eth does in a servo cycle:
+*               send the queued reads (TRAM reads, plus the comm
+*               control and timer accesses hm2_eth uses to match the
+*               reply to the request), wait for the reply, then send
+*               the queued writes. Read round trip and cycle times are
+*               reported as percentiles.
+*
+* This program is free software; you can redistribute it and/or
+* modify it under the terms of version 2 of the GNU General
+* Public License as published by the Free Software Foundation.
+********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <getopt.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "rtapi_int.h"
+#include "hal/drivers/mesa-hostmot2/lbp16.h"
+
+#define MAX_PACKET 1400       // as in hm2_eth.h
+#define TRAM_BASE  0x1000
+#define RECV_TIMEOUT_US 100   // as in hm2_eth.c
+
+typedef struct {
+    u8 buf[MAX_PACKET];
+    int size;
+} packet_t;
+
+static long long now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+static int put_cmd(packet_t *p, u16 cmd, u16 addr, const void *data, int size)
+{
+    if (p->size + (int)sizeof(lbp16_cmd_addr) + size > MAX_PACKET)
+        return -1;
+    LBP16_INIT_PACKET4_PTR((lbp16_cmd_addr *)(p->buf + p->size), cmd, addr);
+    p->size += sizeof(lbp16_cmd_addr);
+    if (data) {
+        memcpy(p->buf + p->size, data, size);
+        p->size += size;
+    }
+    return 0;
+}
+
+// TRAM reads or writes of 'bytes', split into LBP16 commands
+static int put_tram(packet_t *p, int write, int bytes, const void *data)
+{
+    int addr = TRAM_BASE, words;
+
+    for (; bytes > 0; bytes -= words * 4, addr += words * 4) {
+        words = bytes / 4 > LBP16_MAX_PACKET_DATA_SIZE ?
+            LBP16_MAX_PACKET_DATA_SIZE : bytes / 4;
+        if (put_cmd(p, write ? CMD_WRITE_HOSTMOT2_ADDR32_INCR(words) :
+                    CMD_READ_HOSTMOT2_ADDR32_INCR(words),
+                    addr, write ? data : NULL, write ? words * 4 : 0) < 0)
+            return -1;
+        if (data)
+            data = (const u8 *)data + words * 4;
+    }
+    return 0;
+}
+
+static int cmp_ll(const void *a, const void *b)
+{
+    long long x = *(const long long *)a, y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+static void report(const char *what, long long *t, long n)
+{
+    static const double pct[] = { 50, 90, 99, 99.9 };
+    int i;
+
+    if (n == 0) {
+        printf("%s: no samples\n", what);
+        return;
+    }
+    qsort(t, n, sizeof(*t), cmp_ll);
+    printf("%s usec: min %.1f", what, t[0] / 1e3);
+    for (i = 0; i < sizeof(pct) / sizeof(pct[0]); i++)
+        printf(" p%g %.1f", pct[i], t[(long)(pct[i] / 100 * (n - 1))] / 1e3);
+    printf(" max %.1f\n", t[n - 1] / 1e3);
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "Usage: hm2_eth_bench [options] [board-ip]\n"
+        "Measure LBP16 read round trips the way hm2_eth does them.\n"
+        "board-ip defaults to 127.0.0.1, for hm2_eth_emu.\n"
+        "  -P port     UDP port of the board (default %d)\n"
+        "  -n cycles   number of cycles (default 10000)\n"
+        "  -r bytes    TRAM bytes read per cycle (default 64)\n"
+        "  -w bytes    TRAM bytes written per cycle (default 64)\n"
+        "  -p usec     cycle period; 0 runs cycles back to back (default 0)\n"
+        "  -t usec     read timeout per cycle (default 1000)\n"
+        "  -b usec     SO_BUSY_POLL time for receives\n"
+        "  -o file     write each read round trip time in usec to file\n",
+        LBP16_UDP_PORT);
+}
+
+int main(int argc, char **argv)
+{
+    const char *board = "127.0.0.1", *outfile = NULL;
+    int port = LBP16_UDP_PORT, rbytes = 64, wbytes = 64;
+    long cycles = 10000, period = 0, timeout = 1000;
+    int busy_poll = 0, c, fd;
+    long i, nrtt = 0, ncycle = 0;
+    long timeouts = 0, wrong_seq = 0, lost_writes = 0;
+    u32 read_cnt = 0, write_cnt = 0;
+    struct sockaddr_in sa;
+    FILE *out = NULL;
+
+    while ((c = getopt(argc, argv, "P:n:r:w:p:t:b:o:h")) != -1) {
+        switch (c) {
+        case 'P': port = atoi(optarg); break;
+        case 'n': cycles = atol(optarg); break;
+        case 'r': rbytes = atoi(optarg) & ~3; break;
+        case 'w': wbytes = atoi(optarg) & ~3; break;
+        case 'p': period = atol(optarg); break;
+        case 't': timeout = atol(optarg); break;
+        case 'b': busy_poll = atoi(optarg); break;
+        case 'o': outfile = optarg; break;
+        default:
+            usage();
+            exit(c == 'h' ? 0 : 1);
+        }
+    }
+    if (optind < argc)
+        board = argv[optind++];
+    if (optind != argc || cycles <= 0 || rbytes < 0 || wbytes < 0 ||
+        period < 0 || timeout <= 0) {
+        usage();
+        exit(1);
+    }
+
+    if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
+        perror("hm2_eth_bench: socket");
+        exit(1);
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    if (inet_aton(board, &sa.sin_addr) == 0) {
+        fprintf(stderr, "hm2_eth_bench: invalid address '%s'\n", board);
+        exit(1);
+    }
+    if (connect(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+        perror("hm2_eth_bench: connect");
+        exit(1);
+    }
+    struct timeval tv = { 0, RECV_TIMEOUT_US };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    if (busy_poll &&
+        setsockopt(fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll)) < 0)
+        perror("hm2_eth_bench: SO_BUSY_POLL");
+
+    if (outfile && (out = fopen(outfile, "w")) == NULL) {
+        perror(outfile);
+        exit(1);
+    }
+
+    // identify the board
+    {
+        packet_t p = { .size = 0 };
+        char name[17] = { 0 };
+        long long deadline = now_ns() + 200 * 1000000LL;
+        int res = -1;
+
+        put_cmd(&p, CMD_READ_BOARD_INFO_ADDR16_INCR(16 / 2), 0, NULL, 0);
+        send(fd, p.buf, p.size, 0);
+        while (res < 0 && now_ns() < deadline)
+            res = recv(fd, name, 16, 0);
+        if (res != 16) {
+            fprintf(stderr, "hm2_eth_bench: no response from %s:%d\n", board, port);
+            exit(1);
+        }
+        printf("board: %.16s at %s:%d\n", name, board, port);
+    }
+
+    long long *rtt = malloc(cycles * sizeof(long long));
+    long long *cycle = malloc(cycles * sizeof(long long));
+    u8 *tram = calloc(1, wbytes + rbytes + 16);
+    int reply_size = rbytes + 2 + 8;
+    u8 *reply = malloc(reply_size + 64);
+    long long next = now_ns();
+
+    if (!rtt || !cycle || !tram || !reply) {
+        fprintf(stderr, "hm2_eth_bench: out of memory\n");
+        exit(1);
+    }
+
+    for (i = 0; i < cycles; i++) {
+        packet_t rp = { .size = 0 }, wp = { .size = 0 };
+        long long t0, t1, deadline;
+        u32 confirm[2];
+        int res;
+
+        if (period) {
+            struct timespec ts;
+            next += period * 1000;
+            ts.tv_sec = next / 1000000000;
+            ts.tv_nsec = next % 1000000000;
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+                ;
+        }
+
+        // queued reads, as hm2_eth_send_queued_reads() sends them
+        read_cnt++;
+        if (put_tram(&rp, 0, rbytes, NULL) < 0 ||
+            put_cmd(&rp, CMD_READ_COMM_CTRL_ADDR16(1), 0x8, NULL, 0) < 0 ||
+            put_cmd(&rp, CMD_WRITE_TIMER_ADDR16_INCR(2), 0x10, &read_cnt, 4) < 0 ||
+            put_cmd(&rp, CMD_READ_TIMER_ADDR16_INCR(4), 0x10, NULL, 0) < 0) {
+            fprintf(stderr, "hm2_eth_bench: read packet too large\n");
+            exit(1);
+        }
+
+        t0 = now_ns();
+        deadline = t0 + timeout * 1000;
+        if (send(fd, rp.buf, rp.size, 0) < 0) {
+            perror("hm2_eth_bench: send");
+            exit(1);
+        }
+        do {
+            res = recv(fd, reply, reply_size + 64, 0);
+            t1 = now_ns();
+            if (res != reply_size)
+                continue;
+            memcpy(confirm, reply + rbytes + 2, sizeof(confirm));
+            if (confirm[0] == read_cnt)
+                break;
+            wrong_seq++;
+            res = -1;
+        } while (t1 < deadline);
+
+        if (res != reply_size) {
+            timeouts++;
+        } else {
+            rtt[nrtt++] = t1 - t0;
+            if (out)
+                fprintf(out, "%.1f\n", (t1 - t0) / 1e3);
+            if (write_cnt && confirm[1] != write_cnt)
+                lost_writes++;
+            memcpy(tram, reply, rbytes < wbytes ? rbytes : wbytes);
+        }
+
+        // queued writes, as hm2_eth_send_queued_writes() sends them
+        write_cnt++;
+        if (put_tram(&wp, 1, wbytes, tram) < 0 ||
+            put_cmd(&wp, CMD_WRITE_TIMER_ADDR16_INCR(2), 0x14, &write_cnt, 4) < 0) {
+            fprintf(stderr, "hm2_eth_bench: write packet too large\n");
+            exit(1);
+        }
+        if (send(fd, wp.buf, wp.size, 0) < 0) {
+            perror("hm2_eth_bench: send");
+            exit(1);
+        }
+        cycle[ncycle++] = now_ns() - t0;
+    }
+
+    printf("cycles %ld read %d bytes write %d bytes: "
+           "timeouts %ld wrong-seq %ld lost-writes %ld\n",
+           cycles, rbytes, wbytes, timeouts, wrong_seq, lost_writes);
+    report("read round trip", rtt, nrtt);
+    report("cycle", cycle, ncycle);
+
+    if (out)
+        fclose(out);
+    close(fd);
+    return 0;
+}
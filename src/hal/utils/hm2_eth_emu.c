@@ -0,0 +1,365 @@
+/********************************************************************
+* Description:  hm2_eth_emu.c
+*               Emulates a Mesa ethernet AnyIO board: serves LBP16
+*               over UDP, so hm2_eth and hm2_eth_bench can be run
+*               without hardware, over loopback or a veth pair.
+*
+*               The emulated board has an IDROM with 3 ports of 17
+*               GPIOs, a watchdog and optionally encoders (whose
+*               counter and latch/control registers hm2 reads as one
+*               burst, longer than one LBP16 command for 64 of them),
+*               and answers the spaces hm2_eth
+*               uses: the HostMot2 register file, the ethernet EEPROM
+*               (for the hardware address), timers (which hm2_eth uses
+*               to tag its packets), comm control and board info.
+*               HostMot2 registers just hold what was written to them.
+*
+*               Responses can be delayed and requests dropped, to
+*               reproduce a slow or lossy link.
+*
+* This program is free software; you can redistribute it and/or
+* modify it under the terms of version 2 of the GNU General
+* Public License as published by the Free Software Foundation.
+********************************************************************/
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <getopt.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "rtapi_int.h"
+#include "hal/drivers/mesa-hostmot2/lbp16.h"
+
+#define SPACE_SIZE 0x10000
+#define NUM_SPACES LBP16_MEM_SPACE_COUNT
+
+// LBP16 command word fields, see lbp16.h
+#define CMD_COUNT(cmd)  ((cmd) & LBP16_MAX_PACKET_DATA_SIZE)
+#define CMD_INC(cmd)    ((cmd) & LBP16_ADDR_AUTO_INC)
+#define CMD_WIDTH(cmd)  (1 << (((cmd) >> 8) & 3))
+#define CMD_SPACE(cmd)  (((cmd) >> 10) & 7)
+#define CMD_INFO(cmd)   ((cmd) & LBP16_INFO_ACC)
+#define CMD_HAS_ADDR(cmd) ((cmd) & LBP16_ADDR)
+#define CMD_WRITE(cmd)  ((cmd) & LBP16_WRITE)
+
+// HostMot2 register file layout, see hostmot2.h
+#define HM2_ADDR_IOCOOKIE     0x0100
+#define HM2_IOCOOKIE          0x55AACAFE
+#define HM2_ADDR_CONFIGNAME   0x0104
+#define HM2_ADDR_IDROM_OFFSET 0x010C
+#define IDROM                 0x0400
+#define IDROM_MODULES         0x0040   // relative to IDROM
+#define IDROM_PINS            0x0200
+#define GTAG_WATCHDOG         2
+#define GTAG_IOPORT           3
+#define GTAG_ENCODER          4
+#define ENCODER_BASE          0x3000
+#define MAX_ENCODERS          64
+#define NUM_PORTS             3
+#define PORT_WIDTH            17
+
+// comm control space, see lbp_status_area in lbp16.h
+#define COMM_PARSE_ERRORS     0x02
+#define COMM_RX_PACKETS       0x08
+#define COMM_RX_UDP           0x0A
+#define COMM_TX_PACKETS       0x0E
+#define COMM_TX_UDP           0x10
+
+static u8 space[NUM_SPACES][SPACE_SIZE];
+static const char *space_name[NUM_SPACES] = {
+    "HostMot2", "EthernetChip", "EthEEPROM", "FPGAFlash",
+    "Timers", "", "CommCtrl", "BoardInfo",
+};
+
+static int verbose;
+static volatile sig_atomic_t stop;
+static long parse_errors, hm2_words_written;
+
+static void quit(int sig)
+{
+    stop = 1;
+}
+
+static void set16(int sp, unsigned addr, u16 v)
+{
+    space[sp][addr] = v & 0xff;
+    space[sp][addr + 1] = v >> 8;
+}
+
+static void inc16(int sp, unsigned addr)
+{
+    set16(sp, addr, (space[sp][addr] | (space[sp][addr + 1] << 8)) + 1);
+}
+
+static void set32(unsigned addr, u32 v)
+{
+    set16(LBP16_SPACE_HM2 >> 10, addr, v & 0xffff);
+    set16(LBP16_SPACE_HM2 >> 10, addr + 2, v >> 16);
+}
+
+static void init_board(const char *name, const u8 mac[6], int encoders)
+{
+    int i;
+
+    // HostMot2: cookie, config name and an IDROM
+    set32(HM2_ADDR_IOCOOKIE, HM2_IOCOOKIE);
+    memcpy(&space[0][HM2_ADDR_CONFIGNAME], "HOSTMOT2", 8);
+    set32(HM2_ADDR_IDROM_OFFSET, IDROM);
+
+    set32(IDROM + 0x00, 3);                  // IDROM type
+    set32(IDROM + 0x04, IDROM_MODULES);
+    set32(IDROM + 0x08, IDROM_PINS);
+    memcpy(&space[0][IDROM + 0x0c], "MESAEMU ", 8);
+    set32(IDROM + 0x14, 16);                 // FPGA size
+    set32(IDROM + 0x18, 144);                // FPGA pins
+    set32(IDROM + 0x1c, NUM_PORTS);
+    set32(IDROM + 0x20, NUM_PORTS * PORT_WIDTH);
+    set32(IDROM + 0x24, PORT_WIDTH);
+    set32(IDROM + 0x28, 100000000);          // clock low
+    set32(IDROM + 0x2c, 200000000);          // clock high
+    set32(IDROM + 0x30, 4);                  // instance stride 0
+    set32(IDROM + 0x34, 64);                 // instance stride 1
+    set32(IDROM + 0x38, 256);                // register stride 0
+    set32(IDROM + 0x3c, 4);                  // register stride 1
+
+    // module descriptors: gtag, version, clock tag, instances;
+    // base address, number of registers, strides; multiple registers
+    i = IDROM + IDROM_MODULES;
+    set32(i + 0, GTAG_WATCHDOG | (1 << 16) | (1 << 24));
+    set32(i + 4, 0x0c00 | (3 << 16));
+    set32(i + 8, 0);
+    i += 12;
+    set32(i + 0, GTAG_IOPORT | (1 << 16) | (NUM_PORTS << 24));
+    set32(i + 4, 0x1000 | (5 << 16));
+    set32(i + 8, 0x1f);
+    if (encoders) {
+        // version 3, 5 registers, counter and latch/control per instance
+        i += 12;
+        set32(i + 0, GTAG_ENCODER | (3 << 8) | (1 << 16) | (encoders << 24));
+        set32(i + 4, ENCODER_BASE | (5 << 16));
+        set32(i + 8, 0x03);
+    }
+    // the terminating gtag 0 is already there
+
+    // pin descriptors: all GPIO
+    for (i = 0; i < NUM_PORTS * PORT_WIDTH; i++)
+        set32(IDROM + IDROM_PINS + 4 * i, GTAG_IOPORT << 24);
+
+    // hardware address, in EEPROM order
+    for (i = 0; i < 6; i++)
+        space[LBP16_SPACE_ETH_EEPROM >> 10][2 + i] = mac[5 - i];
+
+    strncpy((char *)space[LBP16_SPACE_BOARD_INFO >> 10], name, 16);
+}
+
+// largest UDP payload
+#define MAX_REPLY 65507
+
+// execute the commands in a request, appending read data to reply.
+// returns the reply size.
+static int execute(const u8 *req, int len, u8 *reply)
+{
+    const int comm = LBP16_SPACE_COMM_CTRL >> 10;
+    const u8 *p = req, *end = req + len;
+    int size = 0;
+
+    inc16(comm, COMM_RX_PACKETS);
+    inc16(comm, COMM_RX_UDP);
+
+    while (p + LBP16_CMD_SIZE <= end) {
+        u16 cmd = p[0] | (p[1] << 8);
+        unsigned addr = 0;
+        int count = CMD_COUNT(cmd), width = CMD_WIDTH(cmd);
+        int sp = CMD_SPACE(cmd), bytes = count * width;
+        p += LBP16_CMD_SIZE;
+
+        if (CMD_HAS_ADDR(cmd)) {
+            if (p + LBP16_ADDR_SIZE > end)
+                break;
+            addr = p[0] | (p[1] << 8);
+            p += LBP16_ADDR_SIZE;
+        }
+        if (CMD_WRITE(cmd) ? (p + bytes > end) : (size + bytes > MAX_REPLY))
+            break;
+        if (verbose)
+            fprintf(stderr, "%s %s%s 0x%04x %d x %d bit\n",
+                    CMD_WRITE(cmd) ? "write" : "read ",
+                    CMD_INFO(cmd) ? "info " : "", space_name[sp],
+                    addr, count, width * 8);
+
+        if (CMD_INFO(cmd)) {
+            // area info is read only, and only the name is filled in
+            if (CMD_WRITE(cmd)) {
+                p += bytes;
+            } else {
+                u8 info[sizeof(lbp_mem_info_area)];
+                int i;
+                memset(info, 0, sizeof(info));
+                memcpy(info + offsetof(lbp_mem_info_area, name),
+                       space_name[sp], strnlen(space_name[sp], 8));
+                for (i = 0; i < bytes; i++)
+                    reply[size++] = (addr + i < sizeof(info)) ? info[addr + i] : 0;
+            }
+            continue;
+        }
+
+        int i;
+        for (i = 0; i < count; i++) {
+            unsigned a = (addr + (CMD_INC(cmd) ? i * width : 0)) % SPACE_SIZE;
+            if (a + width > SPACE_SIZE)
+                a = 0;
+            if (CMD_WRITE(cmd)) {
+                memcpy(&space[sp][a], p, width);
+                p += width;
+                if (sp == (LBP16_SPACE_HM2 >> 10))
+                    hm2_words_written += width / 4;
+            } else {
+                memcpy(&reply[size], &space[sp][a], width);
+                size += width;
+            }
+        }
+    }
+    if (p != end) {
+        inc16(comm, COMM_PARSE_ERRORS);
+        parse_errors++;
+    }
+    if (size) {
+        inc16(comm, COMM_TX_PACKETS);
+        inc16(comm, COMM_TX_UDP);
+    }
+    return size;
+}
+
+static void delay_until(const struct timespec *t)
+{
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, t, NULL) == EINTR)
+        if (stop)
+            return;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+        "Usage: hm2_eth_emu [options]\n"
+        "Emulate a Mesa ethernet AnyIO board speaking LBP16 over UDP.\n"
+        "  -a address  address to listen on (default 127.0.0.1)\n"
+        "  -p port     UDP port (default %d)\n"
+        "  -n name     board name in the board info space (default 7I76E-16)\n"
+        "  -e count    add an encoder module of count instances (up to %d)\n"
+        "  -d usec     delay each reply by usec\n"
+        "  -j usec     add a random delay of up to usec to each reply\n"
+        "  -l percent  drop this percentage of requests\n"
+        "  -s seed     seed for -j and -l\n"
+        "  -c count    exit after count requests\n"
+        "  -v          print each command to stderr\n",
+        LBP16_UDP_PORT, MAX_ENCODERS);
+}
+
+int main(int argc, char **argv)
+{
+    const char *address = "127.0.0.1", *name = "7I76E-16";
+    const u8 mac[6] = { 0x00, 0x60, 0x1b, 0x00, 0xe7, 0x0e };
+    int port = LBP16_UDP_PORT, delay = 0, jitter = 0, loss = 0, encoders = 0;
+    long count = -1, n = 0, dropped = 0;
+    struct sockaddr_in sa;
+    unsigned seed = 1;
+    int c, fd;
+
+    while ((c = getopt(argc, argv, "a:p:n:e:d:j:l:s:c:vh")) != -1) {
+        switch (c) {
+        case 'a': address = optarg; break;
+        case 'p': port = atoi(optarg); break;
+        case 'n': name = optarg; break;
+        case 'e': encoders = atoi(optarg); break;
+        case 'd': delay = atoi(optarg); break;
+        case 'j': jitter = atoi(optarg); break;
+        case 'l': loss = atoi(optarg); break;
+        case 's': seed = strtoul(optarg, NULL, 0); break;
+        case 'c': count = atol(optarg); break;
+        case 'v': verbose = 1; break;
+        default:
+            usage();
+            exit(c == 'h' ? 0 : 1);
+        }
+    }
+    if (optind != argc || delay < 0 || jitter < 0 || loss < 0 || loss > 100 ||
+        encoders < 0 || encoders > MAX_ENCODERS) {
+        usage();
+        exit(1);
+    }
+    srandom(seed);
+    init_board(name, mac, encoders);
+
+    if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
+        perror("hm2_eth_emu: socket");
+        exit(1);
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    if (inet_aton(address, &sa.sin_addr) == 0) {
+        fprintf(stderr, "hm2_eth_emu: invalid address '%s'\n", address);
+        exit(1);
+    }
+    if (bind(fd, (struct sockaddr *)&sa, sizeof(sa)) < 0) {
+        perror("hm2_eth_emu: bind");
+        exit(1);
+    }
+
+    // no SA_RESTART, so a signal interrupts recvfrom()
+    struct sigaction act;
+    memset(&act, 0, sizeof(act));
+    act.sa_handler = quit;
+    sigaction(SIGINT, &act, NULL);
+    sigaction(SIGTERM, &act, NULL);
+
+    fprintf(stderr, "hm2_eth_emu: %s listening on %s:%d\n", name, address, port);
+
+    while (!stop && (count < 0 || n < count)) {
+        static u8 req[MAX_REPLY], reply[MAX_REPLY];
+        struct sockaddr_in from;
+        socklen_t fromlen = sizeof(from);
+        struct timespec t;
+        int len, size;
+
+        len = recvfrom(fd, req, sizeof(req), 0, (struct sockaddr *)&from, &fromlen);
+        if (len < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("hm2_eth_emu: recvfrom");
+            exit(1);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        n++;
+        if (loss && (random() % 100) < loss) {
+            dropped++;
+            continue;
+        }
+        size = execute(req, len, reply);
+        if (size == 0)
+            continue;
+
+        if (delay || jitter) {
+            long usec = delay + (jitter ? random() % (jitter + 1) : 0);
+            t.tv_nsec += usec * 1000;
+            t.tv_sec += t.tv_nsec / 1000000000;
+            t.tv_nsec %= 1000000000;
+            delay_until(&t);
+        }
+        if (sendto(fd, reply, size, 0, (struct sockaddr *)&from, fromlen) < 0)
+            perror("hm2_eth_emu: sendto");
+    }
+    fprintf(stderr, "hm2_eth_emu: %ld requests, %ld dropped\n", n, dropped);
+    fprintf(stderr, "hm2_eth_emu: %ld parse errors, %ld HostMot2 words written\n",
+            parse_errors, hm2_words_written);
+    close(fd);
+    return 0;
+}
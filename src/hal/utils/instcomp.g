@@ -309,6 +309,10 @@ def to_c(name):
     name = name.replace("#", "").replace(".", "_").replace("-", "_")
     return re.sub("_+", "_", name)
 
+def funct_c_name(name):
+    if funct_ : return funct_name
+    return to_c(name)
+
 def to_noquotes(name):
     name = name.replace("\"", "")
     return name
@@ -645,6 +649,8 @@ def prologue(f):
             f.write("static int %s(void *arg, const hal_funct_args_t *fa);\n\n" % funct_name)
         else :
             f.write("static int %s(void *arg, const hal_funct_args_t *fa);\n\n" % to_c(name))
+        if options.get("batched"):
+            f.write("static int %s_batch(void * const *args, const int n, const hal_funct_args_t *fa);\n\n" % funct_c_name(name))
         names[name] = 1
 
     f.write("static int instantiate(const int argc, char* const *argv);\n\n")
@@ -806,7 +812,9 @@ def prologue(f):
         f.write("        .arg = ip,\n")
         f.write("        .uses_fp = %d,\n" % int(fp))
         f.write("        .reentrant = 0,\n")
-        f.write("        .owner_id = owner_id\n")
+        f.write("        .owner_id = owner_id,\n")
+        if options.get("batched"):
+            f.write("        .batch = %s_batch,\n" % funct_c_name(name))
         f.write("        };\n\n")
 
         strng = "    rtapi_snprintf(buf, sizeof(buf),\"%s"
@@ -1053,6 +1061,17 @@ def prologue(f):
 def epilogue(f):
     f.write("\n")
 
+##  option batched: adjacent instances of a thread are run by one call of
+##  the batch funct, with the funct body inlined into the loop
+    if options.get("batched"):
+        for name, fp in functions:
+            f.write("__attribute__((flatten))\n")
+            f.write("static int %s_batch(void * const *args, const int n, const hal_funct_args_t *fa)\n{\n" % funct_c_name(name))
+            f.write("    int i;\n\n")
+            f.write("    for (i = 0; i < n; i++)\n")
+            f.write("        %s(args[i], fa);\n" % funct_c_name(name))
+            f.write("    return 0;\n}\n\n")
+
 INSTALL, COMPILE, PREPROCESS, DOCUMENT, INSTALLDOC, VIEWDOC, MODINC = range(7)
 modename = ("install", "compile", "preprocess", "document", "installdoc", "viewdoc", "print-modinc")
 
@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <ctype.h>
 #include <assert.h>
 #include <errno.h>
@@ -31,6 +32,7 @@
 #include <czmq.h>
 
 #include <string>
+#include <vector>
 #include <unordered_map>
 
 #ifndef ULAPI
@@ -42,6 +44,7 @@
 #include <hal_priv.h>
 #include <hal_group.h>
 #include <hal_rcomp.h>
+#include <hal_ring.h>
 #include <mk-inifile.h>
 #include <syslog_async.h>
 
@@ -62,6 +65,7 @@ namespace gpb = google::protobuf;
 #endif
 
 typedef struct htself htself_t;
+typedef struct htworker htworker_t;
 
 typedef struct {
     hal_compiled_group_t *cg;
@@ -70,6 +74,25 @@ typedef struct {
     htself_t *self;
     int timer_id; // > -1: scan timer active - subscribers present
     int msec;
+
+    // set if a grouppub instance publishes changes of this group,
+    // replacing the scan timer. See hal_group.h.
+    ringbuffer_t *changes;
+    int event_fd;     // signalled by the waiter thread, -1: not started
+    pthread_t waiter; // sleeps on the ring scratchpad
+    volatile bool stop;
+
+    // set if a groupsnap instance takes snapshots of this group; the
+    // scan timer then matches and reports snapshots. See hal_group.h.
+    ringbuffer_t *snapshot;
+    const hal_group_snapshot_t *snap; // current snapshot, NULL: none yet
+
+    htworker_t *worker; // scans and reports the group, NULL: not yet assigned
+    bool loaded;        // counted in worker->load: has subscribers
+
+    // GROUP_REPORT_PACKED groups only:
+    std::vector<hal_data_u> values; // changes merged from the changes ring
+    std::string packed;             // encoding buffer, reused
 } group_t;
 
 typedef struct {
@@ -79,8 +102,20 @@ typedef struct {
     htself_t *self;
     int timer_id;
     int msec;
+    std::string packed; // RCOMP_REPORT_PACKED encoding buffer, reused
 } rcomp_t;
 
+// scans groups and encodes their updates, see start_group_workers()
+typedef struct htworker {
+    htself_t *self;
+    int id;           // 0: the main loop
+    zactor_t *actor;  // NULL: the main loop
+    zloop_t *loop;    // runs the timers and pollers of the worker's groups
+    void *socket;     // updates go here: the XPUB socket, or the actor pipe
+    machinetalk::Container tx;
+    int load;         // members of the assigned groups with subscribers
+} htworker_t;
+
 typedef struct htbridge {
     int state;
     void *z_bridge_status;
@@ -124,6 +159,7 @@ typedef struct htconf {
     int default_group_timer; // msec
     int default_rcomp_timer; // msec
     int keepalive_timer; // msec; disabled if zero
+    int group_workers; // threads reporting groups; 0: the main loop does
     bool trap_signals;
 } htconf_t;
 
@@ -146,6 +182,8 @@ typedef struct htself {
     compmap_t  rcomps;
     itemmap_t  items;
 
+    std::vector<htworker_t *> workers; // [0]: the main loop
+
     htbridge_t *bridge;
 } htself_t;
 
@@ -156,6 +194,8 @@ int release_groups(htself_t *self);
 int handle_group_timer(zloop_t *loop, int timer_id, void *arg);
 int handle_group_input(zloop_t *loop, zsock_t *socket, void *arg);
 int ping_groups(htself_t *self);
+int start_group_workers(htself_t *self);
+int stop_group_workers(htself_t *self);
 
 // haltalk_rcomp.cc:
 int scan_comps(htself_t *self);
@@ -169,9 +209,10 @@ int handle_command_input(zloop_t *loop, zsock_t *socket, void *arg);
 
 // haltalk_introspect.cc:
 int process_describe(htself_t *self, zmsg_t *from,  void *socket);
-int describe_group(htself_t *self, const char *group, const std::string &from,  void *socket);
+int describe_group(htself_t *self, machinetalk::Container &tx, const char *group,
+		   const std::string &from,  void *socket);
 int describe_comp(htself_t *self, const char *comp, const std::string &from,  void *socket);
-int describe_parameters(htself_t *self);
+int describe_parameters(htself_t *self, machinetalk::Container &tx);
 
 // haltalk_bridge.cc:
 int bridge_init(htself_t *self);
@@ -19,10 +19,26 @@
 #include "haltalk.hh"
 #include "halpb.hh"
 #include "pbutil.hh"
+#include "haltalk_packed.hh"
+
+#include <limits.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 
 static int group_report_cb(int phase, hal_compiled_group_t *cgroup,
 			   hal_sig_t *sig, void *cb_data);
 static int scan_group_cb(hal_object_ptr o, foreach_args_t *args);
+static void group_worker(zsock_t *pipe, void *arg);
+static int handle_worker_output(zloop_t *loop, zsock_t *pipe, void *arg);
+static void start_scanning(group_t *g);
+static void stop_scanning(group_t *g);
+static void dispatch(htself_t *self, group_t *g, const char *command);
+static void group_command(htworker_t *w, const char *command, group_t *g);
+static void describe_packed(htworker_t *w, group_t *g);
+static void report_group(group_t *g, const hal_data_u *values, int force_all);
+static void send_packed(group_t *g, const hal_data_u *values,
+			const unsigned long *changed);
 
 
 // monitor group subscribe events:
@@ -58,54 +74,19 @@ handle_group_input(zloop_t *loop, zsock_t *socket, void *arg)
 	    // describe all groups
 	    for (groupmap_iterator gi = self->groups.begin();
 		 gi != self->groups.end(); gi++) {
-
-		group_t *g = gi->second;
-		self->tx.set_type(machinetalk::MT_HALGROUP_FULL_UPDATE);
-		self->tx.set_uuid(self->netopts.proc_uuid, sizeof(self->netopts.proc_uuid));
-		self->tx.set_serial(g->serial++);
-		describe_parameters(self);
-		describe_group(self, gi->first.c_str(), gi->first.c_str(), socket);
-
-		// if first subscriber: activate scanning
-		if (g->timer_id < 0) { // not scanning
-		    g->timer_id = zloop_timer(loop, g->msec,
-					      0, handle_group_timer, (void *)g);
-		    assert(g->timer_id > -1);
-		    rtapi_print_msg(RTAPI_MSG_DBG,
-				    "%s: start scanning group %s, tid=%d, %d mS, %d members, %d monitored",
-				    self->cfg->progname, topic, g->timer_id, g->msec,
-				    g->cg->n_members, g->cg->n_monitored);
-		}
+		dispatch(self, gi->second, "SUBSCRIBE");
 		rtapi_print_msg(RTAPI_MSG_DBG,
-				"%s: wildcard subscribe group='%s' serial=%d",
-				self->cfg->progname,
-				gi->first.c_str(), gi->second->serial);
+				"%s: wildcard subscribe group='%s'",
+				self->cfg->progname, gi->first.c_str());
 	    }
 	} else {
 	    // a selective subscribe - describe only the desired group
 	    groupmap_iterator gi = self->groups.find(topic);
 	    if (gi != self->groups.end()) {
-		group_t *g = gi->second;
-		self->tx.set_type(machinetalk::MT_HALGROUP_FULL_UPDATE);
-		self->tx.set_uuid(self->netopts.proc_uuid, sizeof(self->netopts.proc_uuid));
-		self->tx.set_serial(g->serial++);
-		describe_parameters(self);
-		describe_group(self, gi->first.c_str(), gi->first.c_str(), socket);
+		dispatch(self, gi->second, "SUBSCRIBE");
 		rtapi_print_msg(RTAPI_MSG_DBG,
-				"%s: subscribe group='%s' serial=%d",
-				self->cfg->progname,
-				gi->first.c_str(), gi->second->serial);
-
-		// if first subscriber: activate scanning
-		if (g->timer_id < 0) { // not scanning
-		    g->timer_id = zloop_timer(loop, g->msec,
-					      0, handle_group_timer, (void *)g);
-		    assert(g->timer_id > -1);
-		    rtapi_print_msg(RTAPI_MSG_DBG,
-				    "%s: start scanning group %s, tid=%d, %d mS, %d members, %d monitored",
-				    self->cfg->progname, topic,
-				    g->timer_id, g->msec, g->cg->n_members, g->cg->n_monitored);
-		}
+				"%s: subscribe group='%s'",
+				self->cfg->progname, gi->first.c_str());
 	    } else {
 		// non-existant topic, complain.
 		self->tx.set_type(machinetalk::MT_STP_NOGROUP);
@@ -126,16 +107,7 @@ handle_group_input(zloop_t *loop, zsock_t *socket, void *arg)
 
     case '\000':   // last unsubscribe
 	if (self->groups.count(topic) > 0) {
-	    group_t *g = self->groups[topic];
-	    // stop the scanning timer
-	    if (g->timer_id > -1) {  // currently scanning
-		rtapi_print_msg(RTAPI_MSG_DBG,
-				"%s: group %s stop scanning, tid=%d",
-				self->cfg->progname, topic, g->timer_id);
-		int retval = zloop_timer_end (loop, g->timer_id);
-		assert(retval == 0);
-		g->timer_id = -1;
-	    }
+	    dispatch(self, self->groups[topic], "UNSUBSCRIBE");
 	}
 	break;
 
@@ -152,11 +124,195 @@ int
 handle_group_timer(zloop_t *loop, int timer_id, void *arg)
 {
     group_t *g = (group_t *) arg;
+
+    if (g->snapshot) {
+	// use the latest RT snapshot. if there is none since the last
+	// tick, the previous one is still ours to use
+	hal_groupsnap_t *gs = (hal_groupsnap_t *) g->snapshot->scratchpad;
+	if (rtapi_tb_snapshot(&gs->tb))
+	    g->snap = hal_groupsnap_buffer(gs, rtapi_tb_snap_idx(&gs->tb));
+	if ((g->snap != NULL) &&
+	    hal_cgroup_match_values(g->cg, g->snap->value))
+	    report_group(g, g->snap->value, 0);
+	return 0;
+    }
     if (hal_cgroup_match(g->cg))
-	hal_cgroup_report(g->cg, group_report_cb, g, 0);
+	report_group(g, NULL, 0);
+    return 0;
+}
+
+// records consumed per ring update
+#define CHANGES_BATCH 64
+
+// report the changes published by a grouppub instance
+static int
+handle_group_changes(zloop_t *loop, zmq_pollitem_t *poller, void *arg)
+{
+    group_t *g = (group_t *) arg;
+    htworker_t *w = g->worker;
+    hal_compiled_group_t *cg = g->cg;
+    hal_grouppub_t *gp = (hal_grouppub_t *) g->changes->scratchpad;
+    ringvec_t rv[CHANGES_BATCH];
+    eventfd_t count;
+    int n, nrec = 0;
+
+    eventfd_read(g->event_fd, &count);
+
+    // changes are merged into a single update per wakeup
+    bool changed_only = cg->group->userarg2 & GROUP_REPORT_CHANGED_MEMBERS;
+    bool packed = cg->group->userarg2 & GROUP_REPORT_PACKED;
+    if (changed_only && packed)
+	RTAPI_ZERO_BITMAP(cg->changed, cg->n_members);
+    while ((n = record_read_batch(g->changes, rv, CHANGES_BATCH)) > 0) {
+	for (int r = 0; changed_only && (r < n); r++) {
+	    const hal_group_changes_t *rec =
+		(const hal_group_changes_t *) rv[r].rv_base;
+	    for (unsigned i = 0; i < rec->count; i++) {
+		const hal_group_change_t *c = &rec->change[i];
+		if (c->index >= (unsigned) cg->n_members)
+		    continue;
+		if (packed) {
+		    // the last change of a member wins
+		    RTAPI_BIT_SET(cg->changed, c->index);
+		    g->values[c->index] = c->value;
+		    continue;
+		}
+		hal_sig_t *sig = (hal_sig_t *) SHMPTR(cg->member[c->index]->sig_ptr);
+		machinetalk::Signal *signal = w->tx.add_signal();
+		signal->set_handle(ho_id(sig));
+		hal_u2pbsig((hal_type_t) c->type, &c->value, signal);
+	    }
+	}
+	record_shift_batch(g->changes, n);
+	nrec += n;
+    }
+    if ((nrec == 0) || !rtapi_load_u32(&gp->active)) {
+	w->tx.Clear();
+	return 0;
+    }
+    if (changed_only && packed) {
+	send_packed(g, g->values.data(), cg->changed);
+    } else if (changed_only) {
+	w->tx.set_type(machinetalk::MT_HALGROUP_INCREMENTAL_UPDATE);
+	w->tx.set_serial(g->serial++);
+	int retval = send_pbcontainer(ho_name(cg->group), w->tx, w->socket);
+	assert(retval == 0);
+    } else {
+	// a change triggers a report of the whole group
+	w->tx.Clear();
+	report_group(g, NULL, 1);
+    }
     return 0;
 }
 
+static long
+futex(__u32 *uaddr, int op, __u32 val, const struct timespec *timeout)
+{
+    return syscall(SYS_futex, uaddr, op, val, timeout, NULL, 0);
+}
+
+// sleep until the grouppub instance publishes a record, then signal
+// the event fd. the timeout covers publishers started with wake=0,
+// and stopping the thread.
+static void *
+group_waiter(void *arg)
+{
+    group_t *g = (group_t *) arg;
+    hal_grouppub_t *gp = (hal_grouppub_t *) g->changes->scratchpad;
+    __u32 seen = rtapi_load_u32(&gp->wakeup);
+    struct timespec ts = { g->msec / 1000, (g->msec % 1000) * 1000000L };
+
+    while (!g->stop) {
+	rtapi_add_u32(&gp->waiters, 1);
+	rtapi_smp_mb();
+	if (rtapi_load_u32(&gp->wakeup) == seen)
+	    futex(&gp->wakeup, FUTEX_WAIT, seen, &ts);
+	rtapi_add_u32(&gp->waiters, (__u32) -1);
+
+	__u32 now = rtapi_load_u32(&gp->wakeup);
+	if (now != seen) {
+	    seen = now;
+	    eventfd_write(g->event_fd, 1);
+	}
+    }
+    return NULL;
+}
+
+static void
+start_scanning(group_t *g)
+{
+    htself_t *self = g->self;
+    zloop_t *loop = g->worker->loop;
+
+    if (g->changes == NULL) {
+	if (g->timer_id > -1)
+	    return; // already scanning
+	if (g->snapshot) {
+	    hal_groupsnap_t *gs = (hal_groupsnap_t *) g->snapshot->scratchpad;
+	    rtapi_store_u32(&gs->active, 1);
+	}
+	g->timer_id = zloop_timer(loop, g->msec,
+				  0, handle_group_timer, (void *)g);
+	assert(g->timer_id > -1);
+	rtapi_print_msg(RTAPI_MSG_DBG,
+			"%s: start scanning group %s, worker %d, tid=%d, %d mS, %d members, %d monitored",
+			self->cfg->progname, ho_name(g->cg->group), g->worker->id,
+			g->timer_id, g->msec, g->cg->n_members, g->cg->n_monitored);
+	return;
+    }
+
+    hal_grouppub_t *gp = (hal_grouppub_t *) g->changes->scratchpad;
+    if (rtapi_load_u32(&gp->active))
+	return;
+
+    if (g->event_fd < 0) {
+	g->event_fd = eventfd(0, EFD_NONBLOCK|EFD_CLOEXEC);
+	assert(g->event_fd > -1);
+	g->stop = false;
+	int retval = pthread_create(&g->waiter, NULL, group_waiter, g);
+	assert(retval == 0);
+	zmq_pollitem_t changes_poller = { 0, g->event_fd, ZMQ_POLLIN };
+	retval = zloop_poller(loop, &changes_poller, handle_group_changes, g);
+	assert(retval == 0);
+    }
+    // drop anything left over from a previous subscription
+    record_flush_reader(g->changes);
+    rtapi_store_u32(&gp->active, 1);
+    rtapi_print_msg(RTAPI_MSG_DBG,
+		    "%s: group %s: reporting published changes, %d members, %d monitored",
+		    self->cfg->progname, ho_name(g->cg->group),
+		    g->cg->n_members, g->cg->n_monitored);
+}
+
+static void
+stop_scanning(group_t *g)
+{
+    htself_t *self = g->self;
+    zloop_t *loop = g->worker->loop;
+
+    if (g->changes) {
+	hal_grouppub_t *gp = (hal_grouppub_t *) g->changes->scratchpad;
+	rtapi_store_u32(&gp->active, 0);
+	rtapi_print_msg(RTAPI_MSG_DBG,
+			"%s: group %s stop reporting published changes",
+			self->cfg->progname, ho_name(g->cg->group));
+	return;
+    }
+    // stop the scanning timer
+    if (g->timer_id > -1) {  // currently scanning
+	rtapi_print_msg(RTAPI_MSG_DBG,
+			"%s: group %s stop scanning, tid=%d",
+			self->cfg->progname, ho_name(g->cg->group), g->timer_id);
+	int retval = zloop_timer_end (loop, g->timer_id);
+	assert(retval == 0);
+	g->timer_id = -1;
+    }
+    if (g->snapshot) {
+	hal_groupsnap_t *gs = (hal_groupsnap_t *) g->snapshot->scratchpad;
+	rtapi_store_u32(&gs->active, 0);
+    }
+}
+
 // walk HAL groups, and compile any which are not in self->groups yet
 // idempotent - will add new groups as found
 int
@@ -180,8 +336,175 @@ scan_groups(htself_t *self)
     return 0;
 }
 
+// set up the group workers: worker 0 is the main loop, which reports
+// groups itself unless there are cfg->group_workers worker threads.
+// a thread runs the timers and pollers of its groups in its own loop,
+// and hands its encoded updates to the main loop through the actor
+// pipe, to be sent on the XPUB socket as they are.
+//
+// either way an update is encoded exactly once, and the XPUB socket
+// fans it out to all subscribers.
+int
+start_group_workers(htself_t *self)
+{
+    htworker_t *w = new htworker_t();
+    w->self = self;
+    w->id = 0;
+    w->actor = NULL;
+    w->loop = self->netopts.z_loop;
+    w->socket = self->mksock[SVC_HALGROUP].socket;
+    w->load = 0;
+    self->workers.push_back(w);
+
+    for (int i = 1; i <= self->cfg->group_workers; i++) {
+	w = new htworker_t();
+	w->self = self;
+	w->id = i;
+	w->load = 0;
+	// loop and socket are set up by the thread
+	w->actor = zactor_new(group_worker, w);
+	assert(w->actor);
+	int retval = zloop_reader(self->netopts.z_loop,
+				  (zsock_t *) zactor_sock(w->actor),
+				  handle_worker_output, self);
+	assert(retval == 0);
+	self->workers.push_back(w);
+    }
+    rtapi_print_msg(RTAPI_MSG_DBG, "%s: %d group worker thread(s)",
+		    self->cfg->progname, self->cfg->group_workers);
+    return 0;
+}
+
+// stop the worker threads. their groups stop being scanned.
+int
+stop_group_workers(htself_t *self)
+{
+    for (size_t i = 0; i < self->workers.size(); i++) {
+	htworker_t *w = self->workers[i];
+	if (w->actor) {
+	    zloop_reader_end(self->netopts.z_loop,
+			     (zsock_t *) zactor_sock(w->actor));
+	    zactor_destroy(&w->actor);
+	}
+	delete w;
+    }
+    self->workers.clear();
+    for (groupmap_iterator g = self->groups.begin(); g != self->groups.end(); g++)
+	g->second->worker = NULL;
+    return 0;
+}
+
 // ----- end of public functions ----
 
+// hand a subscribe or unsubscribe to the worker of a group,
+// assigning one first if needed: the least loaded thread, else the
+// main loop
+//
+// a group stays with its worker once assigned, so a worker never
+// sees a group it does not own. only groups with subscribers count
+// towards the load, which is what places the next new group.
+static void
+dispatch(htself_t *self, group_t *g, const char *command)
+{
+    if (g->worker == NULL) {
+	htworker_t *w = self->workers[0];
+	for (size_t i = 1; i < self->workers.size(); i++)
+	    if ((w->actor == NULL) || (self->workers[i]->load < w->load))
+		w = self->workers[i];
+	g->worker = w;
+    }
+    htworker_t *w = g->worker;
+    bool subscribe = streq(command, "SUBSCRIBE");
+    if (subscribe != g->loaded) {
+	w->load += subscribe ? g->cg->n_members : -g->cg->n_members;
+	g->loaded = subscribe;
+    }
+    if (w->actor == NULL) {
+	group_command(w, command, g);
+	return;
+    }
+    int retval = zsock_send(w->actor, "sp", command, g);
+    assert(retval == 0);
+}
+
+// runs in the group's worker
+static void
+group_command(htworker_t *w, const char *command, group_t *g)
+{
+    htself_t *self = w->self;
+    const char *name = ho_name(g->cg->group);
+
+    if (streq(command, "SUBSCRIBE")) {
+	// if first subscriber: activate scanning
+	// before taking the full update, so no change is missed
+	start_scanning(g);
+
+	w->tx.set_type(machinetalk::MT_HALGROUP_FULL_UPDATE);
+	w->tx.set_uuid(self->netopts.proc_uuid, sizeof(self->netopts.proc_uuid));
+	w->tx.set_serial(g->serial++);
+	describe_parameters(self, w->tx);
+	describe_packed(w, g);
+	describe_group(self, w->tx, name, name, w->socket);
+	rtapi_print_msg(RTAPI_MSG_DBG,
+			"%s: group '%s' full update, worker %d, serial=%d",
+			self->cfg->progname, name, w->id, g->serial);
+    } else if (streq(command, "UNSUBSCRIBE")) {
+	stop_scanning(g);
+    }
+}
+
+// commands from the main loop
+static int
+handle_worker_command(zloop_t *loop, zsock_t *pipe, void *arg)
+{
+    htworker_t *w = (htworker_t *) arg;
+    char *command = NULL;
+    void *g = NULL;
+
+    if (zsock_recv(pipe, "sp", &command, &g) || (command == NULL))
+	return -1;
+    if (streq(command, "$TERM")) {
+	zstr_free(&command);
+	return -1; // exit the worker loop
+    }
+    group_command(w, command, (group_t *) g);
+    zstr_free(&command);
+    return 0;
+}
+
+static void
+group_worker(zsock_t *pipe, void *arg)
+{
+    htworker_t *w = (htworker_t *) arg;
+
+    w->loop = zloop_new();
+    assert(w->loop);
+    w->socket = pipe;
+    zloop_reader(w->loop, pipe, handle_worker_command, w);
+    zsock_signal(pipe, 0);
+
+    rtapi_print_msg(RTAPI_MSG_DBG, "%s: group worker %d started",
+		    w->self->cfg->progname, w->id);
+    zloop_start(w->loop);
+    zloop_destroy(&w->loop);
+    rtapi_print_msg(RTAPI_MSG_DBG, "%s: group worker %d exiting",
+		    w->self->cfg->progname, w->id);
+}
+
+// an update encoded by a worker thread: send as is
+static int
+handle_worker_output(zloop_t *loop, zsock_t *pipe, void *arg)
+{
+    htself_t *self = (htself_t *) arg;
+    zmsg_t *msg = zmsg_recv(pipe);
+
+    if (msg == NULL)
+	return 0;
+    int retval = zmsg_send(&msg, self->mksock[SVC_HALGROUP].socket);
+    assert(retval == 0);
+    return 0;
+}
+
 // static int
 // add_sig_to_items(int level, hal_group_t **groups,
 // 		 hal_member_t *member, void *cb_data)
@@ -251,12 +574,71 @@ scan_group_cb(hal_object_ptr o, foreach_args_t *args)
     grp->msec =  hal_cgroup_timer(cgroup);
     if (grp->msec == 0)
 	grp->msec = self->cfg->default_group_timer;
+    grp->changes = NULL;
+    grp->event_fd = -1;
+    grp->snapshot = NULL;
+    grp->snap = NULL;
+    grp->worker = NULL; // assigned on first subscribe
+    grp->loaded = false;
+    if (g->userarg2 & GROUP_REPORT_PACKED)
+	grp->values.resize(cgroup->n_members);
+
+    // use the changes published by a grouppub instance if there is one
+    unsigned flags;
+    if (halg_ring_attachf(0, NULL, &flags, GROUP_CHANGES_RING, ho_name(g)) == 0) {
+	ringbuffer_t *rb = new ringbuffer_t();
+	hal_grouppub_t *gp;
+	if ((halg_ring_attachf(0, rb, NULL, GROUP_CHANGES_RING, ho_name(g)) == 0) &&
+	    (ring_scratchpad_size(rb) >= sizeof(hal_grouppub_t)) &&
+	    ((gp = (hal_grouppub_t *) rb->scratchpad)->n_members == cgroup->n_members)) {
+	    rb->header->reader = self->comp_id;
+	    rb->header->reader_instance = rtapi_instance;
+	    grp->changes = rb;
+	} else {
+	    rtapi_print_msg(RTAPI_MSG_ERR,
+			    "%s: group '%s' - cannot use changes ring, polling",
+			    self->cfg->progname, ho_name(g));
+	    if (ringbuffer_attached(rb))
+		halg_ring_detach(0, rb);
+	    delete rb;
+	}
+    }
 
+    // else report the snapshots of a groupsnap instance if there is one
+    if ((grp->changes == NULL) &&
+	(halg_ring_attachf(0, NULL, &flags, GROUP_SNAPSHOT_RING, ho_name(g)) == 0)) {
+	ringbuffer_t *rb = new ringbuffer_t();
+	hal_groupsnap_t *gs;
+	if ((halg_ring_attachf(0, rb, NULL, GROUP_SNAPSHOT_RING, ho_name(g)) == 0) &&
+	    (ring_scratchpad_size(rb) >= sizeof(hal_groupsnap_t)) &&
+	    ((gs = (hal_groupsnap_t *) rb->scratchpad)->n_members == cgroup->n_members) &&
+	    (ring_scratchpad_size(rb) >= sizeof(hal_groupsnap_t) + 3 * gs->bufsize)) {
+	    rb->header->reader = self->comp_id;
+	    rb->header->reader_instance = rtapi_instance;
+	    grp->snapshot = rb;
+	} else {
+	    rtapi_print_msg(RTAPI_MSG_ERR,
+			    "%s: group '%s' - cannot use snapshot ring, polling",
+			    self->cfg->progname, ho_name(g));
+	    if (ringbuffer_attached(rb))
+		halg_ring_detach(0, rb);
+	    delete rb;
+	}
+    }
     self->groups[ho_name(g)] = grp;
 
-    rtapi_print_msg(RTAPI_MSG_DBG,
-		    "%s: group '%s' - using %d mS poll interval",
-		    self->cfg->progname, ho_name(g), grp->msec);
+    if (grp->changes)
+	rtapi_print_msg(RTAPI_MSG_DBG,
+			"%s: group '%s' - using published changes",
+			self->cfg->progname, ho_name(g));
+    else if (grp->snapshot)
+	rtapi_print_msg(RTAPI_MSG_DBG,
+			"%s: group '%s' - using RT snapshots, %d mS poll interval",
+			self->cfg->progname, ho_name(g), grp->msec);
+    else
+	rtapi_print_msg(RTAPI_MSG_DBG,
+			"%s: group '%s' - using %d mS poll interval",
+			self->cfg->progname, ho_name(g), grp->msec);
     args->user_arg2++;
     return 0;
 }
@@ -266,6 +648,31 @@ int release_groups(htself_t *self)
 {
     int nfail = 0;
     for (groupmap_iterator g = self->groups.begin(); g != self->groups.end(); g++) {
+	group_t *grp = g->second;
+	if (grp->changes) {
+	    hal_grouppub_t *gp = (hal_grouppub_t *) grp->changes->scratchpad;
+	    rtapi_store_u32(&gp->active, 0);
+	    if (grp->event_fd > -1) {
+		grp->stop = true;
+		futex(&gp->wakeup, FUTEX_WAKE, INT_MAX, NULL);
+		pthread_join(grp->waiter, NULL);
+		close(grp->event_fd);
+		grp->event_fd = -1;
+	    }
+	    grp->changes->header->reader = 0;
+	    hal_ring_detach(grp->changes);
+	    delete grp->changes;
+	    grp->changes = NULL;
+	}
+	if (grp->snapshot) {
+	    hal_groupsnap_t *gs = (hal_groupsnap_t *) grp->snapshot->scratchpad;
+	    rtapi_store_u32(&gs->active, 0);
+	    grp->snap = NULL;
+	    grp->snapshot->header->reader = 0;
+	    hal_ring_detach(grp->snapshot);
+	    delete grp->snapshot;
+	    grp->snapshot = NULL;
+	}
 	if (hal_unref_group(g->first.c_str()) < 0)
 	    nfail++;
 	rtapi_print_msg(RTAPI_MSG_DBG,
@@ -275,42 +682,109 @@ int release_groups(htself_t *self)
     return -nfail;
 }
 
+// list the member handles of a packed group in the full update;
+// their order defines the item indices of packed updates
+static void
+describe_packed(htworker_t *w, group_t *g)
+{
+    hal_compiled_group_t *cg = g->cg;
+
+    if (!(cg->group->userarg2 & GROUP_REPORT_PACKED))
+	return;
+    for (int i = 0; i < cg->n_members; i++) {
+	hal_sig_t *sig = (hal_sig_t *) SHMPTR(cg->member[i]->sig_ptr);
+	w->tx.add_packed_handle(ho_id(sig));
+    }
+}
+
+// report a group after a match. values: member values by index, or
+// NULL to use the current signal values. only packed updates use
+// them; group_report_cb() takes snapshot values itself.
+static void
+report_group(group_t *g, const hal_data_u *values, int force_all)
+{
+    hal_compiled_group_t *cg = g->cg;
+
+    if (!(cg->group->userarg2 & GROUP_REPORT_PACKED)) {
+	hal_cgroup_report(cg, group_report_cb, g, force_all);
+	return;
+    }
+    // the same choice as hal_cgroup_report()
+    bool reportall = force_all || (cg->n_monitored == 0) ||
+	!(cg->group->userarg2 & GROUP_REPORT_CHANGED_MEMBERS);
+    send_packed(g, values, reportall ? NULL : cg->changed);
+}
+
+// send a MT_HALGROUP_PACKED_UPDATE of the members set in 'changed',
+// or all if NULL
+static void
+send_packed(group_t *g, const hal_data_u *values, const unsigned long *changed)
+{
+    htworker_t *w = g->worker;
+    hal_compiled_group_t *cg = g->cg;
+
+    pack_update(g->packed, cg->n_members, changed,
+		[cg](int i) {
+		    return sig_type((hal_sig_t *) SHMPTR(cg->member[i]->sig_ptr));
+		},
+		[cg, values](int i) -> const hal_data_u * {
+		    if (values)
+			return &values[i];
+		    return sig_value((hal_sig_t *) SHMPTR(cg->member[i]->sig_ptr));
+		});
+
+    w->tx.set_type(machinetalk::MT_HALGROUP_PACKED_UPDATE);
+    w->tx.set_serial(g->serial++);
+    if (g->snapshot && g->snap)
+	w->tx.set_tsc(g->snap->timestamp);
+    w->tx.set_packed(g->packed);
+    int retval = send_pbcontainer(ho_name(cg->group), w->tx, w->socket);
+    assert(retval == 0);
+}
+
 static int
 group_report_cb(int phase, hal_compiled_group_t *cgroup,
 		hal_sig_t *sig, void *cb_data)
 {
     group_t *grp = (group_t *) cb_data;
-    htself_t *self = grp->self;
+    htworker_t *w = grp->worker;
     machinetalk::Signal *signal;
     int retval;
 
     switch (phase) {
 
     case REPORT_BEGIN:	// report initialisation
-	self->tx.set_type(machinetalk::MT_HALGROUP_INCREMENTAL_UPDATE);
+	w->tx.set_type(machinetalk::MT_HALGROUP_INCREMENTAL_UPDATE);
 	// the serial enables detection of lost updates
 	// for a client to recover from a lost update:
 	// unsubscribe + re-subscribe which will cause
 	// a full state dump to be sent
-	self->tx.set_serial(grp->serial++);
+	w->tx.set_serial(grp->serial++);
+	if (grp->snapshot && grp->snap)
+	    w->tx.set_tsc(grp->snap->timestamp);
 	break;
 
     case REPORT_SIGNAL: // per-reported-signal action
-	signal = self->tx.add_signal();
+	signal = w->tx.add_signal();
 	signal->set_handle(ho_id(sig));
+	if (grp->snapshot && grp->snap) {
+	    // the value as of the snapshot, not the current one
+	    hal_u2pbsig(sig_type(sig), &grp->snap->value[cgroup->mbr_index],
+			signal);
+	    break;
+	}
 	retval = hal_sig2pb(sig, signal);
 	assert(retval == 0);
 	break;
 
     case REPORT_END: // finalize & send
-	retval = send_pbcontainer(ho_name(cgroup->group), self->tx,
-				  self->mksock[SVC_HALGROUP].socket);
+	retval = send_pbcontainer(ho_name(cgroup->group), w->tx, w->socket);
 	assert(retval == 0);
 
 #if JSON_TIMING
 	// timing test:
 	try {
-	    std::string json = pb2json(self->tx);
+	    std::string json = pb2json(w->tx);
 	    zframe_t *z_jsonframe = zframe_new( json.c_str(), json.size());
 	    //assert(zframe_send(&z_jsonframe, self->z_status, 0) == 0);
 	    zframe_destroy(&z_jsonframe);
@@ -61,18 +61,19 @@ process_describe(htself_t *self,
 // describe a HAL group as a protobuf message.
 int
 describe_group(htself_t *self,
+	       machinetalk::Container &tx,
 	       const char *group,
 	       const std::string &from,
 	       void *socket)
 {
     WITH_HAL_MUTEX();
-    int ret = halg_object2pb(0, &self->tx, group, HAL_GROUP, 0);
+    int ret = halg_object2pb(0, &tx, group, HAL_GROUP, 0);
     if (ret != 1)  {
-	self->tx.set_type(machinetalk::MT_HALRCOMP_ERROR);
-	note_printf(self->tx, "no such group: '%s'", group);
-	return send_pbcontainer(from, self->tx, socket);
+	tx.set_type(machinetalk::MT_HALRCOMP_ERROR);
+	note_printf(tx, "no such group: '%s'", group);
+	return send_pbcontainer(from, tx, socket);
     }
-    return send_pbcontainer(from, self->tx, socket);
+    return send_pbcontainer(from, tx, socket);
 }
 
 
@@ -94,9 +95,9 @@ describe_comp(htself_t *self,
 }
 
 // add protocol parameters the subscriber might want to know about
-int describe_parameters(htself_t *self)
+int describe_parameters(htself_t *self, machinetalk::Container &tx)
 {
-    machinetalk::ProtocolParameters *pp = self->tx.mutable_pparams();
+    machinetalk::ProtocolParameters *pp = tx.mutable_pparams();
     pp->set_keepalive_timer(self->cfg->keepalive_timer);
     pp->set_group_timer(self->cfg->default_group_timer);
     pp->set_rcomp_timer(self->cfg->default_rcomp_timer);
@@ -54,6 +54,7 @@ static htconf_t conf = {
     100,  // default_group_timer
     100,  // odefault_rcomp_timer
     2000, // keepalive
+    0,    // group_workers
     true, // trap_signals
 };
 
@@ -107,9 +108,11 @@ mainloop( htself_t *self)
     if (self->cfg->keepalive_timer)
 	zloop_timer(loop, self->cfg->keepalive_timer, 0,
 		    handle_keepalive_timer, (void *) self);
+    start_group_workers(self);
     do {
 	retval = zloop_start(loop);
     } while  (!(retval || self->interrupted));
+    stop_group_workers(self);
 
     rtapi_print_msg(RTAPI_MSG_INFO,
 		    "%s: exiting mainloop (%s)\n",
@@ -342,11 +345,13 @@ usage(void)
 	   "    set the RTAPI message level.\n"
 	   "-t or --timer <msec>\n"
 	   "    set the default group scan timer (100mS).\n"
+	   "-w or --workers <n>\n"
+	   "    scan and report groups in <n> threads (default 0: main loop).\n"
 	   "-d or --debug\n"
 	   "    Turn on event debugging messages.\n");
 }
 
-static const char *option_string = "hI:S:d:t:T:R:sK:G";
+static const char *option_string = "hI:S:d:t:T:R:sK:Gw:";
 static struct option long_options[] = {
     {"help", no_argument, 0, 'h'},
     {"ini", required_argument, 0, 'I'},     // default: getenv(INI_FILE_NAME)
@@ -355,6 +360,7 @@ static struct option long_options[] = {
     {"gtimer", required_argument, 0, 't'},
     {"ctimer", required_argument, 0, 'T'},
     {"keepalive", required_argument, 0, 'K'},
+    {"workers", required_argument, 0, 'w'},
     {"svcuuid", required_argument, 0, 'R'},
     {"stderr",  no_argument,        0, 's'},
     {"nosighdlr",   no_argument,    0, 'G'},
@@ -395,6 +401,11 @@ int main (int argc, char *argv[])
 	case 'K':
 	    conf.keepalive_timer = atoi(optarg);
 	    break;
+	case 'w':
+	    conf.group_workers = atoi(optarg);
+	    if (conf.group_workers < 0)
+		conf.group_workers = 0;
+	    break;
 #ifdef NOTYET
 	case 'b':
 	    conf.bridgecomp = optarg;
@@ -0,0 +1,119 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// encoder for packed group and comp updates.
+// the format is described with Container.packed in message.proto.
+
+#ifndef HALTALK_PACKED_HH
+#define HALTALK_PACKED_HH
+
+#include <endian.h>
+#include <string.h>
+#include <string>
+#include <rtapi_bitops.h>
+
+#define PACKED_VERSION   1
+#define PACKED_ALL_ITEMS 1  // flags: no bitmap, all items present
+#define PACKED_HDR_SIZE  6
+
+static inline void packed_put32(uint8_t *p, const uint32_t v)
+{
+    uint32_t le = htole32(v);
+    memcpy(p, &le, sizeof(le));
+}
+
+static inline void packed_put64(uint8_t *p, const uint64_t v)
+{
+    uint64_t le = htole64(v);
+    memcpy(p, &le, sizeof(le));
+}
+
+// encode items 0..n-1 into 'out': those with their bit set in
+// 'changed', or all if changed is NULL. type_of(i) and value_of(i)
+// return the hal_type_t and the const hal_data_u * of item i.
+// items of other types are not encoded.
+template <typename TypeOf, typename ValueOf>
+void pack_update(std::string &out, const int n, const unsigned long *changed,
+		 TypeOf type_of, ValueOf value_of)
+{
+    size_t count[HAL_U64 + 1] = {}, offset[HAL_U64 + 1];
+    int i;
+
+    for (i = 0; i < n; i++) {
+	if (changed && !RTAPI_BIT_TEST(changed, i))
+	    continue;
+	int t = type_of(i);
+	if ((t >= HAL_BIT) && (t <= HAL_U64))
+	    count[t]++;
+    }
+
+    offset[HAL_BIT] = PACKED_HDR_SIZE + (changed ? (n + 7) / 8 : 0);
+    offset[HAL_FLOAT] = offset[HAL_BIT] + (count[HAL_BIT] + 7) / 8;
+    offset[HAL_S32] = offset[HAL_FLOAT] + count[HAL_FLOAT] * 8;
+    offset[HAL_U32] = offset[HAL_S32] + count[HAL_S32] * 4;
+    offset[HAL_S64] = offset[HAL_U32] + count[HAL_U32] * 4;
+    offset[HAL_U64] = offset[HAL_S64] + count[HAL_S64] * 8;
+
+    out.assign(offset[HAL_U64] + count[HAL_U64] * 8, '\0');
+    uint8_t *p = (uint8_t *) &out[0];
+
+    p[0] = PACKED_VERSION;
+    p[1] = changed ? 0 : PACKED_ALL_ITEMS;
+    packed_put32(p + 2, n);
+
+    uint8_t *bitmap = p + PACKED_HDR_SIZE;
+    size_t nbits = 0;
+    for (i = 0; i < n; i++) {
+	if (changed && !RTAPI_BIT_TEST(changed, i))
+	    continue;
+	int t = type_of(i);
+	if ((t < HAL_BIT) || (t > HAL_U64))
+	    continue;
+	if (changed)
+	    bitmap[i / 8] |= 1 << (i % 8);
+
+	const hal_data_u *v = value_of(i);
+	uint8_t *dst = p + offset[t];
+	switch (t) {
+	case HAL_BIT:
+	    if (get_bit_value(v))
+		p[offset[HAL_BIT] + nbits / 8] |= 1 << (nbits % 8);
+	    nbits++;
+	    break;
+	case HAL_FLOAT:
+	    {
+		hal_float_t f = get_float_value(v);
+		uint64_t u;
+		memcpy(&u, &f, sizeof(u));
+		packed_put64(dst, u);
+		offset[t] += 8;
+	    }
+	    break;
+	case HAL_S32:
+	case HAL_U32:
+	    packed_put32(dst, get_u32_value(v));
+	    offset[t] += 4;
+	    break;
+	case HAL_S64:
+	case HAL_U64:
+	    packed_put64(dst, get_u64_value(v));
+	    offset[t] += 8;
+	    break;
+	}
+    }
+}
+
+#endif // HALTALK_PACKED_HH
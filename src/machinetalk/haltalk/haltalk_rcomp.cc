@@ -19,6 +19,7 @@
 #include "haltalk.hh"
 #include "halpb.hh"
 #include "pbutil.hh"
+#include "haltalk_packed.hh"
 
 static int
 comp_report_cb(const int phase,
@@ -34,13 +35,20 @@ add_pins_to_items(const int phase,
           const hal_data_u *vp,
           void *cb_data);
 
+static void
+send_packed(rcomp_t *rc);
+
 // handle timer event for a rcomp - report any changes in comp
 int
 handle_rcomp_timer(zloop_t *loop, int timer_id, void *arg)
 {
     rcomp_t *rc = (rcomp_t *) arg;
-    if (hal_ccomp_match(rc->cc))
-    hal_ccomp_report(rc->cc, comp_report_cb, rc, rc->flags);
+    if (hal_ccomp_match(rc->cc)) {
+        if (rc->cc->comp->userarg2 & RCOMP_REPORT_PACKED)
+            send_packed(rc);
+        else
+            hal_ccomp_report(rc->cc, comp_report_cb, rc, rc->flags);
+    }
     return 0;
 }
 
@@ -88,7 +96,12 @@ handle_rcomp_input(zloop_t *loop, zsock_t *socket, void *arg)
         self->tx.set_type(machinetalk::MT_HALRCOMP_FULL_UPDATE);
         self->tx.set_uuid(self->netopts.proc_uuid, sizeof(self->netopts.proc_uuid));
         self->tx.set_serial(g->serial++);
-        describe_parameters(self);
+        describe_parameters(self, self->tx);
+        if (g->cc->comp->userarg2 & RCOMP_REPORT_PACKED) {
+            // the pin order defines the item indices of packed updates
+            for (int i = 0; i < g->cc->n_pins; i++)
+            self->tx.add_packed_handle(ho_id(g->cc->pin[i]));
+        }
         describe_comp(self, topic, topic, socket);
 
         // first subscriber - activate scanning
@@ -320,6 +333,25 @@ comp_report_cb(const int phase,
     return 0;
 }
 
+// send the changed pins as a MT_HALRCOMP_PACKED_UPDATE
+static void
+send_packed(rcomp_t *rc)
+{
+    htself_t *self = rc->self;
+    hal_compiled_comp_t *cc = rc->cc;
+
+    pack_update(rc->packed, cc->n_pins, rc->flags ? NULL : cc->changed,
+        [cc](int i) { return pin_type(cc->pin[i]); },
+        [cc](int i) -> const hal_data_u * { return pin_value(cc->pin[i]); });
+
+    self->tx.set_type(machinetalk::MT_HALRCOMP_PACKED_UPDATE);
+    self->tx.set_serial(rc->serial++);
+    self->tx.set_packed(rc->packed);
+    int retval = send_pbcontainer(ho_name(cc->comp), self->tx,
+                  self->mksock[SVC_HALRCOMP].socket);
+    assert(retval == 0);
+}
+
 static int
 add_pins_to_items(const int phase,
           const hal_compiled_comp_t *cc,
@@ -24,6 +24,7 @@
 #include <hal_group.h>
 #include <hal_rcomp.h>
 #include <hal_ring.h>
+#include <hal_profile.h>
 #include "message.pb.h"
 
 // in halpb.cc:
@@ -58,10 +59,10 @@ static inline int hal_pin2pb(hal_pin_t *hp, machinetalk::Pin *p)
     return 0;
 }
 
-static inline int hal_sig2pb(hal_sig_t *sp, machinetalk::Signal *s)
+static inline int hal_u2pbsig(const hal_type_t type, const hal_data_u *vp,
+			      machinetalk::Signal *s)
 {
-    const hal_data_u *vp = sig_value(sp);
-    switch (sp->type) {
+    switch (type) {
     default:
 	return -1;
     case HAL_BIT:
@@ -80,6 +81,11 @@ static inline int hal_sig2pb(hal_sig_t *sp, machinetalk::Signal *s)
     return 0;
 }
 
+static inline int hal_sig2pb(hal_sig_t *sp, machinetalk::Signal *s)
+{
+    return hal_u2pbsig(sp->type, sig_value(sp), s);
+}
+
 static inline int hal_param2pb(const hal_param_t *pp, machinetalk::Param *p)
 {
     const hal_data_u *vp = param_value(pp);
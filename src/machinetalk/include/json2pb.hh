@@ -19,4 +19,7 @@ class Message;
 void json2pb(google::protobuf::Message &msg, const char *buf, size_t size);
 std::string pb2json(const google::protobuf::Message &msg);
 
+// the same, into 'out' (cleared first), so its buffer can be reused
+void pb2json(const google::protobuf::Message &msg, std::string &out);
+
 #endif//__JSON2PB_H__
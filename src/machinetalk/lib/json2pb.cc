@@ -6,6 +6,9 @@
  */
 
 #include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
 #include <jansson.h>
 
 #include <google/protobuf/message.h>
@@ -14,6 +17,8 @@
 #include <json2pb.hh>
 
 #include <stdexcept>
+#include <cmath>
+#include <vector>
 
 namespace {
 #include "bin2ascii.hh"
@@ -44,98 +49,229 @@ public:
 	virtual const char *what() const throw () { return _error.c_str(); };
 };
 
-static json_t * _pb2json(const Message& msg);
-static json_t * _field2json(const Message& msg, const FieldDescriptor *field, size_t index)
+// pb2json writes JSON text straight from the message, walking the
+// descriptor, instead of building a jansson object tree and dumping
+// it. Besides the output string, which can be reused, only the field
+// list of each (sub)message and base64 encoded bytes fields allocate.
+// The text is the same json_dump_callback(root, ..., 0) produced -
+// see pb2json-test and tests/pb2json.0.
+
+static void _pb2json(const Message& msg, std::string &out);
+
+// the checks of jansson's json_string(): no overlong sequences,
+// surrogates or code points beyond U+10FFFF
+static bool _utf8_valid(const std::string &s)
+{
+	const unsigned char *p = (const unsigned char *) s.data();
+	const unsigned char *end = p + s.size();
+
+	while (p < end) {
+		unsigned c = *p++;
+		int n;
+		unsigned min;
+
+		if (c < 0x80)
+			continue;
+		else if ((c & 0xe0) == 0xc0) {
+			n = 1; min = 0x80; c &= 0x1f;
+		} else if ((c & 0xf0) == 0xe0) {
+			n = 2; min = 0x800; c &= 0x0f;
+		} else if ((c & 0xf8) == 0xf0) {
+			n = 3; min = 0x10000; c &= 0x07;
+		} else
+			return false;
+		if (end - p < n)
+			return false;
+		for (; n > 0; n--, p++) {
+			if ((*p & 0xc0) != 0x80)
+				return false;
+			c = (c << 6) | (*p & 0x3f);
+		}
+		if ((c < min) || (c > 0x10ffff) ||
+		    ((c >= 0xd800) && (c <= 0xdfff)))
+			return false;
+	}
+	return true;
+}
+
+static void _json_string(const FieldDescriptor *field, const std::string &s,
+			 std::string &out)
+{
+	if (!_utf8_valid(s))
+		throw j2pb_error(field, "Fail to convert to json");
+
+	static const char hex[] = "0123456789ABCDEF";
+	size_t start = 0;
+
+	out += '"';
+	for (size_t i = 0; i < s.size(); i++) {
+		const unsigned char c = s[i];
+		if ((c >= 0x20) && (c != '"') && (c != '\\'))
+			continue;
+		out.append(s, start, i - start);
+		start = i + 1;
+		switch (c) {
+		case '"':  out += "\\\""; break;
+		case '\\': out += "\\\\"; break;
+		case '\b': out += "\\b"; break;
+		case '\f': out += "\\f"; break;
+		case '\n': out += "\\n"; break;
+		case '\r': out += "\\r"; break;
+		case '\t': out += "\\t"; break;
+		default:
+			out += "\\u00";
+			out += hex[c >> 4];
+			out += hex[c & 0xf];
+		}
+	}
+	out.append(s, start, std::string::npos);
+	out += '"';
+}
+
+static void _json_real(const FieldDescriptor *field, double value, std::string &out)
+{
+	char buf[32];
+
+	if (!std::isfinite(value))
+		throw j2pb_error(field, "Fail to convert to json");
+	int n = snprintf(buf, sizeof(buf), "%.17g", value);
+	char *e = strchr(buf, 'e');
+	if (e == NULL) {
+		out.append(buf, n);
+		// keep it a real, as jansson does
+		if (!strchr(buf, '.'))
+			out += ".0";
+		return;
+	}
+	// and like jansson, no '+' or leading zeros in the exponent
+	out.append(buf, ++e - buf);
+	if (*e == '-')
+		out += *e;
+	if ((*e == '-') || (*e == '+'))
+		e++;
+	while ((*e == '0') && (e[1] != '\0'))
+		e++;
+	out += e;
+}
+
+static void _field2json(const Message& msg, const FieldDescriptor *field,
+			size_t index, std::string &out)
 {
 	const Reflection *ref = msg.GetReflection();
 	const bool repeated = field->is_repeated();
-	json_t *jf = 0;
+	char buf[24];
+	int n;
+
 	switch (field->cpp_type())
 	{
-#define _CONVERT(type, ctype, fmt, sfunc, afunc)		\
-		case FieldDescriptor::type: {			\
-			const ctype value = (repeated)?		\
-				ref->afunc(msg, field, index):	\
-				ref->sfunc(msg, field);		\
-			jf = fmt(value);			\
-			break;					\
-		}
-
-		_CONVERT(CPPTYPE_DOUBLE, double, json_real, GetDouble, GetRepeatedDouble);
-		_CONVERT(CPPTYPE_FLOAT, double, json_real, GetFloat, GetRepeatedFloat);
-		_CONVERT(CPPTYPE_INT64, json_int_t, json_integer, GetInt64, GetRepeatedInt64);
-		_CONVERT(CPPTYPE_UINT64, json_int_t, json_integer, GetUInt64, GetRepeatedUInt64);
-		_CONVERT(CPPTYPE_INT32, json_int_t, json_integer, GetInt32, GetRepeatedInt32);
-		_CONVERT(CPPTYPE_UINT32, json_int_t, json_integer, GetUInt32, GetRepeatedUInt32);
-		_CONVERT(CPPTYPE_BOOL, bool, json_boolean, GetBool, GetRepeatedBool);
-#undef _CONVERT
-		case FieldDescriptor::CPPTYPE_STRING: {
-			std::string scratch;
-			const std::string &value = (repeated)?
-				ref->GetRepeatedStringReference(msg, field, index, &scratch):
-				ref->GetStringReference(msg, field, &scratch);
-			if (field->type() == FieldDescriptor::TYPE_BYTES)
-				jf = json_string(b64_encode(value).c_str());
-			else
-				jf = json_string(value.c_str());
-			break;
-		}
-		case FieldDescriptor::CPPTYPE_MESSAGE: {
-			const Message& mf = (repeated)?
-				ref->GetRepeatedMessage(msg, field, index):
-				ref->GetMessage(msg, field);
-			jf = _pb2json(mf);
-			break;
-		}
-		case FieldDescriptor::CPPTYPE_ENUM: {
-			const EnumValueDescriptor* ef = (repeated)?
-				ref->GetRepeatedEnum(msg, field, index):
-				ref->GetEnum(msg, field);
+#define _GET(sfunc, afunc)						\
+		((repeated) ? ref->afunc(msg, field, index) : ref->sfunc(msg, field))
+
+	case FieldDescriptor::CPPTYPE_DOUBLE:
+		_json_real(field, _GET(GetDouble, GetRepeatedDouble), out);
+		break;
+	case FieldDescriptor::CPPTYPE_FLOAT:
+		_json_real(field, _GET(GetFloat, GetRepeatedFloat), out);
+		break;
+	case FieldDescriptor::CPPTYPE_INT64:
+		n = snprintf(buf, sizeof(buf), "%" PRId64,
+			     (int64_t) _GET(GetInt64, GetRepeatedInt64));
+		out.append(buf, n);
+		break;
+	case FieldDescriptor::CPPTYPE_UINT64:
+		// signed, as a json_int_t: json2pb() reads nothing larger
+		n = snprintf(buf, sizeof(buf), "%" PRId64,
+			     (int64_t) _GET(GetUInt64, GetRepeatedUInt64));
+		out.append(buf, n);
+		break;
+	case FieldDescriptor::CPPTYPE_INT32:
+		n = snprintf(buf, sizeof(buf), "%" PRId32,
+			     (int32_t) _GET(GetInt32, GetRepeatedInt32));
+		out.append(buf, n);
+		break;
+	case FieldDescriptor::CPPTYPE_UINT32:
+		n = snprintf(buf, sizeof(buf), "%" PRIu32,
+			     (uint32_t) _GET(GetUInt32, GetRepeatedUInt32));
+		out.append(buf, n);
+		break;
+	case FieldDescriptor::CPPTYPE_BOOL:
+		out += _GET(GetBool, GetRepeatedBool) ? "true" : "false";
+		break;
+	case FieldDescriptor::CPPTYPE_ENUM:
+		n = snprintf(buf, sizeof(buf), "%d",
+			     _GET(GetEnum, GetRepeatedEnum)->number());
+		out.append(buf, n);
+		break;
+#undef _GET
+	case FieldDescriptor::CPPTYPE_STRING: {
+		std::string scratch;
+		const std::string &value = (repeated)?
+			ref->GetRepeatedStringReference(msg, field, index, &scratch):
+			ref->GetStringReference(msg, field, &scratch);
+		if (field->type() == FieldDescriptor::TYPE_BYTES)
+			_json_string(field, b64_encode(value), out);
+		else
+			_json_string(field, value, out);
+		break;
+	}
+	case FieldDescriptor::CPPTYPE_MESSAGE:
+		_pb2json((repeated)?
+			 ref->GetRepeatedMessage(msg, field, index):
+			 ref->GetMessage(msg, field), out);
+		break;
+	default:
+		throw j2pb_error(field, "Fail to convert to json");
+	}
+}
 
-			jf = json_integer(ef->number());
-			break;
+static void _member2json(const Message& msg, const FieldDescriptor *field,
+			 bool &first, std::string &out)
+{
+	const Reflection *ref = msg.GetReflection();
+	size_t count = 0;
+
+	if (field->is_repeated()) {
+		if ((count = ref->FieldSize(msg, field)) == 0)
+			return;
+	} else if (!ref->HasField(msg, field))
+		return;
+
+	if (!first)
+		out += ", ";
+	first = false;
+	out += '"';
+	out += (field->is_extension()) ? field->full_name() : field->name();
+	out += "\": ";
+
+	if (field->is_repeated()) {
+		out += '[';
+		for (size_t j = 0; j < count; j++) {
+			if (j)
+				out += ", ";
+			_field2json(msg, field, j, out);
 		}
-		default:
-			break;
-	}
-	if (!jf) throw j2pb_error(field, "Fail to convert to json");
-	return jf;
+		out += ']';
+	} else
+		_field2json(msg, field, 0, out);
 }
 
-static json_t * _pb2json(const Message& msg)
+// ListFields() is faster than asking every field of a large message
+// like Container whether it is set
+static void _pb2json(const Message& msg, std::string &out)
 {
 	const Descriptor *d = msg.GetDescriptor();
 	const Reflection *ref = msg.GetReflection();
-	if (!d || !ref) return 0;
+	std::vector<const FieldDescriptor *> fields;
+	bool first = true;
 
-	json_t *root = json_object();
-	json_autoptr _auto(root);
+	if (!d || !ref)
+		throw j2pb_error("No descriptor or reflection");
 
-	std::vector<const FieldDescriptor *> fields;
 	ref->ListFields(msg, &fields);
-
+	out += '{';
 	for (size_t i = 0; i != fields.size(); i++)
-	{
-		const FieldDescriptor *field = fields[i];
-
-		json_t *jf = 0;
-		if(field->is_repeated()) {
-			size_t count = ref->FieldSize(msg, field);
-			if (!count) continue;
-
-			json_autoptr array(json_array());
-			for (size_t j = 0; j < count; j++)
-				json_array_append_new(array.ptr, _field2json(msg, field, j));
-			jf = array.release();
-		} else if (ref->HasField(msg, field))
-			jf = _field2json(msg, field, 0);
-		else
-			continue;
-
-		const std::string &name = (field->is_extension())?field->full_name():field->name();
-		json_object_set_new(root, name.c_str(), jf);
-	}
-	return _auto.release();
+		_member2json(msg, fields[i], first, out);
+	out += '}';
 }
 
 static void _json2pb(Message& msg, json_t *root);
@@ -254,20 +390,16 @@ void json2pb(Message &msg, const char *buf, size_t size)
 	_json2pb(msg, root);
 }
 
-int json_dump_std_string(const char *buf, size_t size, void *data)
+void pb2json(const Message &msg, std::string &out)
 {
-	std::string *s = (std::string *) data;
-	s->append(buf, size);
-	return 0;
+	out.clear();
+	_pb2json(msg, out);
 }
 
 std::string pb2json(const Message &msg)
 {
 	std::string r;
 
-	json_t *root = _pb2json(msg);
-
-	json_autoptr _auto(root);
-	json_dump_callback(root, json_dump_std_string, &r, 0);
+	pb2json(msg, r);
 	return r;
 }
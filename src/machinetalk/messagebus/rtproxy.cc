@@ -111,7 +111,6 @@ rtproxy_thread(void *arg, void *pipe)
 
     if (self->flags & (ACTOR_RESPONDER|ACTOR_SUBSCRIBER)) {
 	zpoller_t *cmdpoller = zpoller_new (self->proxy_cmd, NULL);
-	zpoller_t *delay = zpoller_new(NULL);
 
 	while (1) {
 	    self->state = WAIT_FOR_COMMAND;
@@ -124,7 +123,7 @@ rtproxy_thread(void *arg, void *pipe)
 	    int i;
 	    pb_Container rx;
 
-	    size_t mframe_size;
+	    size_t mframe_size = 0;
 	    // compute buffer requirements and block until available
 	    for (i = 0,f = zmsg_first (to_rt);
 		 f != NULL;
@@ -145,15 +144,24 @@ rtproxy_thread(void *arg, void *pipe)
 	    // add in the frameheaders
 	    mframe_size += i * sizeof(frameheader_t);
 
-	    // dont overrun to_rt ring
-	    self->current_delay = self->min_delay;
+	    // dont overrun to_rt ring - sleep until RT has consumed enough
 	    self->state = WAIT_FOR_TO_RT_SPACE;
-
-	    while (record_write_space(self->to_rt_ring.header) - mframe_size < 0) {
-		zpoller_wait (delay, self->current_delay);
-		// exponential backoff
-		self->current_delay <<= 1;
-		self->current_delay = MIN(self->current_delay, self->max_delay);
+	    do {
+		retval = ring_wait_write(&self->to_rt_ring, mframe_size,
+					 self->max_delay);
+		if (zsys_interrupted) {
+		    zmsg_destroy(&to_rt);
+		    goto DONE;
+		}
+	    } while ((retval == ETIMEDOUT) || (retval == EINTR));
+	    if (retval) {
+		// cannot ever fit, drop it
+		self->rb_txfail++;
+		rtapi_print_msg(RTAPI_MSG_ERR, "%s: message size %zu exceeds %s,"
+				" dropped", self->name, mframe_size,
+				self->to_rt_name);
+		zmsg_destroy(&to_rt);
+		continue;
 	    }
 
 	    // good to go, should not fail due to lack of space
@@ -231,8 +239,9 @@ rtproxy_thread(void *arg, void *pipe)
 	    msg_read_abort(&self->from_rt_mframe);
 	    i = 0;
 	    while (1) {
-		zpoller_wait (delay, self->current_delay);
-		if ( zpoller_terminated (delay) ) {
+		// returns as soon as RT responds
+		if (ring_wait_read(&self->from_rt_ring,
+				   self->current_delay) == EINTR) {
 		    rtapi_print_msg(RTAPI_MSG_ERR, "%s: wait interrupted",
 				    self->from_rt_name);
 		}
@@ -301,7 +310,6 @@ rtproxy_thread(void *arg, void *pipe)
 	}
     DONE:
 	zpoller_destroy(&cmdpoller);
-	zpoller_destroy(&delay);
     }
     if (self->buffer)
 	free(self->buffer);
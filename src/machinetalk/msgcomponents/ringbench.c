@@ -17,6 +17,7 @@
 
 #define MODE_RECORD 0
 #define MODE_STREAM 1
+#define MODE_MPMC   2
 
 volatile int go, done, rdone = 0;
 static int comp_id;		/* component ID */
@@ -49,7 +50,7 @@ typedef struct {
 volatile int *ep;
 
 
-static char *option_string = "p:c:r:t:dhmRSs:ve:";
+static char *option_string = "p:c:r:t:dhmRSMs:ve:b:";
 static struct option long_options[] = {
     {"num-producers", no_argument, 0, 'p'},
     {"num-consumers", no_argument, 0, 'c'},
@@ -63,6 +64,8 @@ static struct option long_options[] = {
     {"use-mutex", no_argument, 0, 'm'},
     {"use-rtapi-shm", no_argument, 0, 'R'},
     {"stream-mode", no_argument, 0, 'S'},
+    {"mpmc-mode", no_argument, 0, 'M'},
+    {"batch", required_argument, 0, 'b'},
     {0,0,0,0}
 };
 
@@ -78,6 +81,7 @@ struct conf {
     int mode;
     int size;
     int extra;
+    int batch;
 } conf = {
     .verbose = 0,
     .debug = 0,
@@ -90,6 +94,7 @@ struct conf {
     .mode = 0, // default record mode
     .size = 16384,
     .extra = 0,
+    .batch = 1,
 };
 
 
@@ -105,7 +110,13 @@ void usage(int argc, char **argv) {
 	   "-r or --rtapi-msg-level <level>\n"
 	   "    set the RTAPI message level.\n"
 	   "-d or --debug\n"
-	   "    Turn on event debugging messages.\n");
+	   "    Turn on event debugging messages.\n"
+	   "-p or --num-producers <n>, -c or --num-consumers <n>\n"
+	   "    number of producer and consumer threads (default 1)\n"
+	   "-M or --mpmc-mode\n"
+	   "    use a lock-free MPMC ring instead of a record ring with mutexes\n"
+	   "-b or --batch <n>\n"
+	   "    record mode: write and consume up to n records per ring update\n");
 }
 
 void *timer(void *arg)
@@ -127,7 +138,8 @@ void *producer(void *arg)
 {
     prodinfo_t *p = arg;
     value_t v;
-    int retval;
+    ringbatch_t b;
+    int i, retval;
 
     v.tid = p->id;
     v.val = p->ctr;
@@ -141,6 +153,16 @@ void *producer(void *arg)
 	printf("producer %d go\n",p->id);
 
     while (!done) {
+	if (conf.mode == MODE_MPMC) {
+	    // no locking, any number of producers
+	    if (mpmc_write(p->r, &v, sizeof(v)))
+		p->wfail++;
+	    else {
+		p->ctr++;
+		v.val = p->ctr;
+	    }
+	    continue;
+	}
 	if (p->r->header->use_wmutex && rtapi_mutex_try(&p->r->header->wmutex)) {
 	    p->wlocked++;
 	    sched_yield();
@@ -158,6 +180,19 @@ void *producer(void *arg)
 	    if (p->r->header->use_wmutex)
 		rtapi_mutex_give(&p->r->header->wmutex);
 	    p->ctr++;
+	} else if (conf.batch > 1) {
+	    // publish up to conf.batch records with a single tail update
+	    record_batch_begin(p->r, &b);
+	    for (i = 0; i < conf.batch; i++) {
+		if (record_batch_write(&b, &v, sizeof(v)))
+		    break;
+		p->ctr++;
+		v.val = p->ctr;
+	    }
+	    if (record_batch_commit(&b) == 0)
+		p->wfail++;
+	    if (p->r->header->use_wmutex)
+		rtapi_mutex_give(&p->r->header->wmutex);
 	} else {
 
 	    retval = record_write(p->r, &v, sizeof(v));
@@ -181,7 +216,14 @@ void *consumer(void *arg)
 {
     consinfo_t *c = arg;
     const value_t *vp;
+    value_t v;
     ringsize_t size;
+    rrecsize_t rsize;
+    ringvec_t *rv = NULL;
+    int i, n;
+
+    if (conf.batch > 1)
+	assert((rv = calloc(sizeof(ringvec_t), conf.batch)) != NULL);
 
     if (conf.verbose)
 	printf("consumer %d start\n",c->id);
@@ -192,15 +234,49 @@ void *consumer(void *arg)
 	printf("consumer %d go\n",c->id);
 
     while (1) {
+	if (conf.mode == MODE_MPMC) {
+	    if (mpmc_read(c->r, &v, sizeof(v), &size)) {
+		if (rdone)
+		    break;
+		c->rfail++;
+	    } else {
+		assert(size == sizeof(value_t));
+		// several consumers may take records of one producer
+		// out of order, so just count them
+		__sync_fetch_and_add(&ep[v.tid], 1);
+		c->rcnt++;
+	    }
+	    continue;
+	}
 	if (c->r->header->use_rmutex && rtapi_mutex_try(&c->r->header->rmutex)) {
 	    sched_yield();
 	    c->rlocked++;
 	    continue;
 	}
 	if (conf.mode == MODE_STREAM) {
+	} else if (conf.batch > 1) {
+	    // consume a run of records with a single head update
+	    n = record_read_batch(c->r, rv, conf.batch);
+	    if (n == 0) {
+		if (rdone) {
+		    if (c->r->header->use_rmutex)
+			rtapi_mutex_give(&c->r->header->rmutex);
+		    break;
+		}
+		c->rfail++;
+	    }
+	    for (i = 0; i < n; i++) {
+		vp = rv[i].rv_base;
+		assert(rv[i].rv_len == sizeof(value_t));
+		assert(vp->val == __sync_fetch_and_add (&ep[vp->tid],1));
+	    }
+	    record_shift_batch(c->r, n);
+	    c->rcnt += n;
+	    if (c->r->header->use_rmutex)
+		rtapi_mutex_give(&c->r->header->rmutex);
 	} else {
-	    size = record_next_size(c->r);
-	    if (size < 0) {
+	    rsize = record_next_size(c->r);
+	    if (rsize < 0) {
 		if (rdone) {
 		    if (c->r->header->use_rmutex)
 			rtapi_mutex_give(&c->r->header->rmutex);
@@ -208,7 +284,7 @@ void *consumer(void *arg)
 		}
 		c->rfail++;
 	    } else {
-		assert(size == sizeof(value_t));
+		assert(rsize == sizeof(value_t));
 		vp = record_next(c->r);
 		assert(vp->val == __sync_fetch_and_add (&ep[vp->tid],1));
 		record_shift(c->r);
@@ -218,6 +294,7 @@ void *consumer(void *arg)
 		rtapi_mutex_give(&c->r->header->rmutex);
 	}
     }
+    free(rv);
     return 0;
 }
 
@@ -269,6 +346,12 @@ int main(int argc, char **argv)
 	case 'S':
 	    conf.mode = MODE_STREAM;
 	    break;
+	case 'M':
+	    conf.mode = MODE_MPMC;
+	    break;
+	case 'b':
+	    conf.batch = atoi(optarg);
+	    break;
 	case 'h':
 	default:
 	    usage(argc, argv);
@@ -288,7 +371,15 @@ int main(int argc, char **argv)
     assert((pi = calloc(sizeof(prodinfo_t),conf.n_producers)) != NULL);
     assert((ep = calloc(sizeof(int),conf.n_producers)) != NULL);
 
-    if ((retval = hal_ring_newf( conf.size, 0, conf.mode, ringname))) {
+    if (conf.mode == MODE_MPMC)
+	// as many slots as records of value_t fit into conf.size
+	retval = hal_ring_new_mpmcf(conf.size / mpmc_slot_size(sizeof(value_t)),
+				    sizeof(value_t), 0, 0, ringname);
+    else
+	retval = hal_ring_newf(conf.size, 0,
+			       (conf.mode == MODE_STREAM) ? RINGTYPE_STREAM : 0,
+			       ringname);
+    if (retval) {
 	rtapi_print_msg(RTAPI_MSG_ERR,
 			"ringbench: failed to create new ring %s: %d\n",
 			ringname, retval);
@@ -301,8 +392,10 @@ int main(int argc, char **argv)
 
     hal_ready(comp_id);
 
-    rb.header->use_wmutex = (conf.n_producers > 1);
-    rb.header->use_rmutex = (conf.n_consumers > 1);
+    if (conf.mode != MODE_MPMC) {
+	rb.header->use_wmutex = (conf.n_producers > 1);
+	rb.header->use_rmutex = (conf.n_consumers > 1);
+    }
 
     for(i = 0; i < conf.n_producers; i++) {
 	pi[i].id = i;
@@ -346,8 +439,13 @@ int main(int argc, char **argv)
     elapsedTime = (t2.tv_sec - t1.tv_sec) * 1000.0;
     elapsedTime += (t2.tv_usec - t1.tv_usec) / 1000.0;
 
+    printf("mode=%s producers=%d consumers=%d batch=%d\n",
+	   (conf.mode == MODE_MPMC) ? "mpmc" :
+	   (conf.mode == MODE_STREAM) ? "stream" : "record",
+	   conf.n_producers, conf.n_consumers, conf.batch);
     printf("tx=%d rx=%d txfail=%d rxfail=%d wlock=%d rlock=%d\n",stx,srx,swfail,srfail,swlock,srlock);
-    printf("dt=%fs, nsecs per msg: %g\n", elapsedTime/1000.0, (elapsedTime)*1e6/(srx));
+    printf("dt=%fs, nsecs per msg: %g, msgs/s: %g\n", elapsedTime/1000.0,
+	   (elapsedTime)*1e6/(srx), srx / (elapsedTime/1000.0));
 
     for(i = 0; i < conf.n_producers; i++) {
 	if (pi[i].ctr != ep[i])
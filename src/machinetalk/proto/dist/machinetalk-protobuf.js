@@ -2108,6 +2108,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -5796,6 +5804,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -7649,6 +7665,63 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                         }
                     ]
                 },
+                {
+                    "name": "ProfileStats",
+                    "syntax": "proto2",
+                    "options": {
+                        "(nanopb_msgopt).msgid": 716
+                    },
+                    "fields": [
+                        {
+                            "rule": "optional",
+                            "type": "string",
+                            "name": "name",
+                            "id": 1
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "fixed64",
+                            "name": "count",
+                            "id": 2
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "min",
+                            "id": 3
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "max",
+                            "id": 4
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "mean",
+                            "id": 5
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "p50",
+                            "id": 6
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "p99",
+                            "id": 7
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "p999",
+                            "id": 8
+                        }
+                    ]
+                },
                 {
                     "name": "Thread",
                     "syntax": "proto2",
@@ -7703,6 +7776,30 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "type": "string",
                             "name": "function",
                             "id": 8
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "ProfileStats",
+                            "name": "runtime_profile",
+                            "id": 9
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "ProfileStats",
+                            "name": "jitter_profile",
+                            "id": 10
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "fixed64",
+                            "name": "overruns",
+                            "id": 11
+                        },
+                        {
+                            "rule": "repeated",
+                            "type": "ProfileStats",
+                            "name": "function_profile",
+                            "id": 12
                         }
                     ]
                 },
@@ -9597,6 +9694,18 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "cpu",
                             "id": 9
                         },
+                        {
+                            "rule": "optional",
+                            "type": "string",
+                            "name": "cgname",
+                            "id": 14
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "int32",
+                            "name": "workers",
+                            "id": 15
+                        },
                         {
                             "rule": "optional",
                             "type": "string",
@@ -11785,6 +11894,25 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                                 "(nanopb).type": "FT_IGNORE"
                             }
                         },
+                        {
+                            "rule": "repeated",
+                            "type": "fixed32",
+                            "name": "packed_handle",
+                            "id": 112,
+                            "options": {
+                                "packed": true,
+                                "(nanopb).type": "FT_IGNORE"
+                            }
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "bytes",
+                            "name": "packed",
+                            "id": 113,
+                            "options": {
+                                "(nanopb).type": "FT_IGNORE"
+                            }
+                        },
                         {
                             "rule": "repeated",
                             "type": "Application",
@@ -13005,6 +13133,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -16584,6 +16720,63 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                         }
                     ]
                 },
+                {
+                    "name": "ProfileStats",
+                    "syntax": "proto2",
+                    "options": {
+                        "(nanopb_msgopt).msgid": 716
+                    },
+                    "fields": [
+                        {
+                            "rule": "optional",
+                            "type": "string",
+                            "name": "name",
+                            "id": 1
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "fixed64",
+                            "name": "count",
+                            "id": 2
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "min",
+                            "id": 3
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "max",
+                            "id": 4
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "mean",
+                            "id": 5
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "p50",
+                            "id": 6
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "p99",
+                            "id": 7
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "sfixed32",
+                            "name": "p999",
+                            "id": 8
+                        }
+                    ]
+                },
                 {
                     "name": "Thread",
                     "syntax": "proto2",
@@ -16638,6 +16831,30 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "type": "string",
                             "name": "function",
                             "id": 8
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "ProfileStats",
+                            "name": "runtime_profile",
+                            "id": 9
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "ProfileStats",
+                            "name": "jitter_profile",
+                            "id": 10
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "fixed64",
+                            "name": "overruns",
+                            "id": 11
+                        },
+                        {
+                            "rule": "repeated",
+                            "type": "ProfileStats",
+                            "name": "function_profile",
+                            "id": 12
                         }
                     ]
                 },
@@ -17970,6 +18187,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -21269,6 +21494,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -22715,6 +22948,18 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "cpu",
                             "id": 9
                         },
+                        {
+                            "rule": "optional",
+                            "type": "string",
+                            "name": "cgname",
+                            "id": 14
+                        },
+                        {
+                            "rule": "optional",
+                            "type": "int32",
+                            "name": "workers",
+                            "id": 15
+                        },
                         {
                             "rule": "optional",
                             "type": "string",
@@ -25685,6 +25930,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -28813,6 +29066,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -31390,6 +31651,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -33849,6 +34118,14 @@ module.exports = require("protobufjs").newBuilder({})['import']({
                             "name": "MT_HALRCOMP_ERROR",
                             "id": 290
                         },
+                        {
+                            "name": "MT_HALRCOMP_PACKED_UPDATE",
+                            "id": 291
+                        },
+                        {
+                            "name": "MT_HALGROUP_PACKED_UPDATE",
+                            "id": 292
+                        },
                         {
                             "name": "MT_HALGROUP_BIND",
                             "id": 294
@@ -1,6 +1,6 @@
 (function(f){if(typeof exports==="object"&&typeof module!=="undefined"){module.exports=f()}else if(typeof define==="function"&&define.amd){define([],f)}else{var g;if(typeof window!=="undefined"){g=window}else if(typeof global!=="undefined"){g=global}else if(typeof self!=="undefined"){g=self}else{g=this}(g.machinetalk || (g.machinetalk = {})).protobuf = f()}})(function(){var define,module,exports;return (function(){function r(e,n,t){function o(i,f){if(!n[i]){if(!e[i]){var c="function"==typeof require&&require;if(!f&&c)return c(i,!0);if(u)return u(i,!0);var a=new Error("Cannot find module '"+i+"'");throw a.code="MODULE_NOT_FOUND",a}var p=n[i]={exports:{}};e[i][0].call(p.exports,function(r){var n=e[i][1][r];return o(n||r)},p,p.exports,r,e,n,t)}return n[i].exports}for(var u="function"==typeof require&&require,i=0;i<t.length;i++)o(t[i]);return o}return r})()({1:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"MotionCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":600},fields:[{rule:"required",type:"cmd_code_t",name:"command",id:10},{rule:"required",type:"fixed32",name:"commandNum",id:20},{rule:"optional",type:"double",name:"motor_offset",id:30},{rule:"optional",type:"double",name:"maxLimit",id:40},{rule:"optional",type:"double",name:"minLimit",id:50},{rule:"optional",type:"EmcPose",name:"pos",id:60},{rule:"optional",type:"PmCartesian",name:"center",id:70},{rule:"optional",type:"PmCartesian",name:"normal",id:80},{rule:"optional",type:"fixed32",name:"turn",id:90},{rule:"optional",type:"double",name:"vel",id:100},{rule:"optional",type:"double",name:"ini_maxvel",id:110},{rule:"optional",type:"MotionType",name:"motion_type",id:120},{rule:"optional",type:"double",name:"spindlesync",id:130},{rule:"optional",type:"double",name:"acc",id:140},{rule:"optional",type:"double",name:"backlash",id:150},{rule:"optional",type:"fixed32",name:"id",id:160},{rule:"optional",type:"fixed32",name:"termCond",id:170},{rule:"optional",type:"double",name:"tolerance",id:180},{rule:"optional",type:"fixed32",name:"axis",id:190},{rule:"optional",type:"double",name:"scale",id:200},{rule:"optional",type:"double",name:"offset",id:210},{rule:"optional",type:"double",name:"home",id:220},{rule:"optional",type:"double",name:"home_final_vel",id:230},{rule:"optional",type:"double",name:"search_vel",id:240},{rule:"optional",type:"double",name:"latch_vel",id:250},{rule:"optional",type:"fixed32",name:"flags",id:260},{rule:"optional",type:"fixed32",name:"home_sequence",id:270},{rule:"optional",type:"fixed32",name:"volatile_home",id:280},{rule:"optional",type:"double",name:"minFerror",id:290},{rule:"optional",type:"double",name:"maxFerror",id:300},{rule:"optional",type:"fixed32",name:"wdWait",id:310},{rule:"optional",type:"fixed32",name:"debug",id:320},{rule:"optional",type:"int32",name:"now",id:330},{rule:"optional",type:"int32",name:"out",id:340},{rule:"optional",type:"int32",name:"start",id:350},{rule:"optional",type:"int32",name:"end",id:360},{rule:"optional",type:"int32",name:"mode",id:370},{rule:"optional",type:"double",name:"comp_nominal",id:380},{rule:"optional",type:"double",name:"comp_forward",id:390},{rule:"optional",type:"double",name:"comp_reverse",id:400},{rule:"optional",type:"int32",name:"probe_type",id:410},{rule:"optional",type:"EmcPose",name:"tool_offset",id:420}]},{name:"MotionStatus",syntax:"proto2",options:{"(nanopb_msgopt).msgid":601},fields:[{rule:"required",type:"cmd_code_t",name:"commandEcho",id:10},{rule:"required",type:"fixed32",name:"commandNumEcho",id:20},{rule:"required",type:"cmd_status_t",name:"commandStatus",id:30},{rule:"optional",type:"EmcPose",name:"carte_pos_fb",id:40}]},{name:"Emc_Traj_Set_G5x",syntax:"proto2",options:{"(nanopb_msgopt).msgid":100},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10},{rule:"required",type:"OriginIndex",name:"g5x_index",id:20}]},{name:"Emc_Traj_Set_G92",syntax:"proto2",options:{"(nanopb_msgopt).msgid":101},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10}]},{name:"Emc_Traj_Set_Rotation",syntax:"proto2",options:{"(nanopb_msgopt).msgid":102},fields:[{rule:"required",type:"double",name:"rotation",id:10}]},{name:"Emc_Traj_Linear_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":103},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"indexrotary",id:70}]},{name:"Emc_Traj_Probe",syntax:"proto2",options:{"(nanopb_msgopt).msgid":104},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"uint32",name:"probe_type",id:60}]},{name:"Emc_Traj_Circular_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":105},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"PmCartesian",name:"center",id:25},{rule:"required",type:"PmCartesian",name:"normal",id:27},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"turn",id:70}]},{name:"Emc_Traj_Rigid_Tap",syntax:"proto2",options:{"(nanopb_msgopt).msgid":106},fields:[{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50}]},{name:"Emc_Traj_Set_Term_Cond",syntax:"proto2",options:{"(nanopb_msgopt).msgid":107},fields:[{rule:"required",type:"TermConditionType",name:"cond",id:10},{rule:"required",type:"double",name:"tolerance",id:20}]},{name:"Emc_Traj_Set_Spindlesync",syntax:"proto2",options:{"(nanopb_msgopt).msgid":108},fields:[{rule:"required",type:"double",name:"feed_per_revolution",id:10},{rule:"required",type:"bool",name:"velocity_mode",id:20}]},{name:"Emc_Traj_Delay",syntax:"proto2",options:{"(nanopb_msgopt).msgid":109},fields:[{rule:"required",type:"double",name:"delay",id:10}]},{name:"Emc_Spindle_On",syntax:"proto2",options:{"(nanopb_msgopt).msgid":110},fields:[{rule:"required",type:"double",name:"speed",id:10,options:{default:0}},{rule:"required",type:"double",name:"factor",id:20,options:{default:0}},{rule:"required",type:"double",name:"xoffset",id:30,options:{default:0}}]},{name:"Emc_Spindle_Speed",syntax:"proto2",options:{"(nanopb_msgopt).msgid":111},fields:[{rule:"required",type:"double",name:"speed",id:10},{rule:"required",type:"double",name:"factor",id:20},{rule:"required",type:"double",name:"xoffset",id:30}]},{name:"Emc_Spindle_Orient",syntax:"proto2",options:{"(nanopb_msgopt).msgid":112},fields:[{rule:"required",type:"double",name:"orientation",id:10},{rule:"required",type:"CanonDirection",name:"mode",id:20}]},{name:"Emc_Spindle_Wait_Orient_Complete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":113},fields:[{rule:"required",type:"double",name:"timeout",id:10}]},{name:"Emc_Tool_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":114},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"toolno",id:15},{rule:"required",type:"EmcPose",name:"offset",id:20},{rule:"required",type:"double",name:"diameter",id:30},{rule:"required",type:"double",name:"frontangle",id:40},{rule:"required",type:"double",name:"backangle",id:50},{rule:"required",type:"int32",name:"orientation",id:60}]},{name:"Emc_Traj_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":115},fields:[{rule:"required",type:"EmcPose",name:"offset",id:10}]},{name:"Emc_Tool_Prepare",syntax:"proto2",options:{"(nanopb_msgopt).msgid":116},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"tool",id:20}]},{name:"Emc_Tool_Set_Number",syntax:"proto2",options:{"(nanopb_msgopt).msgid":117},fields:[{rule:"required",type:"int32",name:"tool",id:10}]},{name:"Emc_Traj_Set_Fo_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":118},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_So_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":119},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_Fh_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":120},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Motion_Adaptive",syntax:"proto2",options:{"(nanopb_msgopt).msgid":121},fields:[{rule:"required",type:"bool",name:"status",id:10}]},{name:"Emc_Operator_Display",syntax:"proto2",options:{"(nanopb_msgopt).msgid":122},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"display",id:20}]},{name:"Emc_Operator_Text",syntax:"proto2",options:{"(nanopb_msgopt).msgid":123},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"text",id:20}]},{name:"Emc_Operator_Error",syntax:"proto2",options:{"(nanopb_msgopt).msgid":124},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"error",id:20}]},{name:"Emc_Motion_Set_Dout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":125},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"bool",name:"start",id:20},{rule:"required",type:"bool",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Motion_Set_Aout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":126},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"double",name:"start",id:20},{rule:"required",type:"double",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Aux_Input_Wait",syntax:"proto2",options:{"(nanopb_msgopt).msgid":127},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"InputType",name:"input_type",id:20},{rule:"required",type:"WaitType",name:"wait_type",id:30},{rule:"required",type:"double",name:"timeout",id:40}]},{name:"Emc_Exec_Plugin_Ca1l",syntax:"proto2",options:{"(nanopb_msgopt).msgid":128},fields:[{rule:"required",type:"bytes",name:"call",id:20}]},{name:"Emc_Io_Plugin_Call",syntax:"proto2",options:{"(nanopb_msgopt).msgid":129},fields:[{rule:"required",type:"bytes",name:"call",id:20}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]},{name:"MotionType",syntax:"proto2",values:[{name:"_EMC_MOTION_TYPE_NONE",id:0},{name:"_EMC_MOTION_TYPE_TRAVERSE",id:1},{name:"_EMC_MOTION_TYPE_FEED",id:2},{name:"_EMC_MOTION_TYPE_ARC",id:3},{name:"_EMC_MOTION_TYPE_TOOLCHANGE",id:4},{name:"_EMC_MOTION_TYPE_PROBING",id:5},{name:"_EMC_MOTION_TYPE_INDEXROTARY",id:6}]},{name:"cmd_code_t",syntax:"proto2",values:[{name:"EMCMOT_ABORT",id:4e3},{name:"EMCMOT_AXIS_ABORT",id:4001},{name:"EMCMOT_ENABLE",id:4002},{name:"EMCMOT_DISABLE",id:4003},{name:"EMCMOT_ENABLE_AMPLIFIER",id:4004},{name:"EMCMOT_DISABLE_AMPLIFIER",id:4005},{name:"EMCMOT_ENABLE_WATCHDOG",id:4006},{name:"EMCMOT_DISABLE_WATCHDOG",id:4007},{name:"EMCMOT_ACTIVATE_JOINT",id:4008},{name:"EMCMOT_DEACTIVATE_JOINT",id:4009},{name:"EMCMOT_PAUSE",id:4010},{name:"EMCMOT_RESUME",id:4011},{name:"EMCMOT_STEP",id:4012},{name:"EMCMOT_FREE",id:4013},{name:"EMCMOT_COORD",id:4014},{name:"EMCMOT_TELEOP",id:4015},{name:"EMCMOT_SPINDLE_SCALE",id:4016},{name:"EMCMOT_SS_ENABLE",id:4017},{name:"EMCMOT_FEED_SCALE",id:4018},{name:"EMCMOT_FS_ENABLE",id:4019},{name:"EMCMOT_FH_ENABLE",id:4020},{name:"EMCMOT_AF_ENABLE",id:4021},{name:"EMCMOT_OVERRIDE_LIMITS",id:4022},{name:"EMCMOT_HOME",id:4023},{name:"EMCMOT_UNHOME",id:4024},{name:"EMCMOT_JOG_CONT",id:4025},{name:"EMCMOT_JOG_INCR",id:4026},{name:"EMCMOT_JOG_ABS",id:4027},{name:"EMCMOT_SET_LINE",id:4028},{name:"EMCMOT_SET_CIRCLE",id:4029},{name:"EMCMOT_SET_TELEOP_VECTOR",id:4030},{name:"EMCMOT_CLEAR_PROBE_FLAGS",id:4031},{name:"EMCMOT_PROBE",id:4032},{name:"EMCMOT_RIGID_TAP",id:4033},{name:"EMCMOT_SET_POSITION_LIMITS",id:4034},{name:"EMCMOT_SET_BACKLASH",id:4035},{name:"EMCMOT_SET_MIN_FERROR",id:4036},{name:"EMCMOT_SET_MAX_FERROR",id:4037},{name:"EMCMOT_SET_VEL",id:4038},{name:"EMCMOT_SET_VEL_LIMIT",id:4039},{name:"EMCMOT_SET_JOINT_VEL_LIMIT",id:4040},{name:"EMCMOT_SET_JOINT_ACC_LIMIT",id:4041},{name:"EMCMOT_SET_ACC",id:4042},{name:"EMCMOT_SET_TERM_COND",id:4043},{name:"EMCMOT_SET_NUM_AXES",id:4044},{name:"EMCMOT_SET_WORLD_HOME",id:4045},{name:"EMCMOT_SET_HOMING_PARAMS",id:4046},{name:"EMCMOT_SET_DEBUG",id:4047},{name:"EMCMOT_SET_DOUT",id:4048},{name:"EMCMOT_SET_AOUT",id:4049},{name:"EMCMOT_SET_SPINDLESYNC",id:4050},{name:"EMCMOT_SPINDLE_ON",id:4051},{name:"EMCMOT_SPINDLE_OFF",id:4052},{name:"EMCMOT_SPINDLE_INCREASE",id:4053},{name:"EMCMOT_SPINDLE_DECREASE",id:4054},{name:"EMCMOT_SPINDLE_BRAKE_ENGAGE",id:4055},{name:"EMCMOT_SPINDLE_BRAKE_RELEASE",id:4056},{name:"EMCMOT_SET_MOTOR_OFFSET",id:4057},{name:"EMCMOT_SET_JOINT_COMP",id:4058},{name:"EMCMOT_SET_OFFSET",id:4059}]},{name:"cmd_status_t",syntax:"proto2",values:[{name:"EMCMOT_COMMAND_OK",id:0},{name:"EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1},{name:"EMCMOT_COMMAND_INVALID_COMMAND",id:2},{name:"EMCMOT_COMMAND_INVALID_PARAMS",id:3},{
-name:"EMCMOT_COMMAND_BAD_EXEC",id:4}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"MotionCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":600},fields:[{rule:"required",type:"cmd_code_t",name:"command",id:10},{rule:"required",type:"fixed32",name:"commandNum",id:20},{rule:"optional",type:"double",name:"motor_offset",id:30},{rule:"optional",type:"double",name:"maxLimit",id:40},{rule:"optional",type:"double",name:"minLimit",id:50},{rule:"optional",type:"EmcPose",name:"pos",id:60},{rule:"optional",type:"PmCartesian",name:"center",id:70},{rule:"optional",type:"PmCartesian",name:"normal",id:80},{rule:"optional",type:"fixed32",name:"turn",id:90},{rule:"optional",type:"double",name:"vel",id:100},{rule:"optional",type:"double",name:"ini_maxvel",id:110},{rule:"optional",type:"MotionType",name:"motion_type",id:120},{rule:"optional",type:"double",name:"spindlesync",id:130},{rule:"optional",type:"double",name:"acc",id:140},{rule:"optional",type:"double",name:"backlash",id:150},{rule:"optional",type:"fixed32",name:"id",id:160},{rule:"optional",type:"fixed32",name:"termCond",id:170},{rule:"optional",type:"double",name:"tolerance",id:180},{rule:"optional",type:"fixed32",name:"axis",id:190},{rule:"optional",type:"double",name:"scale",id:200},{rule:"optional",type:"double",name:"offset",id:210},{rule:"optional",type:"double",name:"home",id:220},{rule:"optional",type:"double",name:"home_final_vel",id:230},{rule:"optional",type:"double",name:"search_vel",id:240},{rule:"optional",type:"double",name:"latch_vel",id:250},{rule:"optional",type:"fixed32",name:"flags",id:260},{rule:"optional",type:"fixed32",name:"home_sequence",id:270},{rule:"optional",type:"fixed32",name:"volatile_home",id:280},{rule:"optional",type:"double",name:"minFerror",id:290},{rule:"optional",type:"double",name:"maxFerror",id:300},{rule:"optional",type:"fixed32",name:"wdWait",id:310},{rule:"optional",type:"fixed32",name:"debug",id:320},{rule:"optional",type:"int32",name:"now",id:330},{rule:"optional",type:"int32",name:"out",id:340},{rule:"optional",type:"int32",name:"start",id:350},{rule:"optional",type:"int32",name:"end",id:360},{rule:"optional",type:"int32",name:"mode",id:370},{rule:"optional",type:"double",name:"comp_nominal",id:380},{rule:"optional",type:"double",name:"comp_forward",id:390},{rule:"optional",type:"double",name:"comp_reverse",id:400},{rule:"optional",type:"int32",name:"probe_type",id:410},{rule:"optional",type:"EmcPose",name:"tool_offset",id:420}]},{name:"MotionStatus",syntax:"proto2",options:{"(nanopb_msgopt).msgid":601},fields:[{rule:"required",type:"cmd_code_t",name:"commandEcho",id:10},{rule:"required",type:"fixed32",name:"commandNumEcho",id:20},{rule:"required",type:"cmd_status_t",name:"commandStatus",id:30},{rule:"optional",type:"EmcPose",name:"carte_pos_fb",id:40}]},{name:"Emc_Traj_Set_G5x",syntax:"proto2",options:{"(nanopb_msgopt).msgid":100},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10},{rule:"required",type:"OriginIndex",name:"g5x_index",id:20}]},{name:"Emc_Traj_Set_G92",syntax:"proto2",options:{"(nanopb_msgopt).msgid":101},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10}]},{name:"Emc_Traj_Set_Rotation",syntax:"proto2",options:{"(nanopb_msgopt).msgid":102},fields:[{rule:"required",type:"double",name:"rotation",id:10}]},{name:"Emc_Traj_Linear_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":103},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"indexrotary",id:70}]},{name:"Emc_Traj_Probe",syntax:"proto2",options:{"(nanopb_msgopt).msgid":104},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"uint32",name:"probe_type",id:60}]},{name:"Emc_Traj_Circular_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":105},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"PmCartesian",name:"center",id:25},{rule:"required",type:"PmCartesian",name:"normal",id:27},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"turn",id:70}]},{name:"Emc_Traj_Rigid_Tap",syntax:"proto2",options:{"(nanopb_msgopt).msgid":106},fields:[{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50}]},{name:"Emc_Traj_Set_Term_Cond",syntax:"proto2",options:{"(nanopb_msgopt).msgid":107},fields:[{rule:"required",type:"TermConditionType",name:"cond",id:10},{rule:"required",type:"double",name:"tolerance",id:20}]},{name:"Emc_Traj_Set_Spindlesync",syntax:"proto2",options:{"(nanopb_msgopt).msgid":108},fields:[{rule:"required",type:"double",name:"feed_per_revolution",id:10},{rule:"required",type:"bool",name:"velocity_mode",id:20}]},{name:"Emc_Traj_Delay",syntax:"proto2",options:{"(nanopb_msgopt).msgid":109},fields:[{rule:"required",type:"double",name:"delay",id:10}]},{name:"Emc_Spindle_On",syntax:"proto2",options:{"(nanopb_msgopt).msgid":110},fields:[{rule:"required",type:"double",name:"speed",id:10,options:{default:0}},{rule:"required",type:"double",name:"factor",id:20,options:{default:0}},{rule:"required",type:"double",name:"xoffset",id:30,options:{default:0}}]},{name:"Emc_Spindle_Speed",syntax:"proto2",options:{"(nanopb_msgopt).msgid":111},fields:[{rule:"required",type:"double",name:"speed",id:10},{rule:"required",type:"double",name:"factor",id:20},{rule:"required",type:"double",name:"xoffset",id:30}]},{name:"Emc_Spindle_Orient",syntax:"proto2",options:{"(nanopb_msgopt).msgid":112},fields:[{rule:"required",type:"double",name:"orientation",id:10},{rule:"required",type:"CanonDirection",name:"mode",id:20}]},{name:"Emc_Spindle_Wait_Orient_Complete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":113},fields:[{rule:"required",type:"double",name:"timeout",id:10}]},{name:"Emc_Tool_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":114},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"toolno",id:15},{rule:"required",type:"EmcPose",name:"offset",id:20},{rule:"required",type:"double",name:"diameter",id:30},{rule:"required",type:"double",name:"frontangle",id:40},{rule:"required",type:"double",name:"backangle",id:50},{rule:"required",type:"int32",name:"orientation",id:60}]},{name:"Emc_Traj_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":115},fields:[{rule:"required",type:"EmcPose",name:"offset",id:10}]},{name:"Emc_Tool_Prepare",syntax:"proto2",options:{"(nanopb_msgopt).msgid":116},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"tool",id:20}]},{name:"Emc_Tool_Set_Number",syntax:"proto2",options:{"(nanopb_msgopt).msgid":117},fields:[{rule:"required",type:"int32",name:"tool",id:10}]},{name:"Emc_Traj_Set_Fo_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":118},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_So_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":119},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_Fh_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":120},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Motion_Adaptive",syntax:"proto2",options:{"(nanopb_msgopt).msgid":121},fields:[{rule:"required",type:"bool",name:"status",id:10}]},{name:"Emc_Operator_Display",syntax:"proto2",options:{"(nanopb_msgopt).msgid":122},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"display",id:20}]},{name:"Emc_Operator_Text",syntax:"proto2",options:{"(nanopb_msgopt).msgid":123},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"text",id:20}]},{name:"Emc_Operator_Error",syntax:"proto2",options:{"(nanopb_msgopt).msgid":124},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"error",id:20}]},{name:"Emc_Motion_Set_Dout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":125},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"bool",name:"start",id:20},{rule:"required",type:"bool",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Motion_Set_Aout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":126},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"double",name:"start",id:20},{rule:"required",type:"double",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Aux_Input_Wait",syntax:"proto2",options:{"(nanopb_msgopt).msgid":127},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"InputType",name:"input_type",id:20},{rule:"required",type:"WaitType",name:"wait_type",id:30},{rule:"required",type:"double",name:"timeout",id:40}]},{name:"Emc_Exec_Plugin_Ca1l",syntax:"proto2",options:{"(nanopb_msgopt).msgid":128},fields:[{rule:"required",type:"bytes",name:"call",id:20}]},{name:"Emc_Io_Plugin_Call",syntax:"proto2",options:{"(nanopb_msgopt).msgid":129},fields:[{rule:"required",type:"bytes",name:"call",id:20}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]},{name:"MotionType",syntax:"proto2",values:[{name:"_EMC_MOTION_TYPE_NONE",id:0},{name:"_EMC_MOTION_TYPE_TRAVERSE",id:1},{name:"_EMC_MOTION_TYPE_FEED",id:2},{name:"_EMC_MOTION_TYPE_ARC",id:3},{name:"_EMC_MOTION_TYPE_TOOLCHANGE",id:4},{name:"_EMC_MOTION_TYPE_PROBING",id:5},{name:"_EMC_MOTION_TYPE_INDEXROTARY",id:6}]},{name:"cmd_code_t",syntax:"proto2",values:[{name:"EMCMOT_ABORT",id:4e3},{name:"EMCMOT_AXIS_ABORT",id:4001},{name:"EMCMOT_ENABLE",id:4002},{name:"EMCMOT_DISABLE",id:4003},{name:"EMCMOT_ENABLE_AMPLIFIER",id:4004},{name:"EMCMOT_DISABLE_AMPLIFIER",id:4005},{name:"EMCMOT_ENABLE_WATCHDOG",id:4006},{name:"EMCMOT_DISABLE_WATCHDOG",id:4007},{name:"EMCMOT_ACTIVATE_JOINT",id:4008},{name:"EMCMOT_DEACTIVATE_JOINT",id:4009},{name:"EMCMOT_PAUSE",id:4010},{name:"EMCMOT_RESUME",id:4011},{name:"EMCMOT_STEP",id:4012},{name:"EMCMOT_FREE",id:4013},{name:"EMCMOT_COORD",id:4014},{name:"EMCMOT_TELEOP",id:4015},{name:"EMCMOT_SPINDLE_SCALE",id:4016},{name:"EMCMOT_SS_ENABLE",id:4017},{name:"EMCMOT_FEED_SCALE",id:4018},{name:"EMCMOT_FS_ENABLE",id:4019},{name:"EMCMOT_FH_ENABLE",id:4020},{name:"EMCMOT_AF_ENABLE",id:4021},{name:"EMCMOT_OVERRIDE_LIMITS",id:4022},{name:"EMCMOT_HOME",id:4023},{name:"EMCMOT_UNHOME",id:4024},{name:"EMCMOT_JOG_CONT",id:4025},{name:"EMCMOT_JOG_INCR",id:4026},{name:"EMCMOT_JOG_ABS",id:4027},{name:"EMCMOT_SET_LINE",id:4028},{name:"EMCMOT_SET_CIRCLE",id:4029},{name:"EMCMOT_SET_TELEOP_VECTOR",id:4030},{name:"EMCMOT_CLEAR_PROBE_FLAGS",id:4031},{name:"EMCMOT_PROBE",id:4032},{name:"EMCMOT_RIGID_TAP",id:4033},{name:"EMCMOT_SET_POSITION_LIMITS",id:4034},{name:"EMCMOT_SET_BACKLASH",id:4035},{name:"EMCMOT_SET_MIN_FERROR",id:4036},{name:"EMCMOT_SET_MAX_FERROR",id:4037},{name:"EMCMOT_SET_VEL",id:4038},{name:"EMCMOT_SET_VEL_LIMIT",id:4039},{name:"EMCMOT_SET_JOINT_VEL_LIMIT",id:4040},{name:"EMCMOT_SET_JOINT_ACC_LIMIT",id:4041},{name:"EMCMOT_SET_ACC",id:4042},{name:"EMCMOT_SET_TERM_COND",id:4043},{name:"EMCMOT_SET_NUM_AXES",id:4044},{name:"EMCMOT_SET_WORLD_HOME",id:4045},{name:"EMCMOT_SET_HOMING_PARAMS",id:4046},{name:"EMCMOT_SET_DEBUG",id:4047},{name:"EMCMOT_SET_DOUT",id:4048},{name:"EMCMOT_SET_AOUT",id:4049},{name:"EMCMOT_SET_SPINDLESYNC",id:4050},{name:"EMCMOT_SPINDLE_ON",id:4051},{name:"EMCMOT_SPINDLE_OFF",id:4052},{name:"EMCMOT_SPINDLE_INCREASE",id:4053},{name:"EMCMOT_SPINDLE_DECREASE",id:4054},{name:"EMCMOT_SPINDLE_BRAKE_ENGAGE",id:4055},{name:"EMCMOT_SPINDLE_BRAKE_RELEASE",id:4056},{name:"EMCMOT_SET_MOTOR_OFFSET",id:4057},{name:"EMCMOT_SET_JOINT_COMP",id:4058},{name:"EMCMOT_SET_OFFSET",id:4059}]},{name:"cmd_status_t",syntax:"proto2",values:[{name:"EMCMOT_COMMAND_OK",id:0},{name:"EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1},{
+name:"EMCMOT_COMMAND_INVALID_COMMAND",id:2},{name:"EMCMOT_COMMAND_INVALID_PARAMS",id:3},{name:"EMCMOT_COMMAND_BAD_EXEC",id:4}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],2:[function(require,module,exports){
 module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"File",syntax:"proto2",options:{"(nanopb_msgopt).msgid":200},fields:[{rule:"required",type:"string",name:"name",id:1},{rule:"required",type:"FileContent",name:"encoding",id:2},{rule:"optional",type:"bytes",name:"blob",id:3}]},{name:"Application",syntax:"proto2",options:{"(nanopb_msgopt).msgid":201},fields:[{rule:"required",type:"string",name:"name",id:1},{rule:"optional",type:"string",name:"description",id:2},{rule:"optional",type:"ApplicationType",name:"type",id:3},{rule:"optional",type:"string",name:"weburi",id:4},{rule:"repeated",type:"File",name:"file",id:5}]},{name:"StdoutLine",syntax:"proto2",options:{"(nanopb_msgopt).msgid":202},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"line",id:2}]},{name:"MachineInfo",syntax:"proto2",options:{"(nanopb_msgopt).msgid":203},fields:[{rule:"optional",type:"string",name:"type",id:1},{rule:"optional",type:"string",name:"manufacturer",id:2},{rule:"optional",type:"string",name:"model",id:3},{rule:"optional",type:"string",name:"variant",id:4}]},{name:"Launcher",syntax:"proto2",options:{"(nanopb_msgopt).msgid":204},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"string",name:"description",id:3},{rule:"optional",type:"File",name:"image",id:4},{rule:"optional",type:"MachineInfo",name:"info",id:5},{rule:"optional",type:"bool",name:"running",id:6},{rule:"optional",type:"bool",name:"terminating",id:7},{rule:"optional",type:"string",name:"command",id:8},{rule:"optional",type:"bool",name:"shell",id:9},{rule:"repeated",type:"StdoutLine",name:"output",id:10},{rule:"optional",type:"int32",name:"returncode",id:11},{rule:"optional",type:"string",name:"workdir",id:12},{rule:"optional",type:"uint32",name:"priority",id:13},{rule:"optional",type:"uint32",name:"importance",id:14}]}],enums:[{name:"ApplicationType",syntax:"proto2",values:[{name:"QT5_QML",id:1},{name:"GLADEVCP",id:2},{name:"JAVASCRIPT",id:3}]},{name:"FileContent",syntax:"proto2",values:[{name:"CLEARTEXT",id:1},{name:"ZLIB",id:2}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],3:[function(require,module,exports){
@@ -10,36 +10,36 @@ module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:
 },{"protobufjs":25}],5:[function(require,module,exports){
 module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"JplanJoint",syntax:"proto2",options:{"(nanopb_msgopt).msgid":352},fields:[{rule:"optional",type:"double",name:"pos_cmd",id:1},{rule:"optional",type:"double",name:"max_vel",id:2},{rule:"optional",type:"double",name:"max_acc",id:3},{rule:"optional",type:"bool",name:"enable",id:4}]},{name:"JplanCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":354},fields:[{rule:"repeated",type:"JplanJoint",name:"joint",id:2,options:{"(nanopb).max_count":10}}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],6:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"LogMessage",syntax:"proto2",options:{"(nanopb_msgopt).msgid":400},fields:[{rule:"required",type:"MsgOrigin",name:"origin",id:10},{rule:"required",type:"int32",name:"pid",id:20},{rule:"required",type:"MsgLevel",name:"level",id:30},{rule:"required",type:"string",name:"tag",id:40},{rule:"required",type:"string",name:"text",id:50}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"LogMessage",syntax:"proto2",options:{"(nanopb_msgopt).msgid":400},fields:[{rule:"required",type:"MsgOrigin",name:"origin",id:10},{rule:"required",type:"int32",name:"pid",id:20},{rule:"required",type:"MsgLevel",name:"level",id:30},{rule:"required",type:"string",name:"tag",id:40},{rule:"required",type:"string",name:"text",id:50}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],7:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Instance",syntax:"proto2",options:{"(nanopb_msgopt).msgid":700},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"id",id:2}]},{name:"ServiceAnnouncement",syntax:"proto2",options:{"(nanopb_msgopt).msgid":701},fields:[{rule:"required",type:"ServiceType",name:"stype",id:1},{rule:"required",type:"fixed32",name:"version",id:2,options:{default:0}},{rule:"required",type:"fixed32",name:"instance",id:3,options:{default:0}},{rule:"required",type:"ServiceAPI",name:"api",id:8},{rule:"required",type:"string",name:"uri",id:6},{rule:"optional",type:"string",name:"description",id:7}]},{name:"Originator",syntax:"proto2",options:{"(nanopb_msgopt).msgid":702},fields:[{rule:"optional",type:"OriginType",name:"origin",id:1},{rule:"optional",type:"OriginDetail",name:"detail",id:2},{rule:"optional",type:"string",name:"name",id:3},{rule:"optional",type:"sfixed32",name:"id",id:4},{rule:"optional",type:"Instance",name:"instance",id:5}]},{name:"AnError",syntax:"proto2",options:{"(nanopb_msgopt).msgid":703},fields:[{rule:"required",type:"sfixed32",name:"error_code",id:1},{rule:"optional",type:"Severity",name:"severity",id:2},{rule:"optional",type:"string",name:"error_text",id:3},{rule:"optional",type:"Originator",name:"origin",id:4}]},{name:"Pin",syntax:"proto2",options:{"(nanopb_msgopt).msgid":704},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"HalPinDirection",name:"dir",id:4},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"sfixed32",name:"owner",id:9},{rule:"optional",type:"bool",name:"linked",id:10},{rule:"optional",type:"string",name:"oldname",id:11},{rule:"optional",type:"double",name:"epsilon",id:12},{rule:"optional",type:"fixed32",name:"flags",id:13}]},{name:"Signal",syntax:"proto2",options:{"(nanopb_msgopt).msgid":705},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"fixed32",name:"readers",id:11},{rule:"optional",type:"fixed32",name:"writers",id:12},{rule:"optional",type:"fixed32",name:"bidirs",id:13}]},{name:"Param",syntax:"proto2",options:{"(nanopb_msgopt).msgid":706},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"HalParamDirection",name:"dir",id:11},{rule:"optional",type:"string",name:"oldname",id:12},{rule:"optional",type:"sfixed32",name:"owner",id:13},{rule:"optional",type:"sfixed32",name:"runtime",id:14},{rule:"optional",type:"sfixed32",name:"maytime",id:15}]},{name:"Function",syntax:"proto2",options:{"(nanopb_msgopt).msgid":707},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"fixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"users",id:4},{rule:"optional",type:"fixed32",name:"runtime",id:5},{rule:"optional",type:"fixed32",name:"maxtime",id:6},{rule:"optional",type:"bool",name:"reentrant",id:7},{rule:"optional",type:"HalFunctType",name:"type",id:8},{rule:"optional",type:"bool",name:"maxtime_increased",id:9}]},{name:"Thread",syntax:"proto2",options:{"(nanopb_msgopt).msgid":708},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"bool",name:"uses_fp",id:3},{rule:"optional",type:"fixed32",name:"period",id:4},{rule:"optional",type:"sfixed32",name:"priority",id:5},{rule:"optional",type:"fixed32",name:"task_id",id:6},{rule:"optional",type:"fixed32",name:"cpu_id",id:7},{rule:"repeated",type:"string",name:"function",id:8}]},{name:"Component",syntax:"proto2",options:{"(nanopb_msgopt).msgid":709},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"ninst",id:2},{rule:"optional",type:"sfixed32",name:"comp_id",id:4},{rule:"optional",type:"fixed32",name:"type",id:5},{rule:"optional",type:"fixed32",name:"state",id:6},{rule:"optional",type:"fixed32",name:"last_update",id:7},{rule:"optional",type:"fixed32",name:"last_bound",id:8},{rule:"optional",type:"fixed32",name:"last_unbound",id:9},{rule:"optional",type:"fixed32",name:"pid",id:10},{rule:"optional",type:"string",name:"args",id:11},{rule:"optional",type:"sfixed32",name:"timer",id:12},{rule:"optional",type:"sfixed32",name:"userarg1",id:14},{rule:"optional",type:"sfixed32",name:"userarg2",id:15},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19},{rule:"optional",type:"bool",name:"no_create",id:18}]},{name:"Ring",syntax:"proto2",options:{"(nanopb_msgopt).msgid":710},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner",id:3},{rule:"optional",type:"bool",name:"stream",id:4},{rule:"optional",type:"bool",name:"wmutex",id:5},{rule:"optional",type:"bool",name:"rmutex",id:6},{rule:"optional",type:"bool",name:"rtapi_shm",id:7},{rule:"optional",type:"sfixed32",name:"reader",id:8},{rule:"optional",type:"sfixed32",name:"writer",id:9},{rule:"optional",type:"sfixed32",name:"total_size",id:10},{rule:"optional",type:"sfixed32",name:"scratchpad",id:11},{rule:"optional",type:"sfixed32",name:"ring_shmkey",id:12},{rule:"optional",type:"fixed32",name:"encodings",id:13}]},{name:"Member",syntax:"proto2",options:{"(nanopb_msgopt).msgid":711},fields:[{rule:"optional",type:"ObjectType",name:"mtype",id:1},{rule:"optional",type:"sfixed32",name:"userarg1",id:2},{rule:"optional",type:"double",name:"epsilon",id:3},{rule:"optional",type:"Signal",name:"signal",id:4},{rule:"optional",type:"string",name:"groupname",id:5},{rule:"optional",type:"fixed32",name:"handle",id:6},{rule:"optional",type:"Pin",name:"pin",id:7},{rule:"optional",type:"Param",name:"param",id:8}]},{name:"Group",syntax:"proto2",options:{"(nanopb_msgopt).msgid":712},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"userarg1",id:4},{rule:"optional",type:"sfixed32",name:"userarg2",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"repeated",type:"Member",name:"member",id:7}]},{name:"ProtocolParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":713},fields:[{rule:"optional",type:"sfixed32",name:"keepalive_timer",id:1},{rule:"optional",type:"sfixed32",name:"group_timer",id:2},{rule:"optional",type:"sfixed32",name:"rcomp_timer",id:3}]},{name:"Vtable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":714},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"context",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"optional",type:"sfixed32",name:"version",id:7},{rule:"optional",type:"fixed64",name:"vtable",id:8}]},{name:"Inst",syntax:"proto2",options:{"(nanopb_msgopt).msgid":715},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"comp_id",id:2},{rule:"optional",type:"fixed32",name:"inst_id",id:3},{rule:"optional",type:"fixed32",name:"inst_size",id:4},{rule:"optional",type:"fixed64",name:"vtable",id:5},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19}]},{name:"LogMessage",syntax:"proto2",options:{"(nanopb_msgopt).msgid":400},fields:[{rule:"required",type:"MsgOrigin",name:"origin",id:10},{rule:"required",type:"int32",name:"pid",id:20},{rule:"required",type:"MsgLevel",name:"level",id:30},{rule:"required",type:"string",name:"tag",id:40},{rule:"required",type:"string",name:"text",id:50}]},{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"MotionCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":600},fields:[{rule:"required",type:"cmd_code_t",name:"command",id:10},{rule:"required",type:"fixed32",name:"commandNum",id:20},{rule:"optional",type:"double",name:"motor_offset",id:30},{rule:"optional",type:"double",name:"maxLimit",id:40},{rule:"optional",type:"double",name:"minLimit",id:50},{rule:"optional",type:"EmcPose",name:"pos",id:60},{rule:"optional",type:"PmCartesian",name:"center",id:70},{rule:"optional",type:"PmCartesian",name:"normal",id:80},{rule:"optional",type:"fixed32",name:"turn",id:90},{rule:"optional",type:"double",name:"vel",id:100},{rule:"optional",type:"double",name:"ini_maxvel",id:110},{rule:"optional",type:"MotionType",name:"motion_type",id:120},{rule:"optional",type:"double",name:"spindlesync",id:130},{rule:"optional",type:"double",name:"acc",id:140},{rule:"optional",type:"double",name:"backlash",id:150},{rule:"optional",type:"fixed32",name:"id",id:160},{rule:"optional",type:"fixed32",name:"termCond",id:170},{rule:"optional",type:"double",name:"tolerance",id:180},{rule:"optional",type:"fixed32",name:"axis",id:190},{rule:"optional",type:"double",name:"scale",id:200},{rule:"optional",type:"double",name:"offset",id:210},{rule:"optional",type:"double",name:"home",id:220},{rule:"optional",type:"double",name:"home_final_vel",id:230},{rule:"optional",type:"double",name:"search_vel",id:240},{rule:"optional",type:"double",name:"latch_vel",id:250},{rule:"optional",type:"fixed32",name:"flags",id:260},{rule:"optional",type:"fixed32",name:"home_sequence",id:270},{rule:"optional",type:"fixed32",name:"volatile_home",id:280},{rule:"optional",type:"double",name:"minFerror",id:290},{rule:"optional",type:"double",name:"maxFerror",id:300},{rule:"optional",type:"fixed32",name:"wdWait",id:310},{rule:"optional",type:"fixed32",name:"debug",id:320},{rule:"optional",type:"int32",name:"now",id:330},{rule:"optional",type:"int32",name:"out",id:340},{rule:"optional",type:"int32",name:"start",id:350},{rule:"optional",type:"int32",name:"end",id:360},{rule:"optional",type:"int32",name:"mode",id:370},{rule:"optional",type:"double",name:"comp_nominal",id:380},{rule:"optional",type:"double",name:"comp_forward",id:390},{rule:"optional",type:"double",name:"comp_reverse",id:400},{rule:"optional",type:"int32",name:"probe_type",id:410},{rule:"optional",type:"EmcPose",name:"tool_offset",id:420}]},{name:"MotionStatus",syntax:"proto2",options:{"(nanopb_msgopt).msgid":601},fields:[{rule:"required",type:"cmd_code_t",name:"commandEcho",id:10},{rule:"required",type:"fixed32",name:"commandNumEcho",id:20},{rule:"required",type:"cmd_status_t",name:"commandStatus",id:30},{rule:"optional",type:"EmcPose",name:"carte_pos_fb",id:40}]},{name:"TaskPlanExecute",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1200},fields:[{rule:"optional",type:"string",name:"command",id:10},{rule:"optional",type:"sfixed32",name:"line",id:30}]},{name:"TaskPlanBlockDelete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1201},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOptionalStop",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1202},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOpen",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1203},fields:[{rule:"required",type:"string",name:"filename",id:10}]},{name:"TaskPlanReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1204},fields:[{rule:"required",type:"ContainerType",name:"cmd",id:10},{rule:"optional",type:"string",name:"errormsg",id:20}]},{name:"TaskReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1205},fields:[{rule:"required",type:"fixed32",name:"ticket",id:10}]},{name:"TicketUpdate",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1206},fields:[{rule:"required",type:"fixed32",name:"cticket",id:10},{rule:"required",type:"RCS_STATUS",name:"status",id:20},{rule:"optional",type:"string",name:"text",id:30}]},{name:"Emc_Traj_Set_G5x",syntax:"proto2",options:{"(nanopb_msgopt).msgid":100},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10},{rule:"required",type:"OriginIndex",name:"g5x_index",id:20}]},{name:"Emc_Traj_Set_G92",syntax:"proto2",options:{"(nanopb_msgopt).msgid":101},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10}]},{name:"Emc_Traj_Set_Rotation",syntax:"proto2",options:{"(nanopb_msgopt).msgid":102},fields:[{rule:"required",type:"double",name:"rotation",id:10}]},{name:"Emc_Traj_Linear_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":103},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"indexrotary",id:70}]},{name:"Emc_Traj_Probe",syntax:"proto2",options:{"(nanopb_msgopt).msgid":104},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"uint32",name:"probe_type",id:60}]},{name:"Emc_Traj_Circular_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":105},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"PmCartesian",name:"center",id:25},{rule:"required",type:"PmCartesian",name:"normal",id:27},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"turn",id:70}]},{name:"Emc_Traj_Rigid_Tap",syntax:"proto2",options:{"(nanopb_msgopt).msgid":106},fields:[{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50}]},{name:"Emc_Traj_Set_Term_Cond",syntax:"proto2",options:{"(nanopb_msgopt).msgid":107},fields:[{rule:"required",type:"TermConditionType",name:"cond",id:10},{rule:"required",type:"double",name:"tolerance",id:20}]},{name:"Emc_Traj_Set_Spindlesync",syntax:"proto2",options:{"(nanopb_msgopt).msgid":108},fields:[{rule:"required",type:"double",name:"feed_per_revolution",id:10},{rule:"required",type:"bool",name:"velocity_mode",id:20}]},{name:"Emc_Traj_Delay",syntax:"proto2",options:{"(nanopb_msgopt).msgid":109},fields:[{rule:"required",type:"double",name:"delay",id:10}]},{name:"Emc_Spindle_On",syntax:"proto2",options:{"(nanopb_msgopt).msgid":110},fields:[{rule:"required",type:"double",name:"speed",id:10,options:{default:0}},{rule:"required",type:"double",name:"factor",id:20,options:{default:0}},{rule:"required",type:"double",name:"xoffset",id:30,options:{default:0}}]},{name:"Emc_Spindle_Speed",syntax:"proto2",options:{"(nanopb_msgopt).msgid":111},fields:[{rule:"required",type:"double",name:"speed",id:10},{rule:"required",type:"double",name:"factor",id:20},{rule:"required",type:"double",name:"xoffset",id:30}]},{name:"Emc_Spindle_Orient",syntax:"proto2",options:{"(nanopb_msgopt).msgid":112},fields:[{rule:"required",type:"double",name:"orientation",id:10},{rule:"required",type:"CanonDirection",name:"mode",id:20}]},{name:"Emc_Spindle_Wait_Orient_Complete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":113},fields:[{rule:"required",type:"double",name:"timeout",id:10}]},{name:"Emc_Tool_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":114},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"toolno",id:15},{rule:"required",type:"EmcPose",name:"offset",id:20},{rule:"required",type:"double",name:"diameter",id:30},{rule:"required",type:"double",name:"frontangle",id:40},{rule:"required",type:"double",name:"backangle",id:50},{rule:"required",type:"int32",name:"orientation",id:60}]},{name:"Emc_Traj_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":115},fields:[{rule:"required",type:"EmcPose",name:"offset",id:10}]},{name:"Emc_Tool_Prepare",syntax:"proto2",options:{"(nanopb_msgopt).msgid":116},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"tool",id:20}]},{name:"Emc_Tool_Set_Number",syntax:"proto2",options:{"(nanopb_msgopt).msgid":117},fields:[{rule:"required",type:"int32",name:"tool",id:10}]},{name:"Emc_Traj_Set_Fo_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":118},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_So_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":119},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_Fh_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":120},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Motion_Adaptive",syntax:"proto2",options:{"(nanopb_msgopt).msgid":121},fields:[{rule:"required",type:"bool",name:"status",id:10}]},{name:"Emc_Operator_Display",syntax:"proto2",options:{"(nanopb_msgopt).msgid":122},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"display",id:20}]},{name:"Emc_Operator_Text",syntax:"proto2",options:{"(nanopb_msgopt).msgid":123},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"text",id:20}]},{name:"Emc_Operator_Error",syntax:"proto2",options:{"(nanopb_msgopt).msgid":124},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"error",id:20}]},{name:"Emc_Motion_Set_Dout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":125},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"bool",name:"start",id:20},{rule:"required",type:"bool",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Motion_Set_Aout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":126},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"double",name:"start",id:20},{rule:"required",type:"double",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Aux_Input_Wait",syntax:"proto2",options:{"(nanopb_msgopt).msgid":127},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"InputType",name:"input_type",id:20},{rule:"required",type:"WaitType",name:"wait_type",id:30},{rule:"required",type:"double",name:"timeout",id:40}]},{name:"Emc_Exec_Plugin_Ca1l",syntax:"proto2",options:{"(nanopb_msgopt).msgid":128},fields:[{rule:"required",type:"bytes",name:"call",id:20}]},{name:"Emc_Io_Plugin_Call",syntax:"proto2",options:{"(nanopb_msgopt).msgid":129},fields:[{rule:"required",type:"bytes",name:"call",id:20}]},{name:"Value",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1500},fields:[{rule:"required",type:"ValueType",name:"type",id:10},{rule:"optional",type:"bool",name:"halbit",id:100},{rule:"optional",type:"double",name:"halfloat",id:101},{rule:"optional",type:"sfixed32",name:"hals32",id:102},{rule:"optional",type:"fixed32",name:"halu32",id:103},{rule:"optional",type:"bytes",name:"v_bytes",id:120},{rule:"optional",type:"sfixed32",name:"v_int32",id:130},{rule:"optional",type:"sfixed64",name:"v_int64",id:140},{rule:"optional",type:"fixed32",name:"v_uint32",id:150},{rule:"optional",type:"fixed64",name:"v_uint64",id:160},{rule:"optional",type:"double",name:"v_double",id:170},{rule:"optional",type:"string",name:"v_string",id:180,options:{"(nanopb).max_size":41}},{rule:"optional",type:"bool",name:"v_bool",id:190},{rule:"optional",type:"PmCartesian",name:"carte",id:200},{rule:"optional",type:"EmcPose",name:"pose",id:220}]},{name:"RTAPICommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":900},fields:[{rule:"required",type:"int32",name:"instance",id:1},{rule:"optional",type:"string",name:"modname",id:2},{rule:"optional",type:"int32",name:"rt_msglevel",id:3},{rule:"optional",type:"int32",name:"user_msglevel",id:4},{rule:"repeated",type:"string",name:"argv",id:5},{rule:"optional",type:"string",name:"threadname",id:6},{rule:"optional",type:"int32",name:"threadperiod",id:7},{rule:"optional",type:"bool",name:"use_fp",id:8},{rule:"optional",type:"int32",name:"cpu",id:9},{rule:"optional",type:"string",name:"comp",id:10},{rule:"optional",type:"string",name:"func",id:11},{rule:"optional",type:"string",name:"instname",id:12},{rule:"optional",type:"int32",name:"flags",id:13}]},{name:"RTAPI_Message",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1e3},fields:[{rule:"required",type:"int32",name:"msglevel",id:10},{rule:"required",type:"string",name:"format",id:20,options:{default:"*** uninitialized ***","(nanopb).max_size":100}},{rule:"repeated",type:"Value",name:"arg",id:30,options:{"(nanopb).max_count":10}}]},{name:"File",syntax:"proto2",options:{"(nanopb_msgopt).msgid":200},fields:[{rule:"required",type:"string",name:"name",id:1},{rule:"required",type:"FileContent",name:"encoding",id:2},{rule:"optional",type:"bytes",name:"blob",id:3}]},{name:"Application",syntax:"proto2",options:{"(nanopb_msgopt).msgid":201},fields:[{rule:"required",type:"string",name:"name",id:1},{rule:"optional",type:"string",name:"description",id:2},{rule:"optional",type:"ApplicationType",name:"type",id:3},{rule:"optional",type:"string",name:"weburi",id:4},{rule:"repeated",type:"File",name:"file",id:5}]},{name:"StdoutLine",syntax:"proto2",options:{"(nanopb_msgopt).msgid":202},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"line",id:2}]},{name:"MachineInfo",syntax:"proto2",options:{"(nanopb_msgopt).msgid":203},fields:[{rule:"optional",type:"string",name:"type",id:1},{rule:"optional",type:"string",name:"manufacturer",id:2},{rule:"optional",type:"string",name:"model",id:3},{rule:"optional",type:"string",name:"variant",id:4}]},{name:"Launcher",syntax:"proto2",options:{"(nanopb_msgopt).msgid":204},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"string",name:"description",id:3},{rule:"optional",type:"File",name:"image",id:4},{rule:"optional",type:"MachineInfo",name:"info",id:5},{rule:"optional",type:"bool",name:"running",id:6},{rule:"optional",type:"bool",name:"terminating",id:7},{rule:"optional",type:"string",name:"command",id:8},{rule:"optional",type:"bool",name:"shell",id:9},{rule:"repeated",type:"StdoutLine",name:"output",id:10},{rule:"optional",type:"int32",name:"returncode",id:11},{rule:"optional",type:"string",name:"workdir",id:12},{rule:"optional",type:"uint32",name:"priority",id:13},{rule:"optional",type:"uint32",name:"importance",id:14}]},{name:"Position",syntax:"proto2",options:{"(nanopb_msgopt).msgid":800},fields:[{rule:"optional",type:"double",name:"x",id:3},{rule:"optional",type:"double",name:"y",id:4},{rule:"optional",type:"double",name:"z",id:5},{rule:"optional",type:"double",name:"a",id:6},{rule:"optional",type:"double",name:"b",id:7},{rule:"optional",type:"double",name:"c",id:8},{rule:"optional",type:"double",name:"u",id:9},{rule:"optional",type:"double",name:"v",id:10},{rule:"optional",type:"double",name:"w",id:11}]},{name:"Preview",syntax:"proto2",options:{"(nanopb_msgopt).msgid":801},fields:[{rule:"required",type:"PreviewOpType",name:"type",id:1},{rule:"optional",type:"int32",name:"line_number",id:2},{rule:"optional",type:"Position",name:"pos",id:3},{rule:"optional",type:"double",name:"first_end",id:4},{rule:"optional",type:"double",name:"second_end",id:5},{rule:"optional",type:"double",name:"first_axis",id:6},{rule:"optional",type:"double",name:"second_axis",id:7},{rule:"optional",type:"int32",name:"rotation",id:8},{rule:"optional",type:"double",name:"axis_end_point",id:9},{rule:"optional",type:"double",name:"xy_rotation",id:10},{rule:"optional",type:"int32",name:"plane",id:11},{rule:"optional",type:"double",name:"rate",id:12},{rule:"optional",type:"int32",name:"feed_mode",id:13},{rule:"optional",type:"double",name:"time",id:14},{rule:"optional",type:"string",name:"text",id:15},{rule:"optional",type:"double",name:"angular_units",id:101},{rule:"optional",type:"double",name:"length_units",id:102},{rule:"optional",type:"int32",name:"probetype",id:103},{rule:"optional",type:"KinematicsType",name:"kins",id:104,options:{default:"KT_JOINT"}},{rule:"optional",type:"int32",name:"axismask",id:105},{rule:"optional",type:"int32",name:"g5_index",id:106},{rule:"optional",type:"int32",name:"pocket",id:107},{rule:"optional",type:"SourceType",name:"stype",id:110},{rule:"optional",type:"string",name:"filename",id:111},{rule:"optional",type:"string",name:"cmdstring",id:112},{rule:"optional",type:"int32",name:"call_level",id:113}]},{name:"EmcToolData",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1100},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"id",id:2},{rule:"optional",type:"double",name:"diameter",id:12},{rule:"optional",type:"double",name:"frontangle",id:13},{rule:"optional",type:"double",name:"backangle",id:14},{rule:"optional",type:"int32",name:"orientation",id:15},{rule:"optional",type:"Position",name:"offset",id:16},{rule:"optional",type:"string",name:"comment",id:17},{rule:"optional",type:"int32",name:"pocket",id:18}]},{name:"EmcStatusMotionAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1101},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"enabled",id:2},{rule:"optional",type:"bool",name:"fault",id:3},{rule:"optional",type:"double",name:"ferror_current",id:4},{rule:"optional",type:"double",name:"ferror_highmark",id:5},{rule:"optional",type:"bool",name:"homed",id:6},{rule:"optional",type:"bool",name:"homing",id:7},{rule:"optional",type:"bool",name:"inpos",id:8},{rule:"optional",type:"double",name:"input",id:9},{rule:"optional",type:"bool",name:"max_hard_limit",id:10},{rule:"optional",type:"bool",name:"max_soft_limit",id:11},{rule:"optional",type:"bool",name:"min_hard_limit",id:12},{rule:"optional",type:"bool",name:"min_soft_limit",id:13},{rule:"optional",type:"double",name:"output",id:14},{rule:"optional",type:"bool",name:"override_limits",id:15},{rule:"optional",type:"double",name:"velocity",id:16}]},{name:"EmcStatusConfigAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1102},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"EmcAxisType",name:"axis_type",id:2},{rule:"optional",type:"double",name:"backlash",id:3},{rule:"optional",type:"double",name:"max_ferror",id:4},{rule:"optional",type:"double",name:"max_position_limit",id:5},{rule:"optional",type:"double",name:"min_ferror",id:6},{rule:"optional",type:"double",name:"min_position_limit",id:7},{rule:"optional",type:"int32",name:"home_sequence",id:9},{rule:"optional",type:"double",name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"string",name:"increments",id:12}]},{name:"EmcProgramExtension",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1103},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"extension",id:2}]},{name:"EmcStatusAnalogIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1104},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusDigitalIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1105},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"value",id:2}]},{name:"EmcStatusLimit",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1106},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusGCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1107},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusMCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1108},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusSetting",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1109},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusConfig",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1110},fields:[{rule:"optional",type:"double",name:"default_acceleration",id:1},{rule:"optional",type:"int32",name:"axes",id:3},{rule:"repeated",type:"EmcStatusConfigAxis",name:"axis",id:4},{rule:"optional",type:"int32",name:"axis_mask",id:5},{rule:"optional",type:"double",name:"cycle_time",id:6},{rule:"optional",type:"int32",name:"debug",id:7},{rule:"optional",type:"EmcKinematicsType",name:"kinematics_type",id:8},{rule:"optional",type:"double",name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"EmcLinearUnitsType",name:"linear_units",id:12},{rule:"optional",type:"double",name:"default_velocity",id:13},{rule:"repeated",type:"EmcProgramExtension",name:"program_extension",id:14},{rule:"optional",type:"EmcPositionOffsetType",name:"position_offset",id:15},{rule:"optional",type:"EmcPositionFeedbackType",name:"position_feedback",id:16},{rule:"optional",type:"double",name:"max_feed_override",id:17},{rule:"optional",type:"double",name:"min_feed_override",id:18},{rule:"optional",type:"double",name:"max_spindle_override",id:19},{rule:"optional",type:"double",name:"min_spindle_override",id:20},{rule:"optional",type:"double",name:"default_spindle_speed",id:21},{rule:"optional",type:"double",name:"default_linear_velocity",id:22
-},{rule:"optional",type:"double",name:"min_velocity",id:23},{rule:"optional",type:"double",name:"max_linear_velocity",id:24},{rule:"optional",type:"double",name:"min_linear_velocity",id:25},{rule:"optional",type:"double",name:"default_angular_velocity",id:26},{rule:"optional",type:"double",name:"max_angular_velocity",id:27},{rule:"optional",type:"double",name:"min_angular_velocity",id:28},{rule:"optional",type:"string",name:"increments",id:29},{rule:"optional",type:"string",name:"grids",id:30},{rule:"optional",type:"bool",name:"lathe",id:31},{rule:"optional",type:"string",name:"geometry",id:32},{rule:"optional",type:"uint32",name:"arcdivision",id:33},{rule:"optional",type:"bool",name:"no_force_homing",id:34},{rule:"optional",type:"string",name:"remote_path",id:35},{rule:"optional",type:"EmcTimeUnitsType",name:"time_units",id:36},{rule:"optional",type:"string",name:"name",id:37},{rule:"repeated",type:"EmcStatusUserCommand",name:"user_command",id:38},{rule:"optional",type:"EmcAngularUnitsType",name:"angular_units",id:39}]},{name:"EmcStatusMotion",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1111},fields:[{rule:"optional",type:"int32",name:"active_queue",id:1},{rule:"optional",type:"Position",name:"actual_position",id:2},{rule:"optional",type:"bool",name:"adaptive_feed_enabled",id:3},{rule:"repeated",type:"EmcStatusAnalogIO",name:"ain",id:4},{rule:"repeated",type:"EmcStatusAnalogIO",name:"aout",id:5},{rule:"repeated",type:"EmcStatusMotionAxis",name:"axis",id:6},{rule:"optional",type:"bool",name:"block_delete",id:7},{rule:"optional",type:"int32",name:"current_line",id:8},{rule:"optional",type:"double",name:"current_vel",id:9},{rule:"optional",type:"double",name:"delay_left",id:10},{rule:"repeated",type:"EmcStatusDigitalIO",name:"din",id:11},{rule:"optional",type:"double",name:"distance_to_go",id:12},{rule:"repeated",type:"EmcStatusDigitalIO",name:"dout",id:13},{rule:"optional",type:"Position",name:"dtg",id:14},{rule:"optional",type:"bool",name:"enabled",id:15},{rule:"optional",type:"bool",name:"feed_hold_enabled",id:16},{rule:"optional",type:"bool",name:"feed_override_enabled",id:17},{rule:"optional",type:"double",name:"feedrate",id:18},{rule:"optional",type:"OriginIndex",name:"g5x_index",id:19},{rule:"optional",type:"Position",name:"g5x_offset",id:20},{rule:"optional",type:"Position",name:"g92_offset",id:21},{rule:"optional",type:"int32",name:"id",id:23},{rule:"optional",type:"bool",name:"inpos",id:24},{rule:"optional",type:"Position",name:"joint_actual_position",id:25},{rule:"optional",type:"Position",name:"joint_position",id:26},{rule:"repeated",type:"EmcStatusLimit",name:"limit",id:27},{rule:"optional",type:"int32",name:"motion_line",id:28},{rule:"optional",type:"MotionType",name:"motion_type",id:29},{rule:"optional",type:"EmcTrajectoryModeType",name:"motion_mode",id:30},{rule:"optional",type:"bool",name:"paused",id:31},{rule:"optional",type:"Position",name:"position",id:32},{rule:"optional",type:"bool",name:"probe_tripped",id:33},{rule:"optional",type:"int32",name:"probe_val",id:34},{rule:"optional",type:"Position",name:"probed_position",id:35},{rule:"optional",type:"bool",name:"probing",id:36},{rule:"optional",type:"int32",name:"queue",id:37},{rule:"optional",type:"bool",name:"queue_full",id:38},{rule:"optional",type:"double",name:"rotation_xy",id:39},{rule:"optional",type:"bool",name:"spindle_brake",id:40},{rule:"optional",type:"int32",name:"spindle_direction",id:41},{rule:"optional",type:"bool",name:"spindle_enabled",id:42},{rule:"optional",type:"int32",name:"spindle_increasing",id:43},{rule:"optional",type:"bool",name:"spindle_override_enabled",id:44},{rule:"optional",type:"double",name:"spindle_speed",id:45},{rule:"optional",type:"double",name:"spindlerate",id:46},{rule:"optional",type:"RCS_STATUS",name:"state",id:47},{rule:"optional",type:"double",name:"max_velocity",id:48},{rule:"optional",type:"double",name:"max_acceleration",id:49},{rule:"optional",type:"double",name:"rapidrate",id:50}]},{name:"EmcStatusIo",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1112},fields:[{rule:"optional",type:"bool",name:"estop",id:1},{rule:"optional",type:"bool",name:"flood",id:2},{rule:"optional",type:"bool",name:"lube",id:3},{rule:"optional",type:"bool",name:"lube_level",id:4},{rule:"optional",type:"bool",name:"mist",id:5},{rule:"optional",type:"Position",name:"tool_offset",id:8},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:9},{rule:"optional",type:"int32",name:"pocket_prepped",id:10},{rule:"optional",type:"int32",name:"tool_in_spindle",id:11}]},{name:"EmcStatusTask",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1113},fields:[{rule:"optional",type:"int32",name:"echo_serial_number",id:1},{rule:"optional",type:"EmcTaskExecStateType",name:"exec_state",id:2},{rule:"optional",type:"string",name:"file",id:3},{rule:"optional",type:"bool",name:"input_timeout",id:4},{rule:"optional",type:"bool",name:"optional_stop",id:5},{rule:"optional",type:"int32",name:"read_line",id:6},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:7},{rule:"optional",type:"int32",name:"task_paused",id:8},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:9},{rule:"optional",type:"int32",name:"total_lines",id:10}]},{name:"EmcStatusInterp",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1114},fields:[{rule:"optional",type:"string",name:"command",id:1},{rule:"repeated",type:"EmcStatusGCode",name:"gcodes",id:2},{rule:"optional",type:"EmcInterpStateType",name:"interp_state",id:3},{rule:"optional",type:"EmcInterpExitCodeType",name:"interpreter_errcode",id:4},{rule:"repeated",type:"EmcStatusMCode",name:"mcodes",id:5},{rule:"repeated",type:"EmcStatusSetting",name:"settings",id:6},{rule:"optional",type:"EmcCanonUnitsType",name:"program_units",id:7}]},{name:"EmcCommandParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1115},fields:[{rule:"optional",type:"uint32",name:"index",id:1},{rule:"optional",type:"uint32",name:"debug_level",id:2},{rule:"optional",type:"int32",name:"line_number",id:3},{rule:"optional",type:"double",name:"scale",id:4},{rule:"optional",type:"double",name:"velocity",id:5},{rule:"optional",type:"double",name:"distance",id:6},{rule:"optional",type:"double",name:"value",id:7},{rule:"optional",type:"bool",name:"enable",id:8},{rule:"optional",type:"string",name:"command",id:9},{rule:"optional",type:"string",name:"path",id:10},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:100},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:101},{rule:"optional",type:"EmcTrajectoryModeType",name:"traj_mode",id:102},{rule:"optional",type:"EmcPose",name:"pose",id:103},{rule:"optional",type:"EmcToolData",name:"tool_data",id:104},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:105}]},{name:"EmcStatusUserCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1116},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"command",id:2}]},{name:"EmcStatusUI",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1117},fields:[{rule:"optional",type:"bool",name:"spindle_brake_visible",id:1},{rule:"optional",type:"bool",name:"spindle_cw_visible",id:2},{rule:"optional",type:"bool",name:"spindle_ccw_visible",id:3},{rule:"optional",type:"bool",name:"spindle_stop_visible",id:4},{rule:"optional",type:"bool",name:"spindle_plus_visible",id:5},{rule:"optional",type:"bool",name:"spindle_minus_visible",id:6},{rule:"optional",type:"bool",name:"spindle_override_visible",id:7},{rule:"optional",type:"bool",name:"coolant_flood_visible",id:8},{rule:"optional",type:"bool",name:"coolant_mist_visible",id:9}]},{name:"Container",syntax:"proto2",options:{"(nanopb_msgopt).msgid":500},fields:[{rule:"required",type:"ContainerType",name:"type",id:1},{rule:"optional",type:"sfixed64",name:"tsc",id:7},{rule:"repeated",type:"Preview",name:"preview",id:8,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"MotionCommand",name:"motcmd",id:9},{rule:"optional",type:"MotionStatus",name:"motstat",id:10},{rule:"optional",type:"bytes",name:"legacy_motcmd",id:11,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bytes",name:"legacy_motstat",id:12,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"RTAPI_Message",name:"rtapi_message",id:13},{rule:"optional",type:"TaskReply",name:"task_reply",id:14,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TicketUpdate",name:"ticket_update",id:15},{rule:"optional",type:"bytes",name:"syslog",id:18,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bytes",name:"legacy_nml",id:19,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bytes",name:"legacy_motconfig",id:20,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"int32",name:"tv_sec",id:21},{rule:"optional",type:"int32",name:"tv_nsec",id:22},{rule:"optional",type:"string",name:"topic",id:23},{rule:"optional",type:"bool",name:"reply_required",id:24},{rule:"optional",type:"InterpreterStateType",name:"interp_state",id:25,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"string",name:"interp_name",id:26},{rule:"optional",type:"int32",name:"rsvp",id:30},{rule:"optional",type:"ContainerType",name:"in_reply_to",id:33},{rule:"optional",type:"RCS_STATUS",name:"rcs_status",id:35},{rule:"optional",type:"StatusType",name:"status",id:40},{rule:"optional",type:"int32",name:"serial",id:45},{rule:"optional",type:"int32",name:"reply_serial",id:50},{rule:"optional",type:"int32",name:"ticket",id:55},{rule:"optional",type:"int32",name:"reply_ticket",id:60},{rule:"optional",type:"int32",name:"sequence",id:62},{rule:"optional",type:"int32",name:"credit",id:65},{rule:"optional",type:"int32",name:"line_number",id:66},{rule:"optional",type:"string",name:"name",id:67,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"string",name:"note",id:68},{rule:"optional",type:"int32",name:"retcode",id:69},{rule:"optional",type:"bytes",name:"uuid",id:72,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bool",name:"trace",id:75},{rule:"optional",type:"int32",name:"instance",id:77},{rule:"repeated",type:"Value",name:"value",id:85,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"RTAPICommand",name:"rtapicmd",id:86,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"ServiceAnnouncement",name:"service_announcement",id:88,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Component",name:"comp",id:100,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Pin",name:"pin",id:2,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Signal",name:"signal",id:3,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Param",name:"param",id:103,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Thread",name:"thread",id:104,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Ring",name:"ring",id:105,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Group",name:"group",id:106,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Member",name:"member",id:107,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Function",name:"function",id:108,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"ProtocolParameters",name:"pparams",id:109,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Vtable",name:"vtable",id:110,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Inst",name:"inst",id:111,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Application",name:"app",id:120,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Launcher",name:"launcher",id:130,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"int32",name:"index",id:131,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"LogMessage",name:"log_message",id:87,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanExecute",name:"tpexecute",id:200,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanBlockDelete",name:"tpblockdelete",id:201,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanOptionalStop",name:"tpoptionalstop",id:202,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanOpen",name:"tpopen",id:203,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanReply",name:"taskplan_reply",id:210,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"Emc_Traj_Set_G5x",name:"traj_set_g5x",id:300},{rule:"optional",type:"Emc_Traj_Set_G92",name:"traj_set_g92",id:310},{rule:"optional",type:"Emc_Traj_Set_Rotation",name:"traj_set_rotation",id:320},{rule:"optional",type:"Emc_Traj_Linear_Move",name:"traj_linear_move",id:330},{rule:"optional",type:"Emc_Traj_Probe",name:"traj_probe",id:340},{rule:"optional",type:"Emc_Traj_Circular_Move",name:"traj_circular_move",id:350},{rule:"optional",type:"Emc_Traj_Rigid_Tap",name:"traj_rigid_tap",id:360},{rule:"optional",type:"Emc_Traj_Set_Term_Cond",name:"traj_set_term_cond",id:370},{rule:"optional",type:"Emc_Traj_Set_Spindlesync",name:"traj_set_spindlesync",id:380},{rule:"optional",type:"Emc_Traj_Delay",name:"traj_delay",id:390},{rule:"optional",type:"Emc_Spindle_On",name:"spindle_on",id:400},{rule:"optional",type:"Emc_Spindle_Speed",name:"spindle_speed",id:410},{rule:"optional",type:"Emc_Spindle_Orient",name:"spindle_orient",id:420},{rule:"optional",type:"Emc_Spindle_Wait_Orient_Complete",name:"spindle_wait_orient_complete",id:430},{rule:"optional",type:"Emc_Tool_Set_Offset",name:"tool_set_offet",id:440},{rule:"optional",type:"Emc_Traj_Set_Offset",name:"traj_set_offset",id:450},{rule:"optional",type:"Emc_Tool_Prepare",name:"tool_prepare",id:460},{rule:"optional",type:"Emc_Tool_Set_Number",name:"tool_set_number",id:470},{rule:"optional",type:"Emc_Traj_Set_Fo_Enable",name:"traj_set_fo_enable",id:480},{rule:"optional",type:"Emc_Traj_Set_So_Enable",name:"traj_set_so_enable",id:490},{rule:"optional",type:"Emc_Traj_Set_Fh_Enable",name:"traj_set_fh_enable",id:500},{rule:"optional",type:"Emc_Motion_Adaptive",name:"motion_adaptive",id:510},{rule:"optional",type:"Emc_Operator_Display",name:"operator_display",id:520},{rule:"optional",type:"Emc_Operator_Text",name:"operator_text",id:530},{rule:"optional",type:"Emc_Operator_Error",name:"operator_error",id:540},{rule:"optional",type:"Emc_Motion_Set_Dout",name:"motion_set_dout",id:550},{rule:"optional",type:"Emc_Motion_Set_Aout",name:"motion_set_aout",id:560},{rule:"optional",type:"Emc_Aux_Input_Wait",name:"aux_input_wait",id:570},{rule:"optional",type:"Emc_Exec_Plugin_Ca1l",name:"exec_plugin_call",id:580},{rule:"optional",type:"Emc_Io_Plugin_Call",name:"io_plugin_call",id:590},{rule:"optional",type:"EmcStatusConfig",name:"emc_status_config",id:600,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusMotion",name:"emc_status_motion",id:601,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusIo",name:"emc_status_io",id:602,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusTask",name:"emc_status_task",id:603,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusInterp",name:"emc_status_interp",id:604,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusUI",name:"emc_status_ui",id:605,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcCommandParameters",name:"emc_command_params",id:610,options:{"(nanopb).type":"FT_IGNORE"}}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",
-id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]},{name:"MotionType",syntax:"proto2",values:[{name:"_EMC_MOTION_TYPE_NONE",id:0},{name:"_EMC_MOTION_TYPE_TRAVERSE",id:1},{name:"_EMC_MOTION_TYPE_FEED",id:2},{name:"_EMC_MOTION_TYPE_ARC",id:3},{name:"_EMC_MOTION_TYPE_TOOLCHANGE",id:4},{name:"_EMC_MOTION_TYPE_PROBING",id:5},{name:"_EMC_MOTION_TYPE_INDEXROTARY",id:6}]},{name:"cmd_code_t",syntax:"proto2",values:[{name:"EMCMOT_ABORT",id:4e3},{name:"EMCMOT_AXIS_ABORT",id:4001},{name:"EMCMOT_ENABLE",id:4002},{name:"EMCMOT_DISABLE",id:4003},{name:"EMCMOT_ENABLE_AMPLIFIER",id:4004},{name:"EMCMOT_DISABLE_AMPLIFIER",id:4005},{name:"EMCMOT_ENABLE_WATCHDOG",id:4006},{name:"EMCMOT_DISABLE_WATCHDOG",id:4007},{name:"EMCMOT_ACTIVATE_JOINT",id:4008},{name:"EMCMOT_DEACTIVATE_JOINT",id:4009},{name:"EMCMOT_PAUSE",id:4010},{name:"EMCMOT_RESUME",id:4011},{name:"EMCMOT_STEP",id:4012},{name:"EMCMOT_FREE",id:4013},{name:"EMCMOT_COORD",id:4014},{name:"EMCMOT_TELEOP",id:4015},{name:"EMCMOT_SPINDLE_SCALE",id:4016},{name:"EMCMOT_SS_ENABLE",id:4017},{name:"EMCMOT_FEED_SCALE",id:4018},{name:"EMCMOT_FS_ENABLE",id:4019},{name:"EMCMOT_FH_ENABLE",id:4020},{name:"EMCMOT_AF_ENABLE",id:4021},{name:"EMCMOT_OVERRIDE_LIMITS",id:4022},{name:"EMCMOT_HOME",id:4023},{name:"EMCMOT_UNHOME",id:4024},{name:"EMCMOT_JOG_CONT",id:4025},{name:"EMCMOT_JOG_INCR",id:4026},{name:"EMCMOT_JOG_ABS",id:4027},{name:"EMCMOT_SET_LINE",id:4028},{name:"EMCMOT_SET_CIRCLE",id:4029},{name:"EMCMOT_SET_TELEOP_VECTOR",id:4030},{name:"EMCMOT_CLEAR_PROBE_FLAGS",id:4031},{name:"EMCMOT_PROBE",id:4032},{name:"EMCMOT_RIGID_TAP",id:4033},{name:"EMCMOT_SET_POSITION_LIMITS",id:4034},{name:"EMCMOT_SET_BACKLASH",id:4035},{name:"EMCMOT_SET_MIN_FERROR",id:4036},{name:"EMCMOT_SET_MAX_FERROR",id:4037},{name:"EMCMOT_SET_VEL",id:4038},{name:"EMCMOT_SET_VEL_LIMIT",id:4039},{name:"EMCMOT_SET_JOINT_VEL_LIMIT",id:4040},{name:"EMCMOT_SET_JOINT_ACC_LIMIT",id:4041},{name:"EMCMOT_SET_ACC",id:4042},{name:"EMCMOT_SET_TERM_COND",id:4043},{name:"EMCMOT_SET_NUM_AXES",id:4044},{name:"EMCMOT_SET_WORLD_HOME",id:4045},{name:"EMCMOT_SET_HOMING_PARAMS",id:4046},{name:"EMCMOT_SET_DEBUG",id:4047},{name:"EMCMOT_SET_DOUT",id:4048},{name:"EMCMOT_SET_AOUT",id:4049},{name:"EMCMOT_SET_SPINDLESYNC",id:4050},{name:"EMCMOT_SPINDLE_ON",id:4051},{name:"EMCMOT_SPINDLE_OFF",id:4052},{name:"EMCMOT_SPINDLE_INCREASE",id:4053},{name:"EMCMOT_SPINDLE_DECREASE",id:4054},{name:"EMCMOT_SPINDLE_BRAKE_ENGAGE",id:4055},{name:"EMCMOT_SPINDLE_BRAKE_RELEASE",id:4056},{name:"EMCMOT_SET_MOTOR_OFFSET",id:4057},{name:"EMCMOT_SET_JOINT_COMP",id:4058},{name:"EMCMOT_SET_OFFSET",id:4059}]},{name:"cmd_status_t",syntax:"proto2",values:[{name:"EMCMOT_COMMAND_OK",id:0},{name:"EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1},{name:"EMCMOT_COMMAND_INVALID_COMMAND",id:2},{name:"EMCMOT_COMMAND_INVALID_PARAMS",id:3},{name:"EMCMOT_COMMAND_BAD_EXEC",id:4}]},{name:"ApplicationType",syntax:"proto2",values:[{name:"QT5_QML",id:1},{name:"GLADEVCP",id:2},{name:"JAVASCRIPT",id:3}]},{name:"FileContent",syntax:"proto2",values:[{name:"CLEARTEXT",id:1},{name:"ZLIB",id:2}]},{name:"KinematicsType",syntax:"proto2",values:[{name:"KT_JOINT",id:1},{name:"KT_TRIVKINS",id:2},{name:"KT_DELTA",id:3}]},{name:"PreviewOpType",syntax:"proto2",values:[{name:"PV_STRAIGHT_PROBE",id:1},{name:"PV_RIGID_TAP",id:2},{name:"PV_STRAIGHT_FEED",id:3},{name:"PV_ARC_FEED",id:4},{name:"PV_STRAIGHT_TRAVERSE",id:5},{name:"PV_SET_G5X_OFFSET",id:6},{name:"PV_SET_G92_OFFSET",id:7},{name:"PV_SET_XY_ROTATION",id:8},{name:"PV_SELECT_PLANE",id:9},{name:"PV_SET_TRAVERSE_RATE",id:10},{name:"PV_SET_FEED_RATE",id:11},{name:"PV_CHANGE_TOOL",id:12},{name:"PV_CHANGE_TOOL_NUMBER",id:13},{name:"PV_DWELL",id:14},{name:"PV_MESSAGE",id:15},{name:"PV_COMMENT",id:16},{name:"PV_USE_TOOL_OFFSET",id:17},{name:"PV_SET_PARAMS",id:18},{name:"PV_SET_FEED_MODE",id:19},{name:"PV_SOURCE_CONTEXT",id:20},{name:"PV_PREVIEW_START",id:21},{name:"PV_PREVIEW_END",id:22}]},{name:"SourceType",syntax:"proto2",values:[{name:"ST_NGC_FILE",id:1},{name:"ST_NGC_STRING",id:2},{name:"ST_PYTHON_METHOD",id:3}]},{name:"EmcTaskExecStateType",syntax:"proto2",values:[{name:"EMC_TASK_EXEC_ERROR",id:1},{name:"EMC_TASK_EXEC_DONE",id:2},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION",id:3},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_QUEUE",id:4},{name:"EMC_TASK_EXEC_WAITING_FOR_IO",id:5},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_AND_IO",id:7},{name:"EMC_TASK_EXEC_WAITING_FOR_DELAY",id:8},{name:"EMC_TASK_EXEC_WAITING_FOR_SYSTEM_CMD",id:9},{name:"EMC_TASK_EXEC_WAITING_FOR_SPINDLE_ORIENTED",id:10}]},{name:"EmcInterpStateType",syntax:"proto2",values:[{name:"EMC_TASK_INTERP_IDLE",id:1},{name:"EMC_TASK_INTERP_READING",id:2},{name:"EMC_TASK_INTERP_PAUSED",id:3},{name:"EMC_TASK_INTERP_WAITING",id:4}]},{name:"EmcInterpExitCodeType",syntax:"proto2",values:[{name:"EMC_INTERP_EXIT_OK",id:0},{name:"EMC_INTERP_EXIT_EXIT",id:1},{name:"EMC_INTERP_EXIT_EXECUTE_FINISH",id:2},{name:"EMC_INTERP_EXIT_ENDFILE",id:3},{name:"EMC_INTERP_EXIT_FILE_NOT_OPEN",id:4},{name:"EMC_INTERP_EXIT_ERROR",id:5}]},{name:"EmcKinematicsType",syntax:"proto2",values:[{name:"KINEMATICS_IDENTITY",id:1},{name:"KINEMATICS_FORWARD_ONLY",id:2},{name:"KINEMATICS_INVERSE_ONLY",id:3},{name:"KINEMATICS_BOTH",id:4}]},{name:"EmcTrajectoryModeType",syntax:"proto2",values:[{name:"EMC_TRAJ_MODE_FREE",id:1},{name:"EMC_TRAJ_MODE_COORD",id:2},{name:"EMC_TRAJ_MODE_TELEOP",id:3}]},{name:"EmcCanonUnitsType",syntax:"proto2",values:[{name:"CANON_UNITS_INCH",id:1},{name:"CANON_UNITS_MM",id:2},{name:"CANON_UNITS_CM",id:3}]},{name:"EmcLinearUnitsType",syntax:"proto2",values:[{name:"LINEAR_UNITS_INCH",id:1},{name:"LINEAR_UNITS_MM",id:2},{name:"LINEAR_UNITS_CM",id:3}]},{name:"EmcAngularUnitsType",syntax:"proto2",values:[{name:"ANGULAR_UNITS_DEGREES",id:1},{name:"ANGULAR_UNITS_RADIAN",id:2},{name:"ANGULAR_UNITS_GRAD",id:3}]},{name:"EmcTimeUnitsType",syntax:"proto2",values:[{name:"TIME_UNITS_MINUTE",id:1},{name:"TIME_UNITS_SECOND",id:2}]},{name:"EmcTaskModeType",syntax:"proto2",values:[{name:"EMC_TASK_MODE_MANUAL",id:1},{name:"EMC_TASK_MODE_AUTO",id:2},{name:"EMC_TASK_MODE_MDI",id:3}]},{name:"EmcTaskStateType",syntax:"proto2",values:[{name:"EMC_TASK_STATE_ESTOP",id:1},{name:"EMC_TASK_STATE_ESTOP_RESET",id:2},{name:"EMC_TASK_STATE_OFF",id:3},{name:"EMC_TASK_STATE_ON",id:4}]},{name:"EmcAxisType",syntax:"proto2",values:[{name:"EMC_AXIS_LINEAR",id:1},{name:"EMC_AXIS_ANGULAR",id:2}]},{name:"EmcPositionOffsetType",syntax:"proto2",values:[{name:"EMC_CONFIG_RELATIVE_OFFSET",id:1},{name:"EMC_CONFIG_MACHINE_OFFSET",id:2}]},{name:"EmcPositionFeedbackType",syntax:"proto2",values:[{name:"EMC_CONFIG_ACTUAL_FEEDBACK",id:1},{name:"EMC_CONFIG_COMMANDED_FEEDBACK",id:2}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Instance",syntax:"proto2",options:{"(nanopb_msgopt).msgid":700},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"id",id:2}]},{name:"ServiceAnnouncement",syntax:"proto2",options:{"(nanopb_msgopt).msgid":701},fields:[{rule:"required",type:"ServiceType",name:"stype",id:1},{rule:"required",type:"fixed32",name:"version",id:2,options:{default:0}},{rule:"required",type:"fixed32",name:"instance",id:3,options:{default:0}},{rule:"required",type:"ServiceAPI",name:"api",id:8},{rule:"required",type:"string",name:"uri",id:6},{rule:"optional",type:"string",name:"description",id:7}]},{name:"Originator",syntax:"proto2",options:{"(nanopb_msgopt).msgid":702},fields:[{rule:"optional",type:"OriginType",name:"origin",id:1},{rule:"optional",type:"OriginDetail",name:"detail",id:2},{rule:"optional",type:"string",name:"name",id:3},{rule:"optional",type:"sfixed32",name:"id",id:4},{rule:"optional",type:"Instance",name:"instance",id:5}]},{name:"AnError",syntax:"proto2",options:{"(nanopb_msgopt).msgid":703},fields:[{rule:"required",type:"sfixed32",name:"error_code",id:1},{rule:"optional",type:"Severity",name:"severity",id:2},{rule:"optional",type:"string",name:"error_text",id:3},{rule:"optional",type:"Originator",name:"origin",id:4}]},{name:"Pin",syntax:"proto2",options:{"(nanopb_msgopt).msgid":704},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"HalPinDirection",name:"dir",id:4},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"sfixed32",name:"owner",id:9},{rule:"optional",type:"bool",name:"linked",id:10},{rule:"optional",type:"string",name:"oldname",id:11},{rule:"optional",type:"double",name:"epsilon",id:12},{rule:"optional",type:"fixed32",name:"flags",id:13}]},{name:"Signal",syntax:"proto2",options:{"(nanopb_msgopt).msgid":705},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"fixed32",name:"readers",id:11},{rule:"optional",type:"fixed32",name:"writers",id:12},{rule:"optional",type:"fixed32",name:"bidirs",id:13}]},{name:"Param",syntax:"proto2",options:{"(nanopb_msgopt).msgid":706},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"HalParamDirection",name:"dir",id:11},{rule:"optional",type:"string",name:"oldname",id:12},{rule:"optional",type:"sfixed32",name:"owner",id:13},{rule:"optional",type:"sfixed32",name:"runtime",id:14},{rule:"optional",type:"sfixed32",name:"maytime",id:15}]},{name:"Function",syntax:"proto2",options:{"(nanopb_msgopt).msgid":707},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"fixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"users",id:4},{rule:"optional",type:"fixed32",name:"runtime",id:5},{rule:"optional",type:"fixed32",name:"maxtime",id:6},{rule:"optional",type:"bool",name:"reentrant",id:7},{rule:"optional",type:"HalFunctType",name:"type",id:8},{rule:"optional",type:"bool",name:"maxtime_increased",id:9}]},{name:"ProfileStats",syntax:"proto2",options:{"(nanopb_msgopt).msgid":716},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed64",name:"count",id:2},{rule:"optional",type:"sfixed32",name:"min",id:3},{rule:"optional",type:"sfixed32",name:"max",id:4},{rule:"optional",type:"sfixed32",name:"mean",id:5},{rule:"optional",type:"sfixed32",name:"p50",id:6},{rule:"optional",type:"sfixed32",name:"p99",id:7},{rule:"optional",type:"sfixed32",name:"p999",id:8}]},{name:"Thread",syntax:"proto2",options:{"(nanopb_msgopt).msgid":708},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"bool",name:"uses_fp",id:3},{rule:"optional",type:"fixed32",name:"period",id:4},{rule:"optional",type:"sfixed32",name:"priority",id:5},{rule:"optional",type:"fixed32",name:"task_id",id:6},{rule:"optional",type:"fixed32",name:"cpu_id",id:7},{rule:"repeated",type:"string",name:"function",id:8},{rule:"optional",type:"ProfileStats",name:"runtime_profile",id:9},{rule:"optional",type:"ProfileStats",name:"jitter_profile",id:10},{rule:"optional",type:"fixed64",name:"overruns",id:11},{rule:"repeated",type:"ProfileStats",name:"function_profile",id:12}]},{name:"Component",syntax:"proto2",options:{"(nanopb_msgopt).msgid":709},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"ninst",id:2},{rule:"optional",type:"sfixed32",name:"comp_id",id:4},{rule:"optional",type:"fixed32",name:"type",id:5},{rule:"optional",type:"fixed32",name:"state",id:6},{rule:"optional",type:"fixed32",name:"last_update",id:7},{rule:"optional",type:"fixed32",name:"last_bound",id:8},{rule:"optional",type:"fixed32",name:"last_unbound",id:9},{rule:"optional",type:"fixed32",name:"pid",id:10},{rule:"optional",type:"string",name:"args",id:11},{rule:"optional",type:"sfixed32",name:"timer",id:12},{rule:"optional",type:"sfixed32",name:"userarg1",id:14},{rule:"optional",type:"sfixed32",name:"userarg2",id:15},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19},{rule:"optional",type:"bool",name:"no_create",id:18}]},{name:"Ring",syntax:"proto2",options:{"(nanopb_msgopt).msgid":710},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner",id:3},{rule:"optional",type:"bool",name:"stream",id:4},{rule:"optional",type:"bool",name:"wmutex",id:5},{rule:"optional",type:"bool",name:"rmutex",id:6},{rule:"optional",type:"bool",name:"rtapi_shm",id:7},{rule:"optional",type:"sfixed32",name:"reader",id:8},{rule:"optional",type:"sfixed32",name:"writer",id:9},{rule:"optional",type:"sfixed32",name:"total_size",id:10},{rule:"optional",type:"sfixed32",name:"scratchpad",id:11},{rule:"optional",type:"sfixed32",name:"ring_shmkey",id:12},{rule:"optional",type:"fixed32",name:"encodings",id:13}]},{name:"Member",syntax:"proto2",options:{"(nanopb_msgopt).msgid":711},fields:[{rule:"optional",type:"ObjectType",name:"mtype",id:1},{rule:"optional",type:"sfixed32",name:"userarg1",id:2},{rule:"optional",type:"double",name:"epsilon",id:3},{rule:"optional",type:"Signal",name:"signal",id:4},{rule:"optional",type:"string",name:"groupname",id:5},{rule:"optional",type:"fixed32",name:"handle",id:6},{rule:"optional",type:"Pin",name:"pin",id:7},{rule:"optional",type:"Param",name:"param",id:8}]},{name:"Group",syntax:"proto2",options:{"(nanopb_msgopt).msgid":712},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"userarg1",id:4},{rule:"optional",type:"sfixed32",name:"userarg2",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"repeated",type:"Member",name:"member",id:7}]},{name:"ProtocolParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":713},fields:[{rule:"optional",type:"sfixed32",name:"keepalive_timer",id:1},{rule:"optional",type:"sfixed32",name:"group_timer",id:2},{rule:"optional",type:"sfixed32",name:"rcomp_timer",id:3}]},{name:"Vtable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":714},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"context",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"optional",type:"sfixed32",name:"version",id:7},{rule:"optional",type:"fixed64",name:"vtable",id:8}]},{name:"Inst",syntax:"proto2",options:{"(nanopb_msgopt).msgid":715},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"comp_id",id:2},{rule:"optional",type:"fixed32",name:"inst_id",id:3},{rule:"optional",type:"fixed32",name:"inst_size",id:4},{rule:"optional",type:"fixed64",name:"vtable",id:5},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19}]},{name:"LogMessage",syntax:"proto2",options:{"(nanopb_msgopt).msgid":400},fields:[{rule:"required",type:"MsgOrigin",name:"origin",id:10},{rule:"required",type:"int32",name:"pid",id:20},{rule:"required",type:"MsgLevel",name:"level",id:30},{rule:"required",type:"string",name:"tag",id:40},{rule:"required",type:"string",name:"text",id:50}]},{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"MotionCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":600},fields:[{rule:"required",type:"cmd_code_t",name:"command",id:10},{rule:"required",type:"fixed32",name:"commandNum",id:20},{rule:"optional",type:"double",name:"motor_offset",id:30},{rule:"optional",type:"double",name:"maxLimit",id:40},{rule:"optional",type:"double",name:"minLimit",id:50},{rule:"optional",type:"EmcPose",name:"pos",id:60},{rule:"optional",type:"PmCartesian",name:"center",id:70},{rule:"optional",type:"PmCartesian",name:"normal",id:80},{rule:"optional",type:"fixed32",name:"turn",id:90},{rule:"optional",type:"double",name:"vel",id:100},{rule:"optional",type:"double",name:"ini_maxvel",id:110},{rule:"optional",type:"MotionType",name:"motion_type",id:120},{rule:"optional",type:"double",name:"spindlesync",id:130},{rule:"optional",type:"double",name:"acc",id:140},{rule:"optional",type:"double",name:"backlash",id:150},{rule:"optional",type:"fixed32",name:"id",id:160},{rule:"optional",type:"fixed32",name:"termCond",id:170},{rule:"optional",type:"double",name:"tolerance",id:180},{rule:"optional",type:"fixed32",name:"axis",id:190},{rule:"optional",type:"double",name:"scale",id:200},{rule:"optional",type:"double",name:"offset",id:210},{rule:"optional",type:"double",name:"home",id:220},{rule:"optional",type:"double",name:"home_final_vel",id:230},{rule:"optional",type:"double",name:"search_vel",id:240},{rule:"optional",type:"double",name:"latch_vel",id:250},{rule:"optional",type:"fixed32",name:"flags",id:260},{rule:"optional",type:"fixed32",name:"home_sequence",id:270},{rule:"optional",type:"fixed32",name:"volatile_home",id:280},{rule:"optional",type:"double",name:"minFerror",id:290},{rule:"optional",type:"double",name:"maxFerror",id:300},{rule:"optional",type:"fixed32",name:"wdWait",id:310},{rule:"optional",type:"fixed32",name:"debug",id:320},{rule:"optional",type:"int32",name:"now",id:330},{rule:"optional",type:"int32",name:"out",id:340},{rule:"optional",type:"int32",name:"start",id:350},{rule:"optional",type:"int32",name:"end",id:360},{rule:"optional",type:"int32",name:"mode",id:370},{rule:"optional",type:"double",name:"comp_nominal",id:380},{rule:"optional",type:"double",name:"comp_forward",id:390},{rule:"optional",type:"double",name:"comp_reverse",id:400},{rule:"optional",type:"int32",name:"probe_type",id:410},{rule:"optional",type:"EmcPose",name:"tool_offset",id:420}]},{name:"MotionStatus",syntax:"proto2",options:{"(nanopb_msgopt).msgid":601},fields:[{rule:"required",type:"cmd_code_t",name:"commandEcho",id:10},{rule:"required",type:"fixed32",name:"commandNumEcho",id:20},{rule:"required",type:"cmd_status_t",name:"commandStatus",id:30},{rule:"optional",type:"EmcPose",name:"carte_pos_fb",id:40}]},{name:"TaskPlanExecute",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1200},fields:[{rule:"optional",type:"string",name:"command",id:10},{rule:"optional",type:"sfixed32",name:"line",id:30}]},{name:"TaskPlanBlockDelete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1201},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOptionalStop",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1202},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOpen",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1203},fields:[{rule:"required",type:"string",name:"filename",id:10}]},{name:"TaskPlanReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1204},fields:[{rule:"required",type:"ContainerType",name:"cmd",id:10},{rule:"optional",type:"string",name:"errormsg",id:20}]},{name:"TaskReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1205},fields:[{rule:"required",type:"fixed32",name:"ticket",id:10}]},{name:"TicketUpdate",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1206},fields:[{rule:"required",type:"fixed32",name:"cticket",id:10},{rule:"required",type:"RCS_STATUS",name:"status",id:20},{rule:"optional",type:"string",name:"text",id:30}]},{name:"Emc_Traj_Set_G5x",syntax:"proto2",options:{"(nanopb_msgopt).msgid":100},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10},{rule:"required",type:"OriginIndex",name:"g5x_index",id:20}]},{name:"Emc_Traj_Set_G92",syntax:"proto2",options:{"(nanopb_msgopt).msgid":101},fields:[{rule:"required",type:"EmcPose",name:"origin",id:10}]},{name:"Emc_Traj_Set_Rotation",syntax:"proto2",options:{"(nanopb_msgopt).msgid":102},fields:[{rule:"required",type:"double",name:"rotation",id:10}]},{name:"Emc_Traj_Linear_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":103},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"indexrotary",id:70}]},{name:"Emc_Traj_Probe",syntax:"proto2",options:{"(nanopb_msgopt).msgid":104},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"uint32",name:"probe_type",id:60}]},{name:"Emc_Traj_Circular_Move",syntax:"proto2",options:{"(nanopb_msgopt).msgid":105},fields:[{rule:"required",type:"MotionType",name:"type",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"required",type:"PmCartesian",name:"center",id:25},{rule:"required",type:"PmCartesian",name:"normal",id:27},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50},{rule:"required",type:"bool",name:"feed_mode",id:60},{rule:"required",type:"int32",name:"turn",id:70}]},{name:"Emc_Traj_Rigid_Tap",syntax:"proto2",options:{"(nanopb_msgopt).msgid":106},fields:[{rule:"required",type:"EmcPose",name:"pos",id:20},{rule:"required",type:"double",name:"vel",id:30},{rule:"required",type:"double",name:"ini_maxvel",id:40},{rule:"required",type:"double",name:"acc",id:50}]},{name:"Emc_Traj_Set_Term_Cond",syntax:"proto2",options:{"(nanopb_msgopt).msgid":107},fields:[{rule:"required",type:"TermConditionType",name:"cond",id:10},{rule:"required",type:"double",name:"tolerance",id:20}]},{name:"Emc_Traj_Set_Spindlesync",syntax:"proto2",options:{"(nanopb_msgopt).msgid":108},fields:[{rule:"required",type:"double",name:"feed_per_revolution",id:10},{rule:"required",type:"bool",name:"velocity_mode",id:20}]},{name:"Emc_Traj_Delay",syntax:"proto2",options:{"(nanopb_msgopt).msgid":109},fields:[{rule:"required",type:"double",name:"delay",id:10}]},{name:"Emc_Spindle_On",syntax:"proto2",options:{"(nanopb_msgopt).msgid":110},fields:[{rule:"required",type:"double",name:"speed",id:10,options:{default:0}},{rule:"required",type:"double",name:"factor",id:20,options:{default:0}},{rule:"required",type:"double",name:"xoffset",id:30,options:{default:0}}]},{name:"Emc_Spindle_Speed",syntax:"proto2",options:{"(nanopb_msgopt).msgid":111},fields:[{rule:"required",type:"double",name:"speed",id:10},{rule:"required",type:"double",name:"factor",id:20},{rule:"required",type:"double",name:"xoffset",id:30}]},{name:"Emc_Spindle_Orient",syntax:"proto2",options:{"(nanopb_msgopt).msgid":112},fields:[{rule:"required",type:"double",name:"orientation",id:10},{rule:"required",type:"CanonDirection",name:"mode",id:20}]},{name:"Emc_Spindle_Wait_Orient_Complete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":113},fields:[{rule:"required",type:"double",name:"timeout",id:10}]},{name:"Emc_Tool_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":114},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"toolno",id:15},{rule:"required",type:"EmcPose",name:"offset",id:20},{rule:"required",type:"double",name:"diameter",id:30},{rule:"required",type:"double",name:"frontangle",id:40},{rule:"required",type:"double",name:"backangle",id:50},{rule:"required",type:"int32",name:"orientation",id:60}]},{name:"Emc_Traj_Set_Offset",syntax:"proto2",options:{"(nanopb_msgopt).msgid":115},fields:[{rule:"required",type:"EmcPose",name:"offset",id:10}]},{name:"Emc_Tool_Prepare",syntax:"proto2",options:{"(nanopb_msgopt).msgid":116},fields:[{rule:"required",type:"int32",name:"pocket",id:10},{rule:"required",type:"int32",name:"tool",id:20}]},{name:"Emc_Tool_Set_Number",syntax:"proto2",options:{"(nanopb_msgopt).msgid":117},fields:[{rule:"required",type:"int32",name:"tool",id:10}]},{name:"Emc_Traj_Set_Fo_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":118},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_So_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":119},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Traj_Set_Fh_Enable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":120},fields:[{rule:"required",type:"bool",name:"mode",id:10}]},{name:"Emc_Motion_Adaptive",syntax:"proto2",options:{"(nanopb_msgopt).msgid":121},fields:[{rule:"required",type:"bool",name:"status",id:10}]},{name:"Emc_Operator_Display",syntax:"proto2",options:{"(nanopb_msgopt).msgid":122},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"display",id:20}]},{name:"Emc_Operator_Text",syntax:"proto2",options:{"(nanopb_msgopt).msgid":123},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"text",id:20}]},{name:"Emc_Operator_Error",syntax:"proto2",options:{"(nanopb_msgopt).msgid":124},fields:[{rule:"required",type:"int32",name:"id",id:10},{rule:"required",type:"string",name:"error",id:20}]},{name:"Emc_Motion_Set_Dout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":125},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"bool",name:"start",id:20},{rule:"required",type:"bool",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Motion_Set_Aout",syntax:"proto2",options:{"(nanopb_msgopt).msgid":126},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"double",name:"start",id:20},{rule:"required",type:"double",name:"end",id:30},{rule:"required",type:"bool",name:"now",id:40}]},{name:"Emc_Aux_Input_Wait",syntax:"proto2",options:{"(nanopb_msgopt).msgid":127},fields:[{rule:"required",type:"uint32",name:"index",id:10},{rule:"required",type:"InputType",name:"input_type",id:20},{rule:"required",type:"WaitType",name:"wait_type",id:30},{rule:"required",type:"double",name:"timeout",id:40}]},{name:"Emc_Exec_Plugin_Ca1l",syntax:"proto2",options:{"(nanopb_msgopt).msgid":128},fields:[{rule:"required",type:"bytes",name:"call",id:20}]},{name:"Emc_Io_Plugin_Call",syntax:"proto2",options:{"(nanopb_msgopt).msgid":129},fields:[{rule:"required",type:"bytes",name:"call",id:20}]},{name:"Value",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1500},fields:[{rule:"required",type:"ValueType",name:"type",id:10},{rule:"optional",type:"bool",name:"halbit",id:100},{rule:"optional",type:"double",name:"halfloat",id:101},{rule:"optional",type:"sfixed32",name:"hals32",id:102},{rule:"optional",type:"fixed32",name:"halu32",id:103},{rule:"optional",type:"bytes",name:"v_bytes",id:120},{rule:"optional",type:"sfixed32",name:"v_int32",id:130},{rule:"optional",type:"sfixed64",name:"v_int64",id:140},{rule:"optional",type:"fixed32",name:"v_uint32",id:150},{rule:"optional",type:"fixed64",name:"v_uint64",id:160},{rule:"optional",type:"double",name:"v_double",id:170},{rule:"optional",type:"string",name:"v_string",id:180,options:{"(nanopb).max_size":41}},{rule:"optional",type:"bool",name:"v_bool",id:190},{rule:"optional",type:"PmCartesian",name:"carte",id:200},{rule:"optional",type:"EmcPose",name:"pose",id:220}]},{name:"RTAPICommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":900},fields:[{rule:"required",type:"int32",name:"instance",id:1},{rule:"optional",type:"string",name:"modname",id:2},{rule:"optional",type:"int32",name:"rt_msglevel",id:3},{rule:"optional",type:"int32",name:"user_msglevel",id:4},{rule:"repeated",type:"string",name:"argv",id:5},{rule:"optional",type:"string",name:"threadname",id:6},{rule:"optional",type:"int32",name:"threadperiod",id:7},{rule:"optional",type:"bool",name:"use_fp",id:8},{rule:"optional",type:"int32",name:"cpu",id:9},{rule:"optional",type:"string",name:"cgname",id:14},{rule:"optional",type:"int32",name:"workers",id:15},{rule:"optional",type:"string",name:"comp",id:10},{rule:"optional",type:"string",name:"func",id:11},{rule:"optional",type:"string",name:"instname",id:12},{rule:"optional",type:"int32",name:"flags",id:13}]},{name:"RTAPI_Message",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1e3},fields:[{rule:"required",type:"int32",name:"msglevel",id:10},{rule:"required",type:"string",name:"format",id:20,options:{default:"*** uninitialized ***","(nanopb).max_size":100}},{rule:"repeated",type:"Value",name:"arg",id:30,options:{"(nanopb).max_count":10}}]},{name:"File",syntax:"proto2",options:{"(nanopb_msgopt).msgid":200},fields:[{rule:"required",type:"string",name:"name",id:1},{rule:"required",type:"FileContent",name:"encoding",id:2},{rule:"optional",type:"bytes",name:"blob",id:3}]},{name:"Application",syntax:"proto2",options:{"(nanopb_msgopt).msgid":201},fields:[{rule:"required",type:"string",name:"name",id:1},{rule:"optional",type:"string",name:"description",id:2},{rule:"optional",type:"ApplicationType",name:"type",id:3},{rule:"optional",type:"string",name:"weburi",id:4},{rule:"repeated",type:"File",name:"file",id:5}]},{name:"StdoutLine",syntax:"proto2",options:{"(nanopb_msgopt).msgid":202},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"line",id:2}]},{name:"MachineInfo",syntax:"proto2",options:{"(nanopb_msgopt).msgid":203},fields:[{rule:"optional",type:"string",name:"type",id:1},{rule:"optional",type:"string",name:"manufacturer",id:2},{rule:"optional",type:"string",name:"model",id:3},{rule:"optional",type:"string",name:"variant",id:4}]},{name:"Launcher",syntax:"proto2",options:{"(nanopb_msgopt).msgid":204},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"string",name:"description",id:3},{rule:"optional",type:"File",name:"image",id:4},{rule:"optional",type:"MachineInfo",name:"info",id:5},{rule:"optional",type:"bool",name:"running",id:6},{rule:"optional",type:"bool",name:"terminating",id:7},{rule:"optional",type:"string",name:"command",id:8},{rule:"optional",type:"bool",name:"shell",id:9},{rule:"repeated",type:"StdoutLine",name:"output",id:10},{rule:"optional",type:"int32",name:"returncode",id:11},{rule:"optional",type:"string",name:"workdir",id:12},{rule:"optional",type:"uint32",name:"priority",id:13},{rule:"optional",type:"uint32",name:"importance",id:14}]},{name:"Position",syntax:"proto2",options:{"(nanopb_msgopt).msgid":800},fields:[{rule:"optional",type:"double",name:"x",id:3},{rule:"optional",type:"double",name:"y",id:4},{rule:"optional",type:"double",name:"z",id:5},{rule:"optional",type:"double",name:"a",id:6},{rule:"optional",type:"double",name:"b",id:7},{rule:"optional",type:"double",name:"c",id:8},{rule:"optional",type:"double",name:"u",id:9},{rule:"optional",type:"double",name:"v",id:10},{rule:"optional",type:"double",name:"w",id:11}]},{name:"Preview",syntax:"proto2",options:{"(nanopb_msgopt).msgid":801},fields:[{rule:"required",type:"PreviewOpType",name:"type",id:1},{rule:"optional",type:"int32",name:"line_number",id:2},{rule:"optional",type:"Position",name:"pos",id:3},{rule:"optional",type:"double",name:"first_end",id:4},{rule:"optional",type:"double",name:"second_end",id:5},{rule:"optional",type:"double",name:"first_axis",id:6},{rule:"optional",type:"double",name:"second_axis",id:7},{rule:"optional",type:"int32",name:"rotation",id:8},{rule:"optional",type:"double",name:"axis_end_point",id:9},{rule:"optional",type:"double",name:"xy_rotation",id:10},{rule:"optional",type:"int32",name:"plane",id:11},{rule:"optional",type:"double",name:"rate",id:12},{rule:"optional",type:"int32",name:"feed_mode",id:13},{rule:"optional",type:"double",name:"time",id:14},{rule:"optional",type:"string",name:"text",id:15},{rule:"optional",type:"double",name:"angular_units",id:101},{rule:"optional",type:"double",name:"length_units",id:102},{rule:"optional",type:"int32",name:"probetype",id:103},{rule:"optional",type:"KinematicsType",name:"kins",id:104,options:{default:"KT_JOINT"}},{rule:"optional",type:"int32",name:"axismask",id:105},{rule:"optional",type:"int32",name:"g5_index",id:106},{rule:"optional",type:"int32",name:"pocket",id:107},{rule:"optional",type:"SourceType",name:"stype",id:110},{rule:"optional",type:"string",name:"filename",id:111},{rule:"optional",type:"string",name:"cmdstring",id:112},{rule:"optional",type:"int32",name:"call_level",id:113}]},{name:"EmcToolData",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1100},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"id",id:2},{rule:"optional",type:"double",name:"diameter",id:12},{rule:"optional",type:"double",name:"frontangle",id:13},{rule:"optional",type:"double",name:"backangle",id:14},{rule:"optional",type:"int32",name:"orientation",id:15},{rule:"optional",type:"Position",name:"offset",id:16},{rule:"optional",type:"string",name:"comment",id:17},{rule:"optional",type:"int32",name:"pocket",id:18}]},{name:"EmcStatusMotionAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1101},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"enabled",id:2},{rule:"optional",type:"bool",name:"fault",id:3},{rule:"optional",type:"double",name:"ferror_current",id:4},{rule:"optional",type:"double",name:"ferror_highmark",id:5},{rule:"optional",type:"bool",name:"homed",id:6},{rule:"optional",type:"bool",name:"homing",id:7},{rule:"optional",type:"bool",name:"inpos",id:8},{rule:"optional",type:"double",name:"input",id:9},{rule:"optional",type:"bool",name:"max_hard_limit",id:10},{rule:"optional",type:"bool",name:"max_soft_limit",id:11},{rule:"optional",type:"bool",name:"min_hard_limit",id:12},{rule:"optional",type:"bool",name:"min_soft_limit",id:13},{rule:"optional",type:"double",name:"output",id:14},{rule:"optional",type:"bool",name:"override_limits",id:15},{rule:"optional",type:"double",name:"velocity",id:16}]},{name:"EmcStatusConfigAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1102},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"EmcAxisType",name:"axis_type",id:2},{rule:"optional",type:"double",name:"backlash",id:3},{rule:"optional",type:"double",name:"max_ferror",id:4},{rule:"optional",type:"double",name:"max_position_limit",id:5},{rule:"optional",type:"double",name:"min_ferror",id:6},{rule:"optional",type:"double",name:"min_position_limit",id:7},{rule:"optional",type:"int32",name:"home_sequence",id:9},{rule:"optional",type:"double",name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"string",name:"increments",id:12}]},{name:"EmcProgramExtension",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1103},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"extension",id:2}]},{name:"EmcStatusAnalogIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1104},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusDigitalIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1105},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"value",id:2}]},{name:"EmcStatusLimit",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1106},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusGCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1107},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusMCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1108},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusSetting",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1109},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusConfig",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1110},fields:[{rule:"optional",type:"double",name:"default_acceleration",id:1},{rule:"optional",type:"int32",name:"axes",id:3},{rule:"repeated",type:"EmcStatusConfigAxis",name:"axis",id:4},{rule:"optional",type:"int32",name:"axis_mask",id:5},{rule:"optional",type:"double",name:"cycle_time",id:6},{rule:"optional",type:"int32",name:"debug",id:7},{rule:"optional",type:"EmcKinematicsType",name:"kinematics_type",id:8},{rule:"optional",type:"double",
+name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"EmcLinearUnitsType",name:"linear_units",id:12},{rule:"optional",type:"double",name:"default_velocity",id:13},{rule:"repeated",type:"EmcProgramExtension",name:"program_extension",id:14},{rule:"optional",type:"EmcPositionOffsetType",name:"position_offset",id:15},{rule:"optional",type:"EmcPositionFeedbackType",name:"position_feedback",id:16},{rule:"optional",type:"double",name:"max_feed_override",id:17},{rule:"optional",type:"double",name:"min_feed_override",id:18},{rule:"optional",type:"double",name:"max_spindle_override",id:19},{rule:"optional",type:"double",name:"min_spindle_override",id:20},{rule:"optional",type:"double",name:"default_spindle_speed",id:21},{rule:"optional",type:"double",name:"default_linear_velocity",id:22},{rule:"optional",type:"double",name:"min_velocity",id:23},{rule:"optional",type:"double",name:"max_linear_velocity",id:24},{rule:"optional",type:"double",name:"min_linear_velocity",id:25},{rule:"optional",type:"double",name:"default_angular_velocity",id:26},{rule:"optional",type:"double",name:"max_angular_velocity",id:27},{rule:"optional",type:"double",name:"min_angular_velocity",id:28},{rule:"optional",type:"string",name:"increments",id:29},{rule:"optional",type:"string",name:"grids",id:30},{rule:"optional",type:"bool",name:"lathe",id:31},{rule:"optional",type:"string",name:"geometry",id:32},{rule:"optional",type:"uint32",name:"arcdivision",id:33},{rule:"optional",type:"bool",name:"no_force_homing",id:34},{rule:"optional",type:"string",name:"remote_path",id:35},{rule:"optional",type:"EmcTimeUnitsType",name:"time_units",id:36},{rule:"optional",type:"string",name:"name",id:37},{rule:"repeated",type:"EmcStatusUserCommand",name:"user_command",id:38},{rule:"optional",type:"EmcAngularUnitsType",name:"angular_units",id:39}]},{name:"EmcStatusMotion",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1111},fields:[{rule:"optional",type:"int32",name:"active_queue",id:1},{rule:"optional",type:"Position",name:"actual_position",id:2},{rule:"optional",type:"bool",name:"adaptive_feed_enabled",id:3},{rule:"repeated",type:"EmcStatusAnalogIO",name:"ain",id:4},{rule:"repeated",type:"EmcStatusAnalogIO",name:"aout",id:5},{rule:"repeated",type:"EmcStatusMotionAxis",name:"axis",id:6},{rule:"optional",type:"bool",name:"block_delete",id:7},{rule:"optional",type:"int32",name:"current_line",id:8},{rule:"optional",type:"double",name:"current_vel",id:9},{rule:"optional",type:"double",name:"delay_left",id:10},{rule:"repeated",type:"EmcStatusDigitalIO",name:"din",id:11},{rule:"optional",type:"double",name:"distance_to_go",id:12},{rule:"repeated",type:"EmcStatusDigitalIO",name:"dout",id:13},{rule:"optional",type:"Position",name:"dtg",id:14},{rule:"optional",type:"bool",name:"enabled",id:15},{rule:"optional",type:"bool",name:"feed_hold_enabled",id:16},{rule:"optional",type:"bool",name:"feed_override_enabled",id:17},{rule:"optional",type:"double",name:"feedrate",id:18},{rule:"optional",type:"OriginIndex",name:"g5x_index",id:19},{rule:"optional",type:"Position",name:"g5x_offset",id:20},{rule:"optional",type:"Position",name:"g92_offset",id:21},{rule:"optional",type:"int32",name:"id",id:23},{rule:"optional",type:"bool",name:"inpos",id:24},{rule:"optional",type:"Position",name:"joint_actual_position",id:25},{rule:"optional",type:"Position",name:"joint_position",id:26},{rule:"repeated",type:"EmcStatusLimit",name:"limit",id:27},{rule:"optional",type:"int32",name:"motion_line",id:28},{rule:"optional",type:"MotionType",name:"motion_type",id:29},{rule:"optional",type:"EmcTrajectoryModeType",name:"motion_mode",id:30},{rule:"optional",type:"bool",name:"paused",id:31},{rule:"optional",type:"Position",name:"position",id:32},{rule:"optional",type:"bool",name:"probe_tripped",id:33},{rule:"optional",type:"int32",name:"probe_val",id:34},{rule:"optional",type:"Position",name:"probed_position",id:35},{rule:"optional",type:"bool",name:"probing",id:36},{rule:"optional",type:"int32",name:"queue",id:37},{rule:"optional",type:"bool",name:"queue_full",id:38},{rule:"optional",type:"double",name:"rotation_xy",id:39},{rule:"optional",type:"bool",name:"spindle_brake",id:40},{rule:"optional",type:"int32",name:"spindle_direction",id:41},{rule:"optional",type:"bool",name:"spindle_enabled",id:42},{rule:"optional",type:"int32",name:"spindle_increasing",id:43},{rule:"optional",type:"bool",name:"spindle_override_enabled",id:44},{rule:"optional",type:"double",name:"spindle_speed",id:45},{rule:"optional",type:"double",name:"spindlerate",id:46},{rule:"optional",type:"RCS_STATUS",name:"state",id:47},{rule:"optional",type:"double",name:"max_velocity",id:48},{rule:"optional",type:"double",name:"max_acceleration",id:49},{rule:"optional",type:"double",name:"rapidrate",id:50}]},{name:"EmcStatusIo",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1112},fields:[{rule:"optional",type:"bool",name:"estop",id:1},{rule:"optional",type:"bool",name:"flood",id:2},{rule:"optional",type:"bool",name:"lube",id:3},{rule:"optional",type:"bool",name:"lube_level",id:4},{rule:"optional",type:"bool",name:"mist",id:5},{rule:"optional",type:"Position",name:"tool_offset",id:8},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:9},{rule:"optional",type:"int32",name:"pocket_prepped",id:10},{rule:"optional",type:"int32",name:"tool_in_spindle",id:11}]},{name:"EmcStatusTask",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1113},fields:[{rule:"optional",type:"int32",name:"echo_serial_number",id:1},{rule:"optional",type:"EmcTaskExecStateType",name:"exec_state",id:2},{rule:"optional",type:"string",name:"file",id:3},{rule:"optional",type:"bool",name:"input_timeout",id:4},{rule:"optional",type:"bool",name:"optional_stop",id:5},{rule:"optional",type:"int32",name:"read_line",id:6},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:7},{rule:"optional",type:"int32",name:"task_paused",id:8},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:9},{rule:"optional",type:"int32",name:"total_lines",id:10}]},{name:"EmcStatusInterp",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1114},fields:[{rule:"optional",type:"string",name:"command",id:1},{rule:"repeated",type:"EmcStatusGCode",name:"gcodes",id:2},{rule:"optional",type:"EmcInterpStateType",name:"interp_state",id:3},{rule:"optional",type:"EmcInterpExitCodeType",name:"interpreter_errcode",id:4},{rule:"repeated",type:"EmcStatusMCode",name:"mcodes",id:5},{rule:"repeated",type:"EmcStatusSetting",name:"settings",id:6},{rule:"optional",type:"EmcCanonUnitsType",name:"program_units",id:7}]},{name:"EmcCommandParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1115},fields:[{rule:"optional",type:"uint32",name:"index",id:1},{rule:"optional",type:"uint32",name:"debug_level",id:2},{rule:"optional",type:"int32",name:"line_number",id:3},{rule:"optional",type:"double",name:"scale",id:4},{rule:"optional",type:"double",name:"velocity",id:5},{rule:"optional",type:"double",name:"distance",id:6},{rule:"optional",type:"double",name:"value",id:7},{rule:"optional",type:"bool",name:"enable",id:8},{rule:"optional",type:"string",name:"command",id:9},{rule:"optional",type:"string",name:"path",id:10},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:100},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:101},{rule:"optional",type:"EmcTrajectoryModeType",name:"traj_mode",id:102},{rule:"optional",type:"EmcPose",name:"pose",id:103},{rule:"optional",type:"EmcToolData",name:"tool_data",id:104},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:105}]},{name:"EmcStatusUserCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1116},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"command",id:2}]},{name:"EmcStatusUI",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1117},fields:[{rule:"optional",type:"bool",name:"spindle_brake_visible",id:1},{rule:"optional",type:"bool",name:"spindle_cw_visible",id:2},{rule:"optional",type:"bool",name:"spindle_ccw_visible",id:3},{rule:"optional",type:"bool",name:"spindle_stop_visible",id:4},{rule:"optional",type:"bool",name:"spindle_plus_visible",id:5},{rule:"optional",type:"bool",name:"spindle_minus_visible",id:6},{rule:"optional",type:"bool",name:"spindle_override_visible",id:7},{rule:"optional",type:"bool",name:"coolant_flood_visible",id:8},{rule:"optional",type:"bool",name:"coolant_mist_visible",id:9}]},{name:"Container",syntax:"proto2",options:{"(nanopb_msgopt).msgid":500},fields:[{rule:"required",type:"ContainerType",name:"type",id:1},{rule:"optional",type:"sfixed64",name:"tsc",id:7},{rule:"repeated",type:"Preview",name:"preview",id:8,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"MotionCommand",name:"motcmd",id:9},{rule:"optional",type:"MotionStatus",name:"motstat",id:10},{rule:"optional",type:"bytes",name:"legacy_motcmd",id:11,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bytes",name:"legacy_motstat",id:12,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"RTAPI_Message",name:"rtapi_message",id:13},{rule:"optional",type:"TaskReply",name:"task_reply",id:14,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TicketUpdate",name:"ticket_update",id:15},{rule:"optional",type:"bytes",name:"syslog",id:18,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bytes",name:"legacy_nml",id:19,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bytes",name:"legacy_motconfig",id:20,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"int32",name:"tv_sec",id:21},{rule:"optional",type:"int32",name:"tv_nsec",id:22},{rule:"optional",type:"string",name:"topic",id:23},{rule:"optional",type:"bool",name:"reply_required",id:24},{rule:"optional",type:"InterpreterStateType",name:"interp_state",id:25,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"string",name:"interp_name",id:26},{rule:"optional",type:"int32",name:"rsvp",id:30},{rule:"optional",type:"ContainerType",name:"in_reply_to",id:33},{rule:"optional",type:"RCS_STATUS",name:"rcs_status",id:35},{rule:"optional",type:"StatusType",name:"status",id:40},{rule:"optional",type:"int32",name:"serial",id:45},{rule:"optional",type:"int32",name:"reply_serial",id:50},{rule:"optional",type:"int32",name:"ticket",id:55},{rule:"optional",type:"int32",name:"reply_ticket",id:60},{rule:"optional",type:"int32",name:"sequence",id:62},{rule:"optional",type:"int32",name:"credit",id:65},{rule:"optional",type:"int32",name:"line_number",id:66},{rule:"optional",type:"string",name:"name",id:67,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"string",name:"note",id:68},{rule:"optional",type:"int32",name:"retcode",id:69},{rule:"optional",type:"bytes",name:"uuid",id:72,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bool",name:"trace",id:75},{rule:"optional",type:"int32",name:"instance",id:77},{rule:"repeated",type:"Value",name:"value",id:85,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"RTAPICommand",name:"rtapicmd",id:86,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"ServiceAnnouncement",name:"service_announcement",id:88,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Component",name:"comp",id:100,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Pin",name:"pin",id:2,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Signal",name:"signal",id:3,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Param",name:"param",id:103,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Thread",name:"thread",id:104,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Ring",name:"ring",id:105,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Group",name:"group",id:106,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Member",name:"member",id:107,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Function",name:"function",id:108,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"ProtocolParameters",name:"pparams",id:109,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Vtable",name:"vtable",id:110,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Inst",name:"inst",id:111,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"fixed32",name:"packed_handle",id:112,options:{packed:!0,"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"bytes",name:"packed",id:113,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Application",name:"app",id:120,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"repeated",type:"Launcher",name:"launcher",id:130,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"int32",name:"index",id:131,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"LogMessage",name:"log_message",id:87,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanExecute",name:"tpexecute",id:200,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanBlockDelete",name:"tpblockdelete",id:201,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanOptionalStop",name:"tpoptionalstop",id:202,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanOpen",name:"tpopen",id:203,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"TaskPlanReply",name:"taskplan_reply",id:210,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"Emc_Traj_Set_G5x",name:"traj_set_g5x",id:300},{rule:"optional",type:"Emc_Traj_Set_G92",name:"traj_set_g92",id:310},{rule:"optional",type:"Emc_Traj_Set_Rotation",name:"traj_set_rotation",id:320},{rule:"optional",type:"Emc_Traj_Linear_Move",name:"traj_linear_move",id:330},{rule:"optional",type:"Emc_Traj_Probe",name:"traj_probe",id:340},{rule:"optional",type:"Emc_Traj_Circular_Move",name:"traj_circular_move",id:350},{rule:"optional",type:"Emc_Traj_Rigid_Tap",name:"traj_rigid_tap",id:360},{rule:"optional",type:"Emc_Traj_Set_Term_Cond",name:"traj_set_term_cond",id:370},{rule:"optional",type:"Emc_Traj_Set_Spindlesync",name:"traj_set_spindlesync",id:380},{rule:"optional",type:"Emc_Traj_Delay",name:"traj_delay",id:390},{rule:"optional",type:"Emc_Spindle_On",name:"spindle_on",id:400},{rule:"optional",type:"Emc_Spindle_Speed",name:"spindle_speed",id:410},{rule:"optional",type:"Emc_Spindle_Orient",name:"spindle_orient",id:420},{rule:"optional",type:"Emc_Spindle_Wait_Orient_Complete",name:"spindle_wait_orient_complete",id:430},{rule:"optional",type:"Emc_Tool_Set_Offset",name:"tool_set_offet",id:440},{rule:"optional",type:"Emc_Traj_Set_Offset",name:"traj_set_offset",id:450},{rule:"optional",type:"Emc_Tool_Prepare",name:"tool_prepare",id:460},{rule:"optional",type:"Emc_Tool_Set_Number",name:"tool_set_number",id:470},{rule:"optional",type:"Emc_Traj_Set_Fo_Enable",name:"traj_set_fo_enable",id:480},{rule:"optional",type:"Emc_Traj_Set_So_Enable",name:"traj_set_so_enable",id:490},{rule:"optional",type:"Emc_Traj_Set_Fh_Enable",name:"traj_set_fh_enable",id:500},{rule:"optional",type:"Emc_Motion_Adaptive",name:"motion_adaptive",id:510},{rule:"optional",type:"Emc_Operator_Display",name:"operator_display",id:520},{rule:"optional",type:"Emc_Operator_Text",name:"operator_text",id:530},{rule:"optional",type:"Emc_Operator_Error",name:"operator_error",id:540},{rule:"optional",type:"Emc_Motion_Set_Dout",name:"motion_set_dout",id:550},{rule:"optional",type:"Emc_Motion_Set_Aout",name:"motion_set_aout",id:560},{rule:"optional",type:"Emc_Aux_Input_Wait",name:"aux_input_wait",id:570},{rule:"optional",type:"Emc_Exec_Plugin_Ca1l",name:"exec_plugin_call",id:580},{rule:"optional",type:"Emc_Io_Plugin_Call",name:"io_plugin_call",id:590},{rule:"optional",type:"EmcStatusConfig",name:"emc_status_config",id:600,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusMotion",name:"emc_status_motion",id:601,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusIo",name:"emc_status_io",id:602,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusTask",name:"emc_status_task",id:603,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusInterp",name:"emc_status_interp",id:604,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcStatusUI",name:"emc_status_ui",id:605,options:{"(nanopb).type":"FT_IGNORE"}},{rule:"optional",type:"EmcCommandParameters",name:"emc_command_params",id:610,options:{"(nanopb).type":"FT_IGNORE"}}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{
+name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]},{name:"MotionType",syntax:"proto2",values:[{name:"_EMC_MOTION_TYPE_NONE",id:0},{name:"_EMC_MOTION_TYPE_TRAVERSE",id:1},{name:"_EMC_MOTION_TYPE_FEED",id:2},{name:"_EMC_MOTION_TYPE_ARC",id:3},{name:"_EMC_MOTION_TYPE_TOOLCHANGE",id:4},{name:"_EMC_MOTION_TYPE_PROBING",id:5},{name:"_EMC_MOTION_TYPE_INDEXROTARY",id:6}]},{name:"cmd_code_t",syntax:"proto2",values:[{name:"EMCMOT_ABORT",id:4e3},{name:"EMCMOT_AXIS_ABORT",id:4001},{name:"EMCMOT_ENABLE",id:4002},{name:"EMCMOT_DISABLE",id:4003},{name:"EMCMOT_ENABLE_AMPLIFIER",id:4004},{name:"EMCMOT_DISABLE_AMPLIFIER",id:4005},{name:"EMCMOT_ENABLE_WATCHDOG",id:4006},{name:"EMCMOT_DISABLE_WATCHDOG",id:4007},{name:"EMCMOT_ACTIVATE_JOINT",id:4008},{name:"EMCMOT_DEACTIVATE_JOINT",id:4009},{name:"EMCMOT_PAUSE",id:4010},{name:"EMCMOT_RESUME",id:4011},{name:"EMCMOT_STEP",id:4012},{name:"EMCMOT_FREE",id:4013},{name:"EMCMOT_COORD",id:4014},{name:"EMCMOT_TELEOP",id:4015},{name:"EMCMOT_SPINDLE_SCALE",id:4016},{name:"EMCMOT_SS_ENABLE",id:4017},{name:"EMCMOT_FEED_SCALE",id:4018},{name:"EMCMOT_FS_ENABLE",id:4019},{name:"EMCMOT_FH_ENABLE",id:4020},{name:"EMCMOT_AF_ENABLE",id:4021},{name:"EMCMOT_OVERRIDE_LIMITS",id:4022},{name:"EMCMOT_HOME",id:4023},{name:"EMCMOT_UNHOME",id:4024},{name:"EMCMOT_JOG_CONT",id:4025},{name:"EMCMOT_JOG_INCR",id:4026},{name:"EMCMOT_JOG_ABS",id:4027},{name:"EMCMOT_SET_LINE",id:4028},{name:"EMCMOT_SET_CIRCLE",id:4029},{name:"EMCMOT_SET_TELEOP_VECTOR",id:4030},{name:"EMCMOT_CLEAR_PROBE_FLAGS",id:4031},{name:"EMCMOT_PROBE",id:4032},{name:"EMCMOT_RIGID_TAP",id:4033},{name:"EMCMOT_SET_POSITION_LIMITS",id:4034},{name:"EMCMOT_SET_BACKLASH",id:4035},{name:"EMCMOT_SET_MIN_FERROR",id:4036},{name:"EMCMOT_SET_MAX_FERROR",id:4037},{name:"EMCMOT_SET_VEL",id:4038},{name:"EMCMOT_SET_VEL_LIMIT",id:4039},{name:"EMCMOT_SET_JOINT_VEL_LIMIT",id:4040},{name:"EMCMOT_SET_JOINT_ACC_LIMIT",id:4041},{name:"EMCMOT_SET_ACC",id:4042},{name:"EMCMOT_SET_TERM_COND",id:4043},{name:"EMCMOT_SET_NUM_AXES",id:4044},{name:"EMCMOT_SET_WORLD_HOME",id:4045},{name:"EMCMOT_SET_HOMING_PARAMS",id:4046},{name:"EMCMOT_SET_DEBUG",id:4047},{name:"EMCMOT_SET_DOUT",id:4048},{name:"EMCMOT_SET_AOUT",id:4049},{name:"EMCMOT_SET_SPINDLESYNC",id:4050},{name:"EMCMOT_SPINDLE_ON",id:4051},{name:"EMCMOT_SPINDLE_OFF",id:4052},{name:"EMCMOT_SPINDLE_INCREASE",id:4053},{name:"EMCMOT_SPINDLE_DECREASE",id:4054},{name:"EMCMOT_SPINDLE_BRAKE_ENGAGE",id:4055},{name:"EMCMOT_SPINDLE_BRAKE_RELEASE",id:4056},{name:"EMCMOT_SET_MOTOR_OFFSET",id:4057},{name:"EMCMOT_SET_JOINT_COMP",id:4058},{name:"EMCMOT_SET_OFFSET",id:4059}]},{name:"cmd_status_t",syntax:"proto2",values:[{name:"EMCMOT_COMMAND_OK",id:0},{name:"EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1},{name:"EMCMOT_COMMAND_INVALID_COMMAND",id:2},{name:"EMCMOT_COMMAND_INVALID_PARAMS",id:3},{name:"EMCMOT_COMMAND_BAD_EXEC",id:4}]},{name:"ApplicationType",syntax:"proto2",values:[{name:"QT5_QML",id:1},{name:"GLADEVCP",id:2},{name:"JAVASCRIPT",id:3}]},{name:"FileContent",syntax:"proto2",values:[{name:"CLEARTEXT",id:1},{name:"ZLIB",id:2}]},{name:"KinematicsType",syntax:"proto2",values:[{name:"KT_JOINT",id:1},{name:"KT_TRIVKINS",id:2},{name:"KT_DELTA",id:3}]},{name:"PreviewOpType",syntax:"proto2",values:[{name:"PV_STRAIGHT_PROBE",id:1},{name:"PV_RIGID_TAP",id:2},{name:"PV_STRAIGHT_FEED",id:3},{name:"PV_ARC_FEED",id:4},{name:"PV_STRAIGHT_TRAVERSE",id:5},{name:"PV_SET_G5X_OFFSET",id:6},{name:"PV_SET_G92_OFFSET",id:7},{name:"PV_SET_XY_ROTATION",id:8},{name:"PV_SELECT_PLANE",id:9},{name:"PV_SET_TRAVERSE_RATE",id:10},{name:"PV_SET_FEED_RATE",id:11},{name:"PV_CHANGE_TOOL",id:12},{name:"PV_CHANGE_TOOL_NUMBER",id:13},{name:"PV_DWELL",id:14},{name:"PV_MESSAGE",id:15},{name:"PV_COMMENT",id:16},{name:"PV_USE_TOOL_OFFSET",id:17},{name:"PV_SET_PARAMS",id:18},{name:"PV_SET_FEED_MODE",id:19},{name:"PV_SOURCE_CONTEXT",id:20},{name:"PV_PREVIEW_START",id:21},{name:"PV_PREVIEW_END",id:22}]},{name:"SourceType",syntax:"proto2",values:[{name:"ST_NGC_FILE",id:1},{name:"ST_NGC_STRING",id:2},{name:"ST_PYTHON_METHOD",id:3}]},{name:"EmcTaskExecStateType",syntax:"proto2",values:[{name:"EMC_TASK_EXEC_ERROR",id:1},{name:"EMC_TASK_EXEC_DONE",id:2},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION",id:3},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_QUEUE",id:4},{name:"EMC_TASK_EXEC_WAITING_FOR_IO",id:5},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_AND_IO",id:7},{name:"EMC_TASK_EXEC_WAITING_FOR_DELAY",id:8},{name:"EMC_TASK_EXEC_WAITING_FOR_SYSTEM_CMD",id:9},{name:"EMC_TASK_EXEC_WAITING_FOR_SPINDLE_ORIENTED",id:10}]},{name:"EmcInterpStateType",syntax:"proto2",values:[{name:"EMC_TASK_INTERP_IDLE",id:1},{name:"EMC_TASK_INTERP_READING",id:2},{name:"EMC_TASK_INTERP_PAUSED",id:3},{name:"EMC_TASK_INTERP_WAITING",id:4}]},{name:"EmcInterpExitCodeType",syntax:"proto2",values:[{name:"EMC_INTERP_EXIT_OK",id:0},{name:"EMC_INTERP_EXIT_EXIT",id:1},{name:"EMC_INTERP_EXIT_EXECUTE_FINISH",id:2},{name:"EMC_INTERP_EXIT_ENDFILE",id:3},{name:"EMC_INTERP_EXIT_FILE_NOT_OPEN",id:4},{name:"EMC_INTERP_EXIT_ERROR",id:5}]},{name:"EmcKinematicsType",syntax:"proto2",values:[{name:"KINEMATICS_IDENTITY",id:1},{name:"KINEMATICS_FORWARD_ONLY",id:2},{name:"KINEMATICS_INVERSE_ONLY",id:3},{name:"KINEMATICS_BOTH",id:4}]},{name:"EmcTrajectoryModeType",syntax:"proto2",values:[{name:"EMC_TRAJ_MODE_FREE",id:1},{name:"EMC_TRAJ_MODE_COORD",id:2},{name:"EMC_TRAJ_MODE_TELEOP",id:3}]},{name:"EmcCanonUnitsType",syntax:"proto2",values:[{name:"CANON_UNITS_INCH",id:1},{name:"CANON_UNITS_MM",id:2},{name:"CANON_UNITS_CM",id:3}]},{name:"EmcLinearUnitsType",syntax:"proto2",values:[{name:"LINEAR_UNITS_INCH",id:1},{name:"LINEAR_UNITS_MM",id:2},{name:"LINEAR_UNITS_CM",id:3}]},{name:"EmcAngularUnitsType",syntax:"proto2",values:[{name:"ANGULAR_UNITS_DEGREES",id:1},{name:"ANGULAR_UNITS_RADIAN",id:2},{name:"ANGULAR_UNITS_GRAD",id:3}]},{name:"EmcTimeUnitsType",syntax:"proto2",values:[{name:"TIME_UNITS_MINUTE",id:1},{name:"TIME_UNITS_SECOND",id:2}]},{name:"EmcTaskModeType",syntax:"proto2",values:[{name:"EMC_TASK_MODE_MANUAL",id:1},{name:"EMC_TASK_MODE_AUTO",id:2},{name:"EMC_TASK_MODE_MDI",id:3}]},{name:"EmcTaskStateType",syntax:"proto2",values:[{name:"EMC_TASK_STATE_ESTOP",id:1},{name:"EMC_TASK_STATE_ESTOP_RESET",id:2},{name:"EMC_TASK_STATE_OFF",id:3},{name:"EMC_TASK_STATE_ON",id:4}]},{name:"EmcAxisType",syntax:"proto2",values:[{name:"EMC_AXIS_LINEAR",id:1},{name:"EMC_AXIS_ANGULAR",id:2}]},{name:"EmcPositionOffsetType",syntax:"proto2",values:[{name:"EMC_CONFIG_RELATIVE_OFFSET",id:1},{name:"EMC_CONFIG_MACHINE_OFFSET",id:2}]},{name:"EmcPositionFeedbackType",syntax:"proto2",values:[{name:"EMC_CONFIG_ACTUAL_FEEDBACK",id:1},{name:"EMC_CONFIG_COMMANDED_FEEDBACK",id:2}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],8:[function(require,module,exports){
 module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"MotionCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":600},fields:[{rule:"required",type:"cmd_code_t",name:"command",id:10},{rule:"required",type:"fixed32",name:"commandNum",id:20},{rule:"optional",type:"double",name:"motor_offset",id:30},{rule:"optional",type:"double",name:"maxLimit",id:40},{rule:"optional",type:"double",name:"minLimit",id:50},{rule:"optional",type:"EmcPose",name:"pos",id:60},{rule:"optional",type:"PmCartesian",name:"center",id:70},{rule:"optional",type:"PmCartesian",name:"normal",id:80},{rule:"optional",type:"fixed32",name:"turn",id:90},{rule:"optional",type:"double",name:"vel",id:100},{rule:"optional",type:"double",name:"ini_maxvel",id:110},{rule:"optional",type:"MotionType",name:"motion_type",id:120},{rule:"optional",type:"double",name:"spindlesync",id:130},{rule:"optional",type:"double",name:"acc",id:140},{rule:"optional",type:"double",name:"backlash",id:150},{rule:"optional",type:"fixed32",name:"id",id:160},{rule:"optional",type:"fixed32",name:"termCond",id:170},{rule:"optional",type:"double",name:"tolerance",id:180},{rule:"optional",type:"fixed32",name:"axis",id:190},{rule:"optional",type:"double",name:"scale",id:200},{rule:"optional",type:"double",name:"offset",id:210},{rule:"optional",type:"double",name:"home",id:220},{rule:"optional",type:"double",name:"home_final_vel",id:230},{rule:"optional",type:"double",name:"search_vel",id:240},{rule:"optional",type:"double",name:"latch_vel",id:250},{rule:"optional",type:"fixed32",name:"flags",id:260},{rule:"optional",type:"fixed32",name:"home_sequence",id:270},{rule:"optional",type:"fixed32",name:"volatile_home",id:280},{rule:"optional",type:"double",name:"minFerror",id:290},{rule:"optional",type:"double",name:"maxFerror",id:300},{rule:"optional",type:"fixed32",name:"wdWait",id:310},{rule:"optional",type:"fixed32",name:"debug",id:320},{rule:"optional",type:"int32",name:"now",id:330},{rule:"optional",type:"int32",name:"out",id:340},{rule:"optional",type:"int32",name:"start",id:350},{rule:"optional",type:"int32",name:"end",id:360},{rule:"optional",type:"int32",name:"mode",id:370},{rule:"optional",type:"double",name:"comp_nominal",id:380},{rule:"optional",type:"double",name:"comp_forward",id:390},{rule:"optional",type:"double",name:"comp_reverse",id:400},{rule:"optional",type:"int32",name:"probe_type",id:410},{rule:"optional",type:"EmcPose",name:"tool_offset",id:420}]},{name:"MotionStatus",syntax:"proto2",options:{"(nanopb_msgopt).msgid":601},fields:[{rule:"required",type:"cmd_code_t",name:"commandEcho",id:10},{rule:"required",type:"fixed32",name:"commandNumEcho",id:20},{rule:"required",type:"cmd_status_t",name:"commandStatus",id:30},{rule:"optional",type:"EmcPose",name:"carte_pos_fb",id:40}]}],enums:[{name:"MotionType",syntax:"proto2",values:[{name:"_EMC_MOTION_TYPE_NONE",id:0},{name:"_EMC_MOTION_TYPE_TRAVERSE",id:1},{name:"_EMC_MOTION_TYPE_FEED",id:2},{name:"_EMC_MOTION_TYPE_ARC",id:3},{name:"_EMC_MOTION_TYPE_TOOLCHANGE",id:4},{name:"_EMC_MOTION_TYPE_PROBING",id:5},{name:"_EMC_MOTION_TYPE_INDEXROTARY",id:6}]},{name:"cmd_code_t",syntax:"proto2",values:[{name:"EMCMOT_ABORT",id:4e3},{name:"EMCMOT_AXIS_ABORT",id:4001},{name:"EMCMOT_ENABLE",id:4002},{name:"EMCMOT_DISABLE",id:4003},{name:"EMCMOT_ENABLE_AMPLIFIER",id:4004},{name:"EMCMOT_DISABLE_AMPLIFIER",id:4005},{name:"EMCMOT_ENABLE_WATCHDOG",id:4006},{name:"EMCMOT_DISABLE_WATCHDOG",id:4007},{name:"EMCMOT_ACTIVATE_JOINT",id:4008},{name:"EMCMOT_DEACTIVATE_JOINT",id:4009},{name:"EMCMOT_PAUSE",id:4010},{name:"EMCMOT_RESUME",id:4011},{name:"EMCMOT_STEP",id:4012},{name:"EMCMOT_FREE",id:4013},{name:"EMCMOT_COORD",id:4014},{name:"EMCMOT_TELEOP",id:4015},{name:"EMCMOT_SPINDLE_SCALE",id:4016},{name:"EMCMOT_SS_ENABLE",id:4017},{name:"EMCMOT_FEED_SCALE",id:4018},{name:"EMCMOT_FS_ENABLE",id:4019},{name:"EMCMOT_FH_ENABLE",id:4020},{name:"EMCMOT_AF_ENABLE",id:4021},{name:"EMCMOT_OVERRIDE_LIMITS",id:4022},{name:"EMCMOT_HOME",id:4023},{name:"EMCMOT_UNHOME",id:4024},{name:"EMCMOT_JOG_CONT",id:4025},{name:"EMCMOT_JOG_INCR",id:4026},{name:"EMCMOT_JOG_ABS",id:4027},{name:"EMCMOT_SET_LINE",id:4028},{name:"EMCMOT_SET_CIRCLE",id:4029},{name:"EMCMOT_SET_TELEOP_VECTOR",id:4030},{name:"EMCMOT_CLEAR_PROBE_FLAGS",id:4031},{name:"EMCMOT_PROBE",id:4032},{name:"EMCMOT_RIGID_TAP",id:4033},{name:"EMCMOT_SET_POSITION_LIMITS",id:4034},{name:"EMCMOT_SET_BACKLASH",id:4035},{name:"EMCMOT_SET_MIN_FERROR",id:4036},{name:"EMCMOT_SET_MAX_FERROR",id:4037},{name:"EMCMOT_SET_VEL",id:4038},{name:"EMCMOT_SET_VEL_LIMIT",id:4039},{name:"EMCMOT_SET_JOINT_VEL_LIMIT",id:4040},{name:"EMCMOT_SET_JOINT_ACC_LIMIT",id:4041},{name:"EMCMOT_SET_ACC",id:4042},{name:"EMCMOT_SET_TERM_COND",id:4043},{name:"EMCMOT_SET_NUM_AXES",id:4044},{name:"EMCMOT_SET_WORLD_HOME",id:4045},{name:"EMCMOT_SET_HOMING_PARAMS",id:4046},{name:"EMCMOT_SET_DEBUG",id:4047},{name:"EMCMOT_SET_DOUT",id:4048},{name:"EMCMOT_SET_AOUT",id:4049},{name:"EMCMOT_SET_SPINDLESYNC",id:4050},{name:"EMCMOT_SPINDLE_ON",id:4051},{name:"EMCMOT_SPINDLE_OFF",id:4052},{name:"EMCMOT_SPINDLE_INCREASE",id:4053},{name:"EMCMOT_SPINDLE_DECREASE",id:4054},{name:"EMCMOT_SPINDLE_BRAKE_ENGAGE",id:4055},{name:"EMCMOT_SPINDLE_BRAKE_RELEASE",id:4056},{name:"EMCMOT_SET_MOTOR_OFFSET",id:4057},{name:"EMCMOT_SET_JOINT_COMP",id:4058},{name:"EMCMOT_SET_OFFSET",id:4059}]},{name:"cmd_status_t",syntax:"proto2",values:[{name:"EMCMOT_COMMAND_OK",id:0},{name:"EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1},{name:"EMCMOT_COMMAND_INVALID_COMMAND",id:2},{name:"EMCMOT_COMMAND_INVALID_PARAMS",id:3},{name:"EMCMOT_COMMAND_BAD_EXEC",id:4}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],9:[function(require,module,exports){
 module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],10:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Instance",syntax:"proto2",options:{"(nanopb_msgopt).msgid":700},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"id",id:2}]},{name:"ServiceAnnouncement",syntax:"proto2",options:{"(nanopb_msgopt).msgid":701},fields:[{rule:"required",type:"ServiceType",name:"stype",id:1},{rule:"required",type:"fixed32",name:"version",id:2,options:{default:0}},{rule:"required",type:"fixed32",name:"instance",id:3,options:{default:0}},{rule:"required",type:"ServiceAPI",name:"api",id:8},{rule:"required",type:"string",name:"uri",id:6},{rule:"optional",type:"string",name:"description",id:7}]},{name:"Originator",syntax:"proto2",options:{"(nanopb_msgopt).msgid":702},fields:[{rule:"optional",type:"OriginType",name:"origin",id:1},{rule:"optional",type:"OriginDetail",name:"detail",id:2},{rule:"optional",type:"string",name:"name",id:3},{rule:"optional",type:"sfixed32",name:"id",id:4},{rule:"optional",type:"Instance",name:"instance",id:5}]},{name:"AnError",syntax:"proto2",options:{"(nanopb_msgopt).msgid":703},fields:[{rule:"required",type:"sfixed32",name:"error_code",id:1},{rule:"optional",type:"Severity",name:"severity",id:2},{rule:"optional",type:"string",name:"error_text",id:3},{rule:"optional",type:"Originator",name:"origin",id:4}]},{name:"Pin",syntax:"proto2",options:{"(nanopb_msgopt).msgid":704},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"HalPinDirection",name:"dir",id:4},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"sfixed32",name:"owner",id:9},{rule:"optional",type:"bool",name:"linked",id:10},{rule:"optional",type:"string",name:"oldname",id:11},{rule:"optional",type:"double",name:"epsilon",id:12},{rule:"optional",type:"fixed32",name:"flags",id:13}]},{name:"Signal",syntax:"proto2",options:{"(nanopb_msgopt).msgid":705},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"fixed32",name:"readers",id:11},{rule:"optional",type:"fixed32",name:"writers",id:12},{rule:"optional",type:"fixed32",name:"bidirs",id:13}]},{name:"Param",syntax:"proto2",options:{"(nanopb_msgopt).msgid":706},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"HalParamDirection",name:"dir",id:11},{rule:"optional",type:"string",name:"oldname",id:12},{rule:"optional",type:"sfixed32",name:"owner",id:13},{rule:"optional",type:"sfixed32",name:"runtime",id:14},{rule:"optional",type:"sfixed32",name:"maytime",id:15}]},{name:"Function",syntax:"proto2",options:{"(nanopb_msgopt).msgid":707},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"fixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"users",id:4},{rule:"optional",type:"fixed32",name:"runtime",id:5},{rule:"optional",type:"fixed32",name:"maxtime",id:6},{rule:"optional",type:"bool",name:"reentrant",id:7},{rule:"optional",type:"HalFunctType",name:"type",id:8},{rule:"optional",type:"bool",name:"maxtime_increased",id:9}]},{name:"Thread",syntax:"proto2",options:{"(nanopb_msgopt).msgid":708},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"bool",name:"uses_fp",id:3},{rule:"optional",type:"fixed32",name:"period",id:4},{rule:"optional",type:"sfixed32",name:"priority",id:5},{rule:"optional",type:"fixed32",name:"task_id",id:6},{rule:"optional",type:"fixed32",name:"cpu_id",id:7},{rule:"repeated",type:"string",name:"function",id:8}]},{name:"Component",syntax:"proto2",options:{"(nanopb_msgopt).msgid":709},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"ninst",id:2},{rule:"optional",type:"sfixed32",name:"comp_id",id:4},{rule:"optional",type:"fixed32",name:"type",id:5},{rule:"optional",type:"fixed32",name:"state",id:6},{rule:"optional",type:"fixed32",name:"last_update",id:7},{rule:"optional",type:"fixed32",name:"last_bound",id:8},{rule:"optional",type:"fixed32",name:"last_unbound",id:9},{rule:"optional",type:"fixed32",name:"pid",id:10},{rule:"optional",type:"string",name:"args",id:11},{rule:"optional",type:"sfixed32",name:"timer",id:12},{rule:"optional",type:"sfixed32",name:"userarg1",id:14},{rule:"optional",type:"sfixed32",name:"userarg2",id:15},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19},{rule:"optional",type:"bool",name:"no_create",id:18}]},{name:"Ring",syntax:"proto2",options:{"(nanopb_msgopt).msgid":710},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner",id:3},{rule:"optional",type:"bool",name:"stream",id:4},{rule:"optional",type:"bool",name:"wmutex",id:5},{rule:"optional",type:"bool",name:"rmutex",id:6},{rule:"optional",type:"bool",name:"rtapi_shm",id:7},{rule:"optional",type:"sfixed32",name:"reader",id:8},{rule:"optional",type:"sfixed32",name:"writer",id:9},{rule:"optional",type:"sfixed32",name:"total_size",id:10},{rule:"optional",type:"sfixed32",name:"scratchpad",id:11},{rule:"optional",type:"sfixed32",name:"ring_shmkey",id:12},{rule:"optional",type:"fixed32",name:"encodings",id:13}]},{name:"Member",syntax:"proto2",options:{"(nanopb_msgopt).msgid":711},fields:[{rule:"optional",type:"ObjectType",name:"mtype",id:1},{rule:"optional",type:"sfixed32",name:"userarg1",id:2},{rule:"optional",type:"double",name:"epsilon",id:3},{rule:"optional",type:"Signal",name:"signal",id:4},{rule:"optional",type:"string",name:"groupname",id:5},{rule:"optional",type:"fixed32",name:"handle",id:6},{rule:"optional",type:"Pin",name:"pin",id:7},{rule:"optional",type:"Param",name:"param",id:8}]},{name:"Group",syntax:"proto2",options:{"(nanopb_msgopt).msgid":712},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"userarg1",id:4},{rule:"optional",type:"sfixed32",name:"userarg2",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"repeated",type:"Member",name:"member",id:7}]},{name:"ProtocolParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":713},fields:[{rule:"optional",type:"sfixed32",name:"keepalive_timer",id:1},{rule:"optional",type:"sfixed32",name:"group_timer",id:2},{rule:"optional",type:"sfixed32",name:"rcomp_timer",id:3}]},{name:"Vtable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":714},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"context",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"optional",type:"sfixed32",name:"version",id:7},{rule:"optional",type:"fixed64",name:"vtable",id:8}]},{name:"Inst",syntax:"proto2",options:{"(nanopb_msgopt).msgid":715},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"comp_id",id:2},{rule:"optional",type:"fixed32",name:"inst_id",id:3},{rule:"optional",type:"fixed32",name:"inst_size",id:4},{rule:"optional",type:"fixed64",name:"vtable",id:5},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Instance",syntax:"proto2",options:{"(nanopb_msgopt).msgid":700},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"id",id:2}]},{name:"ServiceAnnouncement",syntax:"proto2",options:{"(nanopb_msgopt).msgid":701},fields:[{rule:"required",type:"ServiceType",name:"stype",id:1},{rule:"required",type:"fixed32",name:"version",id:2,options:{default:0}},{rule:"required",type:"fixed32",name:"instance",id:3,options:{default:0}},{rule:"required",type:"ServiceAPI",name:"api",id:8},{rule:"required",type:"string",name:"uri",id:6},{rule:"optional",type:"string",name:"description",id:7}]},{name:"Originator",syntax:"proto2",options:{"(nanopb_msgopt).msgid":702},fields:[{rule:"optional",type:"OriginType",name:"origin",id:1},{rule:"optional",type:"OriginDetail",name:"detail",id:2},{rule:"optional",type:"string",name:"name",id:3},{rule:"optional",type:"sfixed32",name:"id",id:4},{rule:"optional",type:"Instance",name:"instance",id:5}]},{name:"AnError",syntax:"proto2",options:{"(nanopb_msgopt).msgid":703},fields:[{rule:"required",type:"sfixed32",name:"error_code",id:1},{rule:"optional",type:"Severity",name:"severity",id:2},{rule:"optional",type:"string",name:"error_text",id:3},{rule:"optional",type:"Originator",name:"origin",id:4}]},{name:"Pin",syntax:"proto2",options:{"(nanopb_msgopt).msgid":704},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"HalPinDirection",name:"dir",id:4},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"sfixed32",name:"owner",id:9},{rule:"optional",type:"bool",name:"linked",id:10},{rule:"optional",type:"string",name:"oldname",id:11},{rule:"optional",type:"double",name:"epsilon",id:12},{rule:"optional",type:"fixed32",name:"flags",id:13}]},{name:"Signal",syntax:"proto2",options:{"(nanopb_msgopt).msgid":705},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"fixed32",name:"readers",id:11},{rule:"optional",type:"fixed32",name:"writers",id:12},{rule:"optional",type:"fixed32",name:"bidirs",id:13}]},{name:"Param",syntax:"proto2",options:{"(nanopb_msgopt).msgid":706},fields:[{rule:"optional",type:"ValueType",name:"type",id:1},{rule:"optional",type:"string",name:"name",id:2},{rule:"optional",type:"fixed32",name:"handle",id:3},{rule:"optional",type:"bool",name:"halbit",id:5},{rule:"optional",type:"double",name:"halfloat",id:6},{rule:"optional",type:"sfixed32",name:"hals32",id:7},{rule:"optional",type:"fixed32",name:"halu32",id:8},{rule:"optional",type:"string",name:"strval",id:9},{rule:"optional",type:"bytes",name:"blob",id:10},{rule:"optional",type:"HalParamDirection",name:"dir",id:11},{rule:"optional",type:"string",name:"oldname",id:12},{rule:"optional",type:"sfixed32",name:"owner",id:13},{rule:"optional",type:"sfixed32",name:"runtime",id:14},{rule:"optional",type:"sfixed32",name:"maytime",id:15}]},{name:"Function",syntax:"proto2",options:{"(nanopb_msgopt).msgid":707},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"fixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"users",id:4},{rule:"optional",type:"fixed32",name:"runtime",id:5},{rule:"optional",type:"fixed32",name:"maxtime",id:6},{rule:"optional",type:"bool",name:"reentrant",id:7},{rule:"optional",type:"HalFunctType",name:"type",id:8},{rule:"optional",type:"bool",name:"maxtime_increased",id:9}]},{name:"ProfileStats",syntax:"proto2",options:{"(nanopb_msgopt).msgid":716},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed64",name:"count",id:2},{rule:"optional",type:"sfixed32",name:"min",id:3},{rule:"optional",type:"sfixed32",name:"max",id:4},{rule:"optional",type:"sfixed32",name:"mean",id:5},{rule:"optional",type:"sfixed32",name:"p50",id:6},{rule:"optional",type:"sfixed32",name:"p99",id:7},{rule:"optional",type:"sfixed32",name:"p999",id:8}]},{name:"Thread",syntax:"proto2",options:{"(nanopb_msgopt).msgid":708},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"bool",name:"uses_fp",id:3},{rule:"optional",type:"fixed32",name:"period",id:4},{rule:"optional",type:"sfixed32",name:"priority",id:5},{rule:"optional",type:"fixed32",name:"task_id",id:6},{rule:"optional",type:"fixed32",name:"cpu_id",id:7},{rule:"repeated",type:"string",name:"function",id:8},{rule:"optional",type:"ProfileStats",name:"runtime_profile",id:9},{rule:"optional",type:"ProfileStats",name:"jitter_profile",id:10},{rule:"optional",type:"fixed64",name:"overruns",id:11},{rule:"repeated",type:"ProfileStats",name:"function_profile",id:12}]},{name:"Component",syntax:"proto2",options:{"(nanopb_msgopt).msgid":709},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"ninst",id:2},{rule:"optional",type:"sfixed32",name:"comp_id",id:4},{rule:"optional",type:"fixed32",name:"type",id:5},{rule:"optional",type:"fixed32",name:"state",id:6},{rule:"optional",type:"fixed32",name:"last_update",id:7},{rule:"optional",type:"fixed32",name:"last_bound",id:8},{rule:"optional",type:"fixed32",name:"last_unbound",id:9},{rule:"optional",type:"fixed32",name:"pid",id:10},{rule:"optional",type:"string",name:"args",id:11},{rule:"optional",type:"sfixed32",name:"timer",id:12},{rule:"optional",type:"sfixed32",name:"userarg1",id:14},{rule:"optional",type:"sfixed32",name:"userarg2",id:15},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19},{rule:"optional",type:"bool",name:"no_create",id:18}]},{name:"Ring",syntax:"proto2",options:{"(nanopb_msgopt).msgid":710},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner",id:3},{rule:"optional",type:"bool",name:"stream",id:4},{rule:"optional",type:"bool",name:"wmutex",id:5},{rule:"optional",type:"bool",name:"rmutex",id:6},{rule:"optional",type:"bool",name:"rtapi_shm",id:7},{rule:"optional",type:"sfixed32",name:"reader",id:8},{rule:"optional",type:"sfixed32",name:"writer",id:9},{rule:"optional",type:"sfixed32",name:"total_size",id:10},{rule:"optional",type:"sfixed32",name:"scratchpad",id:11},{rule:"optional",type:"sfixed32",name:"ring_shmkey",id:12},{rule:"optional",type:"fixed32",name:"encodings",id:13}]},{name:"Member",syntax:"proto2",options:{"(nanopb_msgopt).msgid":711},fields:[{rule:"optional",type:"ObjectType",name:"mtype",id:1},{rule:"optional",type:"sfixed32",name:"userarg1",id:2},{rule:"optional",type:"double",name:"epsilon",id:3},{rule:"optional",type:"Signal",name:"signal",id:4},{rule:"optional",type:"string",name:"groupname",id:5},{rule:"optional",type:"fixed32",name:"handle",id:6},{rule:"optional",type:"Pin",name:"pin",id:7},{rule:"optional",type:"Param",name:"param",id:8}]},{name:"Group",syntax:"proto2",options:{"(nanopb_msgopt).msgid":712},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"userarg1",id:4},{rule:"optional",type:"sfixed32",name:"userarg2",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"repeated",type:"Member",name:"member",id:7}]},{name:"ProtocolParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":713},fields:[{rule:"optional",type:"sfixed32",name:"keepalive_timer",id:1},{rule:"optional",type:"sfixed32",name:"group_timer",id:2},{rule:"optional",type:"sfixed32",name:"rcomp_timer",id:3}]},{name:"Vtable",syntax:"proto2",options:{"(nanopb_msgopt).msgid":714},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"fixed32",name:"handle",id:2},{rule:"optional",type:"sfixed32",name:"owner_id",id:3},{rule:"optional",type:"fixed32",name:"context",id:5},{rule:"optional",type:"sfixed32",name:"refcount",id:6},{rule:"optional",type:"sfixed32",name:"version",id:7},{rule:"optional",type:"fixed64",name:"vtable",id:8}]},{name:"Inst",syntax:"proto2",options:{"(nanopb_msgopt).msgid":715},fields:[{rule:"optional",type:"string",name:"name",id:1},{rule:"optional",type:"sfixed32",name:"comp_id",id:2},{rule:"optional",type:"fixed32",name:"inst_id",id:3},{rule:"optional",type:"fixed32",name:"inst_size",id:4},{rule:"optional",type:"fixed64",name:"vtable",id:5},{rule:"repeated",type:"Pin",name:"pin",id:16},{rule:"repeated",type:"Param",name:"param",id:17},{rule:"repeated",type:"Function",name:"funct",id:19}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],11:[function(require,module,exports){
 module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Position",syntax:"proto2",options:{"(nanopb_msgopt).msgid":800},fields:[{rule:"optional",type:"double",name:"x",id:3},{rule:"optional",type:"double",name:"y",id:4},{rule:"optional",type:"double",name:"z",id:5},{rule:"optional",type:"double",name:"a",id:6},{rule:"optional",type:"double",name:"b",id:7},{rule:"optional",type:"double",name:"c",id:8},{rule:"optional",type:"double",name:"u",id:9},{rule:"optional",type:"double",name:"v",id:10},{rule:"optional",type:"double",name:"w",id:11}]},{name:"Preview",syntax:"proto2",options:{"(nanopb_msgopt).msgid":801},fields:[{rule:"required",type:"PreviewOpType",name:"type",id:1},{rule:"optional",type:"int32",name:"line_number",id:2},{rule:"optional",type:"Position",name:"pos",id:3},{rule:"optional",type:"double",name:"first_end",id:4},{rule:"optional",type:"double",name:"second_end",id:5},{rule:"optional",type:"double",name:"first_axis",id:6},{rule:"optional",type:"double",name:"second_axis",id:7},{rule:"optional",type:"int32",name:"rotation",id:8},{rule:"optional",type:"double",name:"axis_end_point",id:9},{rule:"optional",type:"double",name:"xy_rotation",id:10},{rule:"optional",type:"int32",name:"plane",id:11},{rule:"optional",type:"double",name:"rate",id:12},{rule:"optional",type:"int32",name:"feed_mode",id:13},{rule:"optional",type:"double",name:"time",id:14},{rule:"optional",type:"string",name:"text",id:15},{rule:"optional",type:"double",name:"angular_units",id:101},{rule:"optional",type:"double",name:"length_units",id:102},{rule:"optional",type:"int32",name:"probetype",id:103},{rule:"optional",type:"KinematicsType",name:"kins",id:104,options:{default:"KT_JOINT"}},{rule:"optional",type:"int32",name:"axismask",id:105},{rule:"optional",type:"int32",name:"g5_index",id:106},{rule:"optional",type:"int32",name:"pocket",id:107},{rule:"optional",type:"SourceType",name:"stype",id:110},{rule:"optional",type:"string",name:"filename",id:111},{rule:"optional",type:"string",name:"cmdstring",id:112},{rule:"optional",type:"int32",name:"call_level",id:113}]}],enums:[{name:"KinematicsType",syntax:"proto2",values:[{name:"KT_JOINT",id:1},{name:"KT_TRIVKINS",id:2},{name:"KT_DELTA",id:3}]},{name:"PreviewOpType",syntax:"proto2",values:[{name:"PV_STRAIGHT_PROBE",id:1},{name:"PV_RIGID_TAP",id:2},{name:"PV_STRAIGHT_FEED",id:3},{name:"PV_ARC_FEED",id:4},{name:"PV_STRAIGHT_TRAVERSE",id:5},{name:"PV_SET_G5X_OFFSET",id:6},{name:"PV_SET_G92_OFFSET",id:7},{name:"PV_SET_XY_ROTATION",id:8},{name:"PV_SELECT_PLANE",id:9},{name:"PV_SET_TRAVERSE_RATE",id:10},{name:"PV_SET_FEED_RATE",id:11},{name:"PV_CHANGE_TOOL",id:12},{name:"PV_CHANGE_TOOL_NUMBER",id:13},{name:"PV_DWELL",id:14},{name:"PV_MESSAGE",id:15},{name:"PV_COMMENT",id:16},{name:"PV_USE_TOOL_OFFSET",id:17},{name:"PV_SET_PARAMS",id:18},{name:"PV_SET_FEED_MODE",id:19},{name:"PV_SOURCE_CONTEXT",id:20},{name:"PV_PREVIEW_START",id:21},{name:"PV_PREVIEW_END",id:22}]},{name:"SourceType",syntax:"proto2",values:[{name:"ST_NGC_FILE",id:1},{name:"ST_NGC_STRING",id:2},{name:"ST_PYTHON_METHOD",id:3}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],12:[function(require,module,exports){
 module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Time",syntax:"proto2",options:{"(nanopb_msgopt).msgid":371},fields:[{rule:"optional",type:"uint32",name:"secs",id:1},{rule:"optional",type:"uint32",name:"nsecs",id:2}]},{name:"Header",syntax:"proto2",options:{"(nanopb_msgopt).msgid":372},fields:[{rule:"optional",type:"uint32",name:"seq",id:1},{rule:"optional",type:"Time",name:"stamp",id:2},{rule:"optional",type:"string",name:"frame_id",id:3,options:{"(nanopb).max_size":20}}]},{name:"JointTrajectoryPoint",syntax:"proto2",options:{"(nanopb_msgopt).msgid":373},fields:[{rule:"repeated",type:"double",name:"positions",id:1,options:{"(nanopb).max_count":10}},{rule:"repeated",type:"double",name:"velocities",id:2,options:{"(nanopb).max_count":10}},{rule:"repeated",type:"double",name:"accelerations",id:3,options:{"(nanopb).max_count":10}},{rule:"repeated",type:"double",name:"effort",id:4,options:{"(nanopb).max_count":10}},{rule:"optional",type:"double",name:"time_from_start",id:5},{rule:"optional",type:"double",name:"duration",id:7},{rule:"optional",type:"uint32",name:"serial",id:8}]},{name:"JointTrajectory",syntax:"proto2",options:{"(nanopb_msgopt).msgid":374},fields:[{rule:"optional",type:"Header",name:"header",id:1},{rule:"repeated",type:"string",name:"joint_names",id:2},{rule:"repeated",type:"JointTrajectoryPoint",name:"points",id:3}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],13:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"Value",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1500},fields:[{rule:"required",type:"ValueType",name:"type",id:10},{rule:"optional",type:"bool",name:"halbit",id:100},{rule:"optional",type:"double",name:"halfloat",id:101},{rule:"optional",type:"sfixed32",name:"hals32",id:102},{rule:"optional",type:"fixed32",name:"halu32",id:103},{rule:"optional",type:"bytes",name:"v_bytes",id:120},{rule:"optional",type:"sfixed32",name:"v_int32",id:130},{rule:"optional",type:"sfixed64",name:"v_int64",id:140},{rule:"optional",type:"fixed32",name:"v_uint32",id:150},{rule:"optional",type:"fixed64",name:"v_uint64",id:160},{rule:"optional",type:"double",name:"v_double",id:170},{rule:"optional",type:"string",name:"v_string",id:180,options:{"(nanopb).max_size":41}},{rule:"optional",type:"bool",name:"v_bool",id:190},{rule:"optional",type:"PmCartesian",name:"carte",id:200},{rule:"optional",type:"EmcPose",name:"pose",id:220}]},{name:"RTAPI_Message",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1e3},fields:[{rule:"required",type:"int32",name:"msglevel",id:10},{rule:"required",type:"string",name:"format",id:20,options:{default:"*** uninitialized ***","(nanopb).max_size":100}},{rule:"repeated",type:"Value",name:"arg",id:30,options:{"(nanopb).max_count":10}}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"Value",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1500},fields:[{rule:"required",type:"ValueType",name:"type",id:10},{rule:"optional",type:"bool",name:"halbit",id:100},{rule:"optional",type:"double",name:"halfloat",id:101},{rule:"optional",type:"sfixed32",name:"hals32",id:102},{rule:"optional",type:"fixed32",name:"halu32",id:103},{rule:"optional",type:"bytes",name:"v_bytes",id:120},{rule:"optional",type:"sfixed32",name:"v_int32",id:130},{rule:"optional",type:"sfixed64",name:"v_int64",id:140},{rule:"optional",type:"fixed32",name:"v_uint32",id:150},{rule:"optional",type:"fixed64",name:"v_uint64",id:160},{rule:"optional",type:"double",name:"v_double",id:170},{rule:"optional",type:"string",name:"v_string",id:180,options:{"(nanopb).max_size":41}},{rule:"optional",type:"bool",name:"v_bool",id:190},{rule:"optional",type:"PmCartesian",name:"carte",id:200},{rule:"optional",type:"EmcPose",name:"pose",id:220}]},{name:"RTAPI_Message",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1e3},fields:[{rule:"required",type:"int32",name:"msglevel",id:10},{rule:"required",type:"string",name:"format",id:20,options:{default:"*** uninitialized ***","(nanopb).max_size":100}},{rule:"repeated",type:"Value",name:"arg",id:30,options:{"(nanopb).max_count":10}}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],14:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"RTAPICommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":900},fields:[{rule:"required",type:"int32",name:"instance",id:1},{rule:"optional",type:"string",name:"modname",id:2},{rule:"optional",type:"int32",name:"rt_msglevel",id:3},{rule:"optional",type:"int32",name:"user_msglevel",id:4},{rule:"repeated",type:"string",name:"argv",id:5},{rule:"optional",type:"string",name:"threadname",id:6},{rule:"optional",type:"int32",name:"threadperiod",id:7},{rule:"optional",type:"bool",name:"use_fp",id:8},{rule:"optional",type:"int32",name:"cpu",id:9},{rule:"optional",type:"string",name:"comp",id:10},{rule:"optional",type:"string",name:"func",id:11},{rule:"optional",type:"string",name:"instname",id:12},{rule:"optional",type:"int32",name:"flags",id:13}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"RTAPICommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":900},fields:[{rule:"required",type:"int32",name:"instance",id:1},{rule:"optional",type:"string",name:"modname",id:2},{rule:"optional",type:"int32",name:"rt_msglevel",id:3},{rule:"optional",type:"int32",name:"user_msglevel",id:4},{rule:"repeated",type:"string",name:"argv",id:5},{rule:"optional",type:"string",name:"threadname",id:6},{rule:"optional",type:"int32",name:"threadperiod",id:7},{rule:"optional",type:"bool",name:"use_fp",id:8},{rule:"optional",type:"int32",name:"cpu",id:9},{rule:"optional",type:"string",name:"cgname",id:14},{rule:"optional",type:"int32",name:"workers",id:15},{rule:"optional",type:"string",name:"comp",id:10},{rule:"optional",type:"string",name:"func",id:11},{rule:"optional",type:"string",name:"instname",id:12},{rule:"optional",type:"int32",name:"flags",id:13}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],15:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Position",syntax:"proto2",options:{"(nanopb_msgopt).msgid":800},fields:[{rule:"optional",type:"double",name:"x",id:3},{rule:"optional",type:"double",name:"y",id:4},{rule:"optional",type:"double",name:"z",id:5},{rule:"optional",type:"double",name:"a",id:6},{rule:"optional",type:"double",name:"b",id:7},{rule:"optional",type:"double",name:"c",id:8},{rule:"optional",type:"double",name:"u",id:9},{rule:"optional",type:"double",name:"v",id:10},{rule:"optional",type:"double",name:"w",id:11}]},{name:"Preview",syntax:"proto2",options:{"(nanopb_msgopt).msgid":801},fields:[{rule:"required",type:"PreviewOpType",name:"type",id:1},{rule:"optional",type:"int32",name:"line_number",id:2},{rule:"optional",type:"Position",name:"pos",id:3},{rule:"optional",type:"double",name:"first_end",id:4},{rule:"optional",type:"double",name:"second_end",id:5},{rule:"optional",type:"double",name:"first_axis",id:6},{rule:"optional",type:"double",name:"second_axis",id:7},{rule:"optional",type:"int32",name:"rotation",id:8},{rule:"optional",type:"double",name:"axis_end_point",id:9},{rule:"optional",type:"double",name:"xy_rotation",id:10},{rule:"optional",type:"int32",name:"plane",id:11},{rule:"optional",type:"double",name:"rate",id:12},{rule:"optional",type:"int32",name:"feed_mode",id:13},{rule:"optional",type:"double",name:"time",id:14},{rule:"optional",type:"string",name:"text",id:15},{rule:"optional",type:"double",name:"angular_units",id:101},{rule:"optional",type:"double",name:"length_units",id:102},{rule:"optional",type:"int32",name:"probetype",id:103},{rule:"optional",type:"KinematicsType",name:"kins",id:104,options:{default:"KT_JOINT"}},{rule:"optional",type:"int32",name:"axismask",id:105},{rule:"optional",type:"int32",name:"g5_index",id:106},{rule:"optional",type:"int32",name:"pocket",id:107},{rule:"optional",type:"SourceType",name:"stype",id:110},{rule:"optional",type:"string",name:"filename",id:111},{rule:"optional",type:"string",name:"cmdstring",id:112},{rule:"optional",type:"int32",name:"call_level",id:113}]},{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"MotionCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":600},fields:[{rule:"required",type:"cmd_code_t",name:"command",id:10},{rule:"required",type:"fixed32",name:"commandNum",id:20},{rule:"optional",type:"double",name:"motor_offset",id:30},{rule:"optional",type:"double",name:"maxLimit",id:40},{rule:"optional",type:"double",name:"minLimit",id:50},{rule:"optional",type:"EmcPose",name:"pos",id:60},{rule:"optional",type:"PmCartesian",name:"center",id:70},{rule:"optional",type:"PmCartesian",name:"normal",id:80},{rule:"optional",type:"fixed32",name:"turn",id:90},{rule:"optional",type:"double",name:"vel",id:100},{rule:"optional",type:"double",name:"ini_maxvel",id:110},{rule:"optional",type:"MotionType",name:"motion_type",id:120},{rule:"optional",type:"double",name:"spindlesync",id:130},{rule:"optional",type:"double",name:"acc",id:140},{rule:"optional",type:"double",name:"backlash",id:150},{rule:"optional",type:"fixed32",name:"id",id:160},{rule:"optional",type:"fixed32",name:"termCond",id:170},{rule:"optional",type:"double",name:"tolerance",id:180},{rule:"optional",type:"fixed32",name:"axis",id:190},{rule:"optional",type:"double",name:"scale",id:200},{rule:"optional",type:"double",name:"offset",id:210},{rule:"optional",type:"double",name:"home",id:220},{rule:"optional",type:"double",name:"home_final_vel",id:230},{rule:"optional",type:"double",name:"search_vel",id:240},{rule:"optional",type:"double",name:"latch_vel",id:250},{rule:"optional",type:"fixed32",name:"flags",id:260},{rule:"optional",type:"fixed32",name:"home_sequence",id:270},{rule:"optional",type:"fixed32",name:"volatile_home",id:280},{rule:"optional",type:"double",name:"minFerror",id:290},{rule:"optional",type:"double",name:"maxFerror",id:300},{rule:"optional",type:"fixed32",name:"wdWait",id:310},{rule:"optional",type:"fixed32",name:"debug",id:320},{rule:"optional",type:"int32",name:"now",id:330},{rule:"optional",type:"int32",name:"out",id:340},{rule:"optional",type:"int32",name:"start",id:350},{rule:"optional",type:"int32",name:"end",id:360},{rule:"optional",type:"int32",name:"mode",id:370},{rule:"optional",type:"double",name:"comp_nominal",id:380},{rule:"optional",type:"double",name:"comp_forward",id:390},{rule:"optional",type:"double",name:"comp_reverse",id:400},{rule:"optional",type:"int32",name:"probe_type",id:410},{rule:"optional",type:"EmcPose",name:"tool_offset",id:420}]},{name:"MotionStatus",syntax:"proto2",options:{"(nanopb_msgopt).msgid":601},fields:[{rule:"required",type:"cmd_code_t",name:"commandEcho",id:10},{rule:"required",type:"fixed32",name:"commandNumEcho",id:20},{rule:"required",type:"cmd_status_t",name:"commandStatus",id:30},{rule:"optional",type:"EmcPose",name:"carte_pos_fb",id:40}]},{name:"EmcToolData",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1100},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"id",id:2},{rule:"optional",type:"double",name:"diameter",id:12},{rule:"optional",type:"double",name:"frontangle",id:13},{rule:"optional",type:"double",name:"backangle",id:14},{rule:"optional",type:"int32",name:"orientation",id:15},{rule:"optional",type:"Position",name:"offset",id:16},{rule:"optional",type:"string",name:"comment",id:17},{rule:"optional",type:"int32",name:"pocket",id:18}]},{name:"EmcStatusMotionAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1101},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"enabled",id:2},{rule:"optional",type:"bool",name:"fault",id:3},{rule:"optional",type:"double",name:"ferror_current",id:4},{rule:"optional",type:"double",name:"ferror_highmark",id:5},{rule:"optional",type:"bool",name:"homed",id:6},{rule:"optional",type:"bool",name:"homing",id:7},{rule:"optional",type:"bool",name:"inpos",id:8},{rule:"optional",type:"double",name:"input",id:9},{rule:"optional",type:"bool",name:"max_hard_limit",id:10},{rule:"optional",type:"bool",name:"max_soft_limit",id:11},{rule:"optional",type:"bool",name:"min_hard_limit",id:12},{rule:"optional",type:"bool",name:"min_soft_limit",id:13},{rule:"optional",type:"double",name:"output",id:14},{rule:"optional",type:"bool",name:"override_limits",id:15},{rule:"optional",type:"double",name:"velocity",id:16}]},{name:"EmcStatusConfigAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1102},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"EmcAxisType",name:"axis_type",id:2},{rule:"optional",type:"double",name:"backlash",id:3},{rule:"optional",type:"double",name:"max_ferror",id:4},{rule:"optional",type:"double",name:"max_position_limit",id:5},{rule:"optional",type:"double",name:"min_ferror",id:6},{rule:"optional",type:"double",name:"min_position_limit",id:7},{rule:"optional",type:"int32",name:"home_sequence",id:9},{rule:"optional",type:"double",name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"string",name:"increments",id:12}]},{name:"EmcProgramExtension",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1103},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"extension",id:2}]},{name:"EmcStatusAnalogIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1104},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusDigitalIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1105},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"value",id:2}]},{name:"EmcStatusLimit",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1106},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusGCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1107},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusMCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1108},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusSetting",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1109},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusConfig",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1110},fields:[{rule:"optional",type:"double",name:"default_acceleration",id:1},{rule:"optional",type:"int32",name:"axes",id:3},{rule:"repeated",type:"EmcStatusConfigAxis",name:"axis",id:4},{rule:"optional",type:"int32",name:"axis_mask",id:5},{rule:"optional",type:"double",name:"cycle_time",id:6},{rule:"optional",type:"int32",name:"debug",id:7},{rule:"optional",type:"EmcKinematicsType",name:"kinematics_type",id:8},{rule:"optional",type:"double",name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"EmcLinearUnitsType",name:"linear_units",id:12},{rule:"optional",type:"double",name:"default_velocity",id:13},{rule:"repeated",type:"EmcProgramExtension",name:"program_extension",id:14},{rule:"optional",type:"EmcPositionOffsetType",name:"position_offset",id:15},{rule:"optional",type:"EmcPositionFeedbackType",name:"position_feedback",id:16},{rule:"optional",type:"double",name:"max_feed_override",id:17},{rule:"optional",type:"double",name:"min_feed_override",id:18},{rule:"optional",type:"double",name:"max_spindle_override",id:19},{rule:"optional",type:"double",name:"min_spindle_override",id:20},{rule:"optional",type:"double",name:"default_spindle_speed",id:21},{rule:"optional",type:"double",name:"default_linear_velocity",id:22},{rule:"optional",type:"double",name:"min_velocity",id:23},{rule:"optional",type:"double",name:"max_linear_velocity",id:24},{rule:"optional",type:"double",name:"min_linear_velocity",id:25},{rule:"optional",type:"double",name:"default_angular_velocity",id:26},{rule:"optional",type:"double",name:"max_angular_velocity",id:27},{rule:"optional",type:"double",name:"min_angular_velocity",id:28},{rule:"optional",type:"string",name:"increments",id:29},{rule:"optional",type:"string",name:"grids",id:30},{rule:"optional",type:"bool",name:"lathe",id:31},{rule:"optional",type:"string",name:"geometry",id:32},{rule:"optional",type:"uint32",name:"arcdivision",id:33},{rule:"optional",type:"bool",name:"no_force_homing",id:34},{rule:"optional",type:"string",name:"remote_path",id:35},{rule:"optional",type:"EmcTimeUnitsType",name:"time_units",id:36},{rule:"optional",type:"string",name:"name",id:37},{rule:"repeated",type:"EmcStatusUserCommand",name:"user_command",id:38},{rule:"optional",type:"EmcAngularUnitsType",name:"angular_units",id:39}]},{name:"EmcStatusMotion",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1111},fields:[{rule:"optional",type:"int32",name:"active_queue",id:1},{rule:"optional",type:"Position",name:"actual_position",id:2},{rule:"optional",type:"bool",name:"adaptive_feed_enabled",id:3},{rule:"repeated",type:"EmcStatusAnalogIO",name:"ain",id:4},{rule:"repeated",type:"EmcStatusAnalogIO",name:"aout",id:5},{rule:"repeated",type:"EmcStatusMotionAxis",name:"axis",id:6},{rule:"optional",type:"bool",name:"block_delete",id:7},{rule:"optional",type:"int32",name:"current_line",id:8},{rule:"optional",type:"double",name:"current_vel",id:9},{rule:"optional",type:"double",name:"delay_left",id:10},{rule:"repeated",type:"EmcStatusDigitalIO",name:"din",id:11},{rule:"optional",type:"double",name:"distance_to_go",id:12},{rule:"repeated",type:"EmcStatusDigitalIO",name:"dout",id:13},{rule:"optional",type:"Position",name:"dtg",id:14},{rule:"optional",type:"bool",name:"enabled",id:15},{rule:"optional",type:"bool",name:"feed_hold_enabled",id:16},{rule:"optional",type:"bool",name:"feed_override_enabled",id:17},{rule:"optional",type:"double",name:"feedrate",id:18},{rule:"optional",type:"OriginIndex",name:"g5x_index",id:19},{rule:"optional",type:"Position",name:"g5x_offset",id:20},{rule:"optional",type:"Position",name:"g92_offset",id:21},{rule:"optional",type:"int32",name:"id",id:23},{rule:"optional",type:"bool",name:"inpos",id:24},{rule:"optional",type:"Position",name:"joint_actual_position",id:25},{rule:"optional",type:"Position",name:"joint_position",id:26},{rule:"repeated",type:"EmcStatusLimit",name:"limit",id:27},{rule:"optional",type:"int32",name:"motion_line",id:28},{rule:"optional",type:"MotionType",name:"motion_type",id:29},{rule:"optional",type:"EmcTrajectoryModeType",name:"motion_mode",id:30},{rule:"optional",type:"bool",name:"paused",id:31},{rule:"optional",type:"Position",name:"position",id:32},{rule:"optional",type:"bool",name:"probe_tripped",id:33},{rule:"optional",type:"int32",name:"probe_val",id:34},{rule:"optional",type:"Position",name:"probed_position",id:35},{rule:"optional",type:"bool",name:"probing",id:36},{rule:"optional",type:"int32",name:"queue",id:37},{rule:"optional",type:"bool",name:"queue_full",id:38},{rule:"optional",type:"double",name:"rotation_xy",id:39},{rule:"optional",type:"bool",name:"spindle_brake",id:40},{rule:"optional",type:"int32",name:"spindle_direction",id:41},{rule:"optional",type:"bool",name:"spindle_enabled",id:42},{rule:"optional",type:"int32",name:"spindle_increasing",id:43},{rule:"optional",type:"bool",name:"spindle_override_enabled",id:44},{rule:"optional",type:"double",name:"spindle_speed",id:45},{rule:"optional",type:"double",name:"spindlerate",id:46},{rule:"optional",type:"RCS_STATUS",name:"state",id:47},{rule:"optional",type:"double",name:"max_velocity",id:48},{rule:"optional",type:"double",name:"max_acceleration",id:49},{rule:"optional",type:"double",name:"rapidrate",id:50}]},{name:"EmcStatusIo",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1112},fields:[{rule:"optional",type:"bool",name:"estop",id:1},{rule:"optional",type:"bool",name:"flood",id:2},{rule:"optional",type:"bool",name:"lube",id:3},{rule:"optional",type:"bool",name:"lube_level",id:4},{rule:"optional",type:"bool",name:"mist",id:5},{rule:"optional",type:"Position",name:"tool_offset",id:8},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:9},{rule:"optional",type:"int32",name:"pocket_prepped",id:10},{rule:"optional",type:"int32",name:"tool_in_spindle",id:11}]},{name:"EmcStatusTask",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1113},fields:[{rule:"optional",type:"int32",name:"echo_serial_number",id:1},{rule:"optional",type:"EmcTaskExecStateType",name:"exec_state",id:2},{rule:"optional",type:"string",name:"file",id:3},{rule:"optional",type:"bool",name:"input_timeout",id:4},{rule:"optional",type:"bool",name:"optional_stop",id:5},{rule:"optional",type:"int32",name:"read_line",id:6},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:7},{rule:"optional",type:"int32",name:"task_paused",id:8},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:9},{rule:"optional",type:"int32",name:"total_lines",id:10}]},{name:"EmcStatusInterp",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1114},fields:[{rule:"optional",type:"string",name:"command",id:1},{rule:"repeated",type:"EmcStatusGCode",name:"gcodes",id:2},{rule:"optional",type:"EmcInterpStateType",name:"interp_state",id:3},{rule:"optional",type:"EmcInterpExitCodeType",name:"interpreter_errcode",id:4},{rule:"repeated",type:"EmcStatusMCode",name:"mcodes",id:5},{rule:"repeated",type:"EmcStatusSetting",name:"settings",id:6},{rule:"optional",type:"EmcCanonUnitsType",name:"program_units",id:7}]},{name:"EmcCommandParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1115},fields:[{rule:"optional",type:"uint32",name:"index",id:1},{rule:"optional",type:"uint32",name:"debug_level",id:2},{rule:"optional",type:"int32",name:"line_number",id:3},{rule:"optional",type:"double",name:"scale",id:4},{rule:"optional",type:"double",name:"velocity",id:5},{rule:"optional",type:"double",name:"distance",id:6},{rule:"optional",type:"double",name:"value",id:7},{rule:"optional",type:"bool",name:"enable",id:8},{rule:"optional",type:"string",name:"command",id:9},{rule:"optional",type:"string",name:"path",id:10},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:100},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:101},{rule:"optional",type:"EmcTrajectoryModeType",name:"traj_mode",id:102},{rule:"optional",type:"EmcPose",name:"pose",id:103},{rule:"optional",type:"EmcToolData",name:"tool_data",id:104},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:105}]},{name:"EmcStatusUserCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1116},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"command",id:2}]},{name:"EmcStatusUI",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1117},fields:[{rule:"optional",type:"bool",name:"spindle_brake_visible",id:1},{rule:"optional",type:"bool",name:"spindle_cw_visible",id:2},{rule:"optional",type:"bool",name:"spindle_ccw_visible",id:3},{rule:"optional",type:"bool",name:"spindle_stop_visible",id:4},{rule:"optional",type:"bool",name:"spindle_plus_visible",id:5},{rule:"optional",type:"bool",name:"spindle_minus_visible",id:6},{rule:"optional",type:"bool",name:"spindle_override_visible",id:7},{rule:"optional",type:"bool",name:"coolant_flood_visible",id:8},{rule:"optional",type:"bool",name:"coolant_mist_visible",id:9}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{
-name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]},{name:"KinematicsType",syntax:"proto2",values:[{name:"KT_JOINT",id:1},{name:"KT_TRIVKINS",id:2},{name:"KT_DELTA",id:3}]},{name:"PreviewOpType",syntax:"proto2",values:[{name:"PV_STRAIGHT_PROBE",id:1},{name:"PV_RIGID_TAP",id:2},{name:"PV_STRAIGHT_FEED",id:3},{name:"PV_ARC_FEED",id:4},{name:"PV_STRAIGHT_TRAVERSE",id:5},{name:"PV_SET_G5X_OFFSET",id:6},{name:"PV_SET_G92_OFFSET",id:7},{name:"PV_SET_XY_ROTATION",id:8},{name:"PV_SELECT_PLANE",id:9},{name:"PV_SET_TRAVERSE_RATE",id:10},{name:"PV_SET_FEED_RATE",id:11},{name:"PV_CHANGE_TOOL",id:12},{name:"PV_CHANGE_TOOL_NUMBER",id:13},{name:"PV_DWELL",id:14},{name:"PV_MESSAGE",id:15},{name:"PV_COMMENT",id:16},{name:"PV_USE_TOOL_OFFSET",id:17},{name:"PV_SET_PARAMS",id:18},{name:"PV_SET_FEED_MODE",id:19},{name:"PV_SOURCE_CONTEXT",id:20},{name:"PV_PREVIEW_START",id:21},{name:"PV_PREVIEW_END",id:22}]},{name:"SourceType",syntax:"proto2",values:[{name:"ST_NGC_FILE",id:1},{name:"ST_NGC_STRING",id:2},{name:"ST_PYTHON_METHOD",id:3}]},{name:"MotionType",syntax:"proto2",values:[{name:"_EMC_MOTION_TYPE_NONE",id:0},{name:"_EMC_MOTION_TYPE_TRAVERSE",id:1},{name:"_EMC_MOTION_TYPE_FEED",id:2},{name:"_EMC_MOTION_TYPE_ARC",id:3},{name:"_EMC_MOTION_TYPE_TOOLCHANGE",id:4},{name:"_EMC_MOTION_TYPE_PROBING",id:5},{name:"_EMC_MOTION_TYPE_INDEXROTARY",id:6}]},{name:"cmd_code_t",syntax:"proto2",values:[{name:"EMCMOT_ABORT",id:4e3},{name:"EMCMOT_AXIS_ABORT",id:4001},{name:"EMCMOT_ENABLE",id:4002},{name:"EMCMOT_DISABLE",id:4003},{name:"EMCMOT_ENABLE_AMPLIFIER",id:4004},{name:"EMCMOT_DISABLE_AMPLIFIER",id:4005},{name:"EMCMOT_ENABLE_WATCHDOG",id:4006},{name:"EMCMOT_DISABLE_WATCHDOG",id:4007},{name:"EMCMOT_ACTIVATE_JOINT",id:4008},{name:"EMCMOT_DEACTIVATE_JOINT",id:4009},{name:"EMCMOT_PAUSE",id:4010},{name:"EMCMOT_RESUME",id:4011},{name:"EMCMOT_STEP",id:4012},{name:"EMCMOT_FREE",id:4013},{name:"EMCMOT_COORD",id:4014},{name:"EMCMOT_TELEOP",id:4015},{name:"EMCMOT_SPINDLE_SCALE",id:4016},{name:"EMCMOT_SS_ENABLE",id:4017},{name:"EMCMOT_FEED_SCALE",id:4018},{name:"EMCMOT_FS_ENABLE",id:4019},{name:"EMCMOT_FH_ENABLE",id:4020},{name:"EMCMOT_AF_ENABLE",id:4021},{name:"EMCMOT_OVERRIDE_LIMITS",id:4022},{name:"EMCMOT_HOME",id:4023},{name:"EMCMOT_UNHOME",id:4024},{name:"EMCMOT_JOG_CONT",id:4025},{name:"EMCMOT_JOG_INCR",id:4026},{name:"EMCMOT_JOG_ABS",id:4027},{name:"EMCMOT_SET_LINE",id:4028},{name:"EMCMOT_SET_CIRCLE",id:4029},{name:"EMCMOT_SET_TELEOP_VECTOR",id:4030},{name:"EMCMOT_CLEAR_PROBE_FLAGS",id:4031},{name:"EMCMOT_PROBE",id:4032},{name:"EMCMOT_RIGID_TAP",id:4033},{name:"EMCMOT_SET_POSITION_LIMITS",id:4034},{name:"EMCMOT_SET_BACKLASH",id:4035},{name:"EMCMOT_SET_MIN_FERROR",id:4036},{name:"EMCMOT_SET_MAX_FERROR",id:4037},{name:"EMCMOT_SET_VEL",id:4038},{name:"EMCMOT_SET_VEL_LIMIT",id:4039},{name:"EMCMOT_SET_JOINT_VEL_LIMIT",id:4040},{name:"EMCMOT_SET_JOINT_ACC_LIMIT",id:4041},{name:"EMCMOT_SET_ACC",id:4042},{name:"EMCMOT_SET_TERM_COND",id:4043},{name:"EMCMOT_SET_NUM_AXES",id:4044},{name:"EMCMOT_SET_WORLD_HOME",id:4045},{name:"EMCMOT_SET_HOMING_PARAMS",id:4046},{name:"EMCMOT_SET_DEBUG",id:4047},{name:"EMCMOT_SET_DOUT",id:4048},{name:"EMCMOT_SET_AOUT",id:4049},{name:"EMCMOT_SET_SPINDLESYNC",id:4050},{name:"EMCMOT_SPINDLE_ON",id:4051},{name:"EMCMOT_SPINDLE_OFF",id:4052},{name:"EMCMOT_SPINDLE_INCREASE",id:4053},{name:"EMCMOT_SPINDLE_DECREASE",id:4054},{name:"EMCMOT_SPINDLE_BRAKE_ENGAGE",id:4055},{name:"EMCMOT_SPINDLE_BRAKE_RELEASE",id:4056},{name:"EMCMOT_SET_MOTOR_OFFSET",id:4057},{name:"EMCMOT_SET_JOINT_COMP",id:4058},{name:"EMCMOT_SET_OFFSET",id:4059}]},{name:"cmd_status_t",syntax:"proto2",values:[{name:"EMCMOT_COMMAND_OK",id:0},{name:"EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1},{name:"EMCMOT_COMMAND_INVALID_COMMAND",id:2},{name:"EMCMOT_COMMAND_INVALID_PARAMS",id:3},{name:"EMCMOT_COMMAND_BAD_EXEC",id:4}]},{name:"EmcTaskExecStateType",syntax:"proto2",values:[{name:"EMC_TASK_EXEC_ERROR",id:1},{name:"EMC_TASK_EXEC_DONE",id:2},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION",id:3},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_QUEUE",id:4},{name:"EMC_TASK_EXEC_WAITING_FOR_IO",id:5},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_AND_IO",id:7},{name:"EMC_TASK_EXEC_WAITING_FOR_DELAY",id:8},{name:"EMC_TASK_EXEC_WAITING_FOR_SYSTEM_CMD",id:9},{name:"EMC_TASK_EXEC_WAITING_FOR_SPINDLE_ORIENTED",id:10}]},{name:"EmcInterpStateType",syntax:"proto2",values:[{name:"EMC_TASK_INTERP_IDLE",id:1},{name:"EMC_TASK_INTERP_READING",id:2},{name:"EMC_TASK_INTERP_PAUSED",id:3},{name:"EMC_TASK_INTERP_WAITING",id:4}]},{name:"EmcInterpExitCodeType",syntax:"proto2",values:[{name:"EMC_INTERP_EXIT_OK",id:0},{name:"EMC_INTERP_EXIT_EXIT",id:1},{name:"EMC_INTERP_EXIT_EXECUTE_FINISH",id:2},{name:"EMC_INTERP_EXIT_ENDFILE",id:3},{name:"EMC_INTERP_EXIT_FILE_NOT_OPEN",id:4},{name:"EMC_INTERP_EXIT_ERROR",id:5}]},{name:"EmcKinematicsType",syntax:"proto2",values:[{name:"KINEMATICS_IDENTITY",id:1},{name:"KINEMATICS_FORWARD_ONLY",id:2},{name:"KINEMATICS_INVERSE_ONLY",id:3},{name:"KINEMATICS_BOTH",id:4}]},{name:"EmcTrajectoryModeType",syntax:"proto2",values:[{name:"EMC_TRAJ_MODE_FREE",id:1},{name:"EMC_TRAJ_MODE_COORD",id:2},{name:"EMC_TRAJ_MODE_TELEOP",id:3}]},{name:"EmcCanonUnitsType",syntax:"proto2",values:[{name:"CANON_UNITS_INCH",id:1},{name:"CANON_UNITS_MM",id:2},{name:"CANON_UNITS_CM",id:3}]},{name:"EmcLinearUnitsType",syntax:"proto2",values:[{name:"LINEAR_UNITS_INCH",id:1},{name:"LINEAR_UNITS_MM",id:2},{name:"LINEAR_UNITS_CM",id:3}]},{name:"EmcAngularUnitsType",syntax:"proto2",values:[{name:"ANGULAR_UNITS_DEGREES",id:1},{name:"ANGULAR_UNITS_RADIAN",id:2},{name:"ANGULAR_UNITS_GRAD",id:3}]},{name:"EmcTimeUnitsType",syntax:"proto2",values:[{name:"TIME_UNITS_MINUTE",id:1},{name:"TIME_UNITS_SECOND",id:2}]},{name:"EmcTaskModeType",syntax:"proto2",values:[{name:"EMC_TASK_MODE_MANUAL",id:1},{name:"EMC_TASK_MODE_AUTO",id:2},{name:"EMC_TASK_MODE_MDI",id:3}]},{name:"EmcTaskStateType",syntax:"proto2",values:[{name:"EMC_TASK_STATE_ESTOP",id:1},{name:"EMC_TASK_STATE_ESTOP_RESET",id:2},{name:"EMC_TASK_STATE_OFF",id:3},{name:"EMC_TASK_STATE_ON",id:4}]},{name:"EmcAxisType",syntax:"proto2",values:[{name:"EMC_AXIS_LINEAR",id:1},{name:"EMC_AXIS_ANGULAR",id:2}]},{name:"EmcPositionOffsetType",syntax:"proto2",values:[{name:"EMC_CONFIG_RELATIVE_OFFSET",id:1},{name:"EMC_CONFIG_MACHINE_OFFSET",id:2}]},{name:"EmcPositionFeedbackType",syntax:"proto2",values:[{name:"EMC_CONFIG_ACTUAL_FEEDBACK",id:1},{name:"EMC_CONFIG_COMMANDED_FEEDBACK",id:2}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"Position",syntax:"proto2",options:{"(nanopb_msgopt).msgid":800},fields:[{rule:"optional",type:"double",name:"x",id:3},{rule:"optional",type:"double",name:"y",id:4},{rule:"optional",type:"double",name:"z",id:5},{rule:"optional",type:"double",name:"a",id:6},{rule:"optional",type:"double",name:"b",id:7},{rule:"optional",type:"double",name:"c",id:8},{rule:"optional",type:"double",name:"u",id:9},{rule:"optional",type:"double",name:"v",id:10},{rule:"optional",type:"double",name:"w",id:11}]},{name:"Preview",syntax:"proto2",options:{"(nanopb_msgopt).msgid":801},fields:[{rule:"required",type:"PreviewOpType",name:"type",id:1},{rule:"optional",type:"int32",name:"line_number",id:2},{rule:"optional",type:"Position",name:"pos",id:3},{rule:"optional",type:"double",name:"first_end",id:4},{rule:"optional",type:"double",name:"second_end",id:5},{rule:"optional",type:"double",name:"first_axis",id:6},{rule:"optional",type:"double",name:"second_axis",id:7},{rule:"optional",type:"int32",name:"rotation",id:8},{rule:"optional",type:"double",name:"axis_end_point",id:9},{rule:"optional",type:"double",name:"xy_rotation",id:10},{rule:"optional",type:"int32",name:"plane",id:11},{rule:"optional",type:"double",name:"rate",id:12},{rule:"optional",type:"int32",name:"feed_mode",id:13},{rule:"optional",type:"double",name:"time",id:14},{rule:"optional",type:"string",name:"text",id:15},{rule:"optional",type:"double",name:"angular_units",id:101},{rule:"optional",type:"double",name:"length_units",id:102},{rule:"optional",type:"int32",name:"probetype",id:103},{rule:"optional",type:"KinematicsType",name:"kins",id:104,options:{default:"KT_JOINT"}},{rule:"optional",type:"int32",name:"axismask",id:105},{rule:"optional",type:"int32",name:"g5_index",id:106},{rule:"optional",type:"int32",name:"pocket",id:107},{rule:"optional",type:"SourceType",name:"stype",id:110},{rule:"optional",type:"string",name:"filename",id:111},{rule:"optional",type:"string",name:"cmdstring",id:112},{rule:"optional",type:"int32",name:"call_level",id:113}]},{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"MotionCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":600},fields:[{rule:"required",type:"cmd_code_t",name:"command",id:10},{rule:"required",type:"fixed32",name:"commandNum",id:20},{rule:"optional",type:"double",name:"motor_offset",id:30},{rule:"optional",type:"double",name:"maxLimit",id:40},{rule:"optional",type:"double",name:"minLimit",id:50},{rule:"optional",type:"EmcPose",name:"pos",id:60},{rule:"optional",type:"PmCartesian",name:"center",id:70},{rule:"optional",type:"PmCartesian",name:"normal",id:80},{rule:"optional",type:"fixed32",name:"turn",id:90},{rule:"optional",type:"double",name:"vel",id:100},{rule:"optional",type:"double",name:"ini_maxvel",id:110},{rule:"optional",type:"MotionType",name:"motion_type",id:120},{rule:"optional",type:"double",name:"spindlesync",id:130},{rule:"optional",type:"double",name:"acc",id:140},{rule:"optional",type:"double",name:"backlash",id:150},{rule:"optional",type:"fixed32",name:"id",id:160},{rule:"optional",type:"fixed32",name:"termCond",id:170},{rule:"optional",type:"double",name:"tolerance",id:180},{rule:"optional",type:"fixed32",name:"axis",id:190},{rule:"optional",type:"double",name:"scale",id:200},{rule:"optional",type:"double",name:"offset",id:210},{rule:"optional",type:"double",name:"home",id:220},{rule:"optional",type:"double",name:"home_final_vel",id:230},{rule:"optional",type:"double",name:"search_vel",id:240},{rule:"optional",type:"double",name:"latch_vel",id:250},{rule:"optional",type:"fixed32",name:"flags",id:260},{rule:"optional",type:"fixed32",name:"home_sequence",id:270},{rule:"optional",type:"fixed32",name:"volatile_home",id:280},{rule:"optional",type:"double",name:"minFerror",id:290},{rule:"optional",type:"double",name:"maxFerror",id:300},{rule:"optional",type:"fixed32",name:"wdWait",id:310},{rule:"optional",type:"fixed32",name:"debug",id:320},{rule:"optional",type:"int32",name:"now",id:330},{rule:"optional",type:"int32",name:"out",id:340},{rule:"optional",type:"int32",name:"start",id:350},{rule:"optional",type:"int32",name:"end",id:360},{rule:"optional",type:"int32",name:"mode",id:370},{rule:"optional",type:"double",name:"comp_nominal",id:380},{rule:"optional",type:"double",name:"comp_forward",id:390},{rule:"optional",type:"double",name:"comp_reverse",id:400},{rule:"optional",type:"int32",name:"probe_type",id:410},{rule:"optional",type:"EmcPose",name:"tool_offset",id:420}]},{name:"MotionStatus",syntax:"proto2",options:{"(nanopb_msgopt).msgid":601},fields:[{rule:"required",type:"cmd_code_t",name:"commandEcho",id:10},{rule:"required",type:"fixed32",name:"commandNumEcho",id:20},{rule:"required",type:"cmd_status_t",name:"commandStatus",id:30},{rule:"optional",type:"EmcPose",name:"carte_pos_fb",id:40}]},{name:"EmcToolData",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1100},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"id",id:2},{rule:"optional",type:"double",name:"diameter",id:12},{rule:"optional",type:"double",name:"frontangle",id:13},{rule:"optional",type:"double",name:"backangle",id:14},{rule:"optional",type:"int32",name:"orientation",id:15},{rule:"optional",type:"Position",name:"offset",id:16},{rule:"optional",type:"string",name:"comment",id:17},{rule:"optional",type:"int32",name:"pocket",id:18}]},{name:"EmcStatusMotionAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1101},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"enabled",id:2},{rule:"optional",type:"bool",name:"fault",id:3},{rule:"optional",type:"double",name:"ferror_current",id:4},{rule:"optional",type:"double",name:"ferror_highmark",id:5},{rule:"optional",type:"bool",name:"homed",id:6},{rule:"optional",type:"bool",name:"homing",id:7},{rule:"optional",type:"bool",name:"inpos",id:8},{rule:"optional",type:"double",name:"input",id:9},{rule:"optional",type:"bool",name:"max_hard_limit",id:10},{rule:"optional",type:"bool",name:"max_soft_limit",id:11},{rule:"optional",type:"bool",name:"min_hard_limit",id:12},{rule:"optional",type:"bool",name:"min_soft_limit",id:13},{rule:"optional",type:"double",name:"output",id:14},{rule:"optional",type:"bool",name:"override_limits",id:15},{rule:"optional",type:"double",name:"velocity",id:16}]},{name:"EmcStatusConfigAxis",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1102},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"EmcAxisType",name:"axis_type",id:2},{rule:"optional",type:"double",name:"backlash",id:3},{rule:"optional",type:"double",name:"max_ferror",id:4},{rule:"optional",type:"double",name:"max_position_limit",id:5},{rule:"optional",type:"double",name:"min_ferror",id:6},{rule:"optional",type:"double",name:"min_position_limit",id:7},{rule:"optional",type:"int32",name:"home_sequence",id:9},{rule:"optional",type:"double",name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"string",name:"increments",id:12}]},{name:"EmcProgramExtension",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1103},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"extension",id:2}]},{name:"EmcStatusAnalogIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1104},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusDigitalIO",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1105},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"bool",name:"value",id:2}]},{name:"EmcStatusLimit",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1106},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusGCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1107},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusMCode",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1108},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"int32",name:"value",id:2}]},{name:"EmcStatusSetting",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1109},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"double",name:"value",id:2}]},{name:"EmcStatusConfig",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1110},fields:[{rule:"optional",type:"double",name:"default_acceleration",id:1},{rule:"optional",type:"int32",name:"axes",id:3},{rule:"repeated",type:"EmcStatusConfigAxis",name:"axis",id:4},{rule:"optional",type:"int32",name:"axis_mask",id:5},{rule:"optional",type:"double",name:"cycle_time",id:6},{rule:"optional",type:"int32",name:"debug",id:7},{rule:"optional",type:"EmcKinematicsType",name:"kinematics_type",id:8},{rule:"optional",type:"double",name:"max_acceleration",id:10},{rule:"optional",type:"double",name:"max_velocity",id:11},{rule:"optional",type:"EmcLinearUnitsType",name:"linear_units",id:12},{rule:"optional",type:"double",name:"default_velocity",id:13},{rule:"repeated",type:"EmcProgramExtension",name:"program_extension",id:14},{rule:"optional",type:"EmcPositionOffsetType",name:"position_offset",id:15},{rule:"optional",type:"EmcPositionFeedbackType",name:"position_feedback",id:16},{rule:"optional",type:"double",name:"max_feed_override",id:17},{rule:"optional",type:"double",name:"min_feed_override",id:18},{rule:"optional",type:"double",name:"max_spindle_override",id:19},{rule:"optional",type:"double",name:"min_spindle_override",id:20},{rule:"optional",type:"double",name:"default_spindle_speed",id:21},{rule:"optional",type:"double",name:"default_linear_velocity",id:22},{rule:"optional",type:"double",name:"min_velocity",id:23},{rule:"optional",type:"double",name:"max_linear_velocity",id:24},{rule:"optional",type:"double",name:"min_linear_velocity",id:25},{rule:"optional",type:"double",name:"default_angular_velocity",id:26},{rule:"optional",type:"double",name:"max_angular_velocity",id:27},{rule:"optional",type:"double",name:"min_angular_velocity",id:28},{rule:"optional",type:"string",name:"increments",id:29},{rule:"optional",type:"string",name:"grids",id:30},{rule:"optional",type:"bool",name:"lathe",id:31},{rule:"optional",type:"string",name:"geometry",id:32},{rule:"optional",type:"uint32",name:"arcdivision",id:33},{rule:"optional",type:"bool",name:"no_force_homing",id:34},{rule:"optional",type:"string",name:"remote_path",id:35},{rule:"optional",type:"EmcTimeUnitsType",name:"time_units",id:36},{rule:"optional",type:"string",name:"name",id:37},{rule:"repeated",type:"EmcStatusUserCommand",name:"user_command",id:38},{rule:"optional",type:"EmcAngularUnitsType",name:"angular_units",id:39}]},{name:"EmcStatusMotion",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1111},fields:[{rule:"optional",type:"int32",name:"active_queue",id:1},{rule:"optional",type:"Position",name:"actual_position",id:2},{rule:"optional",type:"bool",name:"adaptive_feed_enabled",id:3},{rule:"repeated",type:"EmcStatusAnalogIO",name:"ain",id:4},{rule:"repeated",type:"EmcStatusAnalogIO",name:"aout",id:5},{rule:"repeated",type:"EmcStatusMotionAxis",name:"axis",id:6},{rule:"optional",type:"bool",name:"block_delete",id:7},{rule:"optional",type:"int32",name:"current_line",id:8},{rule:"optional",type:"double",name:"current_vel",id:9},{rule:"optional",type:"double",name:"delay_left",id:10},{rule:"repeated",type:"EmcStatusDigitalIO",name:"din",id:11},{rule:"optional",type:"double",name:"distance_to_go",id:12},{rule:"repeated",type:"EmcStatusDigitalIO",name:"dout",id:13},{rule:"optional",type:"Position",name:"dtg",id:14},{rule:"optional",type:"bool",name:"enabled",id:15},{rule:"optional",type:"bool",name:"feed_hold_enabled",id:16},{rule:"optional",type:"bool",name:"feed_override_enabled",id:17},{rule:"optional",type:"double",name:"feedrate",id:18},{rule:"optional",type:"OriginIndex",name:"g5x_index",id:19},{rule:"optional",type:"Position",name:"g5x_offset",id:20},{rule:"optional",type:"Position",name:"g92_offset",id:21},{rule:"optional",type:"int32",name:"id",id:23},{rule:"optional",type:"bool",name:"inpos",id:24},{rule:"optional",type:"Position",name:"joint_actual_position",id:25},{rule:"optional",type:"Position",name:"joint_position",id:26},{rule:"repeated",type:"EmcStatusLimit",name:"limit",id:27},{rule:"optional",type:"int32",name:"motion_line",id:28},{rule:"optional",type:"MotionType",name:"motion_type",id:29},{rule:"optional",type:"EmcTrajectoryModeType",name:"motion_mode",id:30},{rule:"optional",type:"bool",name:"paused",id:31},{rule:"optional",type:"Position",name:"position",id:32},{rule:"optional",type:"bool",name:"probe_tripped",id:33},{rule:"optional",type:"int32",name:"probe_val",id:34},{rule:"optional",type:"Position",name:"probed_position",id:35},{rule:"optional",type:"bool",name:"probing",id:36},{rule:"optional",type:"int32",name:"queue",id:37},{rule:"optional",type:"bool",name:"queue_full",id:38},{rule:"optional",type:"double",name:"rotation_xy",id:39},{rule:"optional",type:"bool",name:"spindle_brake",id:40},{rule:"optional",type:"int32",name:"spindle_direction",id:41},{rule:"optional",type:"bool",name:"spindle_enabled",id:42},{rule:"optional",type:"int32",name:"spindle_increasing",id:43},{rule:"optional",type:"bool",name:"spindle_override_enabled",id:44},{rule:"optional",type:"double",name:"spindle_speed",id:45},{rule:"optional",type:"double",name:"spindlerate",id:46},{rule:"optional",type:"RCS_STATUS",name:"state",id:47},{rule:"optional",type:"double",name:"max_velocity",id:48},{rule:"optional",type:"double",name:"max_acceleration",id:49},{rule:"optional",type:"double",name:"rapidrate",id:50}]},{name:"EmcStatusIo",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1112},fields:[{rule:"optional",type:"bool",name:"estop",id:1},{rule:"optional",type:"bool",name:"flood",id:2},{rule:"optional",type:"bool",name:"lube",id:3},{rule:"optional",type:"bool",name:"lube_level",id:4},{rule:"optional",type:"bool",name:"mist",id:5},{rule:"optional",type:"Position",name:"tool_offset",id:8},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:9},{rule:"optional",type:"int32",name:"pocket_prepped",id:10},{rule:"optional",type:"int32",name:"tool_in_spindle",id:11}]},{name:"EmcStatusTask",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1113},fields:[{rule:"optional",type:"int32",name:"echo_serial_number",id:1},{rule:"optional",type:"EmcTaskExecStateType",name:"exec_state",id:2},{rule:"optional",type:"string",name:"file",id:3},{rule:"optional",type:"bool",name:"input_timeout",id:4},{rule:"optional",type:"bool",name:"optional_stop",id:5},{rule:"optional",type:"int32",name:"read_line",id:6},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:7},{rule:"optional",type:"int32",name:"task_paused",id:8},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:9},{rule:"optional",type:"int32",name:"total_lines",id:10}]},{name:"EmcStatusInterp",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1114},fields:[{rule:"optional",type:"string",name:"command",id:1},{rule:"repeated",type:"EmcStatusGCode",name:"gcodes",id:2},{rule:"optional",type:"EmcInterpStateType",name:"interp_state",id:3},{rule:"optional",type:"EmcInterpExitCodeType",name:"interpreter_errcode",id:4},{rule:"repeated",type:"EmcStatusMCode",name:"mcodes",id:5},{rule:"repeated",type:"EmcStatusSetting",name:"settings",id:6},{rule:"optional",type:"EmcCanonUnitsType",name:"program_units",id:7}]},{name:"EmcCommandParameters",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1115},fields:[{rule:"optional",type:"uint32",name:"index",id:1},{rule:"optional",type:"uint32",name:"debug_level",id:2},{rule:"optional",type:"int32",name:"line_number",id:3},{rule:"optional",type:"double",name:"scale",id:4},{rule:"optional",type:"double",name:"velocity",id:5},{rule:"optional",type:"double",name:"distance",id:6},{rule:"optional",type:"double",name:"value",id:7},{rule:"optional",type:"bool",name:"enable",id:8},{rule:"optional",type:"string",name:"command",id:9},{rule:"optional",type:"string",name:"path",id:10},{rule:"optional",type:"EmcTaskModeType",name:"task_mode",id:100},{rule:"optional",type:"EmcTaskStateType",name:"task_state",id:101},{rule:"optional",type:"EmcTrajectoryModeType",name:"traj_mode",id:102},{rule:"optional",type:"EmcPose",name:"pose",id:103},{rule:"optional",type:"EmcToolData",name:"tool_data",id:104},{rule:"repeated",type:"EmcToolData",name:"tool_table",id:105}]},{name:"EmcStatusUserCommand",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1116},fields:[{rule:"required",type:"int32",name:"index",id:1},{rule:"optional",type:"string",name:"command",id:2}]},{name:"EmcStatusUI",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1117},fields:[{rule:"optional",type:"bool",name:"spindle_brake_visible",id:1},{rule:"optional",type:"bool",name:"spindle_cw_visible",id:2},{rule:"optional",type:"bool",name:"spindle_ccw_visible",id:3},{rule:"optional",type:"bool",name:"spindle_stop_visible",id:4},{rule:"optional",type:"bool",name:"spindle_plus_visible",id:5},{rule:"optional",type:"bool",name:"spindle_minus_visible",id:6},{rule:"optional",type:"bool",name:"spindle_override_visible",id:7},{rule:"optional",type:"bool",name:"coolant_flood_visible",id:8},{rule:"optional",type:"bool",name:"coolant_mist_visible",id:9}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{
+name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]},{name:"KinematicsType",syntax:"proto2",values:[{name:"KT_JOINT",id:1},{name:"KT_TRIVKINS",id:2},{name:"KT_DELTA",id:3}]},{name:"PreviewOpType",syntax:"proto2",values:[{name:"PV_STRAIGHT_PROBE",id:1},{name:"PV_RIGID_TAP",id:2},{name:"PV_STRAIGHT_FEED",id:3},{name:"PV_ARC_FEED",id:4},{name:"PV_STRAIGHT_TRAVERSE",id:5},{name:"PV_SET_G5X_OFFSET",id:6},{name:"PV_SET_G92_OFFSET",id:7},{name:"PV_SET_XY_ROTATION",id:8},{name:"PV_SELECT_PLANE",id:9},{name:"PV_SET_TRAVERSE_RATE",id:10},{name:"PV_SET_FEED_RATE",id:11},{name:"PV_CHANGE_TOOL",id:12},{name:"PV_CHANGE_TOOL_NUMBER",id:13},{name:"PV_DWELL",id:14},{name:"PV_MESSAGE",id:15},{name:"PV_COMMENT",id:16},{name:"PV_USE_TOOL_OFFSET",id:17},{name:"PV_SET_PARAMS",id:18},{name:"PV_SET_FEED_MODE",id:19},{name:"PV_SOURCE_CONTEXT",id:20},{name:"PV_PREVIEW_START",id:21},{name:"PV_PREVIEW_END",id:22}]},{name:"SourceType",syntax:"proto2",values:[{name:"ST_NGC_FILE",id:1},{name:"ST_NGC_STRING",id:2},{name:"ST_PYTHON_METHOD",id:3}]},{name:"MotionType",syntax:"proto2",values:[{name:"_EMC_MOTION_TYPE_NONE",id:0},{name:"_EMC_MOTION_TYPE_TRAVERSE",id:1},{name:"_EMC_MOTION_TYPE_FEED",id:2},{name:"_EMC_MOTION_TYPE_ARC",id:3},{name:"_EMC_MOTION_TYPE_TOOLCHANGE",id:4},{name:"_EMC_MOTION_TYPE_PROBING",id:5},{name:"_EMC_MOTION_TYPE_INDEXROTARY",id:6}]},{name:"cmd_code_t",syntax:"proto2",values:[{name:"EMCMOT_ABORT",id:4e3},{name:"EMCMOT_AXIS_ABORT",id:4001},{name:"EMCMOT_ENABLE",id:4002},{name:"EMCMOT_DISABLE",id:4003},{name:"EMCMOT_ENABLE_AMPLIFIER",id:4004},{name:"EMCMOT_DISABLE_AMPLIFIER",id:4005},{name:"EMCMOT_ENABLE_WATCHDOG",id:4006},{name:"EMCMOT_DISABLE_WATCHDOG",id:4007},{name:"EMCMOT_ACTIVATE_JOINT",id:4008},{name:"EMCMOT_DEACTIVATE_JOINT",id:4009},{name:"EMCMOT_PAUSE",id:4010},{name:"EMCMOT_RESUME",id:4011},{name:"EMCMOT_STEP",id:4012},{name:"EMCMOT_FREE",id:4013},{name:"EMCMOT_COORD",id:4014},{name:"EMCMOT_TELEOP",id:4015},{name:"EMCMOT_SPINDLE_SCALE",id:4016},{name:"EMCMOT_SS_ENABLE",id:4017},{name:"EMCMOT_FEED_SCALE",id:4018},{name:"EMCMOT_FS_ENABLE",id:4019},{name:"EMCMOT_FH_ENABLE",id:4020},{name:"EMCMOT_AF_ENABLE",id:4021},{name:"EMCMOT_OVERRIDE_LIMITS",id:4022},{name:"EMCMOT_HOME",id:4023},{name:"EMCMOT_UNHOME",id:4024},{name:"EMCMOT_JOG_CONT",id:4025},{name:"EMCMOT_JOG_INCR",id:4026},{name:"EMCMOT_JOG_ABS",id:4027},{name:"EMCMOT_SET_LINE",id:4028},{name:"EMCMOT_SET_CIRCLE",id:4029},{name:"EMCMOT_SET_TELEOP_VECTOR",id:4030},{name:"EMCMOT_CLEAR_PROBE_FLAGS",id:4031},{name:"EMCMOT_PROBE",id:4032},{name:"EMCMOT_RIGID_TAP",id:4033},{name:"EMCMOT_SET_POSITION_LIMITS",id:4034},{name:"EMCMOT_SET_BACKLASH",id:4035},{name:"EMCMOT_SET_MIN_FERROR",id:4036},{name:"EMCMOT_SET_MAX_FERROR",id:4037},{name:"EMCMOT_SET_VEL",id:4038},{name:"EMCMOT_SET_VEL_LIMIT",id:4039},{name:"EMCMOT_SET_JOINT_VEL_LIMIT",id:4040},{name:"EMCMOT_SET_JOINT_ACC_LIMIT",id:4041},{name:"EMCMOT_SET_ACC",id:4042},{name:"EMCMOT_SET_TERM_COND",id:4043},{name:"EMCMOT_SET_NUM_AXES",id:4044},{name:"EMCMOT_SET_WORLD_HOME",id:4045},{name:"EMCMOT_SET_HOMING_PARAMS",id:4046},{name:"EMCMOT_SET_DEBUG",id:4047},{name:"EMCMOT_SET_DOUT",id:4048},{name:"EMCMOT_SET_AOUT",id:4049},{name:"EMCMOT_SET_SPINDLESYNC",id:4050},{name:"EMCMOT_SPINDLE_ON",id:4051},{name:"EMCMOT_SPINDLE_OFF",id:4052},{name:"EMCMOT_SPINDLE_INCREASE",id:4053},{name:"EMCMOT_SPINDLE_DECREASE",id:4054},{name:"EMCMOT_SPINDLE_BRAKE_ENGAGE",id:4055},{name:"EMCMOT_SPINDLE_BRAKE_RELEASE",id:4056},{name:"EMCMOT_SET_MOTOR_OFFSET",id:4057},{name:"EMCMOT_SET_JOINT_COMP",id:4058},{name:"EMCMOT_SET_OFFSET",id:4059}]},{name:"cmd_status_t",syntax:"proto2",values:[{name:"EMCMOT_COMMAND_OK",id:0},{name:"EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1},{name:"EMCMOT_COMMAND_INVALID_COMMAND",id:2},{name:"EMCMOT_COMMAND_INVALID_PARAMS",id:3},{name:"EMCMOT_COMMAND_BAD_EXEC",id:4}]},{name:"EmcTaskExecStateType",syntax:"proto2",values:[{name:"EMC_TASK_EXEC_ERROR",id:1},{name:"EMC_TASK_EXEC_DONE",id:2},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION",id:3},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_QUEUE",id:4},{name:"EMC_TASK_EXEC_WAITING_FOR_IO",id:5},{name:"EMC_TASK_EXEC_WAITING_FOR_MOTION_AND_IO",id:7},{name:"EMC_TASK_EXEC_WAITING_FOR_DELAY",id:8},{name:"EMC_TASK_EXEC_WAITING_FOR_SYSTEM_CMD",id:9},{name:"EMC_TASK_EXEC_WAITING_FOR_SPINDLE_ORIENTED",id:10}]},{name:"EmcInterpStateType",syntax:"proto2",values:[{name:"EMC_TASK_INTERP_IDLE",id:1},{name:"EMC_TASK_INTERP_READING",id:2},{name:"EMC_TASK_INTERP_PAUSED",id:3},{name:"EMC_TASK_INTERP_WAITING",id:4}]},{name:"EmcInterpExitCodeType",syntax:"proto2",values:[{name:"EMC_INTERP_EXIT_OK",id:0},{name:"EMC_INTERP_EXIT_EXIT",id:1},{name:"EMC_INTERP_EXIT_EXECUTE_FINISH",id:2},{name:"EMC_INTERP_EXIT_ENDFILE",id:3},{name:"EMC_INTERP_EXIT_FILE_NOT_OPEN",id:4},{name:"EMC_INTERP_EXIT_ERROR",id:5}]},{name:"EmcKinematicsType",syntax:"proto2",values:[{name:"KINEMATICS_IDENTITY",id:1},{name:"KINEMATICS_FORWARD_ONLY",id:2},{name:"KINEMATICS_INVERSE_ONLY",id:3},{name:"KINEMATICS_BOTH",id:4}]},{name:"EmcTrajectoryModeType",syntax:"proto2",values:[{name:"EMC_TRAJ_MODE_FREE",id:1},{name:"EMC_TRAJ_MODE_COORD",id:2},{name:"EMC_TRAJ_MODE_TELEOP",id:3}]},{name:"EmcCanonUnitsType",syntax:"proto2",values:[{name:"CANON_UNITS_INCH",id:1},{name:"CANON_UNITS_MM",id:2},{name:"CANON_UNITS_CM",id:3}]},{name:"EmcLinearUnitsType",syntax:"proto2",values:[{name:"LINEAR_UNITS_INCH",id:1},{name:"LINEAR_UNITS_MM",id:2},{name:"LINEAR_UNITS_CM",id:3}]},{name:"EmcAngularUnitsType",syntax:"proto2",values:[{name:"ANGULAR_UNITS_DEGREES",id:1},{name:"ANGULAR_UNITS_RADIAN",id:2},{name:"ANGULAR_UNITS_GRAD",id:3}]},{name:"EmcTimeUnitsType",syntax:"proto2",values:[{name:"TIME_UNITS_MINUTE",id:1},{name:"TIME_UNITS_SECOND",id:2}]},{name:"EmcTaskModeType",syntax:"proto2",values:[{name:"EMC_TASK_MODE_MANUAL",id:1},{name:"EMC_TASK_MODE_AUTO",id:2},{name:"EMC_TASK_MODE_MDI",id:3}]},{name:"EmcTaskStateType",syntax:"proto2",values:[{name:"EMC_TASK_STATE_ESTOP",id:1},{name:"EMC_TASK_STATE_ESTOP_RESET",id:2},{name:"EMC_TASK_STATE_OFF",id:3},{name:"EMC_TASK_STATE_ON",id:4}]},{name:"EmcAxisType",syntax:"proto2",values:[{name:"EMC_AXIS_LINEAR",id:1},{name:"EMC_AXIS_ANGULAR",id:2}]},{name:"EmcPositionOffsetType",syntax:"proto2",values:[{name:"EMC_CONFIG_RELATIVE_OFFSET",id:1},{name:"EMC_CONFIG_MACHINE_OFFSET",id:2}]},{name:"EmcPositionFeedbackType",syntax:"proto2",values:[{name:"EMC_CONFIG_ACTUAL_FEEDBACK",id:1},{name:"EMC_CONFIG_COMMANDED_FEEDBACK",id:2}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],16:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"TaskPlanExecute",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1200},fields:[{rule:"optional",type:"string",name:"command",id:10},{rule:"optional",type:"sfixed32",name:"line",id:30}]},{name:"TaskPlanBlockDelete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1201},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOptionalStop",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1202},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOpen",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1203},fields:[{rule:"required",type:"string",name:"filename",id:10}]},{name:"TaskPlanReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1204},fields:[{rule:"required",type:"ContainerType",name:"cmd",id:10},{rule:"optional",type:"string",name:"errormsg",id:20}]},{name:"TaskReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1205},fields:[{rule:"required",type:"fixed32",name:"ticket",id:10}]},{name:"TicketUpdate",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1206},fields:[{rule:"required",type:"fixed32",name:"cticket",id:10},{rule:"required",type:"RCS_STATUS",name:"status",id:20},{rule:"optional",type:"string",name:"text",id:30}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"TaskPlanExecute",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1200},fields:[{rule:"optional",type:"string",name:"command",id:10},{rule:"optional",type:"sfixed32",name:"line",id:30}]},{name:"TaskPlanBlockDelete",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1201},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOptionalStop",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1202},fields:[{rule:"required",type:"bool",name:"state",id:10}]},{name:"TaskPlanOpen",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1203},fields:[{rule:"required",type:"string",name:"filename",id:10}]},{name:"TaskPlanReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1204},fields:[{rule:"required",type:"ContainerType",name:"cmd",id:10},{rule:"optional",type:"string",name:"errormsg",id:20}]},{name:"TaskReply",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1205},fields:[{rule:"required",type:"fixed32",name:"ticket",id:10}]},{name:"TicketUpdate",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1206},fields:[{rule:"required",type:"fixed32",name:"cticket",id:10},{rule:"required",type:"RCS_STATUS",name:"status",id:20},{rule:"optional",type:"string",name:"text",id:30}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],17:[function(require,module,exports){
 module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"Test1",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1300},fields:[{rule:"required",type:"TestOpType",name:"op",id:10},{rule:"required",type:"EmcPose",name:"end",id:20},{rule:"optional",type:"PmCartesian",name:"center",id:30},{rule:"optional",type:"PmCartesian",name:"normal",id:40},{rule:"optional",type:"int32",name:"turn",id:50}]},{name:"Test2",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1301},fields:[]},{name:"Test3",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1302},fields:[]}],enums:[{name:"TestOpType",syntax:"proto2",values:[{name:"LINE",id:10},{name:"CIRCLE",id:20}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],18:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],19:[function(require,module,exports){
-module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"Value",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1500},fields:[{rule:"required",type:"ValueType",name:"type",id:10},{rule:"optional",type:"bool",name:"halbit",id:100},{rule:"optional",type:"double",name:"halfloat",id:101},{rule:"optional",type:"sfixed32",name:"hals32",id:102},{rule:"optional",type:"fixed32",name:"halu32",id:103},{rule:"optional",type:"bytes",name:"v_bytes",id:120},{rule:"optional",type:"sfixed32",name:"v_int32",id:130},{rule:"optional",type:"sfixed64",name:"v_int64",id:140},{rule:"optional",type:"fixed32",name:"v_uint32",id:150},{rule:"optional",type:"fixed64",name:"v_uint64",id:160},{rule:"optional",type:"double",name:"v_double",id:170},{rule:"optional",type:"string",name:"v_string",id:180,options:{"(nanopb).max_size":41}},{rule:"optional",type:"bool",name:"v_bool",id:190},{rule:"optional",type:"PmCartesian",name:"carte",id:200},{rule:"optional",type:"EmcPose",name:"pose",id:220}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
+module.exports=require("protobufjs").newBuilder({}).import({package:null,syntax:"proto2",options:{java_package:"fi.kapsi.koti.jpa.nanopb"},messages:[{name:"NanoPBOptions",syntax:"proto2",fields:[{rule:"optional",type:"int32",name:"max_size",id:1},{rule:"optional",type:"int32",name:"max_count",id:2},{rule:"optional",type:"IntSize",name:"int_size",id:7,options:{default:"IS_DEFAULT"}},{rule:"optional",type:"FieldType",name:"type",id:3,options:{default:"FT_DEFAULT"}},{rule:"optional",type:"bool",name:"long_names",id:4,options:{default:!0}},{rule:"optional",type:"bool",name:"packed_struct",id:5,options:{default:!1}},{rule:"optional",type:"bool",name:"skip_message",id:6,options:{default:!1}},{rule:"optional",type:"bool",name:"no_unions",id:8,options:{default:!1}},{rule:"optional",type:"uint32",name:"msgid",id:9}]},{name:"machinetalk",fields:[],syntax:"proto2",messages:[{name:"PmCartesian",syntax:"proto2",options:{"(nanopb_msgopt).msgid":300},fields:[{rule:"optional",type:"double",name:"x",id:10},{rule:"optional",type:"double",name:"y",id:20},{rule:"optional",type:"double",name:"z",id:30}]},{name:"EmcPose",syntax:"proto2",options:{"(nanopb_msgopt).msgid":301},fields:[{rule:"required",type:"PmCartesian",name:"tran",id:10},{rule:"optional",type:"double",name:"a",id:20},{rule:"optional",type:"double",name:"b",id:30},{rule:"optional",type:"double",name:"c",id:40},{rule:"optional",type:"double",name:"u",id:50},{rule:"optional",type:"double",name:"v",id:60},{rule:"optional",type:"double",name:"w",id:70}]},{name:"Value",syntax:"proto2",options:{"(nanopb_msgopt).msgid":1500},fields:[{rule:"required",type:"ValueType",name:"type",id:10},{rule:"optional",type:"bool",name:"halbit",id:100},{rule:"optional",type:"double",name:"halfloat",id:101},{rule:"optional",type:"sfixed32",name:"hals32",id:102},{rule:"optional",type:"fixed32",name:"halu32",id:103},{rule:"optional",type:"bytes",name:"v_bytes",id:120},{rule:"optional",type:"sfixed32",name:"v_int32",id:130},{rule:"optional",type:"sfixed64",name:"v_int64",id:140},{rule:"optional",type:"fixed32",name:"v_uint32",id:150},{rule:"optional",type:"fixed64",name:"v_uint64",id:160},{rule:"optional",type:"double",name:"v_double",id:170},{rule:"optional",type:"string",name:"v_string",id:180,options:{"(nanopb).max_size":41}},{rule:"optional",type:"bool",name:"v_bool",id:190},{rule:"optional",type:"PmCartesian",name:"carte",id:200},{rule:"optional",type:"EmcPose",name:"pose",id:220}]}],enums:[{name:"ValueType",syntax:"proto2",values:[{name:"HAL_BIT",id:1},{name:"HAL_FLOAT",id:2},{name:"HAL_S32",id:3},{name:"HAL_U32",id:4},{name:"HAL_S64",id:5},{name:"HAL_U64",id:6},{name:"STRING",id:7},{name:"BYTES",id:8},{name:"INT32",id:20},{name:"UINT32",id:30},{name:"INT64",id:40},{name:"UINT64",id:50},{name:"DOUBLE",id:60},{name:"BOOL",id:80},{name:"CARTESIAN",id:100},{name:"LEGACY_CARTESIAN",id:110},{name:"POSE",id:120},{name:"LEGACY_POSE",id:130}]},{name:"HalPinDirection",syntax:"proto2",values:[{name:"HAL_IN",id:16},{name:"HAL_OUT",id:32},{name:"HAL_IO",id:48}]},{name:"HalParamDirection",syntax:"proto2",values:[{name:"HAL_RO",id:64},{name:"HAL_RW",id:192}]},{name:"HalFunctType",syntax:"proto2",values:[{name:"FS_LEGACY_THREADFUNC",id:0},{name:"FS_XTHREADFUNC",id:1},{name:"FS_USERLAND",id:2}]},{name:"ObjectType",syntax:"proto2",values:[{name:"HAL_OBJECT_INVALID",id:0},{name:"HAL_PIN",id:1},{name:"HAL_SIGNAL",id:2},{name:"HAL_PARAM",id:3},{name:"HAL_THREAD",id:4},{name:"HAL_FUNCT",id:5},{name:"HAL_COMPONENT",id:6},{name:"HAL_VTABLE",id:7},{name:"HAL_INST",id:8},{name:"HAL_RING",id:9},{name:"HAL_GROUP",id:10},{name:"HAL_MEMBER",id:11},{name:"HAL_PLUG",id:12}]},{name:"msgidType",syntax:"proto2",values:[{name:"MSGID_MAX",id:4e3},{name:"MSGID_ROUTE_DELIMITER",id:4001},{name:"MSGID_ERROR_MSG",id:4002},{name:"MSGID_BLOB",id:4003},{name:"MSGID_STRING",id:4004},{name:"MSGID_HOP",id:4005}]},{name:"socketType",syntax:"proto2",values:[{name:"ST_ZMQ_PAIR",id:0},{name:"ST_ZMQ_PUB",id:1},{name:"ST_ZMQ_SUB",id:2},{name:"ST_ZMQ_REQ",id:3},{name:"ST_ZMQ_REP",id:4},{name:"ST_ZMQ_DEALER",id:5},{name:"ST_ZMQ_ROUTER",id:6},{name:"ST_ZMQ_PULL",id:7},{name:"ST_ZMQ_PUSH",id:8},{name:"ST_ZMQ_XPUB",id:9},{name:"ST_ZMQ_XSUB",id:10},{name:"ST_ZMQ_STREAM",id:11},{name:"ST_ZMQ_INVALID",id:15}]},{name:"securityMechanism",syntax:"proto2",values:[{name:"SM_ZMQ_NONE",id:-1},{name:"SM_ZMQ_NULL",id:0},{name:"SM_ZMQ_PLAIN",id:1},{name:"SM_ZMQ_CURVE",id:2}]},{name:"RCS_STATUS",syntax:"proto2",values:[{name:"UNINITIALIZED_STATUS",id:-1},{name:"RCS_DONE",id:1},{name:"RCS_EXEC",id:2},{name:"RCS_ERROR",id:3},{name:"RCS_RECEIVED",id:4}]},{name:"MsgOrigin",syntax:"proto2",values:[{name:"MSG_KERNEL",id:0},{name:"MSG_RTUSER",id:1},{name:"MSG_ULAPI",id:2}]},{name:"MsgLevel",syntax:"proto2",values:[{name:"RTAPI_MSG_NONE",id:0},{name:"RTAPI_MSG_ERR",id:1},{name:"RTAPI_MSG_WARN",id:2},{name:"RTAPI_MSG_INFO",id:3},{name:"RTAPI_MSG_DBG",id:4},{name:"RTAPI_MSG_ALL",id:5}]},{name:"OriginDetail",syntax:"proto2",values:[{name:"UNIX_SIGNAL",id:10},{name:"INSTANCE_SHUTDOWN",id:20},{name:"ZMQ_SOCKET",id:70},{name:"NML_LAYER",id:80},{name:"RCS_LAYER",id:90},{name:"CMS_LAYER",id:100},{name:"IP_LAYER",id:110},{name:"TCP_LAYER",id:120},{name:"PGM_LAYER",id:130}]},{name:"OriginType",syntax:"proto2",values:[{name:"PROCESS",id:10},{name:"USER_THREAD",id:20},{name:"RT_THREAD",id:30},{name:"COMPONENT",id:40},{name:"THREAD_FUNCTION",id:50},{name:"COMPONENT_INIT",id:60},{name:"COMPONENT_EXIT",id:70},{name:"GROUP",id:80},{name:"PIN",id:90},{name:"SIGNAL",id:100}]},{name:"Severity",syntax:"proto2",values:[{name:"S_INFORMATIONAL",id:1},{name:"S_WARNING",id:2},{name:"S_FAIL",id:4}]},{name:"StatusType",syntax:"proto2",values:[{name:"ENQUEUED",id:1},{name:"PROCESSING",id:2},{name:"COMPLETE",id:3},{name:"FAILED",id:4}]},{name:"ReplyType",syntax:"proto2",values:[{name:"NONE",id:0},{name:"ON_RECEPTION",id:1},{name:"ON_QUEUED",id:2},{name:"ON_COMPLETION",id:4},{name:"ALL_STEPS",id:255}]},{name:"ServiceType",syntax:"proto2",values:[{name:"ST_LOGGING",id:1},{name:"ST_CONFIG",id:2},{name:"ST_REDIS",id:3},{name:"ST_HTTP",id:4},{name:"ST_HTTPS",id:5},{name:"ST_WEBSOCKET",id:6},{name:"ST_WEBSOCKETS",id:7},{name:"ST_RTAPI_COMMAND",id:8},{name:"ST_STP_HALGROUP",id:9},{name:"ST_STP_HALRCOMP",id:10},{name:"ST_STP_INTERP",id:11},{name:"ST_STP_TASK",id:12},{name:"ST_HAL_RCOMMAND",id:13},{name:"ST_TASK_COMMAND",id:14},{name:"ST_INTERP_COMMAND",id:15},{name:"ST_MESSAGEBUS_COMMAND",id:16},{name:"ST_MESSAGEBUS_RESPONSE",id:17}]},{name:"ServiceAPI",syntax:"proto2",values:[{name:"SA_ZMQ_PROTOBUF",id:1},{name:"SA_WS_JSON",id:2}]},{name:"ContainerType",syntax:"proto2",values:[{name:"MT_RTMESSAGE",id:2},{name:"MT_MOTCMD",id:3},{name:"MT_MOTSTATUS",id:4},{name:"MT_LEGACY_MOTCMD",id:5},{name:"MT_LEGACY_MOTSTATUS",id:6},{name:"MT_WOU",id:7},{name:"MT_HALUPDATE",id:8},{name:"MT_RTAPI_MESSAGE",id:9},{name:"MT_LOG_MESSAGE",id:10},{name:"MT_PREVIEW",id:11},{name:"MT_PROGRESS",id:12},{name:"MT_INTERP_STAT",id:13},{name:"MT_SYSLOG",id:18},{name:"MT_LEGACY_NML",id:19},{name:"MT_LEGACY_MOTCONFIG",id:20},{name:"MT_STP_UPDATE_FULL",id:26},{name:"MT_STP_UPDATE",id:28},{name:"MT_STP_NOGROUP",id:27},{name:"MT_SHUTDOWN",id:45},{name:"MT_CONFIRM_SHUTDOWN",id:50},{name:"MT_RTMESSAGE0",id:30},{name:"MT_RTMESSAGE1",id:31},{name:"MT_RTMESSAGE2",id:32},{name:"MT_RTMESSAGE3",id:33},{name:"MT_RTMESSAGE4",id:34},{name:"MT_ASCII",id:100},{name:"MT_UNICODE",id:101},{name:"MT_GCODE",id:102},{name:"MT_PYTHON",id:103},{name:"MT_PICKLE",id:104},{name:"MT_TCL",id:105},{name:"MT_XML",id:106},{name:"MT_JSON",id:107},{name:"MT_JPEG",id:108},{name:"MT_PNG",id:109},{name:"MT_TIFF",id:110},{name:"MT_POSTSCRIPT",id:111},{name:"MT_SVG",id:112},{name:"MT_ZMQ_SUBSCRIBE",id:150},{name:"MT_ZMQ_UNSUBSCRIBE",id:151},{name:"MT_PING",id:210},{name:"MT_PING_ACKNOWLEDGE",id:215},{name:"MT_REJECT",id:220},{name:"MT_DONE",id:240},{name:"MT_SERVICE_REQUEST",id:250},{name:"MT_SERVICE_ANNOUNCEMENT",id:251},{name:"MT_SERVICE_PROBE",id:252},{name:"MT_MESSAGEBUS_NO_DESTINATION",id:255},{name:"MT_HALRCOMP_BIND",id:256},{name:"MT_HALRCOMP_BIND_CONFIRM",id:257},{name:"MT_HALRCOMP_BIND_REJECT",id:258},{name:"MT_HALRCOMP_SET",id:259},{name:"MT_HALRCOMP_SET_REJECT",id:260},{name:"MT_HALRCOMP_ACK",id:263},{name:"MT_HALRCOMMAND_SET",id:265},{name:"MT_HALRCOMMAND_SET_REJECT",id:266},{name:"MT_HALRCOMMAND_GET",id:267},{name:"MT_HALRCOMMAND_GET_REJECT",id:268},{name:"MT_HALRCOMMAND_CREATE",id:269},{name:"MT_HALRCOMMAND_CREATE_REJECT",id:270},{name:"MT_HALRCOMMAND_DELETE",id:271},{name:"MT_HALRCOMMAND_DELETE_REJECT",id:272},{name:"MT_HALRCOMMAND_ACK",id:273},{name:"MT_HALRCOMMAND_ERROR",id:274},{name:"MT_HALRCOMMAND_DESCRIBE",id:276},{name:"MT_HALRCOMMAND_DESCRIPTION",id:277},{name:"MT_HALRCOMP_FULL_UPDATE",id:288},{name:"MT_HALRCOMP_INCREMENTAL_UPDATE",id:289},{name:"MT_HALRCOMP_ERROR",id:290},{name:"MT_HALRCOMP_PACKED_UPDATE",id:291},{name:"MT_HALGROUP_PACKED_UPDATE",id:292},{name:"MT_HALGROUP_BIND",id:294},{name:"MT_HALGROUP_BIND_CONFIRM",id:295},{name:"MT_HALGROUP_BIND_REJECT",id:296},{name:"MT_HALGROUP_FULL_UPDATE",id:297},{name:"MT_HALGROUP_INCREMENTAL_UPDATE",id:298},{name:"MT_HALGROUP_ERROR",id:299},{name:"MT_RTAPI_APP_EXIT",id:300},{name:"MT_RTAPI_APP_PING",id:301},{name:"MT_RTAPI_APP_LOADRT",id:302},{name:"MT_RTAPI_APP_LOG",id:303},{name:"MT_RTAPI_APP_UNLOADRT",id:305},{name:"MT_RTAPI_APP_NEWINST",id:306},{name:"MT_RTAPI_APP_NEWTHREAD",id:307},{name:"MT_RTAPI_APP_DELTHREAD",id:308},{name:"MT_RTAPI_APP_CALLFUNC",id:309},{name:"MT_RTAPI_APP_REPLY",id:310},{name:"MT_RTAPI_APP_DELINST",id:311},{name:"MT_LIST_APPLICATIONS",id:350},{name:"MT_DESCRIBE_APPLICATION",id:351},{name:"MT_RETRIEVE_APPLICATION",id:352},{name:"MT_APPLICATION_DETAIL",id:353},{name:"MT_ERROR",id:360},{name:"MT_FULL_UPDATE",id:370},{name:"MT_INCREMENTAL_UPDATE",id:371},{name:"MT_TASK_REPLY",id:400},{name:"MT_TICKET_UPDATE",id:401},{name:"MT_CREDIT_UPDATE",id:450},{name:"MT_EMCMOT_LOWER",id:1e3},{name:"MT_EMCMOT_UPPER",id:1100},{name:"MT_EMCMOT_ABORT",id:1001},{name:"MT_EMCMOT_AXIS_ABORT",id:1002},{name:"MT_EMCMOT_ENABLE",id:1003},{name:"MT_EMCMOT_DISABLE",id:1004},{name:"MT_EMCMOT_ENABLE_AMPLIFIER",id:1005},{name:"MT_EMCMOT_DISABLE_AMPLIFIER",id:1006},{name:"MT_EMCMOT_ENABLE_WATCHDOG",id:1007},{name:"MT_EMCMOT_DISABLE_WATCHDOG",id:1008},{name:"MT_EMCMOT_ACTIVATE_JOINT",id:1009},{name:"MT_EMCMOT_DEACTIVATE_JOINT",id:1010},{name:"MT_EMCMOT_PAUSE",id:1011},{name:"MT_EMCMOT_RESUME",id:1012},{name:"MT_EMCMOT_STEP",id:1013},{name:"MT_EMCMOT_FREE",id:1014},{name:"MT_EMCMOT_COORD",id:1015},{name:"MT_EMCMOT_TELEOP",id:1016},{name:"MT_EMCMOT_SPINDLE_SCALE",id:1017},{name:"MT_EMCMOT_SS_ENABLE",id:1018},{name:"MT_EMCMOT_FEED_SCALE",id:1019},{name:"MT_EMCMOT_FS_ENABLE",id:1020},{name:"MT_EMCMOT_FH_ENABLE",id:1021},{name:"MT_EMCMOT_AF_ENABLE",id:1022},{name:"MT_EMCMOT_OVERRIDE_LIMITS",id:1023},{name:"MT_EMCMOT_HOME",id:1024},{name:"MT_EMCMOT_UNHOME",id:1025},{name:"MT_EMCMOT_JOG_CONT",id:1026},{name:"MT_EMCMOT_JOG_INCR",id:1027},{name:"MT_EMCMOT_JOG_ABS",id:1028},{name:"MT_EMCMOT_SET_LINE",id:1029},{name:"MT_EMCMOT_SET_CIRCLE",id:1030},{name:"MT_EMCMOT_SET_TELEOP_VECTOR",id:1031},{name:"MT_EMCMOT_CLEAR_PROBE_FLAGS",id:1032},{name:"MT_EMCMOT_PROBE",id:1033},{name:"MT_EMCMOT_RIGID_TAP",id:1034},{name:"MT_EMCMOT_SET_POSITION_LIMITS",id:1035},{name:"MT_EMCMOT_SET_BACKLASH",id:1036},{name:"MT_EMCMOT_SET_MIN_FERROR",id:1037},{name:"MT_EMCMOT_SET_MAX_FERROR",id:1038},{name:"MT_EMCMOT_SET_VEL",id:1039},{name:"MT_EMCMOT_SET_VEL_LIMIT",id:1040},{name:"MT_EMCMOT_SET_JOINT_VEL_LIMIT",id:1041},{name:"MT_EMCMOT_SET_JOINT_ACC_LIMIT",id:1042},{name:"MT_EMCMOT_SET_ACC",id:1043},{name:"MT_EMCMOT_SET_TERM_COND",id:1044},{name:"MT_EMCMOT_SET_NUM_AXES",id:1045},{name:"MT_EMCMOT_SET_WORLD_HOME",id:1046},{name:"MT_EMCMOT_SET_HOMING_PARAMS",id:1047},{name:"MT_EMCMOT_SET_DEBUG",id:1048},{name:"MT_EMCMOT_SET_DOUT",id:1049},{name:"MT_EMCMOT_SET_AOUT",id:1050},{name:"MT_EMCMOT_SET_SPINDLESYNC",id:1051},{name:"MT_EMCMOT_SPINDLE_ON",id:1052},{name:"MT_EMCMOT_SPINDLE_OFF",id:1053},{name:"MT_EMCMOT_SPINDLE_INCREASE",id:1054},{name:"MT_EMCMOT_SPINDLE_DECREASE",id:1055},{name:"MT_EMCMOT_SPINDLE_BRAKE_ENGAGE",id:1056},{name:"MT_EMCMOT_SPINDLE_BRAKE_RELEASE",id:1057},{name:"MT_EMCMOT_SET_MOTOR_OFFSET",id:1058},{name:"MT_EMCMOT_SET_JOINT_COMP",id:1059},{name:"MT_EMCMOT_SET_OFFSET",id:1060},{name:"MT_EMCMOT_COMMAND_OK",id:1061},{name:"MT_EMCMOT_COMMAND_UNKNOWN_COMMAND",id:1062},{name:"MT_EMCMOT_COMMAND_INVALID_COMMAND",id:1063},{name:"MT_EMCMOT_COMMAND_INVALID_PARAMS",id:1064},{name:"MT_EMCMOT_COMMAND_BAD_EXEC",id:1065},{name:"MT_EMCMOT_MOTION_DISABLED",id:1066},{name:"MT_EMCMOT_MOTION_FREE",id:1067},{name:"MT_EMCMOT_MOTION_TELEOP",id:1068},{name:"MT_EMCMOT_MOTION_COORD",id:1069},{name:"MT_EMCMOT_JOINT_FLAG",id:1070},{name:"MT_EMCMOT_MOTION_FLAG",id:1071},{name:"MT_PRU_FIRMWARE",id:2048},{name:"MT_MESA_5I20_FIRMWARE",id:3e3},{name:"MT_BLOB",id:4e3},{name:"MT_TEST1",id:5001},{name:"MT_TEST2",id:5002},{name:"MT_TEST3",id:5003},{name:"MT_EMC_NML_LOWER",id:1e4},{name:"MT_EMC_NML_UPPER",id:13e3},{name:"MT_EMC_OPERATOR_ERROR",id:10011},{name:"MT_EMC_OPERATOR_TEXT",id:10012},{name:"MT_EMC_OPERATOR_DISPLAY",id:10013},{name:"MT_EMC_NULL",id:10021},{name:"MT_EMC_SET_DEBUG",id:10022},{name:"MT_EMC_SYSTEM_CMD",id:10030},{name:"MT_EMC_AXIS_SET_AXIS",id:10101},{name:"MT_EMC_AXIS_SET_UNITS",id:10102},{name:"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT",id:10107},{name:"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT",id:10108},{name:"MT_EMC_TOOL_START_CHANGE",id:1110},{name:"MT_EMC_EXEC_PLUGIN_CALL",id:1112},{name:"MT_EMC_IO_PLUGIN_CALL",id:1113},{name:"MT_EMC_AXIS_SET_FERROR",id:10111},{name:"MT_EMC_AXIS_SET_HOMING_PARAMS",id:10112},{name:"MT_EMC_AXIS_SET_MIN_FERROR",id:10115},{name:"MT_EMC_AXIS_SET_MAX_VELOCITY",id:10116},{name:"MT_EMC_AXIS_INIT",id:10118},{name:"MT_EMC_AXIS_HALT",id:10119},{name:"MT_EMC_AXIS_ABORT",id:10120},{name:"MT_EMC_AXIS_ENABLE",id:10121},{name:"MT_EMC_AXIS_DISABLE",id:10122},{name:"MT_EMC_AXIS_HOME",id:10123},{name:"MT_EMC_AXIS_UNHOME",id:10135},{name:"MT_EMC_AXIS_JOG",id:10124},{name:"MT_EMC_AXIS_INCR_JOG",id:10125},{name:"MT_EMC_AXIS_ABS_JOG",id:10126},{name:"MT_EMC_AXIS_ACTIVATE",id:10127},{name:"MT_EMC_AXIS_DEACTIVATE",id:10128},{name:"MT_EMC_AXIS_OVERRIDE_LIMITS",id:10129},{name:"MT_EMC_AXIS_LOAD_COMP",id:10131},{name:"MT_EMC_AXIS_SET_BACKLASH",id:10134},{name:"MT_EMC_AXIS_STAT",id:10199},{name:"MT_EMC_TRAJ_SET_AXES",id:10201},{name:"MT_EMC_TRAJ_SET_UNITS",id:10202},{name:"MT_EMC_TRAJ_SET_CYCLE_TIME",id:10203},{name:"MT_EMC_TRAJ_SET_MODE",id:10204},{name:"MT_EMC_TRAJ_SET_VELOCITY",id:10205},{name:"MT_EMC_TRAJ_SET_ACCELERATION",id:10206},{name:"MT_EMC_TRAJ_SET_MAX_VELOCITY",id:10207},{name:"MT_EMC_TRAJ_SET_MAX_ACCELERATION",id:10208},{name:"MT_EMC_TRAJ_SET_SCALE",id:10209},{name:"MT_EMC_TRAJ_SET_MOTION_ID",id:10210},{name:"MT_EMC_TRAJ_INIT",id:10211},{name:"MT_EMC_TRAJ_HALT",id:10212},{name:"MT_EMC_TRAJ_ENABLE",id:10213},{name:"MT_EMC_TRAJ_DISABLE",id:10214},{name:"MT_EMC_TRAJ_ABORT",id:10215},{name:"MT_EMC_TRAJ_PAUSE",id:10216},{name:"MT_EMC_TRAJ_STEP",id:10217},{name:"MT_EMC_TRAJ_RESUME",id:10218},{name:"MT_EMC_TRAJ_DELAY",id:10219},{name:"MT_EMC_TRAJ_LINEAR_MOVE",id:10220},{name:"MT_EMC_TRAJ_CIRCULAR_MOVE",id:10221},{name:"MT_EMC_TRAJ_SET_TERM_COND",id:10222},{name:"MT_EMC_TRAJ_SET_OFFSET",id:10223},{name:"MT_EMC_TRAJ_SET_G5X",id:10224},{name:"MT_EMC_TRAJ_SET_HOME",id:10225},{name:"MT_EMC_TRAJ_SET_ROTATION",id:10226},{name:"MT_EMC_TRAJ_SET_G92",id:10227},{name:"MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG",id:10228},{name:"MT_EMC_TRAJ_PROBE",id:10229},{name:"MT_EMC_TRAJ_SET_TELEOP_ENABLE",id:10230},{name:"MT_EMC_TRAJ_SET_TELEOP_VECTOR",id:10231},{name:"MT_EMC_TRAJ_SET_SPINDLESYNC",id:10232},{name:"MT_EMC_TRAJ_SET_SPINDLE_SCALE",id:10233},{name:"MT_EMC_TRAJ_SET_FO_ENABLE",id:10234},{name:"MT_EMC_TRAJ_SET_SO_ENABLE",id:10235},{name:"MT_EMC_TRAJ_SET_FH_ENABLE",id:10236},{name:"MT_EMC_TRAJ_RIGID_TAP",id:10237},{name:"MT_EMC_TRAJ_SET_RAPID_SCALE",id:10238},{name:"MT_EMC_TRAJ_STAT",id:10299},{name:"MT_EMC_MOTION_INIT",id:10301},{name:"MT_EMC_MOTION_HALT",id:10302},{name:"MT_EMC_MOTION_ABORT",id:10303},{name:"MT_EMC_MOTION_SET_AOUT",id:10304},{name:"MT_EMC_MOTION_SET_DOUT",id:10305},{name:"MT_EMC_MOTION_ADAPTIVE",id:10306},{name:"MT_EMC_SPINDLE_ORIENT",id:10317},{name:"MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE",id:10318},{name:"MT_EMC_MOTION_STAT",id:10399},{name:"MT_EMC_TASK_INIT",id:10501},{name:"MT_EMC_TASK_HALT",id:10502},{name:"MT_EMC_TASK_ABORT",id:10503},{name:"MT_EMC_TASK_SET_MODE",id:10504},{name:"MT_EMC_TASK_SET_STATE",id:10505},{name:"MT_EMC_TASK_PLAN_OPEN",id:10506},{name:"MT_EMC_TASK_PLAN_RUN",id:10507},{name:"MT_EMC_TASK_PLAN_READ",id:10508},{name:"MT_EMC_TASK_PLAN_EXECUTE",id:10509},{name:"MT_EMC_TASK_PLAN_PAUSE",id:10510},{name:"MT_EMC_TASK_PLAN_STEP",id:10511},{name:"MT_EMC_TASK_PLAN_RESUME",id:10512},{name:"MT_EMC_TASK_PLAN_END",id:10513},{name:"MT_EMC_TASK_PLAN_CLOSE",id:10514},{name:"MT_EMC_TASK_PLAN_INIT",id:10515},{name:"MT_EMC_TASK_PLAN_SYNCH",id:10516},{name:"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP",id:10517},{name:"MT_EMC_TASK_PLAN_SET_BLOCK_DELETE",id:10518},{name:"MT_EMC_TASK_PLAN_OPTIONAL_STOP",id:10519},{name:"MT_EMC_TASK_PLAN_RESET",id:10520},{name:"MT_EMC_TASK_PLAN_REPLY",id:10530},{name:"MT_EMC_TASK_STAT",id:10599},{name:"MT_EMC_TOOL_INIT",id:11101},{name:"MT_EMC_TOOL_HALT",id:11102},{name:"MT_EMC_TOOL_ABORT",id:11103},{name:"MT_EMC_TOOL_PREPARE",id:11104},{name:"MT_EMC_TOOL_LOAD",id:11105},{name:"MT_EMC_TOOL_UNLOAD",id:11106},{name:"MT_EMC_TOOL_LOAD_TOOL_TABLE",id:11107},{name:"MT_EMC_TOOL_SET_OFFSET",id:11108},{name:"MT_EMC_TOOL_SET_NUMBER",id:11109},{name:"MT_EMC_TOOL_UPDATE_TOOL_TABLE",id:11110},{name:"MT_EMC_TOOL_STAT",id:11199},{name:"MT_EMC_AUX_ESTOP_ON",id:11206},{name:"MT_EMC_AUX_ESTOP_OFF",id:11207},{name:"MT_EMC_AUX_ESTOP_RESET",id:11208},{name:"MT_EMC_AUX_INPUT_WAIT",id:11209},{name:"MT_EMC_AUX_STAT",id:11299},{name:"MT_EMC_SPINDLE_ON",id:11304},{name:"MT_EMC_SPINDLE_OFF",id:11305},{name:"MT_EMC_SPINDLE_INCREASE",id:11309},{name:"MT_EMC_SPINDLE_DECREASE",id:11310},{name:"MT_EMC_SPINDLE_CONSTANT",id:11311},{name:"MT_EMC_SPINDLE_BRAKE_RELEASE",id:11312},{name:"MT_EMC_SPINDLE_BRAKE_ENGAGE",id:11313},{name:"MT_EMC_SPINDLE_SPEED",id:11316},{name:"MT_EMC_SPINDLE_STAT",id:11399},{name:"MT_EMC_COOLANT_MIST_ON",id:11404},{name:"MT_EMC_COOLANT_MIST_OFF",id:11405},{name:"MT_EMC_COOLANT_FLOOD_ON",id:11406},{name:"MT_EMC_COOLANT_FLOOD_OFF",id:11407},{name:"MT_EMC_COOLANT_STAT",id:11499},{name:"MT_EMC_LUBE_ON",id:11504},{name:"MT_EMC_LUBE_OFF",id:11505},{name:"MT_EMC_LUBE_STAT",id:11599},{name:"MT_EMC_IO_INIT",id:11601},{name:"MT_EMC_IO_HALT",id:11602},{name:"MT_EMC_IO_ABORT",id:11603},{name:"MT_EMC_IO_SET_CYCLE_TIME",id:11604},{name:"MT_EMC_IO_STAT",id:11699},{name:"MT_EMC_INIT",id:11901},{name:"MT_EMC_HALT",id:11902},{name:"MT_EMC_ABORT",id:11903},{name:"MT_EMC_STAT",id:11999},{name:"MT_EMCSTAT_FULL_UPDATE",id:12500},{name:"MT_EMCSTAT_INCREMENTAL_UPDATE",id:12501},{name:"MT_EMC_NML_ERROR",id:12510},{name:"MT_EMC_NML_TEXT",id:12511},{name:"MT_EMC_NML_DISPLAY",id:12512},{name:"MT_EMCCMD_EXECUTED",id:12520},{name:"MT_EMCCMD_COMPLETED",id:12521},{name:"MT_LAUNCHER_FULL_UPDATE",id:12600},{name:"MT_LAUNCHER_INCREMENTAL_UPDATE",id:12601},{name:"MT_LAUNCHER_ERROR",id:12602},{name:"MT_LAUNCHER_START",id:12610},{name:"MT_LAUNCHER_TERMINATE",id:12611},{name:"MT_LAUNCHER_KILL",id:12612},{name:"MT_LAUNCHER_WRITE_STDIN",id:12613},{name:"MT_LAUNCHER_CALL",id:12614},{name:"MT_LAUNCHER_SHUTDOWN",id:12615},{name:"MT_LAUNCHER_SET",id:12616}]},{name:"OriginIndex",syntax:"proto2",values:[{name:"ORIGIN_UNKNOWN",id:0},{name:"ORIGIN_G54",id:1},{name:"ORIGIN_G55",id:2},{name:"ORIGIN_G56",id:3},{name:"ORIGIN_G57",id:4},{name:"ORIGIN_G58",id:5},{name:"ORIGIN_G59",id:6},{name:"ORIGIN_G59_1",id:7},{name:"ORIGIN_G59_2",id:8},{name:"ORIGIN_G59_3",id:9}]},{name:"TermConditionType",syntax:"proto2",values:[{name:"_EMC_TRAJ_TERM_COND_STOP",id:1},{name:"_EMC_TRAJ_TERM_COND_BLEND",id:2}]},{name:"CanonDirection",syntax:"proto2",values:[{name:"_CANON_STOPPED",id:1},{name:"_CANON_CLOCKWISE",id:2},{name:"_CANON_COUNTERCLOCKWISE",id:3}]},{name:"InputType",syntax:"proto2",values:[{name:"_ANALOG_INPUT",id:0},{name:"_DIGITAL_INPUT",id:1}]},{name:"WaitType",syntax:"proto2",values:[{name:"IMMEDIATE",id:0},{name:"RISE",id:1},{name:"FALL",id:2},{name:"BE_HIGH",id:3},{name:"BE_LOW",id:4}]},{name:"InterpreterStateType",syntax:"proto2",values:[{name:"INTERP_IDLE",id:1},{name:"INTERP_RUNNING",id:2},{name:"INTERP_SYNC_WAIT",id:3},{name:"INTERP_PAUSED",id:4},{name:"INTERP_QUEUE_WAIT",id:5},{name:"INTERP_ABORT_WAIT",id:6},{name:"INTERP_STATE_UNSET",id:99}]}],isNamespace:!0}],enums:[{name:"FieldType",syntax:"proto2",values:[{name:"FT_DEFAULT",id:0},{name:"FT_CALLBACK",id:1},{name:"FT_POINTER",id:4},{name:"FT_STATIC",id:2},{name:"FT_IGNORE",id:3}]},{name:"IntSize",syntax:"proto2",values:[{name:"IS_DEFAULT",id:0},{name:"IS_8",id:8},{name:"IS_16",id:16},{name:"IS_32",id:32},{name:"IS_64",id:64}]}],isNamespace:!0}).build();
 },{"protobufjs":25}],20:[function(require,module,exports){
 module.exports.canon=require("./machinetalk/protobuf/canon.js").pb,module.exports.config=require("./machinetalk/protobuf/config.js").pb,module.exports.emcclass=require("./machinetalk/protobuf/emcclass.js").pb,module.exports.firmware=require("./machinetalk/protobuf/firmware.js").pb,module.exports.jplan=require("./machinetalk/protobuf/jplan.js").pb,module.exports.log=require("./machinetalk/protobuf/log.js").pb,module.exports.message=require("./machinetalk/protobuf/message.js").pb,module.exports.motcmds=require("./machinetalk/protobuf/motcmds.js").pb,module.exports.nanopb=require("./machinetalk/protobuf/nanopb.js").pb,module.exports.object=require("./machinetalk/protobuf/object.js").pb,module.exports.preview=require("./machinetalk/protobuf/preview.js").pb,module.exports.ros=require("./machinetalk/protobuf/ros.js").pb,module.exports.rtapi_message=require("./machinetalk/protobuf/rtapi_message.js").pb,module.exports.rtapicommand=require("./machinetalk/protobuf/rtapicommand.js").pb,module.exports.status=require("./machinetalk/protobuf/status.js").pb,module.exports.task=require("./machinetalk/protobuf/task.js").pb,module.exports.test=require("./machinetalk/protobuf/test.js").pb,module.exports.types=require("./machinetalk/protobuf/types.js").pb,module.exports.value=require("./machinetalk/protobuf/value.js").pb;
 },{"./machinetalk/protobuf/canon.js":1,"./machinetalk/protobuf/config.js":2,"./machinetalk/protobuf/emcclass.js":3,"./machinetalk/protobuf/firmware.js":4,"./machinetalk/protobuf/jplan.js":5,"./machinetalk/protobuf/log.js":6,"./machinetalk/protobuf/message.js":7,"./machinetalk/protobuf/motcmds.js":8,"./machinetalk/protobuf/nanopb.js":9,"./machinetalk/protobuf/object.js":10,"./machinetalk/protobuf/preview.js":11,"./machinetalk/protobuf/ros.js":12,"./machinetalk/protobuf/rtapi_message.js":13,"./machinetalk/protobuf/rtapicommand.js":14,"./machinetalk/protobuf/status.js":15,"./machinetalk/protobuf/task.js":16,"./machinetalk/protobuf/test.js":17,"./machinetalk/protobuf/types.js":18,"./machinetalk/protobuf/value.js":19}],21:[function(require,module,exports){
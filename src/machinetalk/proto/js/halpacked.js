@@ -0,0 +1,111 @@
+// Decoder for packed HAL group and remote component updates.
+//
+// Groups and remote components created with the 'packed' flag send
+// MT_HALGROUP_PACKED_UPDATE and MT_HALRCOMP_PACKED_UPDATE messages,
+// which carry their values in Container.packed instead of one Signal
+// or Pin each. The format is described in message.proto.
+//
+// decode(packed, types) takes the packed bytes (a Buffer, Uint8Array
+// or ByteBuffer) and the HAL type of every item by index, as listed in
+// Container.packed_handle of the full update, and returns an array of
+// [index, value] pairs in index order. 64 bit integers are returned as
+// strings to avoid losing precision.
+
+'use strict';
+
+var HAL_BIT = 1;
+var HAL_FLOAT = 2;
+var HAL_S32 = 3;
+var HAL_U32 = 4;
+var HAL_S64 = 5;
+var HAL_U64 = 6;
+
+var VERSION = 1;
+var ALL_ITEMS = 1;   // flags: no bitmap, all items present
+var HEADER_SIZE = 6;
+
+function toUint8Array(packed) {
+    if (packed instanceof Uint8Array)
+        return packed;
+    if (packed && packed.buffer && typeof packed.offset === 'number')
+        // ByteBuffer
+        return new Uint8Array(packed.buffer.slice(packed.offset, packed.limit));
+    return new Uint8Array(packed);
+}
+
+function bit(data, offset, n) {
+    return (data[offset + (n >> 3)] >> (n & 7)) & 1;
+}
+
+function int64(view, offset, signed) {
+    var lo = view.getUint32(offset, true);
+    var hi = signed ? view.getInt32(offset + 4, true) : view.getUint32(offset + 4, true);
+    if (typeof BigInt === 'function')
+        return (BigInt(hi) * BigInt(4294967296) + BigInt(lo)).toString();
+    return String(hi * 4294967296 + lo);
+}
+
+var arrays = [
+    [HAL_FLOAT, 8, function (v, o) { return v.getFloat64(o, true); }],
+    [HAL_S32, 4, function (v, o) { return v.getInt32(o, true); }],
+    [HAL_U32, 4, function (v, o) { return v.getUint32(o, true); }],
+    [HAL_S64, 8, function (v, o) { return int64(v, o, true); }],
+    [HAL_U64, 8, function (v, o) { return int64(v, o, false); }]
+];
+
+function decode(packed, types) {
+    var data = toUint8Array(packed);
+    var view = new DataView(data.buffer, data.byteOffset, data.byteLength);
+    var i, k;
+
+    if (data.length < HEADER_SIZE)
+        throw new Error('packed update too short');
+    var version = data[0];
+    var flags = data[1];
+    var n = view.getUint32(2, true);
+    if (version !== VERSION)
+        throw new Error('unsupported packed update version ' + version);
+    if (n !== types.length)
+        throw new Error('packed update has ' + n + ' items, expected ' + types.length);
+    var offset = HEADER_SIZE;
+
+    var present = [];
+    for (i = 0; i < n; i++)
+        if ((flags & ALL_ITEMS) || bit(data, offset, i))
+            present.push(i);
+    if (!(flags & ALL_ITEMS))
+        offset += (n + 7) >> 3;
+
+    var byType = {};
+    present.forEach(function (i) {
+        (byType[types[i]] = byType[types[i]] || []).push(i);
+    });
+
+    var values = {};
+    var bits = byType[HAL_BIT] || [];
+    for (k = 0; k < bits.length; k++)
+        values[bits[k]] = bit(data, offset, k) === 1;
+    offset += (bits.length + 7) >> 3;
+
+    arrays.forEach(function (a) {
+        var items = byType[a[0]] || [];
+        if (offset + items.length * a[1] > data.length)
+            throw new Error('packed update truncated');
+        for (k = 0; k < items.length; k++) {
+            values[items[k]] = a[2](view, offset);
+            offset += a[1];
+        }
+    });
+
+    return present.filter(function (i) {
+        return i in values;
+    }).map(function (i) {
+        return [i, values[i]];
+    });
+}
+
+module.exports = {
+    VERSION: VERSION,
+    ALL_ITEMS: ALL_ITEMS,
+    decode: decode
+};
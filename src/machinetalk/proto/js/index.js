@@ -1 +1,2 @@
 module.exports = require('../build/js/protoexport.js');
+module.exports.halpacked = require('./halpacked');
@@ -0,0 +1,90 @@
+"""Decoder for packed HAL group and remote component updates.
+
+Groups and remote components created with the 'packed' flag send
+MT_HALGROUP_PACKED_UPDATE and MT_HALRCOMP_PACKED_UPDATE messages, which
+carry their values in Container.packed instead of one Signal or Pin
+each. The format is described in message.proto.
+
+The full update lists the handles in Container.packed_handle, and the
+type of each in its Signal or Pin:
+
+    handles = list(rx.packed_handle)
+    types = dict((s.handle, s.type) for s in rx.signal)
+    types = [types[h] for h in handles]
+
+    for index, value in decode(rx.packed, types):
+        print(handles[index], value)
+"""
+
+import struct
+
+from machinetalk.protobuf.types_pb2 import HAL_BIT, HAL_FLOAT, HAL_S32, \
+    HAL_U32, HAL_S64, HAL_U64
+
+VERSION = 1
+ALL_ITEMS = 1  # flags: no bitmap, all items present
+
+_HEADER = struct.Struct('<BBI')
+
+# value arrays, in the order they follow each other
+_ARRAYS = [
+    (HAL_FLOAT, '<%dd', 8),
+    (HAL_S32, '<%di', 4),
+    (HAL_U32, '<%dI', 4),
+    (HAL_S64, '<%dq', 8),
+    (HAL_U64, '<%dQ', 8),
+]
+
+
+def _bit(data, offset, n):
+    return (data[offset + n // 8] >> (n % 8)) & 1
+
+
+def decode(packed, types):
+    """Decode a packed update.
+
+    packed: the Container.packed bytes
+    types: the HAL type of every item, by index
+
+    Returns a list of (index, value) tuples in index order. Bits are
+    returned as bool, all other types as int or float.
+    """
+    data = bytearray(packed)
+    if len(data) < _HEADER.size:
+        raise ValueError('packed update too short')
+    version, flags, n = _HEADER.unpack_from(data, 0)
+    if version != VERSION:
+        raise ValueError('unsupported packed update version %d' % version)
+    if n != len(types):
+        raise ValueError('packed update has %d items, expected %d'
+                         % (n, len(types)))
+    offset = _HEADER.size
+
+    if flags & ALL_ITEMS:
+        present = list(range(n))
+    else:
+        present = [i for i in range(n) if _bit(data, offset, i)]
+        offset += (n + 7) // 8
+
+    by_type = {}
+    for i in present:
+        by_type.setdefault(types[i], []).append(i)
+
+    values = {}
+    bits = by_type.get(HAL_BIT, [])
+    for k, i in enumerate(bits):
+        values[i] = bool(_bit(data, offset, k))
+    offset += (len(bits) + 7) // 8
+
+    for hal_type, fmt, size in _ARRAYS:
+        items = by_type.get(hal_type, [])
+        if not items:
+            continue
+        if offset + len(items) * size > len(data):
+            raise ValueError('packed update truncated')
+        for i, v in zip(items, struct.unpack_from(fmt % len(items),
+                                                  bytes(data), offset)):
+            values[i] = v
+        offset += len(items) * size
+
+    return [(i, values[i]) for i in present if i in values]
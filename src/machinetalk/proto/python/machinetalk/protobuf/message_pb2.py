@@ -32,7 +32,7 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   name='machinetalk/protobuf/message.proto',
   package='machinetalk',
   syntax='proto2',
-  serialized_pb=_b('\n\"machinetalk/protobuf/message.proto\x12\x0bmachinetalk\x1a!machinetalk/protobuf/nanopb.proto\x1a machinetalk/protobuf/types.proto\x1a!machinetalk/protobuf/object.proto\x1a\x1emachinetalk/protobuf/log.proto\x1a\"machinetalk/protobuf/motcmds.proto\x1a\x1fmachinetalk/protobuf/task.proto\x1a machinetalk/protobuf/canon.proto\x1a machinetalk/protobuf/value.proto\x1a\'machinetalk/protobuf/rtapicommand.proto\x1a(machinetalk/protobuf/rtapi_message.proto\x1a!machinetalk/protobuf/config.proto\x1a\"machinetalk/protobuf/preview.proto\x1a!machinetalk/protobuf/status.proto\"\xed\"\n\tContainer\x12(\n\x04type\x18\x01 \x02(\x0e\x32\x1a.machinetalk.ContainerType\x12\x0b\n\x03tsc\x18\x07 \x01(\x10\x12,\n\x07preview\x18\x08 \x03(\x0b\x32\x14.machinetalk.PreviewB\x05\x92?\x02\x18\x03\x12*\n\x06motcmd\x18\t \x01(\x0b\x32\x1a.machinetalk.MotionCommand\x12*\n\x07motstat\x18\n \x01(\x0b\x32\x19.machinetalk.MotionStatus\x12\x1c\n\rlegacy_motcmd\x18\x0b \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x1d\n\x0elegacy_motstat\x18\x0c \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x31\n\rrtapi_message\x18\r \x01(\x0b\x32\x1a.machinetalk.RTAPI_Message\x12\x31\n\ntask_reply\x18\x0e \x01(\x0b\x32\x16.machinetalk.TaskReplyB\x05\x92?\x02\x18\x03\x12\x30\n\rticket_update\x18\x0f \x01(\x0b\x32\x19.machinetalk.TicketUpdate\x12\x15\n\x06syslog\x18\x12 \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x19\n\nlegacy_nml\x18\x13 \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x1f\n\x10legacy_motconfig\x18\x14 \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x0e\n\x06tv_sec\x18\x15 \x01(\x05\x12\x0f\n\x07tv_nsec\x18\x16 \x01(\x05\x12\r\n\x05topic\x18\x17 \x01(\t\x12\x16\n\x0ereply_required\x18\x18 \x01(\x08\x12>\n\x0cinterp_state\x18\x19 \x01(\x0e\x32!.machinetalk.InterpreterStateTypeB\x05\x92?\x02\x18\x03\x12\x13\n\x0binterp_name\x18\x1a \x01(\t\x12\x0c\n\x04rsvp\x18\x1e \x01(\x05\x12/\n\x0bin_reply_to\x18! \x01(\x0e\x32\x1a.machinetalk.ContainerType\x12+\n\nrcs_status\x18# \x01(\x0e\x32\x17.machinetalk.RCS_STATUS\x12\'\n\x06status\x18( \x01(\x0e\x32\x17.machinetalk.StatusType\x12\x0e\n\x06serial\x18- \x01(\x05\x12\x14\n\x0creply_serial\x18\x32 \x01(\x05\x12\x0e\n\x06ticket\x18\x37 \x01(\x05\x12\x14\n\x0creply_ticket\x18< \x01(\x05\x12\x10\n\x08sequence\x18> \x01(\x05\x12\x0e\n\x06\x63redit\x18\x41 \x01(\x05\x12\x13\n\x0bline_number\x18\x42 \x01(\x05\x12\x13\n\x04name\x18\x43 \x01(\tB\x05\x92?\x02\x18\x03\x12\x0c\n\x04note\x18\x44 \x03(\t\x12\x0f\n\x07retcode\x18\x45 \x01(\x05\x12\x13\n\x04uuid\x18H \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\r\n\x05trace\x18K \x01(\x08\x12\x10\n\x08instance\x18M \x01(\x05\x12(\n\x05value\x18U \x03(\x0b\x32\x12.machinetalk.ValueB\x05\x92?\x02\x18\x03\x12\x32\n\x08rtapicmd\x18V \x01(\x0b\x32\x19.machinetalk.RTAPICommandB\x05\x92?\x02\x18\x03\x12\x45\n\x14service_announcement\x18X \x03(\x0b\x32 .machinetalk.ServiceAnnouncementB\x05\x92?\x02\x18\x03\x12+\n\x04\x63omp\x18\x64 \x03(\x0b\x32\x16.machinetalk.ComponentB\x05\x92?\x02\x18\x03\x12$\n\x03pin\x18\x02 \x03(\x0b\x32\x10.machinetalk.PinB\x05\x92?\x02\x18\x03\x12*\n\x06signal\x18\x03 \x03(\x0b\x32\x13.machinetalk.SignalB\x05\x92?\x02\x18\x03\x12(\n\x05param\x18g \x03(\x0b\x32\x12.machinetalk.ParamB\x05\x92?\x02\x18\x03\x12*\n\x06thread\x18h \x03(\x0b\x32\x13.machinetalk.ThreadB\x05\x92?\x02\x18\x03\x12&\n\x04ring\x18i \x03(\x0b\x32\x11.machinetalk.RingB\x05\x92?\x02\x18\x03\x12(\n\x05group\x18j \x03(\x0b\x32\x12.machinetalk.GroupB\x05\x92?\x02\x18\x03\x12*\n\x06member\x18k \x03(\x0b\x32\x13.machinetalk.MemberB\x05\x92?\x02\x18\x03\x12.\n\x08\x66unction\x18l \x03(\x0b\x32\x15.machinetalk.FunctionB\x05\x92?\x02\x18\x03\x12\x37\n\x07pparams\x18m \x01(\x0b\x32\x1f.machinetalk.ProtocolParametersB\x05\x92?\x02\x18\x03\x12*\n\x06vtable\x18n \x03(\x0b\x32\x13.machinetalk.VtableB\x05\x92?\x02\x18\x03\x12&\n\x04inst\x18o \x03(\x0b\x32\x11.machinetalk.InstB\x05\x92?\x02\x18\x03\x12,\n\x03\x61pp\x18x \x03(\x0b\x32\x18.machinetalk.ApplicationB\x05\x92?\x02\x18\x03\x12/\n\x08launcher\x18\x82\x01 \x03(\x0b\x32\x15.machinetalk.LauncherB\x05\x92?\x02\x18\x03\x12\x15\n\x05index\x18\x83\x01 \x01(\x05\x42\x05\x92?\x02\x18\x03\x12\x33\n\x0blog_message\x18W \x01(\x0b\x32\x17.machinetalk.LogMessageB\x05\x92?\x02\x18\x03\x12\x37\n\ttpexecute\x18\xc8\x01 \x01(\x0b\x32\x1c.machinetalk.TaskPlanExecuteB\x05\x92?\x02\x18\x03\x12?\n\rtpblockdelete\x18\xc9\x01 \x01(\x0b\x32 .machinetalk.TaskPlanBlockDeleteB\x05\x92?\x02\x18\x03\x12\x41\n\x0etpoptionalstop\x18\xca\x01 \x01(\x0b\x32!.machinetalk.TaskPlanOptionalStopB\x05\x92?\x02\x18\x03\x12\x31\n\x06tpopen\x18\xcb\x01 \x01(\x0b\x32\x19.machinetalk.TaskPlanOpenB\x05\x92?\x02\x18\x03\x12:\n\x0etaskplan_reply\x18\xd2\x01 \x01(\x0b\x32\x1a.machinetalk.TaskPlanReplyB\x05\x92?\x02\x18\x03\x12\x34\n\x0ctraj_set_g5x\x18\xac\x02 \x01(\x0b\x32\x1d.machinetalk.Emc_Traj_Set_G5x\x12\x34\n\x0ctraj_set_g92\x18\xb6\x02 \x01(\x0b\x32\x1d.machinetalk.Emc_Traj_Set_G92\x12>\n\x11traj_set_rotation\x18\xc0\x02 \x01(\x0b\x32\".machinetalk.Emc_Traj_Set_Rotation\x12<\n\x10traj_linear_move\x18\xca\x02 \x01(\x0b\x32!.machinetalk.Emc_Traj_Linear_Move\x12\x30\n\ntraj_probe\x18\xd4\x02 \x01(\x0b\x32\x1b.machinetalk.Emc_Traj_Probe\x12@\n\x12traj_circular_move\x18\xde\x02 \x01(\x0b\x32#.machinetalk.Emc_Traj_Circular_Move\x12\x38\n\x0etraj_rigid_tap\x18\xe8\x02 \x01(\x0b\x32\x1f.machinetalk.Emc_Traj_Rigid_Tap\x12@\n\x12traj_set_term_cond\x18\xf2\x02 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_Term_Cond\x12\x44\n\x14traj_set_spindlesync\x18\xfc\x02 \x01(\x0b\x32%.machinetalk.Emc_Traj_Set_Spindlesync\x12\x30\n\ntraj_delay\x18\x86\x03 \x01(\x0b\x32\x1b.machinetalk.Emc_Traj_Delay\x12\x30\n\nspindle_on\x18\x90\x03 \x01(\x0b\x32\x1b.machinetalk.Emc_Spindle_On\x12\x36\n\rspindle_speed\x18\x9a\x03 \x01(\x0b\x32\x1e.machinetalk.Emc_Spindle_Speed\x12\x38\n\x0espindle_orient\x18\xa4\x03 \x01(\x0b\x32\x1f.machinetalk.Emc_Spindle_Orient\x12T\n\x1cspindle_wait_orient_complete\x18\xae\x03 \x01(\x0b\x32-.machinetalk.Emc_Spindle_Wait_Orient_Complete\x12\x39\n\x0etool_set_offet\x18\xb8\x03 \x01(\x0b\x32 .machinetalk.Emc_Tool_Set_Offset\x12:\n\x0ftraj_set_offset\x18\xc2\x03 \x01(\x0b\x32 .machinetalk.Emc_Traj_Set_Offset\x12\x34\n\x0ctool_prepare\x18\xcc\x03 \x01(\x0b\x32\x1d.machinetalk.Emc_Tool_Prepare\x12:\n\x0ftool_set_number\x18\xd6\x03 \x01(\x0b\x32 .machinetalk.Emc_Tool_Set_Number\x12@\n\x12traj_set_fo_enable\x18\xe0\x03 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_Fo_Enable\x12@\n\x12traj_set_so_enable\x18\xea\x03 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_So_Enable\x12@\n\x12traj_set_fh_enable\x18\xf4\x03 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_Fh_Enable\x12:\n\x0fmotion_adaptive\x18\xfe\x03 \x01(\x0b\x32 .machinetalk.Emc_Motion_Adaptive\x12<\n\x10operator_display\x18\x88\x04 \x01(\x0b\x32!.machinetalk.Emc_Operator_Display\x12\x36\n\roperator_text\x18\x92\x04 \x01(\x0b\x32\x1e.machinetalk.Emc_Operator_Text\x12\x38\n\x0eoperator_error\x18\x9c\x04 \x01(\x0b\x32\x1f.machinetalk.Emc_Operator_Error\x12:\n\x0fmotion_set_dout\x18\xa6\x04 \x01(\x0b\x32 .machinetalk.Emc_Motion_Set_Dout\x12:\n\x0fmotion_set_aout\x18\xb0\x04 \x01(\x0b\x32 .machinetalk.Emc_Motion_Set_Aout\x12\x38\n\x0e\x61ux_input_wait\x18\xba\x04 \x01(\x0b\x32\x1f.machinetalk.Emc_Aux_Input_Wait\x12<\n\x10\x65xec_plugin_call\x18\xc4\x04 \x01(\x0b\x32!.machinetalk.Emc_Exec_Plugin_Ca1l\x12\x38\n\x0eio_plugin_call\x18\xce\x04 \x01(\x0b\x32\x1f.machinetalk.Emc_Io_Plugin_Call\x12?\n\x11\x65mc_status_config\x18\xd8\x04 \x01(\x0b\x32\x1c.machinetalk.EmcStatusConfigB\x05\x92?\x02\x18\x03\x12?\n\x11\x65mc_status_motion\x18\xd9\x04 \x01(\x0b\x32\x1c.machinetalk.EmcStatusMotionB\x05\x92?\x02\x18\x03\x12\x37\n\remc_status_io\x18\xda\x04 \x01(\x0b\x32\x18.machinetalk.EmcStatusIoB\x05\x92?\x02\x18\x03\x12;\n\x0f\x65mc_status_task\x18\xdb\x04 \x01(\x0b\x32\x1a.machinetalk.EmcStatusTaskB\x05\x92?\x02\x18\x03\x12?\n\x11\x65mc_status_interp\x18\xdc\x04 \x01(\x0b\x32\x1c.machinetalk.EmcStatusInterpB\x05\x92?\x02\x18\x03\x12\x37\n\remc_status_ui\x18\xdd\x04 \x01(\x0b\x32\x18.machinetalk.EmcStatusUIB\x05\x92?\x02\x18\x03\x12\x45\n\x12\x65mc_command_params\x18\xe2\x04 \x01(\x0b\x32!.machinetalk.EmcCommandParametersB\x05\x92?\x02\x18\x03:\x06\x92?\x03H\xf4\x03')
+  serialized_pb=_b('\n\"machinetalk/protobuf/message.proto\x12\x0bmachinetalk\x1a!machinetalk/protobuf/nanopb.proto\x1a machinetalk/protobuf/types.proto\x1a!machinetalk/protobuf/object.proto\x1a\x1emachinetalk/protobuf/log.proto\x1a\"machinetalk/protobuf/motcmds.proto\x1a\x1fmachinetalk/protobuf/task.proto\x1a machinetalk/protobuf/canon.proto\x1a machinetalk/protobuf/value.proto\x1a\'machinetalk/protobuf/rtapicommand.proto\x1a(machinetalk/protobuf/rtapi_message.proto\x1a!machinetalk/protobuf/config.proto\x1a\"machinetalk/protobuf/preview.proto\x1a!machinetalk/protobuf/status.proto\"\xa4#\n\tContainer\x12(\n\x04type\x18\x01 \x02(\x0e\x32\x1a.machinetalk.ContainerType\x12\x0b\n\x03tsc\x18\x07 \x01(\x10\x12,\n\x07preview\x18\x08 \x03(\x0b\x32\x14.machinetalk.PreviewB\x05\x92?\x02\x18\x03\x12*\n\x06motcmd\x18\t \x01(\x0b\x32\x1a.machinetalk.MotionCommand\x12*\n\x07motstat\x18\n \x01(\x0b\x32\x19.machinetalk.MotionStatus\x12\x1c\n\rlegacy_motcmd\x18\x0b \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x1d\n\x0elegacy_motstat\x18\x0c \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x31\n\rrtapi_message\x18\r \x01(\x0b\x32\x1a.machinetalk.RTAPI_Message\x12\x31\n\ntask_reply\x18\x0e \x01(\x0b\x32\x16.machinetalk.TaskReplyB\x05\x92?\x02\x18\x03\x12\x30\n\rticket_update\x18\x0f \x01(\x0b\x32\x19.machinetalk.TicketUpdate\x12\x15\n\x06syslog\x18\x12 \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x19\n\nlegacy_nml\x18\x13 \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x1f\n\x10legacy_motconfig\x18\x14 \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\x0e\n\x06tv_sec\x18\x15 \x01(\x05\x12\x0f\n\x07tv_nsec\x18\x16 \x01(\x05\x12\r\n\x05topic\x18\x17 \x01(\t\x12\x16\n\x0ereply_required\x18\x18 \x01(\x08\x12>\n\x0cinterp_state\x18\x19 \x01(\x0e\x32!.machinetalk.InterpreterStateTypeB\x05\x92?\x02\x18\x03\x12\x13\n\x0binterp_name\x18\x1a \x01(\t\x12\x0c\n\x04rsvp\x18\x1e \x01(\x05\x12/\n\x0bin_reply_to\x18! \x01(\x0e\x32\x1a.machinetalk.ContainerType\x12+\n\nrcs_status\x18# \x01(\x0e\x32\x17.machinetalk.RCS_STATUS\x12\'\n\x06status\x18( \x01(\x0e\x32\x17.machinetalk.StatusType\x12\x0e\n\x06serial\x18- \x01(\x05\x12\x14\n\x0creply_serial\x18\x32 \x01(\x05\x12\x0e\n\x06ticket\x18\x37 \x01(\x05\x12\x14\n\x0creply_ticket\x18< \x01(\x05\x12\x10\n\x08sequence\x18> \x01(\x05\x12\x0e\n\x06\x63redit\x18\x41 \x01(\x05\x12\x13\n\x0bline_number\x18\x42 \x01(\x05\x12\x13\n\x04name\x18\x43 \x01(\tB\x05\x92?\x02\x18\x03\x12\x0c\n\x04note\x18\x44 \x03(\t\x12\x0f\n\x07retcode\x18\x45 \x01(\x05\x12\x13\n\x04uuid\x18H \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12\r\n\x05trace\x18K \x01(\x08\x12\x10\n\x08instance\x18M \x01(\x05\x12(\n\x05value\x18U \x03(\x0b\x32\x12.machinetalk.ValueB\x05\x92?\x02\x18\x03\x12\x32\n\x08rtapicmd\x18V \x01(\x0b\x32\x19.machinetalk.RTAPICommandB\x05\x92?\x02\x18\x03\x12\x45\n\x14service_announcement\x18X \x03(\x0b\x32 .machinetalk.ServiceAnnouncementB\x05\x92?\x02\x18\x03\x12+\n\x04\x63omp\x18\x64 \x03(\x0b\x32\x16.machinetalk.ComponentB\x05\x92?\x02\x18\x03\x12$\n\x03pin\x18\x02 \x03(\x0b\x32\x10.machinetalk.PinB\x05\x92?\x02\x18\x03\x12*\n\x06signal\x18\x03 \x03(\x0b\x32\x13.machinetalk.SignalB\x05\x92?\x02\x18\x03\x12(\n\x05param\x18g \x03(\x0b\x32\x12.machinetalk.ParamB\x05\x92?\x02\x18\x03\x12*\n\x06thread\x18h \x03(\x0b\x32\x13.machinetalk.ThreadB\x05\x92?\x02\x18\x03\x12&\n\x04ring\x18i \x03(\x0b\x32\x11.machinetalk.RingB\x05\x92?\x02\x18\x03\x12(\n\x05group\x18j \x03(\x0b\x32\x12.machinetalk.GroupB\x05\x92?\x02\x18\x03\x12*\n\x06member\x18k \x03(\x0b\x32\x13.machinetalk.MemberB\x05\x92?\x02\x18\x03\x12.\n\x08\x66unction\x18l \x03(\x0b\x32\x15.machinetalk.FunctionB\x05\x92?\x02\x18\x03\x12\x37\n\x07pparams\x18m \x01(\x0b\x32\x1f.machinetalk.ProtocolParametersB\x05\x92?\x02\x18\x03\x12*\n\x06vtable\x18n \x03(\x0b\x32\x13.machinetalk.VtableB\x05\x92?\x02\x18\x03\x12&\n\x04inst\x18o \x03(\x0b\x32\x11.machinetalk.InstB\x05\x92?\x02\x18\x03\x12\x1e\n\rpacked_handle\x18p \x03(\x07\x42\x07\x10\x01\x92?\x02\x18\x03\x12\x15\n\x06packed\x18q \x01(\x0c\x42\x05\x92?\x02\x18\x03\x12,\n\x03\x61pp\x18x \x03(\x0b\x32\x18.machinetalk.ApplicationB\x05\x92?\x02\x18\x03\x12/\n\x08launcher\x18\x82\x01 \x03(\x0b\x32\x15.machinetalk.LauncherB\x05\x92?\x02\x18\x03\x12\x15\n\x05index\x18\x83\x01 \x01(\x05\x42\x05\x92?\x02\x18\x03\x12\x33\n\x0blog_message\x18W \x01(\x0b\x32\x17.machinetalk.LogMessageB\x05\x92?\x02\x18\x03\x12\x37\n\ttpexecute\x18\xc8\x01 \x01(\x0b\x32\x1c.machinetalk.TaskPlanExecuteB\x05\x92?\x02\x18\x03\x12?\n\rtpblockdelete\x18\xc9\x01 \x01(\x0b\x32 .machinetalk.TaskPlanBlockDeleteB\x05\x92?\x02\x18\x03\x12\x41\n\x0etpoptionalstop\x18\xca\x01 \x01(\x0b\x32!.machinetalk.TaskPlanOptionalStopB\x05\x92?\x02\x18\x03\x12\x31\n\x06tpopen\x18\xcb\x01 \x01(\x0b\x32\x19.machinetalk.TaskPlanOpenB\x05\x92?\x02\x18\x03\x12:\n\x0etaskplan_reply\x18\xd2\x01 \x01(\x0b\x32\x1a.machinetalk.TaskPlanReplyB\x05\x92?\x02\x18\x03\x12\x34\n\x0ctraj_set_g5x\x18\xac\x02 \x01(\x0b\x32\x1d.machinetalk.Emc_Traj_Set_G5x\x12\x34\n\x0ctraj_set_g92\x18\xb6\x02 \x01(\x0b\x32\x1d.machinetalk.Emc_Traj_Set_G92\x12>\n\x11traj_set_rotation\x18\xc0\x02 \x01(\x0b\x32\".machinetalk.Emc_Traj_Set_Rotation\x12<\n\x10traj_linear_move\x18\xca\x02 \x01(\x0b\x32!.machinetalk.Emc_Traj_Linear_Move\x12\x30\n\ntraj_probe\x18\xd4\x02 \x01(\x0b\x32\x1b.machinetalk.Emc_Traj_Probe\x12@\n\x12traj_circular_move\x18\xde\x02 \x01(\x0b\x32#.machinetalk.Emc_Traj_Circular_Move\x12\x38\n\x0etraj_rigid_tap\x18\xe8\x02 \x01(\x0b\x32\x1f.machinetalk.Emc_Traj_Rigid_Tap\x12@\n\x12traj_set_term_cond\x18\xf2\x02 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_Term_Cond\x12\x44\n\x14traj_set_spindlesync\x18\xfc\x02 \x01(\x0b\x32%.machinetalk.Emc_Traj_Set_Spindlesync\x12\x30\n\ntraj_delay\x18\x86\x03 \x01(\x0b\x32\x1b.machinetalk.Emc_Traj_Delay\x12\x30\n\nspindle_on\x18\x90\x03 \x01(\x0b\x32\x1b.machinetalk.Emc_Spindle_On\x12\x36\n\rspindle_speed\x18\x9a\x03 \x01(\x0b\x32\x1e.machinetalk.Emc_Spindle_Speed\x12\x38\n\x0espindle_orient\x18\xa4\x03 \x01(\x0b\x32\x1f.machinetalk.Emc_Spindle_Orient\x12T\n\x1cspindle_wait_orient_complete\x18\xae\x03 \x01(\x0b\x32-.machinetalk.Emc_Spindle_Wait_Orient_Complete\x12\x39\n\x0etool_set_offet\x18\xb8\x03 \x01(\x0b\x32 .machinetalk.Emc_Tool_Set_Offset\x12:\n\x0ftraj_set_offset\x18\xc2\x03 \x01(\x0b\x32 .machinetalk.Emc_Traj_Set_Offset\x12\x34\n\x0ctool_prepare\x18\xcc\x03 \x01(\x0b\x32\x1d.machinetalk.Emc_Tool_Prepare\x12:\n\x0ftool_set_number\x18\xd6\x03 \x01(\x0b\x32 .machinetalk.Emc_Tool_Set_Number\x12@\n\x12traj_set_fo_enable\x18\xe0\x03 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_Fo_Enable\x12@\n\x12traj_set_so_enable\x18\xea\x03 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_So_Enable\x12@\n\x12traj_set_fh_enable\x18\xf4\x03 \x01(\x0b\x32#.machinetalk.Emc_Traj_Set_Fh_Enable\x12:\n\x0fmotion_adaptive\x18\xfe\x03 \x01(\x0b\x32 .machinetalk.Emc_Motion_Adaptive\x12<\n\x10operator_display\x18\x88\x04 \x01(\x0b\x32!.machinetalk.Emc_Operator_Display\x12\x36\n\roperator_text\x18\x92\x04 \x01(\x0b\x32\x1e.machinetalk.Emc_Operator_Text\x12\x38\n\x0eoperator_error\x18\x9c\x04 \x01(\x0b\x32\x1f.machinetalk.Emc_Operator_Error\x12:\n\x0fmotion_set_dout\x18\xa6\x04 \x01(\x0b\x32 .machinetalk.Emc_Motion_Set_Dout\x12:\n\x0fmotion_set_aout\x18\xb0\x04 \x01(\x0b\x32 .machinetalk.Emc_Motion_Set_Aout\x12\x38\n\x0e\x61ux_input_wait\x18\xba\x04 \x01(\x0b\x32\x1f.machinetalk.Emc_Aux_Input_Wait\x12<\n\x10\x65xec_plugin_call\x18\xc4\x04 \x01(\x0b\x32!.machinetalk.Emc_Exec_Plugin_Ca1l\x12\x38\n\x0eio_plugin_call\x18\xce\x04 \x01(\x0b\x32\x1f.machinetalk.Emc_Io_Plugin_Call\x12?\n\x11\x65mc_status_config\x18\xd8\x04 \x01(\x0b\x32\x1c.machinetalk.EmcStatusConfigB\x05\x92?\x02\x18\x03\x12?\n\x11\x65mc_status_motion\x18\xd9\x04 \x01(\x0b\x32\x1c.machinetalk.EmcStatusMotionB\x05\x92?\x02\x18\x03\x12\x37\n\remc_status_io\x18\xda\x04 \x01(\x0b\x32\x18.machinetalk.EmcStatusIoB\x05\x92?\x02\x18\x03\x12;\n\x0f\x65mc_status_task\x18\xdb\x04 \x01(\x0b\x32\x1a.machinetalk.EmcStatusTaskB\x05\x92?\x02\x18\x03\x12?\n\x11\x65mc_status_interp\x18\xdc\x04 \x01(\x0b\x32\x1c.machinetalk.EmcStatusInterpB\x05\x92?\x02\x18\x03\x12\x37\n\remc_status_ui\x18\xdd\x04 \x01(\x0b\x32\x18.machinetalk.EmcStatusUIB\x05\x92?\x02\x18\x03\x12\x45\n\x12\x65mc_command_params\x18\xe2\x04 \x01(\x0b\x32!.machinetalk.EmcCommandParametersB\x05\x92?\x02\x18\x03:\x06\x92?\x03H\xf4\x03')
   ,
   dependencies=[machinetalk_dot_protobuf_dot_nanopb__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_types__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_object__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_log__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_motcmds__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_task__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_canon__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_value__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_rtapicommand__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_rtapi__message__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_config__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_preview__pb2.DESCRIPTOR,machinetalk_dot_protobuf_dot_status__pb2.DESCRIPTOR,])
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
@@ -405,322 +405,336 @@ _CONTAINER = _descriptor.Descriptor(
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='app', full_name='machinetalk.Container.app', index=51,
+      name='packed_handle', full_name='machinetalk.Container.packed_handle', index=51,
+      number=112, type=7, cpp_type=3, label=3,
+      has_default_value=False, default_value=[],
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001\222?\002\030\003'))),
+    _descriptor.FieldDescriptor(
+      name='packed', full_name='machinetalk.Container.packed', index=52,
+      number=113, type=12, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b(""),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
+    _descriptor.FieldDescriptor(
+      name='app', full_name='machinetalk.Container.app', index=53,
       number=120, type=11, cpp_type=10, label=3,
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='launcher', full_name='machinetalk.Container.launcher', index=52,
+      name='launcher', full_name='machinetalk.Container.launcher', index=54,
       number=130, type=11, cpp_type=10, label=3,
       has_default_value=False, default_value=[],
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='index', full_name='machinetalk.Container.index', index=53,
+      name='index', full_name='machinetalk.Container.index', index=55,
       number=131, type=5, cpp_type=1, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='log_message', full_name='machinetalk.Container.log_message', index=54,
+      name='log_message', full_name='machinetalk.Container.log_message', index=56,
       number=87, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='tpexecute', full_name='machinetalk.Container.tpexecute', index=55,
+      name='tpexecute', full_name='machinetalk.Container.tpexecute', index=57,
       number=200, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='tpblockdelete', full_name='machinetalk.Container.tpblockdelete', index=56,
+      name='tpblockdelete', full_name='machinetalk.Container.tpblockdelete', index=58,
       number=201, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='tpoptionalstop', full_name='machinetalk.Container.tpoptionalstop', index=57,
+      name='tpoptionalstop', full_name='machinetalk.Container.tpoptionalstop', index=59,
       number=202, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='tpopen', full_name='machinetalk.Container.tpopen', index=58,
+      name='tpopen', full_name='machinetalk.Container.tpopen', index=60,
       number=203, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='taskplan_reply', full_name='machinetalk.Container.taskplan_reply', index=59,
+      name='taskplan_reply', full_name='machinetalk.Container.taskplan_reply', index=61,
       number=210, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='traj_set_g5x', full_name='machinetalk.Container.traj_set_g5x', index=60,
+      name='traj_set_g5x', full_name='machinetalk.Container.traj_set_g5x', index=62,
       number=300, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_g92', full_name='machinetalk.Container.traj_set_g92', index=61,
+      name='traj_set_g92', full_name='machinetalk.Container.traj_set_g92', index=63,
       number=310, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_rotation', full_name='machinetalk.Container.traj_set_rotation', index=62,
+      name='traj_set_rotation', full_name='machinetalk.Container.traj_set_rotation', index=64,
       number=320, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_linear_move', full_name='machinetalk.Container.traj_linear_move', index=63,
+      name='traj_linear_move', full_name='machinetalk.Container.traj_linear_move', index=65,
       number=330, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_probe', full_name='machinetalk.Container.traj_probe', index=64,
+      name='traj_probe', full_name='machinetalk.Container.traj_probe', index=66,
       number=340, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_circular_move', full_name='machinetalk.Container.traj_circular_move', index=65,
+      name='traj_circular_move', full_name='machinetalk.Container.traj_circular_move', index=67,
       number=350, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_rigid_tap', full_name='machinetalk.Container.traj_rigid_tap', index=66,
+      name='traj_rigid_tap', full_name='machinetalk.Container.traj_rigid_tap', index=68,
       number=360, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_term_cond', full_name='machinetalk.Container.traj_set_term_cond', index=67,
+      name='traj_set_term_cond', full_name='machinetalk.Container.traj_set_term_cond', index=69,
       number=370, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_spindlesync', full_name='machinetalk.Container.traj_set_spindlesync', index=68,
+      name='traj_set_spindlesync', full_name='machinetalk.Container.traj_set_spindlesync', index=70,
       number=380, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_delay', full_name='machinetalk.Container.traj_delay', index=69,
+      name='traj_delay', full_name='machinetalk.Container.traj_delay', index=71,
       number=390, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='spindle_on', full_name='machinetalk.Container.spindle_on', index=70,
+      name='spindle_on', full_name='machinetalk.Container.spindle_on', index=72,
       number=400, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='spindle_speed', full_name='machinetalk.Container.spindle_speed', index=71,
+      name='spindle_speed', full_name='machinetalk.Container.spindle_speed', index=73,
       number=410, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='spindle_orient', full_name='machinetalk.Container.spindle_orient', index=72,
+      name='spindle_orient', full_name='machinetalk.Container.spindle_orient', index=74,
       number=420, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='spindle_wait_orient_complete', full_name='machinetalk.Container.spindle_wait_orient_complete', index=73,
+      name='spindle_wait_orient_complete', full_name='machinetalk.Container.spindle_wait_orient_complete', index=75,
       number=430, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='tool_set_offet', full_name='machinetalk.Container.tool_set_offet', index=74,
+      name='tool_set_offet', full_name='machinetalk.Container.tool_set_offet', index=76,
       number=440, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_offset', full_name='machinetalk.Container.traj_set_offset', index=75,
+      name='traj_set_offset', full_name='machinetalk.Container.traj_set_offset', index=77,
       number=450, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='tool_prepare', full_name='machinetalk.Container.tool_prepare', index=76,
+      name='tool_prepare', full_name='machinetalk.Container.tool_prepare', index=78,
       number=460, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='tool_set_number', full_name='machinetalk.Container.tool_set_number', index=77,
+      name='tool_set_number', full_name='machinetalk.Container.tool_set_number', index=79,
       number=470, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_fo_enable', full_name='machinetalk.Container.traj_set_fo_enable', index=78,
+      name='traj_set_fo_enable', full_name='machinetalk.Container.traj_set_fo_enable', index=80,
       number=480, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_so_enable', full_name='machinetalk.Container.traj_set_so_enable', index=79,
+      name='traj_set_so_enable', full_name='machinetalk.Container.traj_set_so_enable', index=81,
       number=490, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='traj_set_fh_enable', full_name='machinetalk.Container.traj_set_fh_enable', index=80,
+      name='traj_set_fh_enable', full_name='machinetalk.Container.traj_set_fh_enable', index=82,
       number=500, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='motion_adaptive', full_name='machinetalk.Container.motion_adaptive', index=81,
+      name='motion_adaptive', full_name='machinetalk.Container.motion_adaptive', index=83,
       number=510, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='operator_display', full_name='machinetalk.Container.operator_display', index=82,
+      name='operator_display', full_name='machinetalk.Container.operator_display', index=84,
       number=520, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='operator_text', full_name='machinetalk.Container.operator_text', index=83,
+      name='operator_text', full_name='machinetalk.Container.operator_text', index=85,
       number=530, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='operator_error', full_name='machinetalk.Container.operator_error', index=84,
+      name='operator_error', full_name='machinetalk.Container.operator_error', index=86,
       number=540, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='motion_set_dout', full_name='machinetalk.Container.motion_set_dout', index=85,
+      name='motion_set_dout', full_name='machinetalk.Container.motion_set_dout', index=87,
       number=550, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='motion_set_aout', full_name='machinetalk.Container.motion_set_aout', index=86,
+      name='motion_set_aout', full_name='machinetalk.Container.motion_set_aout', index=88,
       number=560, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='aux_input_wait', full_name='machinetalk.Container.aux_input_wait', index=87,
+      name='aux_input_wait', full_name='machinetalk.Container.aux_input_wait', index=89,
       number=570, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='exec_plugin_call', full_name='machinetalk.Container.exec_plugin_call', index=88,
+      name='exec_plugin_call', full_name='machinetalk.Container.exec_plugin_call', index=90,
       number=580, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='io_plugin_call', full_name='machinetalk.Container.io_plugin_call', index=89,
+      name='io_plugin_call', full_name='machinetalk.Container.io_plugin_call', index=91,
       number=590, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='emc_status_config', full_name='machinetalk.Container.emc_status_config', index=90,
+      name='emc_status_config', full_name='machinetalk.Container.emc_status_config', index=92,
       number=600, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='emc_status_motion', full_name='machinetalk.Container.emc_status_motion', index=91,
+      name='emc_status_motion', full_name='machinetalk.Container.emc_status_motion', index=93,
       number=601, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='emc_status_io', full_name='machinetalk.Container.emc_status_io', index=92,
+      name='emc_status_io', full_name='machinetalk.Container.emc_status_io', index=94,
       number=602, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='emc_status_task', full_name='machinetalk.Container.emc_status_task', index=93,
+      name='emc_status_task', full_name='machinetalk.Container.emc_status_task', index=95,
       number=603, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='emc_status_interp', full_name='machinetalk.Container.emc_status_interp', index=94,
+      name='emc_status_interp', full_name='machinetalk.Container.emc_status_interp', index=96,
       number=604, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='emc_status_ui', full_name='machinetalk.Container.emc_status_ui', index=95,
+      name='emc_status_ui', full_name='machinetalk.Container.emc_status_ui', index=97,
       number=605, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=_descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))),
     _descriptor.FieldDescriptor(
-      name='emc_command_params', full_name='machinetalk.Container.emc_command_params', index=96,
+      name='emc_command_params', full_name='machinetalk.Container.emc_command_params', index=98,
       number=610, type=11, cpp_type=10, label=1,
       has_default_value=False, default_value=None,
       message_type=None, enum_type=None, containing_type=None,
@@ -739,7 +753,7 @@ _CONTAINER = _descriptor.Descriptor(
   oneofs=[
   ],
   serialized_start=514,
-  serialized_end=4975,
+  serialized_end=5030,
 )
 
 _CONTAINER.fields_by_name['type'].enum_type = machinetalk_dot_protobuf_dot_types__pb2._CONTAINERTYPE
@@ -873,6 +887,10 @@ _CONTAINER.fields_by_name['vtable'].has_options = True
 _CONTAINER.fields_by_name['vtable']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))
 _CONTAINER.fields_by_name['inst'].has_options = True
 _CONTAINER.fields_by_name['inst']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))
+_CONTAINER.fields_by_name['packed_handle'].has_options = True
+_CONTAINER.fields_by_name['packed_handle']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\020\001\222?\002\030\003'))
+_CONTAINER.fields_by_name['packed'].has_options = True
+_CONTAINER.fields_by_name['packed']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))
 _CONTAINER.fields_by_name['app'].has_options = True
 _CONTAINER.fields_by_name['app']._options = _descriptor._ParseOptions(descriptor_pb2.FieldOptions(), _b('\222?\002\030\003'))
 _CONTAINER.fields_by_name['launcher'].has_options = True
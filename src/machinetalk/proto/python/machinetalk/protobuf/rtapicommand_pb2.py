@@ -20,7 +20,7 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   name='machinetalk/protobuf/rtapicommand.proto',
   package='machinetalk',
   syntax='proto2',
-  serialized_pb=_b('\n\'machinetalk/protobuf/rtapicommand.proto\x12\x0bmachinetalk\x1a!machinetalk/protobuf/nanopb.proto\"\xf7\x01\n\x0cRTAPICommand\x12\x10\n\x08instance\x18\x01 \x02(\x05\x12\x0f\n\x07modname\x18\x02 \x01(\t\x12\x13\n\x0brt_msglevel\x18\x03 \x01(\x05\x12\x15\n\ruser_msglevel\x18\x04 \x01(\x05\x12\x0c\n\x04\x61rgv\x18\x05 \x03(\t\x12\x12\n\nthreadname\x18\x06 \x01(\t\x12\x14\n\x0cthreadperiod\x18\x07 \x01(\x05\x12\x0e\n\x06use_fp\x18\x08 \x01(\x08\x12\x0b\n\x03\x63pu\x18\t \x01(\x05\x12\x0c\n\x04\x63omp\x18\n \x01(\t\x12\x0c\n\x04\x66unc\x18\x0b \x01(\t\x12\x10\n\x08instname\x18\x0c \x01(\t\x12\r\n\x05\x66lags\x18\r \x01(\x05:\x06\x92?\x03H\x84\x07')
+  serialized_pb=_b('\n\'machinetalk/protobuf/rtapicommand.proto\x12\x0bmachinetalk\x1a!machinetalk/protobuf/nanopb.proto\"\x98\x02\n\x0cRTAPICommand\x12\x10\n\x08instance\x18\x01 \x02(\x05\x12\x0f\n\x07modname\x18\x02 \x01(\t\x12\x13\n\x0brt_msglevel\x18\x03 \x01(\x05\x12\x15\n\ruser_msglevel\x18\x04 \x01(\x05\x12\x0c\n\x04\x61rgv\x18\x05 \x03(\t\x12\x12\n\nthreadname\x18\x06 \x01(\t\x12\x14\n\x0cthreadperiod\x18\x07 \x01(\x05\x12\x0e\n\x06use_fp\x18\x08 \x01(\x08\x12\x0b\n\x03\x63pu\x18\t \x01(\x05\x12\x0e\n\x06\x63gname\x18\x0e \x01(\t\x12\x0f\n\x07workers\x18\x0f \x01(\x05\x12\x0c\n\x04\x63omp\x18\n \x01(\t\x12\x0c\n\x04\x66unc\x18\x0b \x01(\t\x12\x10\n\x08instname\x18\x0c \x01(\t\x12\r\n\x05\x66lags\x18\r \x01(\x05:\x06\x92?\x03H\x84\x07')
   ,
   dependencies=[machinetalk_dot_protobuf_dot_nanopb__pb2.DESCRIPTOR,])
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
@@ -99,28 +99,42 @@ _RTAPICOMMAND = _descriptor.Descriptor(
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='comp', full_name='machinetalk.RTAPICommand.comp', index=9,
+      name='cgname', full_name='machinetalk.RTAPICommand.cgname', index=9,
+      number=14, type=9, cpp_type=9, label=1,
+      has_default_value=False, default_value=_b("").decode('utf-8'),
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='workers', full_name='machinetalk.RTAPICommand.workers', index=10,
+      number=15, type=5, cpp_type=1, label=1,
+      has_default_value=False, default_value=0,
+      message_type=None, enum_type=None, containing_type=None,
+      is_extension=False, extension_scope=None,
+      options=None),
+    _descriptor.FieldDescriptor(
+      name='comp', full_name='machinetalk.RTAPICommand.comp', index=11,
       number=10, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='func', full_name='machinetalk.RTAPICommand.func', index=10,
+      name='func', full_name='machinetalk.RTAPICommand.func', index=12,
       number=11, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='instname', full_name='machinetalk.RTAPICommand.instname', index=11,
+      name='instname', full_name='machinetalk.RTAPICommand.instname', index=13,
       number=12, type=9, cpp_type=9, label=1,
       has_default_value=False, default_value=_b("").decode('utf-8'),
       message_type=None, enum_type=None, containing_type=None,
       is_extension=False, extension_scope=None,
       options=None),
     _descriptor.FieldDescriptor(
-      name='flags', full_name='machinetalk.RTAPICommand.flags', index=12,
+      name='flags', full_name='machinetalk.RTAPICommand.flags', index=14,
       number=13, type=5, cpp_type=1, label=1,
       has_default_value=False, default_value=0,
       message_type=None, enum_type=None, containing_type=None,
@@ -139,7 +153,7 @@ _RTAPICOMMAND = _descriptor.Descriptor(
   oneofs=[
   ],
   serialized_start=92,
-  serialized_end=339,
+  serialized_end=372,
 )
 
 DESCRIPTOR.message_types_by_name['RTAPICommand'] = _RTAPICOMMAND
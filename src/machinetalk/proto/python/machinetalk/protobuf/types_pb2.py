@@ -21,7 +21,7 @@ DESCRIPTOR = _descriptor.FileDescriptor(
   name='machinetalk/protobuf/types.proto',
   package='machinetalk',
   syntax='proto2',
-  serialized_pb=_b('\n machinetalk/protobuf/types.proto\x12\x0bmachinetalk\x1a!machinetalk/protobuf/nanopb.proto*\xf7\x01\n\tValueType\x12\x0b\n\x07HAL_BIT\x10\x01\x12\r\n\tHAL_FLOAT\x10\x02\x12\x0b\n\x07HAL_S32\x10\x03\x12\x0b\n\x07HAL_U32\x10\x04\x12\x0b\n\x07HAL_S64\x10\x05\x12\x0b\n\x07HAL_U64\x10\x06\x12\n\n\x06STRING\x10\x07\x12\t\n\x05\x42YTES\x10\x08\x12\t\n\x05INT32\x10\x14\x12\n\n\x06UINT32\x10\x1e\x12\t\n\x05INT64\x10(\x12\n\n\x06UINT64\x10\x32\x12\n\n\x06\x44OUBLE\x10<\x12\x08\n\x04\x42OOL\x10P\x12\r\n\tCARTESIAN\x10\x64\x12\x14\n\x10LEGACY_CARTESIAN\x10n\x12\x08\n\x04POSE\x10x\x12\x10\n\x0bLEGACY_POSE\x10\x82\x01*6\n\x0fHalPinDirection\x12\n\n\x06HAL_IN\x10\x10\x12\x0b\n\x07HAL_OUT\x10 \x12\n\n\x06HAL_IO\x10\x30*,\n\x11HalParamDirection\x12\n\n\x06HAL_RO\x10@\x12\x0b\n\x06HAL_RW\x10\xc0\x01*M\n\x0cHalFunctType\x12\x18\n\x14\x46S_LEGACY_THREADFUNC\x10\x00\x12\x12\n\x0e\x46S_XTHREADFUNC\x10\x01\x12\x0f\n\x0b\x46S_USERLAND\x10\x02*\xdb\x01\n\nObjectType\x12\x16\n\x12HAL_OBJECT_INVALID\x10\x00\x12\x0b\n\x07HAL_PIN\x10\x01\x12\x0e\n\nHAL_SIGNAL\x10\x02\x12\r\n\tHAL_PARAM\x10\x03\x12\x0e\n\nHAL_THREAD\x10\x04\x12\r\n\tHAL_FUNCT\x10\x05\x12\x11\n\rHAL_COMPONENT\x10\x06\x12\x0e\n\nHAL_VTABLE\x10\x07\x12\x0c\n\x08HAL_INST\x10\x08\x12\x0c\n\x08HAL_RING\x10\t\x12\r\n\tHAL_GROUP\x10\n\x12\x0e\n\nHAL_MEMBER\x10\x0b\x12\x0c\n\x08HAL_PLUG\x10\x0c*\x81\x01\n\tmsgidType\x12\x0e\n\tMSGID_MAX\x10\xa0\x1f\x12\x1a\n\x15MSGID_ROUTE_DELIMITER\x10\xa1\x1f\x12\x14\n\x0fMSGID_ERROR_MSG\x10\xa2\x1f\x12\x0f\n\nMSGID_BLOB\x10\xa3\x1f\x12\x11\n\x0cMSGID_STRING\x10\xa4\x1f\x12\x0e\n\tMSGID_HOP\x10\xa5\x1f*\xee\x01\n\nsocketType\x12\x0f\n\x0bST_ZMQ_PAIR\x10\x00\x12\x0e\n\nST_ZMQ_PUB\x10\x01\x12\x0e\n\nST_ZMQ_SUB\x10\x02\x12\x0e\n\nST_ZMQ_REQ\x10\x03\x12\x0e\n\nST_ZMQ_REP\x10\x04\x12\x11\n\rST_ZMQ_DEALER\x10\x05\x12\x11\n\rST_ZMQ_ROUTER\x10\x06\x12\x0f\n\x0bST_ZMQ_PULL\x10\x07\x12\x0f\n\x0bST_ZMQ_PUSH\x10\x08\x12\x0f\n\x0bST_ZMQ_XPUB\x10\t\x12\x0f\n\x0bST_ZMQ_XSUB\x10\n\x12\x11\n\rST_ZMQ_STREAM\x10\x0b\x12\x12\n\x0eST_ZMQ_INVALID\x10\x0f*b\n\x11securityMechanism\x12\x18\n\x0bSM_ZMQ_NONE\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x12\x0f\n\x0bSM_ZMQ_NULL\x10\x00\x12\x10\n\x0cSM_ZMQ_PLAIN\x10\x01\x12\x10\n\x0cSM_ZMQ_CURVE\x10\x02*l\n\nRCS_STATUS\x12!\n\x14UNINITIALIZED_STATUS\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x12\x0c\n\x08RCS_DONE\x10\x01\x12\x0c\n\x08RCS_EXEC\x10\x02\x12\r\n\tRCS_ERROR\x10\x03\x12\x10\n\x0cRCS_RECEIVED\x10\x04*:\n\tMsgOrigin\x12\x0e\n\nMSG_KERNEL\x10\x00\x12\x0e\n\nMSG_RTUSER\x10\x01\x12\r\n\tMSG_ULAPI\x10\x02*\x7f\n\x08MsgLevel\x12\x12\n\x0eRTAPI_MSG_NONE\x10\x00\x12\x11\n\rRTAPI_MSG_ERR\x10\x01\x12\x12\n\x0eRTAPI_MSG_WARN\x10\x02\x12\x12\n\x0eRTAPI_MSG_INFO\x10\x03\x12\x11\n\rRTAPI_MSG_DBG\x10\x04\x12\x11\n\rRTAPI_MSG_ALL\x10\x05*\xa0\x01\n\x0cOriginDetail\x12\x0f\n\x0bUNIX_SIGNAL\x10\n\x12\x15\n\x11INSTANCE_SHUTDOWN\x10\x14\x12\x0e\n\nZMQ_SOCKET\x10\x46\x12\r\n\tNML_LAYER\x10P\x12\r\n\tRCS_LAYER\x10Z\x12\r\n\tCMS_LAYER\x10\x64\x12\x0c\n\x08IP_LAYER\x10n\x12\r\n\tTCP_LAYER\x10x\x12\x0e\n\tPGM_LAYER\x10\x82\x01*\xa5\x01\n\nOriginType\x12\x0b\n\x07PROCESS\x10\n\x12\x0f\n\x0bUSER_THREAD\x10\x14\x12\r\n\tRT_THREAD\x10\x1e\x12\r\n\tCOMPONENT\x10(\x12\x13\n\x0fTHREAD_FUNCTION\x10\x32\x12\x12\n\x0e\x43OMPONENT_INIT\x10<\x12\x12\n\x0e\x43OMPONENT_EXIT\x10\x46\x12\t\n\x05GROUP\x10P\x12\x07\n\x03PIN\x10Z\x12\n\n\x06SIGNAL\x10\x64*:\n\x08Severity\x12\x13\n\x0fS_INFORMATIONAL\x10\x01\x12\r\n\tS_WARNING\x10\x02\x12\n\n\x06S_FAIL\x10\x04*D\n\nStatusType\x12\x0c\n\x08\x45NQUEUED\x10\x01\x12\x0e\n\nPROCESSING\x10\x02\x12\x0c\n\x08\x43OMPLETE\x10\x03\x12\n\n\x06\x46\x41ILED\x10\x04*Y\n\tReplyType\x12\x08\n\x04NONE\x10\x00\x12\x10\n\x0cON_RECEPTION\x10\x01\x12\r\n\tON_QUEUED\x10\x02\x12\x11\n\rON_COMPLETION\x10\x04\x12\x0e\n\tALL_STEPS\x10\xff\x01*\xd6\x02\n\x0bServiceType\x12\x0e\n\nST_LOGGING\x10\x01\x12\r\n\tST_CONFIG\x10\x02\x12\x0c\n\x08ST_REDIS\x10\x03\x12\x0b\n\x07ST_HTTP\x10\x04\x12\x0c\n\x08ST_HTTPS\x10\x05\x12\x10\n\x0cST_WEBSOCKET\x10\x06\x12\x11\n\rST_WEBSOCKETS\x10\x07\x12\x14\n\x10ST_RTAPI_COMMAND\x10\x08\x12\x13\n\x0fST_STP_HALGROUP\x10\t\x12\x13\n\x0fST_STP_HALRCOMP\x10\n\x12\x11\n\rST_STP_INTERP\x10\x0b\x12\x0f\n\x0bST_STP_TASK\x10\x0c\x12\x13\n\x0fST_HAL_RCOMMAND\x10\r\x12\x13\n\x0fST_TASK_COMMAND\x10\x0e\x12\x15\n\x11ST_INTERP_COMMAND\x10\x0f\x12\x19\n\x15ST_MESSAGEBUS_COMMAND\x10\x10\x12\x1a\n\x16ST_MESSAGEBUS_RESPONSE\x10\x11*1\n\nServiceAPI\x12\x13\n\x0fSA_ZMQ_PROTOBUF\x10\x01\x12\x0e\n\nSA_WS_JSON\x10\x02*\x9f\x46\n\rContainerType\x12\x10\n\x0cMT_RTMESSAGE\x10\x02\x12\r\n\tMT_MOTCMD\x10\x03\x12\x10\n\x0cMT_MOTSTATUS\x10\x04\x12\x14\n\x10MT_LEGACY_MOTCMD\x10\x05\x12\x17\n\x13MT_LEGACY_MOTSTATUS\x10\x06\x12\n\n\x06MT_WOU\x10\x07\x12\x10\n\x0cMT_HALUPDATE\x10\x08\x12\x14\n\x10MT_RTAPI_MESSAGE\x10\t\x12\x12\n\x0eMT_LOG_MESSAGE\x10\n\x12\x0e\n\nMT_PREVIEW\x10\x0b\x12\x0f\n\x0bMT_PROGRESS\x10\x0c\x12\x12\n\x0eMT_INTERP_STAT\x10\r\x12\r\n\tMT_SYSLOG\x10\x12\x12\x11\n\rMT_LEGACY_NML\x10\x13\x12\x17\n\x13MT_LEGACY_MOTCONFIG\x10\x14\x12\x16\n\x12MT_STP_UPDATE_FULL\x10\x1a\x12\x11\n\rMT_STP_UPDATE\x10\x1c\x12\x12\n\x0eMT_STP_NOGROUP\x10\x1b\x12\x0f\n\x0bMT_SHUTDOWN\x10-\x12\x17\n\x13MT_CONFIRM_SHUTDOWN\x10\x32\x12\x11\n\rMT_RTMESSAGE0\x10\x1e\x12\x11\n\rMT_RTMESSAGE1\x10\x1f\x12\x11\n\rMT_RTMESSAGE2\x10 \x12\x11\n\rMT_RTMESSAGE3\x10!\x12\x11\n\rMT_RTMESSAGE4\x10\"\x12\x0c\n\x08MT_ASCII\x10\x64\x12\x0e\n\nMT_UNICODE\x10\x65\x12\x0c\n\x08MT_GCODE\x10\x66\x12\r\n\tMT_PYTHON\x10g\x12\r\n\tMT_PICKLE\x10h\x12\n\n\x06MT_TCL\x10i\x12\n\n\x06MT_XML\x10j\x12\x0b\n\x07MT_JSON\x10k\x12\x0b\n\x07MT_JPEG\x10l\x12\n\n\x06MT_PNG\x10m\x12\x0b\n\x07MT_TIFF\x10n\x12\x11\n\rMT_POSTSCRIPT\x10o\x12\n\n\x06MT_SVG\x10p\x12\x15\n\x10MT_ZMQ_SUBSCRIBE\x10\x96\x01\x12\x17\n\x12MT_ZMQ_UNSUBSCRIBE\x10\x97\x01\x12\x0c\n\x07MT_PING\x10\xd2\x01\x12\x18\n\x13MT_PING_ACKNOWLEDGE\x10\xd7\x01\x12\x0e\n\tMT_REJECT\x10\xdc\x01\x12\x0c\n\x07MT_DONE\x10\xf0\x01\x12\x17\n\x12MT_SERVICE_REQUEST\x10\xfa\x01\x12\x1c\n\x17MT_SERVICE_ANNOUNCEMENT\x10\xfb\x01\x12\x15\n\x10MT_SERVICE_PROBE\x10\xfc\x01\x12!\n\x1cMT_MESSAGEBUS_NO_DESTINATION\x10\xff\x01\x12\x15\n\x10MT_HALRCOMP_BIND\x10\x80\x02\x12\x1d\n\x18MT_HALRCOMP_BIND_CONFIRM\x10\x81\x02\x12\x1c\n\x17MT_HALRCOMP_BIND_REJECT\x10\x82\x02\x12\x14\n\x0fMT_HALRCOMP_SET\x10\x83\x02\x12\x1b\n\x16MT_HALRCOMP_SET_REJECT\x10\x84\x02\x12\x14\n\x0fMT_HALRCOMP_ACK\x10\x87\x02\x12\x17\n\x12MT_HALRCOMMAND_SET\x10\x89\x02\x12\x1e\n\x19MT_HALRCOMMAND_SET_REJECT\x10\x8a\x02\x12\x17\n\x12MT_HALRCOMMAND_GET\x10\x8b\x02\x12\x1e\n\x19MT_HALRCOMMAND_GET_REJECT\x10\x8c\x02\x12\x1a\n\x15MT_HALRCOMMAND_CREATE\x10\x8d\x02\x12!\n\x1cMT_HALRCOMMAND_CREATE_REJECT\x10\x8e\x02\x12\x1a\n\x15MT_HALRCOMMAND_DELETE\x10\x8f\x02\x12!\n\x1cMT_HALRCOMMAND_DELETE_REJECT\x10\x90\x02\x12\x17\n\x12MT_HALRCOMMAND_ACK\x10\x91\x02\x12\x19\n\x14MT_HALRCOMMAND_ERROR\x10\x92\x02\x12\x1c\n\x17MT_HALRCOMMAND_DESCRIBE\x10\x94\x02\x12\x1f\n\x1aMT_HALRCOMMAND_DESCRIPTION\x10\x95\x02\x12\x1c\n\x17MT_HALRCOMP_FULL_UPDATE\x10\xa0\x02\x12#\n\x1eMT_HALRCOMP_INCREMENTAL_UPDATE\x10\xa1\x02\x12\x16\n\x11MT_HALRCOMP_ERROR\x10\xa2\x02\x12\x15\n\x10MT_HALGROUP_BIND\x10\xa6\x02\x12\x1d\n\x18MT_HALGROUP_BIND_CONFIRM\x10\xa7\x02\x12\x1c\n\x17MT_HALGROUP_BIND_REJECT\x10\xa8\x02\x12\x1c\n\x17MT_HALGROUP_FULL_UPDATE\x10\xa9\x02\x12#\n\x1eMT_HALGROUP_INCREMENTAL_UPDATE\x10\xaa\x02\x12\x16\n\x11MT_HALGROUP_ERROR\x10\xab\x02\x12\x16\n\x11MT_RTAPI_APP_EXIT\x10\xac\x02\x12\x16\n\x11MT_RTAPI_APP_PING\x10\xad\x02\x12\x18\n\x13MT_RTAPI_APP_LOADRT\x10\xae\x02\x12\x15\n\x10MT_RTAPI_APP_LOG\x10\xaf\x02\x12\x1a\n\x15MT_RTAPI_APP_UNLOADRT\x10\xb1\x02\x12\x19\n\x14MT_RTAPI_APP_NEWINST\x10\xb2\x02\x12\x1b\n\x16MT_RTAPI_APP_NEWTHREAD\x10\xb3\x02\x12\x1b\n\x16MT_RTAPI_APP_DELTHREAD\x10\xb4\x02\x12\x1a\n\x15MT_RTAPI_APP_CALLFUNC\x10\xb5\x02\x12\x17\n\x12MT_RTAPI_APP_REPLY\x10\xb6\x02\x12\x19\n\x14MT_RTAPI_APP_DELINST\x10\xb7\x02\x12\x19\n\x14MT_LIST_APPLICATIONS\x10\xde\x02\x12\x1c\n\x17MT_DESCRIBE_APPLICATION\x10\xdf\x02\x12\x1c\n\x17MT_RETRIEVE_APPLICATION\x10\xe0\x02\x12\x1a\n\x15MT_APPLICATION_DETAIL\x10\xe1\x02\x12\r\n\x08MT_ERROR\x10\xe8\x02\x12\x13\n\x0eMT_FULL_UPDATE\x10\xf2\x02\x12\x1a\n\x15MT_INCREMENTAL_UPDATE\x10\xf3\x02\x12\x12\n\rMT_TASK_REPLY\x10\x90\x03\x12\x15\n\x10MT_TICKET_UPDATE\x10\x91\x03\x12\x15\n\x10MT_CREDIT_UPDATE\x10\xc2\x03\x12\x14\n\x0fMT_EMCMOT_LOWER\x10\xe8\x07\x12\x14\n\x0fMT_EMCMOT_UPPER\x10\xcc\x08\x12\x14\n\x0fMT_EMCMOT_ABORT\x10\xe9\x07\x12\x19\n\x14MT_EMCMOT_AXIS_ABORT\x10\xea\x07\x12\x15\n\x10MT_EMCMOT_ENABLE\x10\xeb\x07\x12\x16\n\x11MT_EMCMOT_DISABLE\x10\xec\x07\x12\x1f\n\x1aMT_EMCMOT_ENABLE_AMPLIFIER\x10\xed\x07\x12 \n\x1bMT_EMCMOT_DISABLE_AMPLIFIER\x10\xee\x07\x12\x1e\n\x19MT_EMCMOT_ENABLE_WATCHDOG\x10\xef\x07\x12\x1f\n\x1aMT_EMCMOT_DISABLE_WATCHDOG\x10\xf0\x07\x12\x1d\n\x18MT_EMCMOT_ACTIVATE_JOINT\x10\xf1\x07\x12\x1f\n\x1aMT_EMCMOT_DEACTIVATE_JOINT\x10\xf2\x07\x12\x14\n\x0fMT_EMCMOT_PAUSE\x10\xf3\x07\x12\x15\n\x10MT_EMCMOT_RESUME\x10\xf4\x07\x12\x13\n\x0eMT_EMCMOT_STEP\x10\xf5\x07\x12\x13\n\x0eMT_EMCMOT_FREE\x10\xf6\x07\x12\x14\n\x0fMT_EMCMOT_COORD\x10\xf7\x07\x12\x15\n\x10MT_EMCMOT_TELEOP\x10\xf8\x07\x12\x1c\n\x17MT_EMCMOT_SPINDLE_SCALE\x10\xf9\x07\x12\x18\n\x13MT_EMCMOT_SS_ENABLE\x10\xfa\x07\x12\x19\n\x14MT_EMCMOT_FEED_SCALE\x10\xfb\x07\x12\x18\n\x13MT_EMCMOT_FS_ENABLE\x10\xfc\x07\x12\x18\n\x13MT_EMCMOT_FH_ENABLE\x10\xfd\x07\x12\x18\n\x13MT_EMCMOT_AF_ENABLE\x10\xfe\x07\x12\x1e\n\x19MT_EMCMOT_OVERRIDE_LIMITS\x10\xff\x07\x12\x13\n\x0eMT_EMCMOT_HOME\x10\x80\x08\x12\x15\n\x10MT_EMCMOT_UNHOME\x10\x81\x08\x12\x17\n\x12MT_EMCMOT_JOG_CONT\x10\x82\x08\x12\x17\n\x12MT_EMCMOT_JOG_INCR\x10\x83\x08\x12\x16\n\x11MT_EMCMOT_JOG_ABS\x10\x84\x08\x12\x17\n\x12MT_EMCMOT_SET_LINE\x10\x85\x08\x12\x19\n\x14MT_EMCMOT_SET_CIRCLE\x10\x86\x08\x12 \n\x1bMT_EMCMOT_SET_TELEOP_VECTOR\x10\x87\x08\x12 \n\x1bMT_EMCMOT_CLEAR_PROBE_FLAGS\x10\x88\x08\x12\x14\n\x0fMT_EMCMOT_PROBE\x10\x89\x08\x12\x18\n\x13MT_EMCMOT_RIGID_TAP\x10\x8a\x08\x12\"\n\x1dMT_EMCMOT_SET_POSITION_LIMITS\x10\x8b\x08\x12\x1b\n\x16MT_EMCMOT_SET_BACKLASH\x10\x8c\x08\x12\x1d\n\x18MT_EMCMOT_SET_MIN_FERROR\x10\x8d\x08\x12\x1d\n\x18MT_EMCMOT_SET_MAX_FERROR\x10\x8e\x08\x12\x16\n\x11MT_EMCMOT_SET_VEL\x10\x8f\x08\x12\x1c\n\x17MT_EMCMOT_SET_VEL_LIMIT\x10\x90\x08\x12\"\n\x1dMT_EMCMOT_SET_JOINT_VEL_LIMIT\x10\x91\x08\x12\"\n\x1dMT_EMCMOT_SET_JOINT_ACC_LIMIT\x10\x92\x08\x12\x16\n\x11MT_EMCMOT_SET_ACC\x10\x93\x08\x12\x1c\n\x17MT_EMCMOT_SET_TERM_COND\x10\x94\x08\x12\x1b\n\x16MT_EMCMOT_SET_NUM_AXES\x10\x95\x08\x12\x1d\n\x18MT_EMCMOT_SET_WORLD_HOME\x10\x96\x08\x12 \n\x1bMT_EMCMOT_SET_HOMING_PARAMS\x10\x97\x08\x12\x18\n\x13MT_EMCMOT_SET_DEBUG\x10\x98\x08\x12\x17\n\x12MT_EMCMOT_SET_DOUT\x10\x99\x08\x12\x17\n\x12MT_EMCMOT_SET_AOUT\x10\x9a\x08\x12\x1e\n\x19MT_EMCMOT_SET_SPINDLESYNC\x10\x9b\x08\x12\x19\n\x14MT_EMCMOT_SPINDLE_ON\x10\x9c\x08\x12\x1a\n\x15MT_EMCMOT_SPINDLE_OFF\x10\x9d\x08\x12\x1f\n\x1aMT_EMCMOT_SPINDLE_INCREASE\x10\x9e\x08\x12\x1f\n\x1aMT_EMCMOT_SPINDLE_DECREASE\x10\x9f\x08\x12#\n\x1eMT_EMCMOT_SPINDLE_BRAKE_ENGAGE\x10\xa0\x08\x12$\n\x1fMT_EMCMOT_SPINDLE_BRAKE_RELEASE\x10\xa1\x08\x12\x1f\n\x1aMT_EMCMOT_SET_MOTOR_OFFSET\x10\xa2\x08\x12\x1d\n\x18MT_EMCMOT_SET_JOINT_COMP\x10\xa3\x08\x12\x19\n\x14MT_EMCMOT_SET_OFFSET\x10\xa4\x08\x12\x19\n\x14MT_EMCMOT_COMMAND_OK\x10\xa5\x08\x12&\n!MT_EMCMOT_COMMAND_UNKNOWN_COMMAND\x10\xa6\x08\x12&\n!MT_EMCMOT_COMMAND_INVALID_COMMAND\x10\xa7\x08\x12%\n MT_EMCMOT_COMMAND_INVALID_PARAMS\x10\xa8\x08\x12\x1f\n\x1aMT_EMCMOT_COMMAND_BAD_EXEC\x10\xa9\x08\x12\x1e\n\x19MT_EMCMOT_MOTION_DISABLED\x10\xaa\x08\x12\x1a\n\x15MT_EMCMOT_MOTION_FREE\x10\xab\x08\x12\x1c\n\x17MT_EMCMOT_MOTION_TELEOP\x10\xac\x08\x12\x1b\n\x16MT_EMCMOT_MOTION_COORD\x10\xad\x08\x12\x19\n\x14MT_EMCMOT_JOINT_FLAG\x10\xae\x08\x12\x1a\n\x15MT_EMCMOT_MOTION_FLAG\x10\xaf\x08\x12\x14\n\x0fMT_PRU_FIRMWARE\x10\x80\x10\x12\x1a\n\x15MT_MESA_5I20_FIRMWARE\x10\xb8\x17\x12\x0c\n\x07MT_BLOB\x10\xa0\x1f\x12\r\n\x08MT_TEST1\x10\x89\'\x12\r\n\x08MT_TEST2\x10\x8a\'\x12\r\n\x08MT_TEST3\x10\x8b\'\x12\x15\n\x10MT_EMC_NML_LOWER\x10\x90N\x12\x15\n\x10MT_EMC_NML_UPPER\x10\xc8\x65\x12\x1a\n\x15MT_EMC_OPERATOR_ERROR\x10\x9bN\x12\x19\n\x14MT_EMC_OPERATOR_TEXT\x10\x9cN\x12\x1c\n\x17MT_EMC_OPERATOR_DISPLAY\x10\x9dN\x12\x10\n\x0bMT_EMC_NULL\x10\xa5N\x12\x15\n\x10MT_EMC_SET_DEBUG\x10\xa6N\x12\x16\n\x11MT_EMC_SYSTEM_CMD\x10\xaeN\x12\x19\n\x14MT_EMC_AXIS_SET_AXIS\x10\xf5N\x12\x1a\n\x15MT_EMC_AXIS_SET_UNITS\x10\xf6N\x12\'\n\"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT\x10\xfbN\x12\'\n\"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT\x10\xfcN\x12\x1d\n\x18MT_EMC_TOOL_START_CHANGE\x10\xd6\x08\x12\x1c\n\x17MT_EMC_EXEC_PLUGIN_CALL\x10\xd8\x08\x12\x1a\n\x15MT_EMC_IO_PLUGIN_CALL\x10\xd9\x08\x12\x1b\n\x16MT_EMC_AXIS_SET_FERROR\x10\xffN\x12\"\n\x1dMT_EMC_AXIS_SET_HOMING_PARAMS\x10\x80O\x12\x1f\n\x1aMT_EMC_AXIS_SET_MIN_FERROR\x10\x83O\x12!\n\x1cMT_EMC_AXIS_SET_MAX_VELOCITY\x10\x84O\x12\x15\n\x10MT_EMC_AXIS_INIT\x10\x86O\x12\x15\n\x10MT_EMC_AXIS_HALT\x10\x87O\x12\x16\n\x11MT_EMC_AXIS_ABORT\x10\x88O\x12\x17\n\x12MT_EMC_AXIS_ENABLE\x10\x89O\x12\x18\n\x13MT_EMC_AXIS_DISABLE\x10\x8aO\x12\x15\n\x10MT_EMC_AXIS_HOME\x10\x8bO\x12\x17\n\x12MT_EMC_AXIS_UNHOME\x10\x97O\x12\x14\n\x0fMT_EMC_AXIS_JOG\x10\x8cO\x12\x19\n\x14MT_EMC_AXIS_INCR_JOG\x10\x8dO\x12\x18\n\x13MT_EMC_AXIS_ABS_JOG\x10\x8eO\x12\x19\n\x14MT_EMC_AXIS_ACTIVATE\x10\x8fO\x12\x1b\n\x16MT_EMC_AXIS_DEACTIVATE\x10\x90O\x12 \n\x1bMT_EMC_AXIS_OVERRIDE_LIMITS\x10\x91O\x12\x1a\n\x15MT_EMC_AXIS_LOAD_COMP\x10\x93O\x12\x1d\n\x18MT_EMC_AXIS_SET_BACKLASH\x10\x96O\x12\x15\n\x10MT_EMC_AXIS_STAT\x10\xd7O\x12\x19\n\x14MT_EMC_TRAJ_SET_AXES\x10\xd9O\x12\x1a\n\x15MT_EMC_TRAJ_SET_UNITS\x10\xdaO\x12\x1f\n\x1aMT_EMC_TRAJ_SET_CYCLE_TIME\x10\xdbO\x12\x19\n\x14MT_EMC_TRAJ_SET_MODE\x10\xdcO\x12\x1d\n\x18MT_EMC_TRAJ_SET_VELOCITY\x10\xddO\x12!\n\x1cMT_EMC_TRAJ_SET_ACCELERATION\x10\xdeO\x12!\n\x1cMT_EMC_TRAJ_SET_MAX_VELOCITY\x10\xdfO\x12%\n MT_EMC_TRAJ_SET_MAX_ACCELERATION\x10\xe0O\x12\x1a\n\x15MT_EMC_TRAJ_SET_SCALE\x10\xe1O\x12\x1e\n\x19MT_EMC_TRAJ_SET_MOTION_ID\x10\xe2O\x12\x15\n\x10MT_EMC_TRAJ_INIT\x10\xe3O\x12\x15\n\x10MT_EMC_TRAJ_HALT\x10\xe4O\x12\x17\n\x12MT_EMC_TRAJ_ENABLE\x10\xe5O\x12\x18\n\x13MT_EMC_TRAJ_DISABLE\x10\xe6O\x12\x16\n\x11MT_EMC_TRAJ_ABORT\x10\xe7O\x12\x16\n\x11MT_EMC_TRAJ_PAUSE\x10\xe8O\x12\x15\n\x10MT_EMC_TRAJ_STEP\x10\xe9O\x12\x17\n\x12MT_EMC_TRAJ_RESUME\x10\xeaO\x12\x16\n\x11MT_EMC_TRAJ_DELAY\x10\xebO\x12\x1c\n\x17MT_EMC_TRAJ_LINEAR_MOVE\x10\xecO\x12\x1e\n\x19MT_EMC_TRAJ_CIRCULAR_MOVE\x10\xedO\x12\x1e\n\x19MT_EMC_TRAJ_SET_TERM_COND\x10\xeeO\x12\x1b\n\x16MT_EMC_TRAJ_SET_OFFSET\x10\xefO\x12\x18\n\x13MT_EMC_TRAJ_SET_G5X\x10\xf0O\x12\x19\n\x14MT_EMC_TRAJ_SET_HOME\x10\xf1O\x12\x1d\n\x18MT_EMC_TRAJ_SET_ROTATION\x10\xf2O\x12\x18\n\x13MT_EMC_TRAJ_SET_G92\x10\xf3O\x12)\n$MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG\x10\xf4O\x12\x16\n\x11MT_EMC_TRAJ_PROBE\x10\xf5O\x12\"\n\x1dMT_EMC_TRAJ_SET_TELEOP_ENABLE\x10\xf6O\x12\"\n\x1dMT_EMC_TRAJ_SET_TELEOP_VECTOR\x10\xf7O\x12 \n\x1bMT_EMC_TRAJ_SET_SPINDLESYNC\x10\xf8O\x12\"\n\x1dMT_EMC_TRAJ_SET_SPINDLE_SCALE\x10\xf9O\x12\x1e\n\x19MT_EMC_TRAJ_SET_FO_ENABLE\x10\xfaO\x12\x1e\n\x19MT_EMC_TRAJ_SET_SO_ENABLE\x10\xfbO\x12\x1e\n\x19MT_EMC_TRAJ_SET_FH_ENABLE\x10\xfcO\x12\x1a\n\x15MT_EMC_TRAJ_RIGID_TAP\x10\xfdO\x12 \n\x1bMT_EMC_TRAJ_SET_RAPID_SCALE\x10\xfeO\x12\x15\n\x10MT_EMC_TRAJ_STAT\x10\xbbP\x12\x17\n\x12MT_EMC_MOTION_INIT\x10\xbdP\x12\x17\n\x12MT_EMC_MOTION_HALT\x10\xbeP\x12\x18\n\x13MT_EMC_MOTION_ABORT\x10\xbfP\x12\x1b\n\x16MT_EMC_MOTION_SET_AOUT\x10\xc0P\x12\x1b\n\x16MT_EMC_MOTION_SET_DOUT\x10\xc1P\x12\x1b\n\x16MT_EMC_MOTION_ADAPTIVE\x10\xc2P\x12\x1a\n\x15MT_EMC_SPINDLE_ORIENT\x10\xcdP\x12(\n#MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE\x10\xceP\x12\x17\n\x12MT_EMC_MOTION_STAT\x10\x9fQ\x12\x15\n\x10MT_EMC_TASK_INIT\x10\x85R\x12\x15\n\x10MT_EMC_TASK_HALT\x10\x86R\x12\x16\n\x11MT_EMC_TASK_ABORT\x10\x87R\x12\x19\n\x14MT_EMC_TASK_SET_MODE\x10\x88R\x12\x1a\n\x15MT_EMC_TASK_SET_STATE\x10\x89R\x12\x1a\n\x15MT_EMC_TASK_PLAN_OPEN\x10\x8aR\x12\x19\n\x14MT_EMC_TASK_PLAN_RUN\x10\x8bR\x12\x1a\n\x15MT_EMC_TASK_PLAN_READ\x10\x8cR\x12\x1d\n\x18MT_EMC_TASK_PLAN_EXECUTE\x10\x8dR\x12\x1b\n\x16MT_EMC_TASK_PLAN_PAUSE\x10\x8eR\x12\x1a\n\x15MT_EMC_TASK_PLAN_STEP\x10\x8fR\x12\x1c\n\x17MT_EMC_TASK_PLAN_RESUME\x10\x90R\x12\x19\n\x14MT_EMC_TASK_PLAN_END\x10\x91R\x12\x1b\n\x16MT_EMC_TASK_PLAN_CLOSE\x10\x92R\x12\x1a\n\x15MT_EMC_TASK_PLAN_INIT\x10\x93R\x12\x1b\n\x16MT_EMC_TASK_PLAN_SYNCH\x10\x94R\x12\'\n\"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP\x10\x95R\x12&\n!MT_EMC_TASK_PLAN_SET_BLOCK_DELETE\x10\x96R\x12#\n\x1eMT_EMC_TASK_PLAN_OPTIONAL_STOP\x10\x97R\x12\x1b\n\x16MT_EMC_TASK_PLAN_RESET\x10\x98R\x12\x1b\n\x16MT_EMC_TASK_PLAN_REPLY\x10\xa2R\x12\x15\n\x10MT_EMC_TASK_STAT\x10\xe7R\x12\x15\n\x10MT_EMC_TOOL_INIT\x10\xddV\x12\x15\n\x10MT_EMC_TOOL_HALT\x10\xdeV\x12\x16\n\x11MT_EMC_TOOL_ABORT\x10\xdfV\x12\x18\n\x13MT_EMC_TOOL_PREPARE\x10\xe0V\x12\x15\n\x10MT_EMC_TOOL_LOAD\x10\xe1V\x12\x17\n\x12MT_EMC_TOOL_UNLOAD\x10\xe2V\x12 \n\x1bMT_EMC_TOOL_LOAD_TOOL_TABLE\x10\xe3V\x12\x1b\n\x16MT_EMC_TOOL_SET_OFFSET\x10\xe4V\x12\x1b\n\x16MT_EMC_TOOL_SET_NUMBER\x10\xe5V\x12\"\n\x1dMT_EMC_TOOL_UPDATE_TOOL_TABLE\x10\xe6V\x12\x15\n\x10MT_EMC_TOOL_STAT\x10\xbfW\x12\x18\n\x13MT_EMC_AUX_ESTOP_ON\x10\xc6W\x12\x19\n\x14MT_EMC_AUX_ESTOP_OFF\x10\xc7W\x12\x1b\n\x16MT_EMC_AUX_ESTOP_RESET\x10\xc8W\x12\x1a\n\x15MT_EMC_AUX_INPUT_WAIT\x10\xc9W\x12\x14\n\x0fMT_EMC_AUX_STAT\x10\xa3X\x12\x16\n\x11MT_EMC_SPINDLE_ON\x10\xa8X\x12\x17\n\x12MT_EMC_SPINDLE_OFF\x10\xa9X\x12\x1c\n\x17MT_EMC_SPINDLE_INCREASE\x10\xadX\x12\x1c\n\x17MT_EMC_SPINDLE_DECREASE\x10\xaeX\x12\x1c\n\x17MT_EMC_SPINDLE_CONSTANT\x10\xafX\x12!\n\x1cMT_EMC_SPINDLE_BRAKE_RELEASE\x10\xb0X\x12 \n\x1bMT_EMC_SPINDLE_BRAKE_ENGAGE\x10\xb1X\x12\x19\n\x14MT_EMC_SPINDLE_SPEED\x10\xb4X\x12\x18\n\x13MT_EMC_SPINDLE_STAT\x10\x87Y\x12\x1b\n\x16MT_EMC_COOLANT_MIST_ON\x10\x8cY\x12\x1c\n\x17MT_EMC_COOLANT_MIST_OFF\x10\x8dY\x12\x1c\n\x17MT_EMC_COOLANT_FLOOD_ON\x10\x8eY\x12\x1d\n\x18MT_EMC_COOLANT_FLOOD_OFF\x10\x8fY\x12\x18\n\x13MT_EMC_COOLANT_STAT\x10\xebY\x12\x13\n\x0eMT_EMC_LUBE_ON\x10\xf0Y\x12\x14\n\x0fMT_EMC_LUBE_OFF\x10\xf1Y\x12\x15\n\x10MT_EMC_LUBE_STAT\x10\xcfZ\x12\x13\n\x0eMT_EMC_IO_INIT\x10\xd1Z\x12\x13\n\x0eMT_EMC_IO_HALT\x10\xd2Z\x12\x14\n\x0fMT_EMC_IO_ABORT\x10\xd3Z\x12\x1d\n\x18MT_EMC_IO_SET_CYCLE_TIME\x10\xd4Z\x12\x13\n\x0eMT_EMC_IO_STAT\x10\xb3[\x12\x10\n\x0bMT_EMC_INIT\x10\xfd\\\x12\x10\n\x0bMT_EMC_HALT\x10\xfe\\\x12\x11\n\x0cMT_EMC_ABORT\x10\xff\\\x12\x10\n\x0bMT_EMC_STAT\x10\xdf]\x12\x1b\n\x16MT_EMCSTAT_FULL_UPDATE\x10\xd4\x61\x12\"\n\x1dMT_EMCSTAT_INCREMENTAL_UPDATE\x10\xd5\x61\x12\x15\n\x10MT_EMC_NML_ERROR\x10\xde\x61\x12\x14\n\x0fMT_EMC_NML_TEXT\x10\xdf\x61\x12\x17\n\x12MT_EMC_NML_DISPLAY\x10\xe0\x61\x12\x17\n\x12MT_EMCCMD_EXECUTED\x10\xe8\x61\x12\x18\n\x13MT_EMCCMD_COMPLETED\x10\xe9\x61\x12\x1c\n\x17MT_LAUNCHER_FULL_UPDATE\x10\xb8\x62\x12#\n\x1eMT_LAUNCHER_INCREMENTAL_UPDATE\x10\xb9\x62\x12\x16\n\x11MT_LAUNCHER_ERROR\x10\xba\x62\x12\x16\n\x11MT_LAUNCHER_START\x10\xc2\x62\x12\x1a\n\x15MT_LAUNCHER_TERMINATE\x10\xc3\x62\x12\x15\n\x10MT_LAUNCHER_KILL\x10\xc4\x62\x12\x1c\n\x17MT_LAUNCHER_WRITE_STDIN\x10\xc5\x62\x12\x15\n\x10MT_LAUNCHER_CALL\x10\xc6\x62\x12\x19\n\x14MT_LAUNCHER_SHUTDOWN\x10\xc7\x62\x12\x14\n\x0fMT_LAUNCHER_SET\x10\xc8\x62*\xb7\x01\n\x0bOriginIndex\x12\x12\n\x0eORIGIN_UNKNOWN\x10\x00\x12\x0e\n\nORIGIN_G54\x10\x01\x12\x0e\n\nORIGIN_G55\x10\x02\x12\x0e\n\nORIGIN_G56\x10\x03\x12\x0e\n\nORIGIN_G57\x10\x04\x12\x0e\n\nORIGIN_G58\x10\x05\x12\x0e\n\nORIGIN_G59\x10\x06\x12\x10\n\x0cORIGIN_G59_1\x10\x07\x12\x10\n\x0cORIGIN_G59_2\x10\x08\x12\x10\n\x0cORIGIN_G59_3\x10\t*P\n\x11TermConditionType\x12\x1c\n\x18_EMC_TRAJ_TERM_COND_STOP\x10\x01\x12\x1d\n\x19_EMC_TRAJ_TERM_COND_BLEND\x10\x02*W\n\x0e\x43\x61nonDirection\x12\x12\n\x0e_CANON_STOPPED\x10\x01\x12\x14\n\x10_CANON_CLOCKWISE\x10\x02\x12\x1b\n\x17_CANON_COUNTERCLOCKWISE\x10\x03*2\n\tInputType\x12\x11\n\r_ANALOG_INPUT\x10\x00\x12\x12\n\x0e_DIGITAL_INPUT\x10\x01*F\n\x08WaitType\x12\r\n\tIMMEDIATE\x10\x00\x12\x08\n\x04RISE\x10\x01\x12\x08\n\x04\x46\x41LL\x10\x02\x12\x0b\n\x07\x42\x45_HIGH\x10\x03\x12\n\n\x06\x42\x45_LOW\x10\x04*\xaa\x01\n\x14InterpreterStateType\x12\x0f\n\x0bINTERP_IDLE\x10\x01\x12\x12\n\x0eINTERP_RUNNING\x10\x02\x12\x14\n\x10INTERP_SYNC_WAIT\x10\x03\x12\x11\n\rINTERP_PAUSED\x10\x04\x12\x15\n\x11INTERP_QUEUE_WAIT\x10\x05\x12\x15\n\x11INTERP_ABORT_WAIT\x10\x06\x12\x16\n\x12INTERP_STATE_UNSET\x10\x63')
+  serialized_pb=_b('\n machinetalk/protobuf/types.proto\x12\x0bmachinetalk\x1a!machinetalk/protobuf/nanopb.proto*\xf7\x01\n\tValueType\x12\x0b\n\x07HAL_BIT\x10\x01\x12\r\n\tHAL_FLOAT\x10\x02\x12\x0b\n\x07HAL_S32\x10\x03\x12\x0b\n\x07HAL_U32\x10\x04\x12\x0b\n\x07HAL_S64\x10\x05\x12\x0b\n\x07HAL_U64\x10\x06\x12\n\n\x06STRING\x10\x07\x12\t\n\x05\x42YTES\x10\x08\x12\t\n\x05INT32\x10\x14\x12\n\n\x06UINT32\x10\x1e\x12\t\n\x05INT64\x10(\x12\n\n\x06UINT64\x10\x32\x12\n\n\x06\x44OUBLE\x10<\x12\x08\n\x04\x42OOL\x10P\x12\r\n\tCARTESIAN\x10\x64\x12\x14\n\x10LEGACY_CARTESIAN\x10n\x12\x08\n\x04POSE\x10x\x12\x10\n\x0bLEGACY_POSE\x10\x82\x01*6\n\x0fHalPinDirection\x12\n\n\x06HAL_IN\x10\x10\x12\x0b\n\x07HAL_OUT\x10 \x12\n\n\x06HAL_IO\x10\x30*,\n\x11HalParamDirection\x12\n\n\x06HAL_RO\x10@\x12\x0b\n\x06HAL_RW\x10\xc0\x01*M\n\x0cHalFunctType\x12\x18\n\x14\x46S_LEGACY_THREADFUNC\x10\x00\x12\x12\n\x0e\x46S_XTHREADFUNC\x10\x01\x12\x0f\n\x0b\x46S_USERLAND\x10\x02*\xdb\x01\n\nObjectType\x12\x16\n\x12HAL_OBJECT_INVALID\x10\x00\x12\x0b\n\x07HAL_PIN\x10\x01\x12\x0e\n\nHAL_SIGNAL\x10\x02\x12\r\n\tHAL_PARAM\x10\x03\x12\x0e\n\nHAL_THREAD\x10\x04\x12\r\n\tHAL_FUNCT\x10\x05\x12\x11\n\rHAL_COMPONENT\x10\x06\x12\x0e\n\nHAL_VTABLE\x10\x07\x12\x0c\n\x08HAL_INST\x10\x08\x12\x0c\n\x08HAL_RING\x10\t\x12\r\n\tHAL_GROUP\x10\n\x12\x0e\n\nHAL_MEMBER\x10\x0b\x12\x0c\n\x08HAL_PLUG\x10\x0c*\x81\x01\n\tmsgidType\x12\x0e\n\tMSGID_MAX\x10\xa0\x1f\x12\x1a\n\x15MSGID_ROUTE_DELIMITER\x10\xa1\x1f\x12\x14\n\x0fMSGID_ERROR_MSG\x10\xa2\x1f\x12\x0f\n\nMSGID_BLOB\x10\xa3\x1f\x12\x11\n\x0cMSGID_STRING\x10\xa4\x1f\x12\x0e\n\tMSGID_HOP\x10\xa5\x1f*\xee\x01\n\nsocketType\x12\x0f\n\x0bST_ZMQ_PAIR\x10\x00\x12\x0e\n\nST_ZMQ_PUB\x10\x01\x12\x0e\n\nST_ZMQ_SUB\x10\x02\x12\x0e\n\nST_ZMQ_REQ\x10\x03\x12\x0e\n\nST_ZMQ_REP\x10\x04\x12\x11\n\rST_ZMQ_DEALER\x10\x05\x12\x11\n\rST_ZMQ_ROUTER\x10\x06\x12\x0f\n\x0bST_ZMQ_PULL\x10\x07\x12\x0f\n\x0bST_ZMQ_PUSH\x10\x08\x12\x0f\n\x0bST_ZMQ_XPUB\x10\t\x12\x0f\n\x0bST_ZMQ_XSUB\x10\n\x12\x11\n\rST_ZMQ_STREAM\x10\x0b\x12\x12\n\x0eST_ZMQ_INVALID\x10\x0f*b\n\x11securityMechanism\x12\x18\n\x0bSM_ZMQ_NONE\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x12\x0f\n\x0bSM_ZMQ_NULL\x10\x00\x12\x10\n\x0cSM_ZMQ_PLAIN\x10\x01\x12\x10\n\x0cSM_ZMQ_CURVE\x10\x02*l\n\nRCS_STATUS\x12!\n\x14UNINITIALIZED_STATUS\x10\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01\x12\x0c\n\x08RCS_DONE\x10\x01\x12\x0c\n\x08RCS_EXEC\x10\x02\x12\r\n\tRCS_ERROR\x10\x03\x12\x10\n\x0cRCS_RECEIVED\x10\x04*:\n\tMsgOrigin\x12\x0e\n\nMSG_KERNEL\x10\x00\x12\x0e\n\nMSG_RTUSER\x10\x01\x12\r\n\tMSG_ULAPI\x10\x02*\x7f\n\x08MsgLevel\x12\x12\n\x0eRTAPI_MSG_NONE\x10\x00\x12\x11\n\rRTAPI_MSG_ERR\x10\x01\x12\x12\n\x0eRTAPI_MSG_WARN\x10\x02\x12\x12\n\x0eRTAPI_MSG_INFO\x10\x03\x12\x11\n\rRTAPI_MSG_DBG\x10\x04\x12\x11\n\rRTAPI_MSG_ALL\x10\x05*\xa0\x01\n\x0cOriginDetail\x12\x0f\n\x0bUNIX_SIGNAL\x10\n\x12\x15\n\x11INSTANCE_SHUTDOWN\x10\x14\x12\x0e\n\nZMQ_SOCKET\x10\x46\x12\r\n\tNML_LAYER\x10P\x12\r\n\tRCS_LAYER\x10Z\x12\r\n\tCMS_LAYER\x10\x64\x12\x0c\n\x08IP_LAYER\x10n\x12\r\n\tTCP_LAYER\x10x\x12\x0e\n\tPGM_LAYER\x10\x82\x01*\xa5\x01\n\nOriginType\x12\x0b\n\x07PROCESS\x10\n\x12\x0f\n\x0bUSER_THREAD\x10\x14\x12\r\n\tRT_THREAD\x10\x1e\x12\r\n\tCOMPONENT\x10(\x12\x13\n\x0fTHREAD_FUNCTION\x10\x32\x12\x12\n\x0e\x43OMPONENT_INIT\x10<\x12\x12\n\x0e\x43OMPONENT_EXIT\x10\x46\x12\t\n\x05GROUP\x10P\x12\x07\n\x03PIN\x10Z\x12\n\n\x06SIGNAL\x10\x64*:\n\x08Severity\x12\x13\n\x0fS_INFORMATIONAL\x10\x01\x12\r\n\tS_WARNING\x10\x02\x12\n\n\x06S_FAIL\x10\x04*D\n\nStatusType\x12\x0c\n\x08\x45NQUEUED\x10\x01\x12\x0e\n\nPROCESSING\x10\x02\x12\x0c\n\x08\x43OMPLETE\x10\x03\x12\n\n\x06\x46\x41ILED\x10\x04*Y\n\tReplyType\x12\x08\n\x04NONE\x10\x00\x12\x10\n\x0cON_RECEPTION\x10\x01\x12\r\n\tON_QUEUED\x10\x02\x12\x11\n\rON_COMPLETION\x10\x04\x12\x0e\n\tALL_STEPS\x10\xff\x01*\xd6\x02\n\x0bServiceType\x12\x0e\n\nST_LOGGING\x10\x01\x12\r\n\tST_CONFIG\x10\x02\x12\x0c\n\x08ST_REDIS\x10\x03\x12\x0b\n\x07ST_HTTP\x10\x04\x12\x0c\n\x08ST_HTTPS\x10\x05\x12\x10\n\x0cST_WEBSOCKET\x10\x06\x12\x11\n\rST_WEBSOCKETS\x10\x07\x12\x14\n\x10ST_RTAPI_COMMAND\x10\x08\x12\x13\n\x0fST_STP_HALGROUP\x10\t\x12\x13\n\x0fST_STP_HALRCOMP\x10\n\x12\x11\n\rST_STP_INTERP\x10\x0b\x12\x0f\n\x0bST_STP_TASK\x10\x0c\x12\x13\n\x0fST_HAL_RCOMMAND\x10\r\x12\x13\n\x0fST_TASK_COMMAND\x10\x0e\x12\x15\n\x11ST_INTERP_COMMAND\x10\x0f\x12\x19\n\x15ST_MESSAGEBUS_COMMAND\x10\x10\x12\x1a\n\x16ST_MESSAGEBUS_RESPONSE\x10\x11*1\n\nServiceAPI\x12\x13\n\x0fSA_ZMQ_PROTOBUF\x10\x01\x12\x0e\n\nSA_WS_JSON\x10\x02*\xdf\x46\n\rContainerType\x12\x10\n\x0cMT_RTMESSAGE\x10\x02\x12\r\n\tMT_MOTCMD\x10\x03\x12\x10\n\x0cMT_MOTSTATUS\x10\x04\x12\x14\n\x10MT_LEGACY_MOTCMD\x10\x05\x12\x17\n\x13MT_LEGACY_MOTSTATUS\x10\x06\x12\n\n\x06MT_WOU\x10\x07\x12\x10\n\x0cMT_HALUPDATE\x10\x08\x12\x14\n\x10MT_RTAPI_MESSAGE\x10\t\x12\x12\n\x0eMT_LOG_MESSAGE\x10\n\x12\x0e\n\nMT_PREVIEW\x10\x0b\x12\x0f\n\x0bMT_PROGRESS\x10\x0c\x12\x12\n\x0eMT_INTERP_STAT\x10\r\x12\r\n\tMT_SYSLOG\x10\x12\x12\x11\n\rMT_LEGACY_NML\x10\x13\x12\x17\n\x13MT_LEGACY_MOTCONFIG\x10\x14\x12\x16\n\x12MT_STP_UPDATE_FULL\x10\x1a\x12\x11\n\rMT_STP_UPDATE\x10\x1c\x12\x12\n\x0eMT_STP_NOGROUP\x10\x1b\x12\x0f\n\x0bMT_SHUTDOWN\x10-\x12\x17\n\x13MT_CONFIRM_SHUTDOWN\x10\x32\x12\x11\n\rMT_RTMESSAGE0\x10\x1e\x12\x11\n\rMT_RTMESSAGE1\x10\x1f\x12\x11\n\rMT_RTMESSAGE2\x10 \x12\x11\n\rMT_RTMESSAGE3\x10!\x12\x11\n\rMT_RTMESSAGE4\x10\"\x12\x0c\n\x08MT_ASCII\x10\x64\x12\x0e\n\nMT_UNICODE\x10\x65\x12\x0c\n\x08MT_GCODE\x10\x66\x12\r\n\tMT_PYTHON\x10g\x12\r\n\tMT_PICKLE\x10h\x12\n\n\x06MT_TCL\x10i\x12\n\n\x06MT_XML\x10j\x12\x0b\n\x07MT_JSON\x10k\x12\x0b\n\x07MT_JPEG\x10l\x12\n\n\x06MT_PNG\x10m\x12\x0b\n\x07MT_TIFF\x10n\x12\x11\n\rMT_POSTSCRIPT\x10o\x12\n\n\x06MT_SVG\x10p\x12\x15\n\x10MT_ZMQ_SUBSCRIBE\x10\x96\x01\x12\x17\n\x12MT_ZMQ_UNSUBSCRIBE\x10\x97\x01\x12\x0c\n\x07MT_PING\x10\xd2\x01\x12\x18\n\x13MT_PING_ACKNOWLEDGE\x10\xd7\x01\x12\x0e\n\tMT_REJECT\x10\xdc\x01\x12\x0c\n\x07MT_DONE\x10\xf0\x01\x12\x17\n\x12MT_SERVICE_REQUEST\x10\xfa\x01\x12\x1c\n\x17MT_SERVICE_ANNOUNCEMENT\x10\xfb\x01\x12\x15\n\x10MT_SERVICE_PROBE\x10\xfc\x01\x12!\n\x1cMT_MESSAGEBUS_NO_DESTINATION\x10\xff\x01\x12\x15\n\x10MT_HALRCOMP_BIND\x10\x80\x02\x12\x1d\n\x18MT_HALRCOMP_BIND_CONFIRM\x10\x81\x02\x12\x1c\n\x17MT_HALRCOMP_BIND_REJECT\x10\x82\x02\x12\x14\n\x0fMT_HALRCOMP_SET\x10\x83\x02\x12\x1b\n\x16MT_HALRCOMP_SET_REJECT\x10\x84\x02\x12\x14\n\x0fMT_HALRCOMP_ACK\x10\x87\x02\x12\x17\n\x12MT_HALRCOMMAND_SET\x10\x89\x02\x12\x1e\n\x19MT_HALRCOMMAND_SET_REJECT\x10\x8a\x02\x12\x17\n\x12MT_HALRCOMMAND_GET\x10\x8b\x02\x12\x1e\n\x19MT_HALRCOMMAND_GET_REJECT\x10\x8c\x02\x12\x1a\n\x15MT_HALRCOMMAND_CREATE\x10\x8d\x02\x12!\n\x1cMT_HALRCOMMAND_CREATE_REJECT\x10\x8e\x02\x12\x1a\n\x15MT_HALRCOMMAND_DELETE\x10\x8f\x02\x12!\n\x1cMT_HALRCOMMAND_DELETE_REJECT\x10\x90\x02\x12\x17\n\x12MT_HALRCOMMAND_ACK\x10\x91\x02\x12\x19\n\x14MT_HALRCOMMAND_ERROR\x10\x92\x02\x12\x1c\n\x17MT_HALRCOMMAND_DESCRIBE\x10\x94\x02\x12\x1f\n\x1aMT_HALRCOMMAND_DESCRIPTION\x10\x95\x02\x12\x1c\n\x17MT_HALRCOMP_FULL_UPDATE\x10\xa0\x02\x12#\n\x1eMT_HALRCOMP_INCREMENTAL_UPDATE\x10\xa1\x02\x12\x16\n\x11MT_HALRCOMP_ERROR\x10\xa2\x02\x12\x1e\n\x19MT_HALRCOMP_PACKED_UPDATE\x10\xa3\x02\x12\x1e\n\x19MT_HALGROUP_PACKED_UPDATE\x10\xa4\x02\x12\x15\n\x10MT_HALGROUP_BIND\x10\xa6\x02\x12\x1d\n\x18MT_HALGROUP_BIND_CONFIRM\x10\xa7\x02\x12\x1c\n\x17MT_HALGROUP_BIND_REJECT\x10\xa8\x02\x12\x1c\n\x17MT_HALGROUP_FULL_UPDATE\x10\xa9\x02\x12#\n\x1eMT_HALGROUP_INCREMENTAL_UPDATE\x10\xaa\x02\x12\x16\n\x11MT_HALGROUP_ERROR\x10\xab\x02\x12\x16\n\x11MT_RTAPI_APP_EXIT\x10\xac\x02\x12\x16\n\x11MT_RTAPI_APP_PING\x10\xad\x02\x12\x18\n\x13MT_RTAPI_APP_LOADRT\x10\xae\x02\x12\x15\n\x10MT_RTAPI_APP_LOG\x10\xaf\x02\x12\x1a\n\x15MT_RTAPI_APP_UNLOADRT\x10\xb1\x02\x12\x19\n\x14MT_RTAPI_APP_NEWINST\x10\xb2\x02\x12\x1b\n\x16MT_RTAPI_APP_NEWTHREAD\x10\xb3\x02\x12\x1b\n\x16MT_RTAPI_APP_DELTHREAD\x10\xb4\x02\x12\x1a\n\x15MT_RTAPI_APP_CALLFUNC\x10\xb5\x02\x12\x17\n\x12MT_RTAPI_APP_REPLY\x10\xb6\x02\x12\x19\n\x14MT_RTAPI_APP_DELINST\x10\xb7\x02\x12\x19\n\x14MT_LIST_APPLICATIONS\x10\xde\x02\x12\x1c\n\x17MT_DESCRIBE_APPLICATION\x10\xdf\x02\x12\x1c\n\x17MT_RETRIEVE_APPLICATION\x10\xe0\x02\x12\x1a\n\x15MT_APPLICATION_DETAIL\x10\xe1\x02\x12\r\n\x08MT_ERROR\x10\xe8\x02\x12\x13\n\x0eMT_FULL_UPDATE\x10\xf2\x02\x12\x1a\n\x15MT_INCREMENTAL_UPDATE\x10\xf3\x02\x12\x12\n\rMT_TASK_REPLY\x10\x90\x03\x12\x15\n\x10MT_TICKET_UPDATE\x10\x91\x03\x12\x15\n\x10MT_CREDIT_UPDATE\x10\xc2\x03\x12\x14\n\x0fMT_EMCMOT_LOWER\x10\xe8\x07\x12\x14\n\x0fMT_EMCMOT_UPPER\x10\xcc\x08\x12\x14\n\x0fMT_EMCMOT_ABORT\x10\xe9\x07\x12\x19\n\x14MT_EMCMOT_AXIS_ABORT\x10\xea\x07\x12\x15\n\x10MT_EMCMOT_ENABLE\x10\xeb\x07\x12\x16\n\x11MT_EMCMOT_DISABLE\x10\xec\x07\x12\x1f\n\x1aMT_EMCMOT_ENABLE_AMPLIFIER\x10\xed\x07\x12 \n\x1bMT_EMCMOT_DISABLE_AMPLIFIER\x10\xee\x07\x12\x1e\n\x19MT_EMCMOT_ENABLE_WATCHDOG\x10\xef\x07\x12\x1f\n\x1aMT_EMCMOT_DISABLE_WATCHDOG\x10\xf0\x07\x12\x1d\n\x18MT_EMCMOT_ACTIVATE_JOINT\x10\xf1\x07\x12\x1f\n\x1aMT_EMCMOT_DEACTIVATE_JOINT\x10\xf2\x07\x12\x14\n\x0fMT_EMCMOT_PAUSE\x10\xf3\x07\x12\x15\n\x10MT_EMCMOT_RESUME\x10\xf4\x07\x12\x13\n\x0eMT_EMCMOT_STEP\x10\xf5\x07\x12\x13\n\x0eMT_EMCMOT_FREE\x10\xf6\x07\x12\x14\n\x0fMT_EMCMOT_COORD\x10\xf7\x07\x12\x15\n\x10MT_EMCMOT_TELEOP\x10\xf8\x07\x12\x1c\n\x17MT_EMCMOT_SPINDLE_SCALE\x10\xf9\x07\x12\x18\n\x13MT_EMCMOT_SS_ENABLE\x10\xfa\x07\x12\x19\n\x14MT_EMCMOT_FEED_SCALE\x10\xfb\x07\x12\x18\n\x13MT_EMCMOT_FS_ENABLE\x10\xfc\x07\x12\x18\n\x13MT_EMCMOT_FH_ENABLE\x10\xfd\x07\x12\x18\n\x13MT_EMCMOT_AF_ENABLE\x10\xfe\x07\x12\x1e\n\x19MT_EMCMOT_OVERRIDE_LIMITS\x10\xff\x07\x12\x13\n\x0eMT_EMCMOT_HOME\x10\x80\x08\x12\x15\n\x10MT_EMCMOT_UNHOME\x10\x81\x08\x12\x17\n\x12MT_EMCMOT_JOG_CONT\x10\x82\x08\x12\x17\n\x12MT_EMCMOT_JOG_INCR\x10\x83\x08\x12\x16\n\x11MT_EMCMOT_JOG_ABS\x10\x84\x08\x12\x17\n\x12MT_EMCMOT_SET_LINE\x10\x85\x08\x12\x19\n\x14MT_EMCMOT_SET_CIRCLE\x10\x86\x08\x12 \n\x1bMT_EMCMOT_SET_TELEOP_VECTOR\x10\x87\x08\x12 \n\x1bMT_EMCMOT_CLEAR_PROBE_FLAGS\x10\x88\x08\x12\x14\n\x0fMT_EMCMOT_PROBE\x10\x89\x08\x12\x18\n\x13MT_EMCMOT_RIGID_TAP\x10\x8a\x08\x12\"\n\x1dMT_EMCMOT_SET_POSITION_LIMITS\x10\x8b\x08\x12\x1b\n\x16MT_EMCMOT_SET_BACKLASH\x10\x8c\x08\x12\x1d\n\x18MT_EMCMOT_SET_MIN_FERROR\x10\x8d\x08\x12\x1d\n\x18MT_EMCMOT_SET_MAX_FERROR\x10\x8e\x08\x12\x16\n\x11MT_EMCMOT_SET_VEL\x10\x8f\x08\x12\x1c\n\x17MT_EMCMOT_SET_VEL_LIMIT\x10\x90\x08\x12\"\n\x1dMT_EMCMOT_SET_JOINT_VEL_LIMIT\x10\x91\x08\x12\"\n\x1dMT_EMCMOT_SET_JOINT_ACC_LIMIT\x10\x92\x08\x12\x16\n\x11MT_EMCMOT_SET_ACC\x10\x93\x08\x12\x1c\n\x17MT_EMCMOT_SET_TERM_COND\x10\x94\x08\x12\x1b\n\x16MT_EMCMOT_SET_NUM_AXES\x10\x95\x08\x12\x1d\n\x18MT_EMCMOT_SET_WORLD_HOME\x10\x96\x08\x12 \n\x1bMT_EMCMOT_SET_HOMING_PARAMS\x10\x97\x08\x12\x18\n\x13MT_EMCMOT_SET_DEBUG\x10\x98\x08\x12\x17\n\x12MT_EMCMOT_SET_DOUT\x10\x99\x08\x12\x17\n\x12MT_EMCMOT_SET_AOUT\x10\x9a\x08\x12\x1e\n\x19MT_EMCMOT_SET_SPINDLESYNC\x10\x9b\x08\x12\x19\n\x14MT_EMCMOT_SPINDLE_ON\x10\x9c\x08\x12\x1a\n\x15MT_EMCMOT_SPINDLE_OFF\x10\x9d\x08\x12\x1f\n\x1aMT_EMCMOT_SPINDLE_INCREASE\x10\x9e\x08\x12\x1f\n\x1aMT_EMCMOT_SPINDLE_DECREASE\x10\x9f\x08\x12#\n\x1eMT_EMCMOT_SPINDLE_BRAKE_ENGAGE\x10\xa0\x08\x12$\n\x1fMT_EMCMOT_SPINDLE_BRAKE_RELEASE\x10\xa1\x08\x12\x1f\n\x1aMT_EMCMOT_SET_MOTOR_OFFSET\x10\xa2\x08\x12\x1d\n\x18MT_EMCMOT_SET_JOINT_COMP\x10\xa3\x08\x12\x19\n\x14MT_EMCMOT_SET_OFFSET\x10\xa4\x08\x12\x19\n\x14MT_EMCMOT_COMMAND_OK\x10\xa5\x08\x12&\n!MT_EMCMOT_COMMAND_UNKNOWN_COMMAND\x10\xa6\x08\x12&\n!MT_EMCMOT_COMMAND_INVALID_COMMAND\x10\xa7\x08\x12%\n MT_EMCMOT_COMMAND_INVALID_PARAMS\x10\xa8\x08\x12\x1f\n\x1aMT_EMCMOT_COMMAND_BAD_EXEC\x10\xa9\x08\x12\x1e\n\x19MT_EMCMOT_MOTION_DISABLED\x10\xaa\x08\x12\x1a\n\x15MT_EMCMOT_MOTION_FREE\x10\xab\x08\x12\x1c\n\x17MT_EMCMOT_MOTION_TELEOP\x10\xac\x08\x12\x1b\n\x16MT_EMCMOT_MOTION_COORD\x10\xad\x08\x12\x19\n\x14MT_EMCMOT_JOINT_FLAG\x10\xae\x08\x12\x1a\n\x15MT_EMCMOT_MOTION_FLAG\x10\xaf\x08\x12\x14\n\x0fMT_PRU_FIRMWARE\x10\x80\x10\x12\x1a\n\x15MT_MESA_5I20_FIRMWARE\x10\xb8\x17\x12\x0c\n\x07MT_BLOB\x10\xa0\x1f\x12\r\n\x08MT_TEST1\x10\x89\'\x12\r\n\x08MT_TEST2\x10\x8a\'\x12\r\n\x08MT_TEST3\x10\x8b\'\x12\x15\n\x10MT_EMC_NML_LOWER\x10\x90N\x12\x15\n\x10MT_EMC_NML_UPPER\x10\xc8\x65\x12\x1a\n\x15MT_EMC_OPERATOR_ERROR\x10\x9bN\x12\x19\n\x14MT_EMC_OPERATOR_TEXT\x10\x9cN\x12\x1c\n\x17MT_EMC_OPERATOR_DISPLAY\x10\x9dN\x12\x10\n\x0bMT_EMC_NULL\x10\xa5N\x12\x15\n\x10MT_EMC_SET_DEBUG\x10\xa6N\x12\x16\n\x11MT_EMC_SYSTEM_CMD\x10\xaeN\x12\x19\n\x14MT_EMC_AXIS_SET_AXIS\x10\xf5N\x12\x1a\n\x15MT_EMC_AXIS_SET_UNITS\x10\xf6N\x12\'\n\"MT_EMC_AXIS_SET_MIN_POSITION_LIMIT\x10\xfbN\x12\'\n\"MT_EMC_AXIS_SET_MAX_POSITION_LIMIT\x10\xfcN\x12\x1d\n\x18MT_EMC_TOOL_START_CHANGE\x10\xd6\x08\x12\x1c\n\x17MT_EMC_EXEC_PLUGIN_CALL\x10\xd8\x08\x12\x1a\n\x15MT_EMC_IO_PLUGIN_CALL\x10\xd9\x08\x12\x1b\n\x16MT_EMC_AXIS_SET_FERROR\x10\xffN\x12\"\n\x1dMT_EMC_AXIS_SET_HOMING_PARAMS\x10\x80O\x12\x1f\n\x1aMT_EMC_AXIS_SET_MIN_FERROR\x10\x83O\x12!\n\x1cMT_EMC_AXIS_SET_MAX_VELOCITY\x10\x84O\x12\x15\n\x10MT_EMC_AXIS_INIT\x10\x86O\x12\x15\n\x10MT_EMC_AXIS_HALT\x10\x87O\x12\x16\n\x11MT_EMC_AXIS_ABORT\x10\x88O\x12\x17\n\x12MT_EMC_AXIS_ENABLE\x10\x89O\x12\x18\n\x13MT_EMC_AXIS_DISABLE\x10\x8aO\x12\x15\n\x10MT_EMC_AXIS_HOME\x10\x8bO\x12\x17\n\x12MT_EMC_AXIS_UNHOME\x10\x97O\x12\x14\n\x0fMT_EMC_AXIS_JOG\x10\x8cO\x12\x19\n\x14MT_EMC_AXIS_INCR_JOG\x10\x8dO\x12\x18\n\x13MT_EMC_AXIS_ABS_JOG\x10\x8eO\x12\x19\n\x14MT_EMC_AXIS_ACTIVATE\x10\x8fO\x12\x1b\n\x16MT_EMC_AXIS_DEACTIVATE\x10\x90O\x12 \n\x1bMT_EMC_AXIS_OVERRIDE_LIMITS\x10\x91O\x12\x1a\n\x15MT_EMC_AXIS_LOAD_COMP\x10\x93O\x12\x1d\n\x18MT_EMC_AXIS_SET_BACKLASH\x10\x96O\x12\x15\n\x10MT_EMC_AXIS_STAT\x10\xd7O\x12\x19\n\x14MT_EMC_TRAJ_SET_AXES\x10\xd9O\x12\x1a\n\x15MT_EMC_TRAJ_SET_UNITS\x10\xdaO\x12\x1f\n\x1aMT_EMC_TRAJ_SET_CYCLE_TIME\x10\xdbO\x12\x19\n\x14MT_EMC_TRAJ_SET_MODE\x10\xdcO\x12\x1d\n\x18MT_EMC_TRAJ_SET_VELOCITY\x10\xddO\x12!\n\x1cMT_EMC_TRAJ_SET_ACCELERATION\x10\xdeO\x12!\n\x1cMT_EMC_TRAJ_SET_MAX_VELOCITY\x10\xdfO\x12%\n MT_EMC_TRAJ_SET_MAX_ACCELERATION\x10\xe0O\x12\x1a\n\x15MT_EMC_TRAJ_SET_SCALE\x10\xe1O\x12\x1e\n\x19MT_EMC_TRAJ_SET_MOTION_ID\x10\xe2O\x12\x15\n\x10MT_EMC_TRAJ_INIT\x10\xe3O\x12\x15\n\x10MT_EMC_TRAJ_HALT\x10\xe4O\x12\x17\n\x12MT_EMC_TRAJ_ENABLE\x10\xe5O\x12\x18\n\x13MT_EMC_TRAJ_DISABLE\x10\xe6O\x12\x16\n\x11MT_EMC_TRAJ_ABORT\x10\xe7O\x12\x16\n\x11MT_EMC_TRAJ_PAUSE\x10\xe8O\x12\x15\n\x10MT_EMC_TRAJ_STEP\x10\xe9O\x12\x17\n\x12MT_EMC_TRAJ_RESUME\x10\xeaO\x12\x16\n\x11MT_EMC_TRAJ_DELAY\x10\xebO\x12\x1c\n\x17MT_EMC_TRAJ_LINEAR_MOVE\x10\xecO\x12\x1e\n\x19MT_EMC_TRAJ_CIRCULAR_MOVE\x10\xedO\x12\x1e\n\x19MT_EMC_TRAJ_SET_TERM_COND\x10\xeeO\x12\x1b\n\x16MT_EMC_TRAJ_SET_OFFSET\x10\xefO\x12\x18\n\x13MT_EMC_TRAJ_SET_G5X\x10\xf0O\x12\x19\n\x14MT_EMC_TRAJ_SET_HOME\x10\xf1O\x12\x1d\n\x18MT_EMC_TRAJ_SET_ROTATION\x10\xf2O\x12\x18\n\x13MT_EMC_TRAJ_SET_G92\x10\xf3O\x12)\n$MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG\x10\xf4O\x12\x16\n\x11MT_EMC_TRAJ_PROBE\x10\xf5O\x12\"\n\x1dMT_EMC_TRAJ_SET_TELEOP_ENABLE\x10\xf6O\x12\"\n\x1dMT_EMC_TRAJ_SET_TELEOP_VECTOR\x10\xf7O\x12 \n\x1bMT_EMC_TRAJ_SET_SPINDLESYNC\x10\xf8O\x12\"\n\x1dMT_EMC_TRAJ_SET_SPINDLE_SCALE\x10\xf9O\x12\x1e\n\x19MT_EMC_TRAJ_SET_FO_ENABLE\x10\xfaO\x12\x1e\n\x19MT_EMC_TRAJ_SET_SO_ENABLE\x10\xfbO\x12\x1e\n\x19MT_EMC_TRAJ_SET_FH_ENABLE\x10\xfcO\x12\x1a\n\x15MT_EMC_TRAJ_RIGID_TAP\x10\xfdO\x12 \n\x1bMT_EMC_TRAJ_SET_RAPID_SCALE\x10\xfeO\x12\x15\n\x10MT_EMC_TRAJ_STAT\x10\xbbP\x12\x17\n\x12MT_EMC_MOTION_INIT\x10\xbdP\x12\x17\n\x12MT_EMC_MOTION_HALT\x10\xbeP\x12\x18\n\x13MT_EMC_MOTION_ABORT\x10\xbfP\x12\x1b\n\x16MT_EMC_MOTION_SET_AOUT\x10\xc0P\x12\x1b\n\x16MT_EMC_MOTION_SET_DOUT\x10\xc1P\x12\x1b\n\x16MT_EMC_MOTION_ADAPTIVE\x10\xc2P\x12\x1a\n\x15MT_EMC_SPINDLE_ORIENT\x10\xcdP\x12(\n#MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE\x10\xceP\x12\x17\n\x12MT_EMC_MOTION_STAT\x10\x9fQ\x12\x15\n\x10MT_EMC_TASK_INIT\x10\x85R\x12\x15\n\x10MT_EMC_TASK_HALT\x10\x86R\x12\x16\n\x11MT_EMC_TASK_ABORT\x10\x87R\x12\x19\n\x14MT_EMC_TASK_SET_MODE\x10\x88R\x12\x1a\n\x15MT_EMC_TASK_SET_STATE\x10\x89R\x12\x1a\n\x15MT_EMC_TASK_PLAN_OPEN\x10\x8aR\x12\x19\n\x14MT_EMC_TASK_PLAN_RUN\x10\x8bR\x12\x1a\n\x15MT_EMC_TASK_PLAN_READ\x10\x8cR\x12\x1d\n\x18MT_EMC_TASK_PLAN_EXECUTE\x10\x8dR\x12\x1b\n\x16MT_EMC_TASK_PLAN_PAUSE\x10\x8eR\x12\x1a\n\x15MT_EMC_TASK_PLAN_STEP\x10\x8fR\x12\x1c\n\x17MT_EMC_TASK_PLAN_RESUME\x10\x90R\x12\x19\n\x14MT_EMC_TASK_PLAN_END\x10\x91R\x12\x1b\n\x16MT_EMC_TASK_PLAN_CLOSE\x10\x92R\x12\x1a\n\x15MT_EMC_TASK_PLAN_INIT\x10\x93R\x12\x1b\n\x16MT_EMC_TASK_PLAN_SYNCH\x10\x94R\x12\'\n\"MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP\x10\x95R\x12&\n!MT_EMC_TASK_PLAN_SET_BLOCK_DELETE\x10\x96R\x12#\n\x1eMT_EMC_TASK_PLAN_OPTIONAL_STOP\x10\x97R\x12\x1b\n\x16MT_EMC_TASK_PLAN_RESET\x10\x98R\x12\x1b\n\x16MT_EMC_TASK_PLAN_REPLY\x10\xa2R\x12\x15\n\x10MT_EMC_TASK_STAT\x10\xe7R\x12\x15\n\x10MT_EMC_TOOL_INIT\x10\xddV\x12\x15\n\x10MT_EMC_TOOL_HALT\x10\xdeV\x12\x16\n\x11MT_EMC_TOOL_ABORT\x10\xdfV\x12\x18\n\x13MT_EMC_TOOL_PREPARE\x10\xe0V\x12\x15\n\x10MT_EMC_TOOL_LOAD\x10\xe1V\x12\x17\n\x12MT_EMC_TOOL_UNLOAD\x10\xe2V\x12 \n\x1bMT_EMC_TOOL_LOAD_TOOL_TABLE\x10\xe3V\x12\x1b\n\x16MT_EMC_TOOL_SET_OFFSET\x10\xe4V\x12\x1b\n\x16MT_EMC_TOOL_SET_NUMBER\x10\xe5V\x12\"\n\x1dMT_EMC_TOOL_UPDATE_TOOL_TABLE\x10\xe6V\x12\x15\n\x10MT_EMC_TOOL_STAT\x10\xbfW\x12\x18\n\x13MT_EMC_AUX_ESTOP_ON\x10\xc6W\x12\x19\n\x14MT_EMC_AUX_ESTOP_OFF\x10\xc7W\x12\x1b\n\x16MT_EMC_AUX_ESTOP_RESET\x10\xc8W\x12\x1a\n\x15MT_EMC_AUX_INPUT_WAIT\x10\xc9W\x12\x14\n\x0fMT_EMC_AUX_STAT\x10\xa3X\x12\x16\n\x11MT_EMC_SPINDLE_ON\x10\xa8X\x12\x17\n\x12MT_EMC_SPINDLE_OFF\x10\xa9X\x12\x1c\n\x17MT_EMC_SPINDLE_INCREASE\x10\xadX\x12\x1c\n\x17MT_EMC_SPINDLE_DECREASE\x10\xaeX\x12\x1c\n\x17MT_EMC_SPINDLE_CONSTANT\x10\xafX\x12!\n\x1cMT_EMC_SPINDLE_BRAKE_RELEASE\x10\xb0X\x12 \n\x1bMT_EMC_SPINDLE_BRAKE_ENGAGE\x10\xb1X\x12\x19\n\x14MT_EMC_SPINDLE_SPEED\x10\xb4X\x12\x18\n\x13MT_EMC_SPINDLE_STAT\x10\x87Y\x12\x1b\n\x16MT_EMC_COOLANT_MIST_ON\x10\x8cY\x12\x1c\n\x17MT_EMC_COOLANT_MIST_OFF\x10\x8dY\x12\x1c\n\x17MT_EMC_COOLANT_FLOOD_ON\x10\x8eY\x12\x1d\n\x18MT_EMC_COOLANT_FLOOD_OFF\x10\x8fY\x12\x18\n\x13MT_EMC_COOLANT_STAT\x10\xebY\x12\x13\n\x0eMT_EMC_LUBE_ON\x10\xf0Y\x12\x14\n\x0fMT_EMC_LUBE_OFF\x10\xf1Y\x12\x15\n\x10MT_EMC_LUBE_STAT\x10\xcfZ\x12\x13\n\x0eMT_EMC_IO_INIT\x10\xd1Z\x12\x13\n\x0eMT_EMC_IO_HALT\x10\xd2Z\x12\x14\n\x0fMT_EMC_IO_ABORT\x10\xd3Z\x12\x1d\n\x18MT_EMC_IO_SET_CYCLE_TIME\x10\xd4Z\x12\x13\n\x0eMT_EMC_IO_STAT\x10\xb3[\x12\x10\n\x0bMT_EMC_INIT\x10\xfd\\\x12\x10\n\x0bMT_EMC_HALT\x10\xfe\\\x12\x11\n\x0cMT_EMC_ABORT\x10\xff\\\x12\x10\n\x0bMT_EMC_STAT\x10\xdf]\x12\x1b\n\x16MT_EMCSTAT_FULL_UPDATE\x10\xd4\x61\x12\"\n\x1dMT_EMCSTAT_INCREMENTAL_UPDATE\x10\xd5\x61\x12\x15\n\x10MT_EMC_NML_ERROR\x10\xde\x61\x12\x14\n\x0fMT_EMC_NML_TEXT\x10\xdf\x61\x12\x17\n\x12MT_EMC_NML_DISPLAY\x10\xe0\x61\x12\x17\n\x12MT_EMCCMD_EXECUTED\x10\xe8\x61\x12\x18\n\x13MT_EMCCMD_COMPLETED\x10\xe9\x61\x12\x1c\n\x17MT_LAUNCHER_FULL_UPDATE\x10\xb8\x62\x12#\n\x1eMT_LAUNCHER_INCREMENTAL_UPDATE\x10\xb9\x62\x12\x16\n\x11MT_LAUNCHER_ERROR\x10\xba\x62\x12\x16\n\x11MT_LAUNCHER_START\x10\xc2\x62\x12\x1a\n\x15MT_LAUNCHER_TERMINATE\x10\xc3\x62\x12\x15\n\x10MT_LAUNCHER_KILL\x10\xc4\x62\x12\x1c\n\x17MT_LAUNCHER_WRITE_STDIN\x10\xc5\x62\x12\x15\n\x10MT_LAUNCHER_CALL\x10\xc6\x62\x12\x19\n\x14MT_LAUNCHER_SHUTDOWN\x10\xc7\x62\x12\x14\n\x0fMT_LAUNCHER_SET\x10\xc8\x62*\xb7\x01\n\x0bOriginIndex\x12\x12\n\x0eORIGIN_UNKNOWN\x10\x00\x12\x0e\n\nORIGIN_G54\x10\x01\x12\x0e\n\nORIGIN_G55\x10\x02\x12\x0e\n\nORIGIN_G56\x10\x03\x12\x0e\n\nORIGIN_G57\x10\x04\x12\x0e\n\nORIGIN_G58\x10\x05\x12\x0e\n\nORIGIN_G59\x10\x06\x12\x10\n\x0cORIGIN_G59_1\x10\x07\x12\x10\n\x0cORIGIN_G59_2\x10\x08\x12\x10\n\x0cORIGIN_G59_3\x10\t*P\n\x11TermConditionType\x12\x1c\n\x18_EMC_TRAJ_TERM_COND_STOP\x10\x01\x12\x1d\n\x19_EMC_TRAJ_TERM_COND_BLEND\x10\x02*W\n\x0e\x43\x61nonDirection\x12\x12\n\x0e_CANON_STOPPED\x10\x01\x12\x14\n\x10_CANON_CLOCKWISE\x10\x02\x12\x1b\n\x17_CANON_COUNTERCLOCKWISE\x10\x03*2\n\tInputType\x12\x11\n\r_ANALOG_INPUT\x10\x00\x12\x12\n\x0e_DIGITAL_INPUT\x10\x01*F\n\x08WaitType\x12\r\n\tIMMEDIATE\x10\x00\x12\x08\n\x04RISE\x10\x01\x12\x08\n\x04\x46\x41LL\x10\x02\x12\x0b\n\x07\x42\x45_HIGH\x10\x03\x12\n\n\x06\x42\x45_LOW\x10\x04*\xaa\x01\n\x14InterpreterStateType\x12\x0f\n\x0bINTERP_IDLE\x10\x01\x12\x12\n\x0eINTERP_RUNNING\x10\x02\x12\x14\n\x10INTERP_SYNC_WAIT\x10\x03\x12\x11\n\rINTERP_PAUSED\x10\x04\x12\x15\n\x11INTERP_QUEUE_WAIT\x10\x05\x12\x15\n\x11INTERP_ABORT_WAIT\x10\x06\x12\x16\n\x12INTERP_STATE_UNSET\x10\x63')
   ,
   dependencies=[machinetalk_dot_protobuf_dot_nanopb__pb2.DESCRIPTOR,])
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
@@ -1083,1090 +1083,1098 @@ _CONTAINERTYPE = _descriptor.EnumDescriptor(
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_HALGROUP_BIND', index=69, number=294,
+      name='MT_HALRCOMP_PACKED_UPDATE', index=69, number=291,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_HALGROUP_BIND_CONFIRM', index=70, number=295,
+      name='MT_HALGROUP_PACKED_UPDATE', index=70, number=292,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_HALGROUP_BIND_REJECT', index=71, number=296,
+      name='MT_HALGROUP_BIND', index=71, number=294,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_HALGROUP_FULL_UPDATE', index=72, number=297,
+      name='MT_HALGROUP_BIND_CONFIRM', index=72, number=295,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_HALGROUP_INCREMENTAL_UPDATE', index=73, number=298,
+      name='MT_HALGROUP_BIND_REJECT', index=73, number=296,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_HALGROUP_ERROR', index=74, number=299,
+      name='MT_HALGROUP_FULL_UPDATE', index=74, number=297,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_EXIT', index=75, number=300,
+      name='MT_HALGROUP_INCREMENTAL_UPDATE', index=75, number=298,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_PING', index=76, number=301,
+      name='MT_HALGROUP_ERROR', index=76, number=299,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_LOADRT', index=77, number=302,
+      name='MT_RTAPI_APP_EXIT', index=77, number=300,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_LOG', index=78, number=303,
+      name='MT_RTAPI_APP_PING', index=78, number=301,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_UNLOADRT', index=79, number=305,
+      name='MT_RTAPI_APP_LOADRT', index=79, number=302,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_NEWINST', index=80, number=306,
+      name='MT_RTAPI_APP_LOG', index=80, number=303,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_NEWTHREAD', index=81, number=307,
+      name='MT_RTAPI_APP_UNLOADRT', index=81, number=305,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_DELTHREAD', index=82, number=308,
+      name='MT_RTAPI_APP_NEWINST', index=82, number=306,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_CALLFUNC', index=83, number=309,
+      name='MT_RTAPI_APP_NEWTHREAD', index=83, number=307,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_REPLY', index=84, number=310,
+      name='MT_RTAPI_APP_DELTHREAD', index=84, number=308,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RTAPI_APP_DELINST', index=85, number=311,
+      name='MT_RTAPI_APP_CALLFUNC', index=85, number=309,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LIST_APPLICATIONS', index=86, number=350,
+      name='MT_RTAPI_APP_REPLY', index=86, number=310,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_DESCRIBE_APPLICATION', index=87, number=351,
+      name='MT_RTAPI_APP_DELINST', index=87, number=311,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_RETRIEVE_APPLICATION', index=88, number=352,
+      name='MT_LIST_APPLICATIONS', index=88, number=350,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_APPLICATION_DETAIL', index=89, number=353,
+      name='MT_DESCRIBE_APPLICATION', index=89, number=351,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_ERROR', index=90, number=360,
+      name='MT_RETRIEVE_APPLICATION', index=90, number=352,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_FULL_UPDATE', index=91, number=370,
+      name='MT_APPLICATION_DETAIL', index=91, number=353,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_INCREMENTAL_UPDATE', index=92, number=371,
+      name='MT_ERROR', index=92, number=360,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_TASK_REPLY', index=93, number=400,
+      name='MT_FULL_UPDATE', index=93, number=370,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_TICKET_UPDATE', index=94, number=401,
+      name='MT_INCREMENTAL_UPDATE', index=94, number=371,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_CREDIT_UPDATE', index=95, number=450,
+      name='MT_TASK_REPLY', index=95, number=400,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_LOWER', index=96, number=1000,
+      name='MT_TICKET_UPDATE', index=96, number=401,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_UPPER', index=97, number=1100,
+      name='MT_CREDIT_UPDATE', index=97, number=450,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_ABORT', index=98, number=1001,
+      name='MT_EMCMOT_LOWER', index=98, number=1000,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_AXIS_ABORT', index=99, number=1002,
+      name='MT_EMCMOT_UPPER', index=99, number=1100,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_ENABLE', index=100, number=1003,
+      name='MT_EMCMOT_ABORT', index=100, number=1001,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_DISABLE', index=101, number=1004,
+      name='MT_EMCMOT_AXIS_ABORT', index=101, number=1002,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_ENABLE_AMPLIFIER', index=102, number=1005,
+      name='MT_EMCMOT_ENABLE', index=102, number=1003,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_DISABLE_AMPLIFIER', index=103, number=1006,
+      name='MT_EMCMOT_DISABLE', index=103, number=1004,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_ENABLE_WATCHDOG', index=104, number=1007,
+      name='MT_EMCMOT_ENABLE_AMPLIFIER', index=104, number=1005,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_DISABLE_WATCHDOG', index=105, number=1008,
+      name='MT_EMCMOT_DISABLE_AMPLIFIER', index=105, number=1006,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_ACTIVATE_JOINT', index=106, number=1009,
+      name='MT_EMCMOT_ENABLE_WATCHDOG', index=106, number=1007,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_DEACTIVATE_JOINT', index=107, number=1010,
+      name='MT_EMCMOT_DISABLE_WATCHDOG', index=107, number=1008,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_PAUSE', index=108, number=1011,
+      name='MT_EMCMOT_ACTIVATE_JOINT', index=108, number=1009,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_RESUME', index=109, number=1012,
+      name='MT_EMCMOT_DEACTIVATE_JOINT', index=109, number=1010,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_STEP', index=110, number=1013,
+      name='MT_EMCMOT_PAUSE', index=110, number=1011,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_FREE', index=111, number=1014,
+      name='MT_EMCMOT_RESUME', index=111, number=1012,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_COORD', index=112, number=1015,
+      name='MT_EMCMOT_STEP', index=112, number=1013,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_TELEOP', index=113, number=1016,
+      name='MT_EMCMOT_FREE', index=113, number=1014,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SPINDLE_SCALE', index=114, number=1017,
+      name='MT_EMCMOT_COORD', index=114, number=1015,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SS_ENABLE', index=115, number=1018,
+      name='MT_EMCMOT_TELEOP', index=115, number=1016,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_FEED_SCALE', index=116, number=1019,
+      name='MT_EMCMOT_SPINDLE_SCALE', index=116, number=1017,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_FS_ENABLE', index=117, number=1020,
+      name='MT_EMCMOT_SS_ENABLE', index=117, number=1018,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_FH_ENABLE', index=118, number=1021,
+      name='MT_EMCMOT_FEED_SCALE', index=118, number=1019,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_AF_ENABLE', index=119, number=1022,
+      name='MT_EMCMOT_FS_ENABLE', index=119, number=1020,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_OVERRIDE_LIMITS', index=120, number=1023,
+      name='MT_EMCMOT_FH_ENABLE', index=120, number=1021,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_HOME', index=121, number=1024,
+      name='MT_EMCMOT_AF_ENABLE', index=121, number=1022,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_UNHOME', index=122, number=1025,
+      name='MT_EMCMOT_OVERRIDE_LIMITS', index=122, number=1023,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_JOG_CONT', index=123, number=1026,
+      name='MT_EMCMOT_HOME', index=123, number=1024,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_JOG_INCR', index=124, number=1027,
+      name='MT_EMCMOT_UNHOME', index=124, number=1025,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_JOG_ABS', index=125, number=1028,
+      name='MT_EMCMOT_JOG_CONT', index=125, number=1026,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_LINE', index=126, number=1029,
+      name='MT_EMCMOT_JOG_INCR', index=126, number=1027,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_CIRCLE', index=127, number=1030,
+      name='MT_EMCMOT_JOG_ABS', index=127, number=1028,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_TELEOP_VECTOR', index=128, number=1031,
+      name='MT_EMCMOT_SET_LINE', index=128, number=1029,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_CLEAR_PROBE_FLAGS', index=129, number=1032,
+      name='MT_EMCMOT_SET_CIRCLE', index=129, number=1030,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_PROBE', index=130, number=1033,
+      name='MT_EMCMOT_SET_TELEOP_VECTOR', index=130, number=1031,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_RIGID_TAP', index=131, number=1034,
+      name='MT_EMCMOT_CLEAR_PROBE_FLAGS', index=131, number=1032,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_POSITION_LIMITS', index=132, number=1035,
+      name='MT_EMCMOT_PROBE', index=132, number=1033,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_BACKLASH', index=133, number=1036,
+      name='MT_EMCMOT_RIGID_TAP', index=133, number=1034,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_MIN_FERROR', index=134, number=1037,
+      name='MT_EMCMOT_SET_POSITION_LIMITS', index=134, number=1035,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_MAX_FERROR', index=135, number=1038,
+      name='MT_EMCMOT_SET_BACKLASH', index=135, number=1036,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_VEL', index=136, number=1039,
+      name='MT_EMCMOT_SET_MIN_FERROR', index=136, number=1037,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_VEL_LIMIT', index=137, number=1040,
+      name='MT_EMCMOT_SET_MAX_FERROR', index=137, number=1038,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_JOINT_VEL_LIMIT', index=138, number=1041,
+      name='MT_EMCMOT_SET_VEL', index=138, number=1039,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_JOINT_ACC_LIMIT', index=139, number=1042,
+      name='MT_EMCMOT_SET_VEL_LIMIT', index=139, number=1040,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_ACC', index=140, number=1043,
+      name='MT_EMCMOT_SET_JOINT_VEL_LIMIT', index=140, number=1041,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_TERM_COND', index=141, number=1044,
+      name='MT_EMCMOT_SET_JOINT_ACC_LIMIT', index=141, number=1042,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_NUM_AXES', index=142, number=1045,
+      name='MT_EMCMOT_SET_ACC', index=142, number=1043,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_WORLD_HOME', index=143, number=1046,
+      name='MT_EMCMOT_SET_TERM_COND', index=143, number=1044,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_HOMING_PARAMS', index=144, number=1047,
+      name='MT_EMCMOT_SET_NUM_AXES', index=144, number=1045,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_DEBUG', index=145, number=1048,
+      name='MT_EMCMOT_SET_WORLD_HOME', index=145, number=1046,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_DOUT', index=146, number=1049,
+      name='MT_EMCMOT_SET_HOMING_PARAMS', index=146, number=1047,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_AOUT', index=147, number=1050,
+      name='MT_EMCMOT_SET_DEBUG', index=147, number=1048,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_SPINDLESYNC', index=148, number=1051,
+      name='MT_EMCMOT_SET_DOUT', index=148, number=1049,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SPINDLE_ON', index=149, number=1052,
+      name='MT_EMCMOT_SET_AOUT', index=149, number=1050,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SPINDLE_OFF', index=150, number=1053,
+      name='MT_EMCMOT_SET_SPINDLESYNC', index=150, number=1051,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SPINDLE_INCREASE', index=151, number=1054,
+      name='MT_EMCMOT_SPINDLE_ON', index=151, number=1052,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SPINDLE_DECREASE', index=152, number=1055,
+      name='MT_EMCMOT_SPINDLE_OFF', index=152, number=1053,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SPINDLE_BRAKE_ENGAGE', index=153, number=1056,
+      name='MT_EMCMOT_SPINDLE_INCREASE', index=153, number=1054,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SPINDLE_BRAKE_RELEASE', index=154, number=1057,
+      name='MT_EMCMOT_SPINDLE_DECREASE', index=154, number=1055,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_MOTOR_OFFSET', index=155, number=1058,
+      name='MT_EMCMOT_SPINDLE_BRAKE_ENGAGE', index=155, number=1056,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_JOINT_COMP', index=156, number=1059,
+      name='MT_EMCMOT_SPINDLE_BRAKE_RELEASE', index=156, number=1057,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_SET_OFFSET', index=157, number=1060,
+      name='MT_EMCMOT_SET_MOTOR_OFFSET', index=157, number=1058,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_COMMAND_OK', index=158, number=1061,
+      name='MT_EMCMOT_SET_JOINT_COMP', index=158, number=1059,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_COMMAND_UNKNOWN_COMMAND', index=159, number=1062,
+      name='MT_EMCMOT_SET_OFFSET', index=159, number=1060,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_COMMAND_INVALID_COMMAND', index=160, number=1063,
+      name='MT_EMCMOT_COMMAND_OK', index=160, number=1061,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_COMMAND_INVALID_PARAMS', index=161, number=1064,
+      name='MT_EMCMOT_COMMAND_UNKNOWN_COMMAND', index=161, number=1062,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_COMMAND_BAD_EXEC', index=162, number=1065,
+      name='MT_EMCMOT_COMMAND_INVALID_COMMAND', index=162, number=1063,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_MOTION_DISABLED', index=163, number=1066,
+      name='MT_EMCMOT_COMMAND_INVALID_PARAMS', index=163, number=1064,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_MOTION_FREE', index=164, number=1067,
+      name='MT_EMCMOT_COMMAND_BAD_EXEC', index=164, number=1065,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_MOTION_TELEOP', index=165, number=1068,
+      name='MT_EMCMOT_MOTION_DISABLED', index=165, number=1066,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_MOTION_COORD', index=166, number=1069,
+      name='MT_EMCMOT_MOTION_FREE', index=166, number=1067,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_JOINT_FLAG', index=167, number=1070,
+      name='MT_EMCMOT_MOTION_TELEOP', index=167, number=1068,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCMOT_MOTION_FLAG', index=168, number=1071,
+      name='MT_EMCMOT_MOTION_COORD', index=168, number=1069,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_PRU_FIRMWARE', index=169, number=2048,
+      name='MT_EMCMOT_JOINT_FLAG', index=169, number=1070,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_MESA_5I20_FIRMWARE', index=170, number=3000,
+      name='MT_EMCMOT_MOTION_FLAG', index=170, number=1071,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_BLOB', index=171, number=4000,
+      name='MT_PRU_FIRMWARE', index=171, number=2048,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_TEST1', index=172, number=5001,
+      name='MT_MESA_5I20_FIRMWARE', index=172, number=3000,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_TEST2', index=173, number=5002,
+      name='MT_BLOB', index=173, number=4000,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_TEST3', index=174, number=5003,
+      name='MT_TEST1', index=174, number=5001,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_NML_LOWER', index=175, number=10000,
+      name='MT_TEST2', index=175, number=5002,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_NML_UPPER', index=176, number=13000,
+      name='MT_TEST3', index=176, number=5003,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_OPERATOR_ERROR', index=177, number=10011,
+      name='MT_EMC_NML_LOWER', index=177, number=10000,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_OPERATOR_TEXT', index=178, number=10012,
+      name='MT_EMC_NML_UPPER', index=178, number=13000,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_OPERATOR_DISPLAY', index=179, number=10013,
+      name='MT_EMC_OPERATOR_ERROR', index=179, number=10011,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_NULL', index=180, number=10021,
+      name='MT_EMC_OPERATOR_TEXT', index=180, number=10012,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SET_DEBUG', index=181, number=10022,
+      name='MT_EMC_OPERATOR_DISPLAY', index=181, number=10013,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SYSTEM_CMD', index=182, number=10030,
+      name='MT_EMC_NULL', index=182, number=10021,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_AXIS', index=183, number=10101,
+      name='MT_EMC_SET_DEBUG', index=183, number=10022,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_UNITS', index=184, number=10102,
+      name='MT_EMC_SYSTEM_CMD', index=184, number=10030,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_MIN_POSITION_LIMIT', index=185, number=10107,
+      name='MT_EMC_AXIS_SET_AXIS', index=185, number=10101,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_MAX_POSITION_LIMIT', index=186, number=10108,
+      name='MT_EMC_AXIS_SET_UNITS', index=186, number=10102,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_START_CHANGE', index=187, number=1110,
+      name='MT_EMC_AXIS_SET_MIN_POSITION_LIMIT', index=187, number=10107,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_EXEC_PLUGIN_CALL', index=188, number=1112,
+      name='MT_EMC_AXIS_SET_MAX_POSITION_LIMIT', index=188, number=10108,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_IO_PLUGIN_CALL', index=189, number=1113,
+      name='MT_EMC_TOOL_START_CHANGE', index=189, number=1110,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_FERROR', index=190, number=10111,
+      name='MT_EMC_EXEC_PLUGIN_CALL', index=190, number=1112,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_HOMING_PARAMS', index=191, number=10112,
+      name='MT_EMC_IO_PLUGIN_CALL', index=191, number=1113,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_MIN_FERROR', index=192, number=10115,
+      name='MT_EMC_AXIS_SET_FERROR', index=192, number=10111,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_MAX_VELOCITY', index=193, number=10116,
+      name='MT_EMC_AXIS_SET_HOMING_PARAMS', index=193, number=10112,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_INIT', index=194, number=10118,
+      name='MT_EMC_AXIS_SET_MIN_FERROR', index=194, number=10115,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_HALT', index=195, number=10119,
+      name='MT_EMC_AXIS_SET_MAX_VELOCITY', index=195, number=10116,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_ABORT', index=196, number=10120,
+      name='MT_EMC_AXIS_INIT', index=196, number=10118,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_ENABLE', index=197, number=10121,
+      name='MT_EMC_AXIS_HALT', index=197, number=10119,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_DISABLE', index=198, number=10122,
+      name='MT_EMC_AXIS_ABORT', index=198, number=10120,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_HOME', index=199, number=10123,
+      name='MT_EMC_AXIS_ENABLE', index=199, number=10121,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_UNHOME', index=200, number=10135,
+      name='MT_EMC_AXIS_DISABLE', index=200, number=10122,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_JOG', index=201, number=10124,
+      name='MT_EMC_AXIS_HOME', index=201, number=10123,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_INCR_JOG', index=202, number=10125,
+      name='MT_EMC_AXIS_UNHOME', index=202, number=10135,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_ABS_JOG', index=203, number=10126,
+      name='MT_EMC_AXIS_JOG', index=203, number=10124,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_ACTIVATE', index=204, number=10127,
+      name='MT_EMC_AXIS_INCR_JOG', index=204, number=10125,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_DEACTIVATE', index=205, number=10128,
+      name='MT_EMC_AXIS_ABS_JOG', index=205, number=10126,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_OVERRIDE_LIMITS', index=206, number=10129,
+      name='MT_EMC_AXIS_ACTIVATE', index=206, number=10127,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_LOAD_COMP', index=207, number=10131,
+      name='MT_EMC_AXIS_DEACTIVATE', index=207, number=10128,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_SET_BACKLASH', index=208, number=10134,
+      name='MT_EMC_AXIS_OVERRIDE_LIMITS', index=208, number=10129,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AXIS_STAT', index=209, number=10199,
+      name='MT_EMC_AXIS_LOAD_COMP', index=209, number=10131,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_AXES', index=210, number=10201,
+      name='MT_EMC_AXIS_SET_BACKLASH', index=210, number=10134,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_UNITS', index=211, number=10202,
+      name='MT_EMC_AXIS_STAT', index=211, number=10199,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_CYCLE_TIME', index=212, number=10203,
+      name='MT_EMC_TRAJ_SET_AXES', index=212, number=10201,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_MODE', index=213, number=10204,
+      name='MT_EMC_TRAJ_SET_UNITS', index=213, number=10202,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_VELOCITY', index=214, number=10205,
+      name='MT_EMC_TRAJ_SET_CYCLE_TIME', index=214, number=10203,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_ACCELERATION', index=215, number=10206,
+      name='MT_EMC_TRAJ_SET_MODE', index=215, number=10204,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_MAX_VELOCITY', index=216, number=10207,
+      name='MT_EMC_TRAJ_SET_VELOCITY', index=216, number=10205,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_MAX_ACCELERATION', index=217, number=10208,
+      name='MT_EMC_TRAJ_SET_ACCELERATION', index=217, number=10206,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_SCALE', index=218, number=10209,
+      name='MT_EMC_TRAJ_SET_MAX_VELOCITY', index=218, number=10207,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_MOTION_ID', index=219, number=10210,
+      name='MT_EMC_TRAJ_SET_MAX_ACCELERATION', index=219, number=10208,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_INIT', index=220, number=10211,
+      name='MT_EMC_TRAJ_SET_SCALE', index=220, number=10209,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_HALT', index=221, number=10212,
+      name='MT_EMC_TRAJ_SET_MOTION_ID', index=221, number=10210,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_ENABLE', index=222, number=10213,
+      name='MT_EMC_TRAJ_INIT', index=222, number=10211,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_DISABLE', index=223, number=10214,
+      name='MT_EMC_TRAJ_HALT', index=223, number=10212,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_ABORT', index=224, number=10215,
+      name='MT_EMC_TRAJ_ENABLE', index=224, number=10213,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_PAUSE', index=225, number=10216,
+      name='MT_EMC_TRAJ_DISABLE', index=225, number=10214,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_STEP', index=226, number=10217,
+      name='MT_EMC_TRAJ_ABORT', index=226, number=10215,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_RESUME', index=227, number=10218,
+      name='MT_EMC_TRAJ_PAUSE', index=227, number=10216,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_DELAY', index=228, number=10219,
+      name='MT_EMC_TRAJ_STEP', index=228, number=10217,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_LINEAR_MOVE', index=229, number=10220,
+      name='MT_EMC_TRAJ_RESUME', index=229, number=10218,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_CIRCULAR_MOVE', index=230, number=10221,
+      name='MT_EMC_TRAJ_DELAY', index=230, number=10219,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_TERM_COND', index=231, number=10222,
+      name='MT_EMC_TRAJ_LINEAR_MOVE', index=231, number=10220,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_OFFSET', index=232, number=10223,
+      name='MT_EMC_TRAJ_CIRCULAR_MOVE', index=232, number=10221,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_G5X', index=233, number=10224,
+      name='MT_EMC_TRAJ_SET_TERM_COND', index=233, number=10222,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_HOME', index=234, number=10225,
+      name='MT_EMC_TRAJ_SET_OFFSET', index=234, number=10223,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_ROTATION', index=235, number=10226,
+      name='MT_EMC_TRAJ_SET_G5X', index=235, number=10224,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_G92', index=236, number=10227,
+      name='MT_EMC_TRAJ_SET_HOME', index=236, number=10225,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG', index=237, number=10228,
+      name='MT_EMC_TRAJ_SET_ROTATION', index=237, number=10226,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_PROBE', index=238, number=10229,
+      name='MT_EMC_TRAJ_SET_G92', index=238, number=10227,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_TELEOP_ENABLE', index=239, number=10230,
+      name='MT_EMC_TRAJ_CLEAR_PROBE_TRIPPED_FLAG', index=239, number=10228,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_TELEOP_VECTOR', index=240, number=10231,
+      name='MT_EMC_TRAJ_PROBE', index=240, number=10229,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_SPINDLESYNC', index=241, number=10232,
+      name='MT_EMC_TRAJ_SET_TELEOP_ENABLE', index=241, number=10230,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_SPINDLE_SCALE', index=242, number=10233,
+      name='MT_EMC_TRAJ_SET_TELEOP_VECTOR', index=242, number=10231,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_FO_ENABLE', index=243, number=10234,
+      name='MT_EMC_TRAJ_SET_SPINDLESYNC', index=243, number=10232,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_SO_ENABLE', index=244, number=10235,
+      name='MT_EMC_TRAJ_SET_SPINDLE_SCALE', index=244, number=10233,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_FH_ENABLE', index=245, number=10236,
+      name='MT_EMC_TRAJ_SET_FO_ENABLE', index=245, number=10234,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_RIGID_TAP', index=246, number=10237,
+      name='MT_EMC_TRAJ_SET_SO_ENABLE', index=246, number=10235,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_SET_RAPID_SCALE', index=247, number=10238,
+      name='MT_EMC_TRAJ_SET_FH_ENABLE', index=247, number=10236,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TRAJ_STAT', index=248, number=10299,
+      name='MT_EMC_TRAJ_RIGID_TAP', index=248, number=10237,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_MOTION_INIT', index=249, number=10301,
+      name='MT_EMC_TRAJ_SET_RAPID_SCALE', index=249, number=10238,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_MOTION_HALT', index=250, number=10302,
+      name='MT_EMC_TRAJ_STAT', index=250, number=10299,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_MOTION_ABORT', index=251, number=10303,
+      name='MT_EMC_MOTION_INIT', index=251, number=10301,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_MOTION_SET_AOUT', index=252, number=10304,
+      name='MT_EMC_MOTION_HALT', index=252, number=10302,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_MOTION_SET_DOUT', index=253, number=10305,
+      name='MT_EMC_MOTION_ABORT', index=253, number=10303,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_MOTION_ADAPTIVE', index=254, number=10306,
+      name='MT_EMC_MOTION_SET_AOUT', index=254, number=10304,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_ORIENT', index=255, number=10317,
+      name='MT_EMC_MOTION_SET_DOUT', index=255, number=10305,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE', index=256, number=10318,
+      name='MT_EMC_MOTION_ADAPTIVE', index=256, number=10306,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_MOTION_STAT', index=257, number=10399,
+      name='MT_EMC_SPINDLE_ORIENT', index=257, number=10317,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_INIT', index=258, number=10501,
+      name='MT_EMC_SPINDLE_WAIT_ORIENT_COMPLETE', index=258, number=10318,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_HALT', index=259, number=10502,
+      name='MT_EMC_MOTION_STAT', index=259, number=10399,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_ABORT', index=260, number=10503,
+      name='MT_EMC_TASK_INIT', index=260, number=10501,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_SET_MODE', index=261, number=10504,
+      name='MT_EMC_TASK_HALT', index=261, number=10502,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_SET_STATE', index=262, number=10505,
+      name='MT_EMC_TASK_ABORT', index=262, number=10503,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_OPEN', index=263, number=10506,
+      name='MT_EMC_TASK_SET_MODE', index=263, number=10504,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_RUN', index=264, number=10507,
+      name='MT_EMC_TASK_SET_STATE', index=264, number=10505,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_READ', index=265, number=10508,
+      name='MT_EMC_TASK_PLAN_OPEN', index=265, number=10506,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_EXECUTE', index=266, number=10509,
+      name='MT_EMC_TASK_PLAN_RUN', index=266, number=10507,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_PAUSE', index=267, number=10510,
+      name='MT_EMC_TASK_PLAN_READ', index=267, number=10508,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_STEP', index=268, number=10511,
+      name='MT_EMC_TASK_PLAN_EXECUTE', index=268, number=10509,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_RESUME', index=269, number=10512,
+      name='MT_EMC_TASK_PLAN_PAUSE', index=269, number=10510,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_END', index=270, number=10513,
+      name='MT_EMC_TASK_PLAN_STEP', index=270, number=10511,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_CLOSE', index=271, number=10514,
+      name='MT_EMC_TASK_PLAN_RESUME', index=271, number=10512,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_INIT', index=272, number=10515,
+      name='MT_EMC_TASK_PLAN_END', index=272, number=10513,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_SYNCH', index=273, number=10516,
+      name='MT_EMC_TASK_PLAN_CLOSE', index=273, number=10514,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP', index=274, number=10517,
+      name='MT_EMC_TASK_PLAN_INIT', index=274, number=10515,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_SET_BLOCK_DELETE', index=275, number=10518,
+      name='MT_EMC_TASK_PLAN_SYNCH', index=275, number=10516,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_OPTIONAL_STOP', index=276, number=10519,
+      name='MT_EMC_TASK_PLAN_SET_OPTIONAL_STOP', index=276, number=10517,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_RESET', index=277, number=10520,
+      name='MT_EMC_TASK_PLAN_SET_BLOCK_DELETE', index=277, number=10518,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_PLAN_REPLY', index=278, number=10530,
+      name='MT_EMC_TASK_PLAN_OPTIONAL_STOP', index=278, number=10519,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TASK_STAT', index=279, number=10599,
+      name='MT_EMC_TASK_PLAN_RESET', index=279, number=10520,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_INIT', index=280, number=11101,
+      name='MT_EMC_TASK_PLAN_REPLY', index=280, number=10530,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_HALT', index=281, number=11102,
+      name='MT_EMC_TASK_STAT', index=281, number=10599,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_ABORT', index=282, number=11103,
+      name='MT_EMC_TOOL_INIT', index=282, number=11101,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_PREPARE', index=283, number=11104,
+      name='MT_EMC_TOOL_HALT', index=283, number=11102,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_LOAD', index=284, number=11105,
+      name='MT_EMC_TOOL_ABORT', index=284, number=11103,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_UNLOAD', index=285, number=11106,
+      name='MT_EMC_TOOL_PREPARE', index=285, number=11104,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_LOAD_TOOL_TABLE', index=286, number=11107,
+      name='MT_EMC_TOOL_LOAD', index=286, number=11105,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_SET_OFFSET', index=287, number=11108,
+      name='MT_EMC_TOOL_UNLOAD', index=287, number=11106,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_SET_NUMBER', index=288, number=11109,
+      name='MT_EMC_TOOL_LOAD_TOOL_TABLE', index=288, number=11107,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_UPDATE_TOOL_TABLE', index=289, number=11110,
+      name='MT_EMC_TOOL_SET_OFFSET', index=289, number=11108,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_TOOL_STAT', index=290, number=11199,
+      name='MT_EMC_TOOL_SET_NUMBER', index=290, number=11109,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AUX_ESTOP_ON', index=291, number=11206,
+      name='MT_EMC_TOOL_UPDATE_TOOL_TABLE', index=291, number=11110,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AUX_ESTOP_OFF', index=292, number=11207,
+      name='MT_EMC_TOOL_STAT', index=292, number=11199,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AUX_ESTOP_RESET', index=293, number=11208,
+      name='MT_EMC_AUX_ESTOP_ON', index=293, number=11206,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AUX_INPUT_WAIT', index=294, number=11209,
+      name='MT_EMC_AUX_ESTOP_OFF', index=294, number=11207,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_AUX_STAT', index=295, number=11299,
+      name='MT_EMC_AUX_ESTOP_RESET', index=295, number=11208,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_ON', index=296, number=11304,
+      name='MT_EMC_AUX_INPUT_WAIT', index=296, number=11209,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_OFF', index=297, number=11305,
+      name='MT_EMC_AUX_STAT', index=297, number=11299,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_INCREASE', index=298, number=11309,
+      name='MT_EMC_SPINDLE_ON', index=298, number=11304,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_DECREASE', index=299, number=11310,
+      name='MT_EMC_SPINDLE_OFF', index=299, number=11305,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_CONSTANT', index=300, number=11311,
+      name='MT_EMC_SPINDLE_INCREASE', index=300, number=11309,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_BRAKE_RELEASE', index=301, number=11312,
+      name='MT_EMC_SPINDLE_DECREASE', index=301, number=11310,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_BRAKE_ENGAGE', index=302, number=11313,
+      name='MT_EMC_SPINDLE_CONSTANT', index=302, number=11311,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_SPEED', index=303, number=11316,
+      name='MT_EMC_SPINDLE_BRAKE_RELEASE', index=303, number=11312,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_SPINDLE_STAT', index=304, number=11399,
+      name='MT_EMC_SPINDLE_BRAKE_ENGAGE', index=304, number=11313,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_COOLANT_MIST_ON', index=305, number=11404,
+      name='MT_EMC_SPINDLE_SPEED', index=305, number=11316,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_COOLANT_MIST_OFF', index=306, number=11405,
+      name='MT_EMC_SPINDLE_STAT', index=306, number=11399,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_COOLANT_FLOOD_ON', index=307, number=11406,
+      name='MT_EMC_COOLANT_MIST_ON', index=307, number=11404,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_COOLANT_FLOOD_OFF', index=308, number=11407,
+      name='MT_EMC_COOLANT_MIST_OFF', index=308, number=11405,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_COOLANT_STAT', index=309, number=11499,
+      name='MT_EMC_COOLANT_FLOOD_ON', index=309, number=11406,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_LUBE_ON', index=310, number=11504,
+      name='MT_EMC_COOLANT_FLOOD_OFF', index=310, number=11407,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_LUBE_OFF', index=311, number=11505,
+      name='MT_EMC_COOLANT_STAT', index=311, number=11499,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_LUBE_STAT', index=312, number=11599,
+      name='MT_EMC_LUBE_ON', index=312, number=11504,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_IO_INIT', index=313, number=11601,
+      name='MT_EMC_LUBE_OFF', index=313, number=11505,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_IO_HALT', index=314, number=11602,
+      name='MT_EMC_LUBE_STAT', index=314, number=11599,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_IO_ABORT', index=315, number=11603,
+      name='MT_EMC_IO_INIT', index=315, number=11601,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_IO_SET_CYCLE_TIME', index=316, number=11604,
+      name='MT_EMC_IO_HALT', index=316, number=11602,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_IO_STAT', index=317, number=11699,
+      name='MT_EMC_IO_ABORT', index=317, number=11603,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_INIT', index=318, number=11901,
+      name='MT_EMC_IO_SET_CYCLE_TIME', index=318, number=11604,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_HALT', index=319, number=11902,
+      name='MT_EMC_IO_STAT', index=319, number=11699,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_ABORT', index=320, number=11903,
+      name='MT_EMC_INIT', index=320, number=11901,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_STAT', index=321, number=11999,
+      name='MT_EMC_HALT', index=321, number=11902,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCSTAT_FULL_UPDATE', index=322, number=12500,
+      name='MT_EMC_ABORT', index=322, number=11903,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCSTAT_INCREMENTAL_UPDATE', index=323, number=12501,
+      name='MT_EMC_STAT', index=323, number=11999,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_NML_ERROR', index=324, number=12510,
+      name='MT_EMCSTAT_FULL_UPDATE', index=324, number=12500,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_NML_TEXT', index=325, number=12511,
+      name='MT_EMCSTAT_INCREMENTAL_UPDATE', index=325, number=12501,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMC_NML_DISPLAY', index=326, number=12512,
+      name='MT_EMC_NML_ERROR', index=326, number=12510,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCCMD_EXECUTED', index=327, number=12520,
+      name='MT_EMC_NML_TEXT', index=327, number=12511,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_EMCCMD_COMPLETED', index=328, number=12521,
+      name='MT_EMC_NML_DISPLAY', index=328, number=12512,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_FULL_UPDATE', index=329, number=12600,
+      name='MT_EMCCMD_EXECUTED', index=329, number=12520,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_INCREMENTAL_UPDATE', index=330, number=12601,
+      name='MT_EMCCMD_COMPLETED', index=330, number=12521,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_ERROR', index=331, number=12602,
+      name='MT_LAUNCHER_FULL_UPDATE', index=331, number=12600,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_START', index=332, number=12610,
+      name='MT_LAUNCHER_INCREMENTAL_UPDATE', index=332, number=12601,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_TERMINATE', index=333, number=12611,
+      name='MT_LAUNCHER_ERROR', index=333, number=12602,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_KILL', index=334, number=12612,
+      name='MT_LAUNCHER_START', index=334, number=12610,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_WRITE_STDIN', index=335, number=12613,
+      name='MT_LAUNCHER_TERMINATE', index=335, number=12611,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_CALL', index=336, number=12614,
+      name='MT_LAUNCHER_KILL', index=336, number=12612,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_SHUTDOWN', index=337, number=12615,
+      name='MT_LAUNCHER_WRITE_STDIN', index=337, number=12613,
       options=None,
       type=None),
     _descriptor.EnumValueDescriptor(
-      name='MT_LAUNCHER_SET', index=338, number=12616,
+      name='MT_LAUNCHER_CALL', index=338, number=12614,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='MT_LAUNCHER_SHUTDOWN', index=339, number=12615,
+      options=None,
+      type=None),
+    _descriptor.EnumValueDescriptor(
+      name='MT_LAUNCHER_SET', index=340, number=12616,
       options=None,
       type=None),
   ],
   containing_type=None,
   options=None,
   serialized_start=2458,
-  serialized_end=11449,
+  serialized_end=11513,
 )
 _sym_db.RegisterEnumDescriptor(_CONTAINERTYPE)
 
@@ -2220,8 +2228,8 @@ _ORIGININDEX = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=11452,
-  serialized_end=11635,
+  serialized_start=11516,
+  serialized_end=11699,
 )
 _sym_db.RegisterEnumDescriptor(_ORIGININDEX)
 
@@ -2243,8 +2251,8 @@ _TERMCONDITIONTYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=11637,
-  serialized_end=11717,
+  serialized_start=11701,
+  serialized_end=11781,
 )
 _sym_db.RegisterEnumDescriptor(_TERMCONDITIONTYPE)
 
@@ -2270,8 +2278,8 @@ _CANONDIRECTION = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=11719,
-  serialized_end=11806,
+  serialized_start=11783,
+  serialized_end=11870,
 )
 _sym_db.RegisterEnumDescriptor(_CANONDIRECTION)
 
@@ -2293,8 +2301,8 @@ _INPUTTYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=11808,
-  serialized_end=11858,
+  serialized_start=11872,
+  serialized_end=11922,
 )
 _sym_db.RegisterEnumDescriptor(_INPUTTYPE)
 
@@ -2328,8 +2336,8 @@ _WAITTYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=11860,
-  serialized_end=11930,
+  serialized_start=11924,
+  serialized_end=11994,
 )
 _sym_db.RegisterEnumDescriptor(_WAITTYPE)
 
@@ -2371,8 +2379,8 @@ _INTERPRETERSTATETYPE = _descriptor.EnumDescriptor(
   ],
   containing_type=None,
   options=None,
-  serialized_start=11933,
-  serialized_end=12103,
+  serialized_start=11997,
+  serialized_end=12167,
 )
 _sym_db.RegisterEnumDescriptor(_INTERPRETERSTATETYPE)
 
@@ -2572,6 +2580,8 @@ MT_HALRCOMMAND_DESCRIPTION = 277
 MT_HALRCOMP_FULL_UPDATE = 288
 MT_HALRCOMP_INCREMENTAL_UPDATE = 289
 MT_HALRCOMP_ERROR = 290
+MT_HALRCOMP_PACKED_UPDATE = 291
+MT_HALGROUP_PACKED_UPDATE = 292
 MT_HALGROUP_BIND = 294
 MT_HALGROUP_BIND_CONFIRM = 295
 MT_HALGROUP_BIND_REJECT = 296
@@ -0,0 +1,167 @@
+// pb2json()/json2pb() regression test:
+// convert representative Containers to JSON, print the JSON for
+// comparison with a known good output, and parse it back - the result
+// must serialize to the same bytes as the original.
+//
+// exits 1 if a round trip fails.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <string>
+
+#include <machinetalk/protobuf/types.pb.h>
+#include <machinetalk/protobuf/value.pb.h>
+#include <machinetalk/protobuf/object.pb.h>
+#include <machinetalk/protobuf/message.pb.h>
+
+#include <json2pb.hh>
+
+using namespace machinetalk;
+
+static int failed;
+
+static void check(const char *name, const Container &c)
+{
+    std::string json;
+
+    try {
+	json = pb2json(c);
+    } catch (std::exception &ex) {
+	printf("%s: pb2json exception: %s\n", name, ex.what());
+	return;
+    }
+    printf("%s: %s\n", name, json.c_str());
+
+    Container back;
+    try {
+	json2pb(back, json.data(), json.size());
+    } catch (std::exception &ex) {
+	printf("%s: json2pb exception: %s\n", name, ex.what());
+	failed = 1;
+	return;
+    }
+    if (back.SerializeAsString() != c.SerializeAsString()) {
+	printf("%s: round trip FAILED\n", name);
+	failed = 1;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+    Container c;
+
+    // as haltalk reports a remote component
+    c.set_type(MT_HALRCOMP_FULL_UPDATE);
+    c.set_serial(56789);
+    c.set_rsvp(NONE);
+    Pin *pin = c.add_pin();
+    pin->set_type(HAL_S32);
+    pin->set_name("foo.1.bar");
+    pin->set_handle(4711);
+    pin->set_hals32(-4711);
+    pin = c.add_pin();
+    pin->set_type(HAL_BIT);
+    pin->set_name("foo.1.enable");
+    pin->set_handle(4712);
+    pin->set_halbit(true);
+    check("rcomp", c);
+
+    // a group full update
+    c.Clear();
+    c.set_type(MT_HALGROUP_FULL_UPDATE);
+    Group *g = c.add_group();
+    g->set_name("group1");
+    g->set_handle(0xffffffff);
+    static const struct {
+	ValueType type;
+	const char *name;
+    } sigs[] = {
+	{ HAL_BIT,   "sig.bit" },
+	{ HAL_FLOAT, "sig.float" },
+	{ HAL_S32,   "sig.s32" },
+	{ HAL_U32,   "sig.u32" },
+    };
+    for (int i = 0; i < 4; i++) {
+	Member *m = g->add_member();
+	m->set_mtype(HAL_SIGNAL);
+	m->set_epsilon(0.0);
+	Signal *s = m->mutable_signal();
+	s->set_type(sigs[i].type);
+	s->set_name(sigs[i].name);
+	s->set_handle(100 + i);
+	switch (sigs[i].type) {
+	case HAL_BIT:   s->set_halbit(false); break;
+	case HAL_FLOAT: s->set_halfloat(0.1); break;
+	case HAL_S32:   s->set_hals32(INT32_MIN); break;
+	case HAL_U32:   s->set_halu32(UINT32_MAX); break;
+	default: break;
+	}
+    }
+    c.mutable_pparams()->set_keepalive_timer(5000);
+    check("group-full", c);
+
+    // an incremental update: the reals as they come
+    c.Clear();
+    c.set_type(MT_HALGROUP_INCREMENTAL_UPDATE);
+    c.set_tsc(INT64_MIN);
+    static const double reals[] = {
+	100.0, -0.0, 1e300, 1.5e-7, 2.5e-300, -123456.789, 1e17, 1e16
+    };
+    for (size_t i = 0; i < sizeof(reals) / sizeof(reals[0]); i++) {
+	Signal *s = c.add_signal();
+	s->set_handle(100 + i);
+	s->set_halfloat(reals[i]);
+    }
+    check("group-incremental", c);
+
+    // 64 bit values, strings and bytes
+    c.Clear();
+    c.set_type(MT_PING);
+    Value *v = c.add_value();
+    v->set_type(INT64);
+    v->set_v_int64(INT64_MIN);
+    v = c.add_value();
+    v->set_type(UINT64);
+    v->set_v_uint64(UINT64_MAX);
+    v = c.add_value();
+    v->set_type(UINT64);
+    v->set_v_uint64(UINT64_C(4711));
+    v = c.add_value();
+    v->set_type(STRING);
+    v->set_v_string("quote \" backslash \\ slash /");
+    v = c.add_value();
+    v->set_type(BYTES);
+    v->set_v_bytes(std::string("\0\1\2\376\377", 5));
+    c.add_note("control \b\f\n\r\t \x01\x1f\x7f");
+    c.add_note("utf-8 \xc2\xb0 \xe2\x82\xac \xf0\x9f\x98\x80");
+    c.add_note("");
+    c.set_uuid(std::string("\x12\x34\x56\x78\x9a\xbc\xde\xf0", 8));
+    check("values", c);
+
+    // packed updates
+    c.Clear();
+    c.set_type(MT_HALGROUP_PACKED_UPDATE);
+    c.add_packed_handle(1);
+    c.add_packed_handle(2);
+    c.add_packed_handle(300);
+    c.set_packed(std::string("\x05\x00\x00\x00", 4));
+    check("packed", c);
+
+    // what cannot be converted
+    c.Clear();
+    c.set_type(MT_PING);
+    c.add_note("invalid \xc3\x28 utf-8");
+    check("invalid-utf8", c);
+
+    c.Clear();
+    c.set_type(MT_PING);
+    c.add_value()->set_type(DOUBLE);
+    c.mutable_value(0)->set_v_double(NAN);
+    check("nan", c);
+
+    google::protobuf::ShutdownProtobufLibrary();
+    return failed;
+}
@@ -5,12 +5,241 @@
 #include <string.h>
 #include <libwebsockets.h>
 
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+
 #include <google/protobuf/text_format.h>
 #include <machinetalk/protobuf/message.pb.h>
 using namespace google::protobuf;
 
 #include "webtalk.hh"
 
+// SUB sessions connecting to the same destinations share a feed: one
+// SUB socket, which each session subscribes its topics on. The SUB
+// socket counts subscriptions per topic, and passes every subscribe
+// upstream (libzmq >= 4.2), so a publisher with xpub_verbose like
+// haltalk sends its full update for each session subscribing - this
+// is the initial state of the session. The sessions already
+// subscribed to the topic receive that full update as well, which
+// just refreshes their state.
+//
+// Each update is parsed and converted to JSON once per feed, into a
+// single zmq message, which all sessions subscribed to its topic
+// reference rather than copy.
+
+typedef struct json_feed json_feed_t;
+
+typedef struct {
+    json_feed_t *feed;
+    std::vector<std::string> topics; // as subscribed by this session
+} json_session_t;
+
+typedef struct json_feed {
+    wtself_t *self;
+    std::string key; // the connect= destinations
+    zsock_t *socket;
+    zmq_pollitem_t pollitem;
+    std::vector<zws_session_t *> sessions;
+    std::string json; // conversion buffer, reused
+} json_feed_t;
+
+// feeds indexed by key
+static std::unordered_map<std::string, json_feed_t *> feeds;
+
+static machinetalk::Container c; // fast; threadsafe???
+
+// sessions of type=sub which only connect can share a feed.
+// returns the feed key, or an empty string if not shareable.
+static std::string feed_key(zws_session_t *wss)
+{
+    std::string key;
+    bool sub = false;
+
+    for (UriQueryListA *q = wss->queryList; q != NULL; q = q->next) {
+	if (!strcmp(q->key, "type"))
+	    sub = (q->value != NULL) && !strcasecmp(q->value, "sub");
+	if (!strcmp(q->key, "bind"))
+	    return "";
+	if (!strcmp(q->key, "connect") && (q->value != NULL)) {
+	    key += q->value;
+	    key += ' ';
+	}
+    }
+    return sub ? key : "";
+}
+
+static void feed_subscribe(json_feed_t *feed, zws_session_t *wss,
+			   const std::string &topic)
+{
+    json_session_t *js = (json_session_t *) wss->user_data;
+
+    js->topics.push_back(topic);
+    zsock_set_subscribe(feed->socket, topic.c_str());
+    lwsl_uri("%s: subscribe '%s' on feed '%s'\n", __func__,
+	     topic.c_str(), feed->key.c_str());
+}
+
+static void feed_unsubscribe(json_feed_t *feed, zws_session_t *wss,
+			     const std::string &topic)
+{
+    json_session_t *js = (json_session_t *) wss->user_data;
+
+    std::vector<std::string>::iterator it =
+	std::find(js->topics.begin(), js->topics.end(), topic);
+    if (it == js->topics.end())
+	return;
+    js->topics.erase(it);
+    zsock_set_unsubscribe(feed->socket, topic.c_str());
+}
+
+// pass the JSON of an update to all sessions subscribed to its topic.
+// each session gets a reference to the same message, not a copy.
+static void feed_deliver(json_feed_t *feed, const char *t, size_t tlen,
+			 size_t size)
+{
+    zmq_msg_t msg;
+
+    if (zmq_msg_init_size(&msg, feed->json.size())) {
+	lwsl_err("%s: cant allocate %zu bytes: %s\n", __func__,
+		 feed->json.size(), zmq_strerror(errno));
+	return;
+    }
+    memcpy(zmq_msg_data(&msg), feed->json.data(), feed->json.size());
+
+    for (size_t i = 0; i < feed->sessions.size(); i++) {
+	zws_session_t *wss = feed->sessions[i];
+	json_session_t *js = (json_session_t *) wss->user_data;
+
+	// same prefix match as the SUB socket
+	for (size_t j = 0; j < js->topics.size(); j++) {
+	    const std::string &s = js->topics[j];
+	    if ((s.size() <= tlen) && !memcmp(s.data(), t, s.size())) {
+		zmq_msg_t ref;
+		zmq_msg_init(&ref);
+		zmq_msg_copy(&ref, &msg);
+		if (zmq_msg_send(&ref, zsock_resolve(wss->wsq_out), 0) < 0) {
+		    lwsl_err("%s: send to session failed: %s\n", __func__,
+			     zmq_strerror(errno));
+		    zmq_msg_close(&ref);
+		}
+		wss->zmq_bytes += size;
+		wss->zmq_msgs++;
+		break;
+	    }
+	}
+    }
+    zmq_msg_close(&msg);
+}
+
+static int feed_readable(zloop_t *loop, zmq_pollitem_t *item, void *arg)
+{
+    json_feed_t *feed = (json_feed_t *) arg;
+    zmsg_t *m = zmsg_recv(feed->socket);
+    zframe_t *f;
+
+    if (m == NULL)
+	return 0;
+
+    // the topic frame selects the sessions
+    zframe_t *topic = zmsg_pop(m);
+    const char *t = (const char *) zframe_data(topic);
+    size_t tlen = zframe_size(topic);
+
+    while ((f = zmsg_pop(m)) != NULL) {
+	size_t size = zframe_size(f);
+
+	if (!c.ParseFromArray(zframe_data(f), size)) {
+	    char *hex = zframe_strhex(f);
+	    lwsl_err("cant protobuf parse from %s", hex);
+	    free(hex);
+	    zframe_destroy(&f);
+	    break;
+	}
+	zframe_destroy(&f);
+
+	try {
+	    pb2json(c, feed->json);
+	} catch (std::exception &ex) {
+	    lwsl_err("%s: pb2json exception: %s\n", __func__, ex.what());
+	    std::string text;
+	    if (TextFormat::PrintToString(c, &text))
+		lwsl_err("%s: pb2json exception: %s\n container: %s\n",
+			 __func__, ex.what(), text.c_str());
+	    continue;
+	}
+	lwsl_tows("%s: '%s'\n", __func__, feed->json.c_str());
+	feed_deliver(feed, t, tlen, size);
+    }
+    zframe_destroy(&topic);
+    zmsg_destroy(&m);
+    c.Clear();
+    return 0;
+}
+
+// take over the socket of wss, set up and subscribed by
+// default_policy(), as the feed of all sessions connecting to the
+// same destinations
+static json_feed_t *feed_new(wtself_t *self, zws_session_t *wss,
+			     const std::string &key)
+{
+    json_feed_t *feed = new json_feed_t();
+    json_session_t *js = (json_session_t *) wss->user_data;
+
+    feed->self = self;
+    feed->key = key;
+    feed->socket = wss->socket;
+    wss->socket = NULL;
+
+    feed->pollitem.socket = feed->socket;
+    feed->pollitem.fd = 0;
+    feed->pollitem.events = ZMQ_POLLIN;
+    int retval = zloop_poller(self->netopts.z_loop, &feed->pollitem,
+			      feed_readable, feed);
+    assert(retval == 0);
+    feeds[key] = feed;
+    lwsl_uri("%s: new feed '%s'\n", __func__, key.c_str());
+
+    js->feed = feed;
+    feed->sessions.push_back(wss);
+    return feed;
+}
+
+static void feed_attach(json_feed_t *feed, zws_session_t *wss)
+{
+    json_session_t *js = (json_session_t *) wss->user_data;
+    std::vector<std::string> topics;
+
+    js->feed = feed;
+    topics.swap(js->topics);
+    for (size_t i = 0; i < topics.size(); i++)
+	feed_subscribe(feed, wss, topics[i]);
+    feed->sessions.push_back(wss);
+}
+
+static void feed_detach(zws_session_t *wss)
+{
+    json_session_t *js = (json_session_t *) wss->user_data;
+    json_feed_t *feed = js->feed;
+
+    while (!js->topics.empty())
+	feed_unsubscribe(feed, wss, js->topics.back());
+    feed->sessions.erase(std::remove(feed->sessions.begin(),
+				     feed->sessions.end(), wss),
+			 feed->sessions.end());
+    js->feed = NULL;
+
+    if (feed->sessions.empty()) {
+	lwsl_uri("%s: last session gone, closing feed '%s'\n", __func__,
+		 feed->key.c_str());
+	zloop_poller_end(feed->self->netopts.z_loop, &feed->pollitem);
+	zsock_destroy(&feed->socket);
+	feeds.erase(feed->key);
+	delete feed;
+    }
+}
+
 // relay policy to convert to/from JSON as needed
 int
 json_policy(wtself_t *self,
@@ -20,20 +249,72 @@ json_policy(wtself_t *self,
     lwsl_debug("%s op=%d\n",__func__,  type);
     zmsg_t *m;
     zframe_t *f;
-    static machinetalk::Container c; // fast; threadsafe???
+    json_session_t *js = (json_session_t *) wss->user_data;
 
     switch (type) {
 
     case ZWS_CONNECTING:
-	// > 0 indicates: run the default policy ZWS_CONNECTING code
-	return 1;
+	{
+	    std::string key = feed_key(wss);
+	    if (key.empty())
+		// > 0 indicates: run the default policy ZWS_CONNECTING code
+		return 1;
+
+	    js = new json_session_t();
+	    wss->user_data = js;
+	    for (UriQueryListA *q = wss->queryList; q != NULL; q = q->next) {
+		if (!strcmp(q->key, "subscribe"))
+		    js->topics.push_back((q->value == NULL) ? "" : q->value);
+	    }
+	    if (feeds.count(key)) {
+		// the feed is connected already, just check the args
+		wss->socket_type = ZMQ_SUB;
+		wss->txmode = LWS_WRITE_BINARY;
+		for (UriQueryListA *q = wss->queryList; q != NULL; q = q->next) {
+		    if (!strcmp(q->key, "text"))
+			wss->txmode = LWS_WRITE_TEXT;
+		}
+		return 0;
+	    }
+	    // the first session connects the socket, see ZWS_ESTABLISHED
+	    int retval = default_policy(self, wss, ZWS_CONNECTING);
+	    if (retval) {
+		delete js;
+		wss->user_data = NULL;
+	    }
+	    return retval;
+	}
 	break;
 
     case ZWS_ESTABLISHED:
+	if (js != NULL) {
+	    std::string key = feed_key(wss);
+	    std::unordered_map<std::string, json_feed_t *>::iterator it =
+		feeds.find(key);
+	    if (it != feeds.end()) {
+		if (wss->socket != NULL)
+		    // the feed was set up in the meantime
+		    zsock_destroy(&wss->socket);
+		feed_attach(it->second, wss);
+		return 0;
+	    }
+	    // the feed found while connecting is gone already
+	    if ((wss->socket == NULL) &&
+		default_policy(self, wss, ZWS_CONNECTING))
+		return -1;
+	    feed_new(self, wss, key);
+	    return 0;
+	}
 	return register_zmq_poller(wss);
 	break;
 
     case ZWS_CLOSE:
+	if (js != NULL) {
+	    if (js->feed != NULL)
+		feed_detach(wss);
+	    delete js;
+	    wss->user_data = NULL;
+	}
 	break;
 
     case ZWS_FROM_WS:
@@ -62,7 +343,9 @@ json_policy(wtself_t *self,
 #endif
 			assert(z_pbframe != NULL);
 			if (c.SerializeWithCachedSizesToArray(zframe_data(z_pbframe))) {
-			    assert(zframe_send(&z_pbframe, wss->socket, 0) == 0);
+			    if (zframe_send(&z_pbframe, wss->socket, 0))
+				lwsl_err("from_ws: send failed: %s\n",
+					 zmq_strerror(errno));
 			} else {
 			    lwsl_err("from_ws: cant serialize: '%.*s'\n",
 				     wss->length, wss->buffer);
@@ -77,11 +360,17 @@ json_policy(wtself_t *self,
 			for (int i = 0; i < c.note_size(); i++) {
 				if (c.type() == machinetalk::MT_ZMQ_SUBSCRIBE) {
 				lwsl_fromws("%s: subscribe to '%s'\n", __func__, c.note(i).c_str());
-				zsock_set_subscribe (wss->socket, c.note(i).c_str());
+				if (js != NULL)
+				    feed_subscribe(js->feed, wss, c.note(i));
+				else
+				    zsock_set_subscribe (wss->socket, c.note(i).c_str());
 			    }
 			    if (c.type() == machinetalk::MT_ZMQ_UNSUBSCRIBE) {
 				lwsl_fromws("%s: unsubscribe from '%s'\n", __func__, c.note(i).c_str());
-				zsock_set_unsubscribe (wss->socket, c.note(i).c_str());
+				if (js != NULL)
+				    feed_unsubscribe(js->feed, wss, c.note(i));
+				else
+				    zsock_set_unsubscribe (wss->socket, c.note(i).c_str());
 			    }
 			}
 			c.Clear();
@@ -132,6 +421,9 @@ json_policy(wtself_t *self,
 	    }
 
 	    while ((f = zmsg_pop (m)) != NULL) {
+		wss->zmq_bytes += zframe_size(f);
+		wss->zmq_msgs++;
+
 		if (!c.ParseFromArray(zframe_data(f), zframe_size(f))) {
 		    char *hex = zframe_strhex(f);
 		    lwsl_err("cant protobuf parse from %s",
@@ -140,15 +432,19 @@ json_policy(wtself_t *self,
 		    zframe_destroy(&f);
 		    break;
 		}
+		zframe_destroy(&f);
 		// this breaks - probably needs some MergeFrom* pb method
 		// if (!c.has_topic() && (topic != NULL))
 		//     c.set_topic(topic); // tack on
 
 		try {
-		    std::string json = pb2json(c);
+		    static std::string json;
+		    pb2json(c, json);
 		    zframe_t *z_jsonframe = zframe_new( json.c_str(), json.size());
 		    lwsl_tows("%s: '%s'\n", __func__, json.c_str());
-		    assert(zframe_send(&z_jsonframe, wss->wsq_out, 0) == 0);
+		    if (zframe_send(&z_jsonframe, wss->wsq_out, 0))
+			lwsl_err("%s: send failed: %s\n", __func__,
+				 zmq_strerror(errno));
 
 		} catch (std::exception &ex) {
 		    lwsl_err("%s: pb2json exception: %s\n", __func__, ex.what());
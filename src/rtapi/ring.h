@@ -16,6 +16,12 @@
 * lock-free, single-reader, single-writer queue which does not require
 * any operating system support and is extremely fast.
 *
+* For several concurrent readers and writers, MPMC rings are a bounded
+* lock-free queue of records up to a fixed size - see mpmc_write_begin().
+*
+* Optionally, userland readers and writers may block until the other side
+* has made progress - see ring_wait_read() and ring_wait_write().
+*
 * ringbuffers are intended to replace a variety of special-purpose
 * messaging schemes like the ones used between task and motion,
 * in halstreamer, halsampler and halscope, at the same time making
@@ -66,6 +72,13 @@
 #include "rtapi_string.h"
 #include "rtapi_int.h"
 
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
 
 #ifndef MAXIMUM // MAX conflicts with definition in hal/drivers/pci_8255.c
 #define MAXIMUM(x, y) (((x) > (y))?(x):(y))
@@ -84,7 +97,11 @@ typedef __s32 rrecsize_t;
 
 typedef struct {
     ringsize_t tail __attribute__((aligned(RTAPI_CACHELINE)));
-    char __tailpad[RTAPI_CACHELINE - sizeof(ringsize_t)];
+    // writer side of blocking wait support, see ring_wait_read():
+    __u32 wwaiters;          // writers sleeping on ringheader_t.wseq
+    __u32 rseq;              // futex word, bumped on commit if readers sleep
+    __u32 wwaitable;         // set once a writer ever waited
+    char __tailpad[RTAPI_CACHELINE - 4 * sizeof(__u32)];
     // offset 64:
     __u8 scratchpad_buf[0];  // actual scratchpad storage
 } ringtrailer_t;
@@ -100,8 +117,9 @@ typedef enum {
     RINGTYPE_RECORD = 0,
     RINGTYPE_MULTIPART = RTAPI_BIT(0),
     RINGTYPE_STREAM = RTAPI_BIT(1),
-    RINGTYPE_ANY  = (RTAPI_BIT(0)|RTAPI_BIT(1)),
-    RINGTYPE_MASK = (RTAPI_BIT(0)|RTAPI_BIT(1))
+    RINGTYPE_ANY  = (RTAPI_BIT(0)|RTAPI_BIT(1)), // plug matching only
+    RINGTYPE_MPMC = RTAPI_BIT(5),
+    RINGTYPE_MASK = (RTAPI_BIT(0)|RTAPI_BIT(1)|RTAPI_BIT(5))
 } ring_type_t;
 
 // mode flags passed in by ring_new
@@ -113,7 +131,7 @@ typedef enum {
 } ring_mode_flags_t;
 
 typedef struct {
-    __u8    type       : 2;  // RINGTYPE_*
+    __u8    type       : 6;  // RINGTYPE_*
     __u8    use_rmutex : 1;  // hint to using code - use ringheader_t.rmutex
     __u8    use_wmutex : 1;  // hint to using code - use ringheader_t.wmutex
 
@@ -124,7 +142,7 @@ typedef struct {
     // ringbuffer code per se.
     __u8    alloc_halmem : 1;
 
-    __u32   userflags : 27;  // not interpreted by ringbuffer code
+    __u32   userflags : 23;  // not interpreted by ringbuffer code
     // offset 4:
     __s32   refcount;        // number of referencing entities (modules, threads..)
     // offset 8:
@@ -136,19 +154,23 @@ typedef struct {
     // offset 32:
     ringsize_t trailer_size;   // sizeof(ringtrailer_t) + scratchpad size
     // offset 36:
-    ringsize_t size_mask;      // stream mode only
+    ringsize_t size_mask;      // stream mode: bytes, MPMC mode: slots
     // offset 40:
     // this is the size of the actual ring buffer. There might be
     // padding between the ring storage and the ringtrailer_t due to the alignment
     // of the trailer (64) so the tail pointer is cache-aligned.
     ringsize_t size;           // common to stream and record mode
-    // offset 44 - 4 bytes left:
-    __u32 __unused1;
+    // offset 44:
+    ringsize_t slot_size;      // MPMC mode only
     // offset 48:
     __u64   generation;
     // offset 56:
     ringsize_t  head __attribute__((aligned(RTAPI_CACHELINE)));
-    char __headpad[RTAPI_CACHELINE - sizeof(ringsize_t)];
+    // reader side of blocking wait support, see ring_wait_read():
+    __u32 rwaiters;          // readers sleeping on ringtrailer_t.rseq
+    __u32 wseq;              // futex word, bumped on consume if writers sleep
+    __u32 rwaitable;         // set once a reader ever waited
+    char __headpad[RTAPI_CACHELINE - 4 * sizeof(__u32)];
     // offset 128:
     __u8    buf[0];         // actual ring storage without scratchpad
 } ringheader_t;
@@ -278,11 +300,14 @@ static inline void ringheader_init(ringheader_t *ringheader,
 
     // init the ringheader - mode independent part
     ringheader->rmutex = ringheader->wmutex = 0;
+    ringheader->slot_size = 0;
     ringheader->reader = ringheader->writer = 0;
     ringheader->reader_instance = ringheader->writer_instance = 0;
     ringheader->head = 0;
+    ringheader->rwaiters = ringheader->wseq = ringheader->rwaitable = 0;
     t = _trailer_from_header(ringheader);
     t->tail = 0;
+    t->wwaiters = t->rseq = t->wwaitable = 0;
     ringheader->type = (flags & RINGTYPE_MASK);
 
     // mode-dependent initialisation
@@ -315,6 +340,72 @@ static inline void ringbuffer_init(ringheader_t *ringheader,
     ring->magic = RINGBUFFER_MAGIC;
 }
 
+/* blocking wait support
+ *
+ * ring operations never block. A reader or writer which cannot proceed
+ * may instead sleep until the other side has made progress, see
+ * ring_wait_read() and ring_wait_write() below.
+ *
+ * The side making progress - a writer committing, or a reader consuming -
+ * checks the waiter count of the other side after updating its index,
+ * and only if nonzero bumps the futex word the other side sleeps on and
+ * issues a FUTEX_WAKE. This never blocks and is safe to use from RT
+ * threads.
+ *
+ * The barrier ordering the index update before the waiter count load is
+ * a full fence, which is not free on every ring operation. So each side
+ * has a sticky 'waitable' flag, set by the first ring_wait_*() on that
+ * side; until then, the wakeup costs one load of the flag. Once set, it
+ * stays set for the life of the ring, and the cost is the barrier and a
+ * load of the waiter count.
+ *
+ * Setting the flag is not ordered against an operation the other side
+ * has already started, which might therefore miss the first waiter. The
+ * first sleep after setting the flag is hence limited to
+ * RING_WAIT_ARM_MS, after which the waiter rechecks and sleeps again.
+ *
+ * On Xenomai, the wakeup is a Linux syscall and causes a mode switch of
+ * the RT thread when a waiter is present.
+ *
+ * The futex words live in the ring's shared memory, so waiting works
+ * across processes.
+ */
+static inline long _ring_futex(__u32 *uaddr, const int op, const __u32 val,
+			       const struct timespec *timeout)
+{
+    return syscall(SYS_futex, uaddr, op, val, timeout, NULL, 0);
+}
+
+#define RING_WAIT_ARM_MS 1
+
+static inline void _ring_wake(__u32 *waitable, __u32 *waiters, __u32 *seq)
+{
+    // nobody ever waited on this side
+    if (!rtapi_load_u32(waitable))
+	return;
+    // order the preceding index update before reading the waiter count,
+    // pairs with the barrier in _ring_wait()
+    rtapi_smp_mb();
+    if (rtapi_load_u32(waiters)) {
+	rtapi_add_u32(seq, 1);
+	_ring_futex(seq, FUTEX_WAKE, INT_MAX, NULL);
+    }
+}
+
+// after a write was committed
+static inline void _ring_wake_readers(const ringbuffer_t *ring)
+{
+    _ring_wake(&ring->header->rwaitable, &ring->header->rwaiters,
+	       &ring->trailer->rseq);
+}
+
+// after data was consumed
+static inline void _ring_wake_writers(const ringbuffer_t *ring)
+{
+    _ring_wake(&ring->trailer->wwaitable, &ring->trailer->wwaiters,
+	       &ring->header->wseq);
+}
+
 // memory layout of record rings:
 //
 // an RB_ALIGN aligned sequence of records:
@@ -369,13 +460,13 @@ static inline ringsize_t record_usage(const ringsize_t record_size)
  * record_write_end() uses the 'data' field to decide if the decision was to
  * wrap or not.
  */
-static inline int record_write_begin(ringbuffer_t *ring,
-				     void ** data,
-				     const ringsize_t sz)
+static inline int _record_write_begin_at(ringbuffer_t *ring,
+					 const ringsize_t tail,
+					 void ** data,
+					 const ringsize_t sz)
 {
     ringsize_t free;
     ringheader_t *h = ring->header;
-    ringtrailer_t *t = ring->trailer;
     ringsize_t a = size_aligned(sz + sizeof(rrecsize_t));
 
     // record too large for ring?
@@ -383,14 +474,14 @@ static inline int record_write_begin(ringbuffer_t *ring,
 	return ERANGE;
 
      // -1 + 1 is needed for head==tail
-    free = (h->size +  rtapi_load_u32(&h->head) - t->tail - 1) % h->size + 1;
+    free = (h->size +  rtapi_load_u32(&h->head) - tail - 1) % h->size + 1;
 
     //printf("Free space: %d; Need %zd\n", free, a);
 
     if (free <= a) return EAGAIN; // currently not enough space
 
     // would the write wrap around the end of ring?
-    if (t->tail + a > h->size) {
+    if (tail + a > h->size) {
 
 	// would record fit at the start of the ring?
 	if (rtapi_load_u32(&h->head) <= a)
@@ -402,10 +493,17 @@ static inline int record_write_begin(ringbuffer_t *ring,
 	return 0;
     }
     // size would fit, return address post tail + size field
-    *data = _size_at(ring, t->tail) + 1;
+    *data = _size_at(ring, tail) + 1;
     return 0;
 }
 
+static inline int record_write_begin(ringbuffer_t *ring,
+				     void ** data,
+				     const ringsize_t sz)
+{
+    return _record_write_begin_at(ring, ring->trailer->tail, data, sz);
+}
+
 /* record_write_end()
  *
  * commit a zero-copy write to the ring which was started by record_write_begin().
@@ -413,6 +511,27 @@ static inline int record_write_begin(ringbuffer_t *ring,
  * the corresponding record_write_begin().
  * 'data' must be the pointer returned by record_write_begin().
  */
+// write the size field - and if the write wrapped, the wrap mark - for
+// a record at 'tail', and return the tail after it. Does not publish.
+static inline ringsize_t _record_write_end_at(ringbuffer_t *ring,
+					      ringsize_t tail,
+					      const void * data,
+					      const ringsize_t sz)
+{
+    ringsize_t a = size_aligned(sz + sizeof(rrecsize_t));
+
+    // was the write at the beginning of the buffer?
+    if (data == _size_at(ring, 0) + 1) {
+	// Wrap case
+	// invalidate the tail record
+	rtapi_store_u32((__u32 *)_size_at(ring, tail), -1);
+	tail = 0;
+    }
+    // record comitted write size
+    rtapi_store_u32((__u32 *)_size_at(ring, tail), sz);
+    return (tail + a) % ring->header->size;
+}
+
 static inline int record_write_end(ringbuffer_t *ring,
 				   const void * data,
 				   const ringsize_t sz)
@@ -440,6 +559,7 @@ static inline int record_write_end(ringbuffer_t *ring,
 
     rtapi_store_u32(&t->tail, (t->tail + a) % h->size);
     //printf("New head/tail: %zd/%zd\n", h->head, t->tail);
+    _ring_wake_readers(ring);
     return 0;
 }
 
@@ -637,23 +757,205 @@ static inline int record_shift(ringbuffer_t *ring)
 
     rtapi_inc_u64((uint64_t *)&ring->header->generation);
     rtapi_store_u32(&ring->header->head, off);
+    _ring_wake_writers(ring);
     return 0;
 }
 
-/* record_flush_reader()
+/* batched record writes and reads
  *
- * clear the buffer, and return the number of records flushed.
- * call from reader only (!)
+ * each record_write_end() publishes its record with a write barrier and
+ * a tail store, and each record_shift() consumes one with a barrier, a
+ * 64-bit atomic generation increment and a head store. When many small
+ * records are written per cycle, or drained per wakeup, these dominate.
+ *
+ * a writer may instead reserve and fill several records against a
+ * private tail, and publish all of them with a single barrier and tail
+ * update:
+ *
+ * ringbatch_t b;
+ * record_batch_begin(ring, &b);
+ * for (...) {
+ *     if (record_batch_write_begin(&b, &data, size))
+ *         break;   // EAGAIN/ERANGE - records so far can still be committed
+ *     fill(data);
+ *     record_batch_write_end(&b, data, size);
+ * }
+ * record_batch_commit(&b);
+ *
+ * nothing is visible to the reader before record_batch_commit(); a
+ * batch which is not committed is dropped. While a batch is open, the
+ * writer must not use record_write() and friends on the ring.
+ *
+ * a reader may look at a run of records with record_read_batch(), and
+ * consume them with a single head and generation update through
+ * record_shift_batch():
+ *
+ * ringvec_t rv[64];
+ * int i, n = record_read_batch(ring, rv, 64);
+ * for (i = 0; i < n; i++)
+ *     process(rv[i].rv_base, rv[i].rv_len);
+ * record_shift_batch(ring, n);
+ *
+ * works for record and multipart rings.
  */
-static inline int record_flush_reader(ringbuffer_t *ring)
+typedef struct {
+    ringbuffer_t *ring;
+    ringsize_t tail;      // private write position
+    int count;            // records written but not committed
+} ringbatch_t;
+
+static inline void record_batch_begin(ringbuffer_t *ring, ringbatch_t *b)
+{
+    b->ring = ring;
+    b->tail = ring->trailer->tail;
+    b->count = 0;
+}
+
+/* record_batch_write_begin()
+ *
+ * as record_write_begin(), but behind the records already in the batch.
+ */
+static inline int record_batch_write_begin(ringbatch_t *b,
+					   void **data,
+					   const ringsize_t sz)
+{
+    return _record_write_begin_at(b->ring, b->tail, data, sz);
+}
+
+/* record_batch_write_end()
+ *
+ * add a record started by record_batch_write_begin() to the batch.
+ * The record is not visible before record_batch_commit().
+ */
+static inline int record_batch_write_end(ringbatch_t *b,
+					 const void *data,
+					 const ringsize_t sz)
+{
+    b->tail = _record_write_end_at(b->ring, b->tail, data, sz);
+    b->count++;
+    return 0;
+}
+
+// copying variant
+static inline int record_batch_write(ringbatch_t *b,
+				     const void *data,
+				     const ringsize_t sz)
+{
+    void *ptr;
+    int r = record_batch_write_begin(b, &ptr, sz);
+    if (r) return r;
+    memmove(ptr, data, sz);
+    return record_batch_write_end(b, ptr, sz);
+}
+
+/* record_batch_commit()
+ *
+ * publish all records of the batch at once, return their number.
+ * The batch may be reused right away.
+ */
+static inline int record_batch_commit(ringbatch_t *b)
 {
+    int n = b->count;
+
+    if (n == 0)
+	return 0;
+    // all records and size fields before the tail update
+    rtapi_smp_wmb();
+    rtapi_store_u32(&b->ring->trailer->tail, b->tail);
+    _ring_wake_readers(b->ring);
+    b->count = 0;
+    return n;
+}
+
+/* internal: walk up to n records from the head, optionally
+ * returning them in vec. Returns the number of records, and the
+ * offset behind the last one in *end.
+ */
+static inline int _record_walk(const ringbuffer_t *ring,
+			       ringvec_t *vec,
+			       const int n,
+			       ringsize_t *end)
+{
+    ringheader_t *h = ring->header;
+    ringsize_t tail = rtapi_load_u32(&ring->trailer->tail);
+    ringsize_t off = h->head;
+    rrecsize_t *sz;
     int count = 0;
 
-    while (!record_shift(ring))
+    // serialize with respect to our snapshot of the tail index
+    rtapi_smp_rmb();
+
+    while ((count < n) && (off != tail)) {
+	sz = _size_at(ring, off);
+	if (*sz < 0) { // wrap mark: continue at start of ring
+	    off = 0;
+	    continue;
+	}
+	if (vec) {
+	    vec[count].rv_base = sz + 1;
+	    vec[count].rv_len = *sz;
+	    vec[count].rv_flags = 0;
+	}
+	off = (off + size_aligned(*sz + sizeof(rrecsize_t))) % h->size;
 	count++;
+    }
+    *end = off;
+    return count;
+}
+
+/* record_read_batch()
+ *
+ * peek at up to n records from the head: fill in vec[] with their
+ * addresses and sizes, and return the number of records, 0 if none.
+ * Like record_read(), this does not consume.
+ */
+static inline int record_read_batch(const ringbuffer_t *ring,
+				    ringvec_t *vec,
+				    const int n)
+{
+    ringsize_t end;
+    return _record_walk(ring, vec, n, &end);
+}
+
+/* record_shift_batch()
+ *
+ * consume up to n records with a single head update, return the
+ * number consumed. Use n as returned by record_read_batch(), or
+ * INT_MAX to consume everything currently in the ring.
+ */
+static inline int record_shift_batch(ringbuffer_t *ring, const int n)
+{
+    ringheader_t *h = ring->header;
+    uint64_t *gen = (uint64_t *)&h->generation;
+    ringsize_t end;
+    uint64_t g;
+    int count = _record_walk(ring, NULL, n, &end);
+
+    if (count == 0)
+	return 0;
+
+    // iterators rely on generation counting consumed records
+    do {
+	g = rtapi_load_u64(gen);
+    } while (!rtapi_cas_u64(gen, g, g + count));
+
+    // reads of the records complete before the head update
+    rtapi_smp_mb();
+    rtapi_store_u32(&h->head, end);
+    _ring_wake_writers(ring);
     return count;
 }
 
+/* record_flush_reader()
+ *
+ * clear the buffer, and return the number of records flushed.
+ * call from reader only (!)
+ */
+static inline int record_flush_reader(ringbuffer_t *ring)
+{
+    return record_shift_batch(ring, INT_MAX);
+}
+
 /* record_flush()
  *
  * clear the buffer
@@ -669,6 +971,7 @@ static inline void record_flush(ringbuffer_t *ring)
     } while (!rtapi_cas_u32(&ring->header->head,
 			   rtapi_load_u32(&ring->header->head),
 			   rtapi_load_u32(&t->tail)));
+    _ring_wake_writers(ring);
 }
 
 /* rings by default behave like queues:
@@ -754,6 +1057,11 @@ static inline int ring_ismultipart(const ringbuffer_t *ring)
     return (ring->header->type == RINGTYPE_MULTIPART);
 }
 
+static inline int ring_ismpmc(const ringbuffer_t *ring)
+{
+    return (ring->header->type == RINGTYPE_MPMC);
+}
+
 
 static inline int ring_use_wmutex(const ringbuffer_t *ring)
 {
@@ -1001,6 +1309,7 @@ static inline ringsize_t stream_read(ringbuffer_t *ring,
 	rtapi_smp_wmb();
 	rtapi_store_u32(&h->head, (h->head + n1) & h->size_mask);
     }
+    _ring_wake_writers(ring);
     return to_read;
 }
 
@@ -1055,6 +1364,7 @@ static inline void stream_read_advance(ringbuffer_t *ring,
     */
     rtapi_smp_wmb();
     rtapi_store_u32(&h->head, (h->head + cnt) & h->size_mask);
+    _ring_wake_writers(ring);
 }
 
 
@@ -1127,6 +1437,7 @@ static inline ringsize_t stream_write(ringbuffer_t *ring,
 	rtapi_smp_wmb();
 	rtapi_store_u32(&t->tail,(t->tail + n1) & h->size_mask);
     }
+    _ring_wake_readers(ring);
     return to_write;
 }
 
@@ -1142,6 +1453,421 @@ static inline void stream_write_advance(ringbuffer_t *ring,
     */
     rtapi_smp_wmb();
     rtapi_store_u32(&t->tail, (t->tail + cnt) & h->size_mask);
+    _ring_wake_readers(ring);
+}
+
+/* MPMC rings
+ *
+ * record and stream rings are single-reader, single-writer. The
+ * USE_RMUTEX/USE_WMUTEX hints merely ask using code to serialize
+ * several readers or writers through rmutex/wmutex, a spinlock which
+ * must not be contended for from RT threads.
+ *
+ * An MPMC ring (RINGTYPE_MPMC) is a bounded queue of fixed-size slots
+ * after Dmitry Vyukov's bounded MPMC queue:
+ *   http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ * Any number of RT threads and userland processes may read and write
+ * concurrently. No operation waits for another one; it fails with
+ * EAGAIN instead. Records may have any size up to the record size
+ * the ring was created with.
+ *
+ * Positions count records and wrap at 2^32. The enqueue position is
+ * ringtrailer_t.tail, the dequeue position ringheader_t.head; both are
+ * advanced with a CAS to claim a slot. The slot at position pos is
+ * slot (pos & size_mask), and its sequence number tells its state:
+ *   seq == pos           free: a writer may claim it
+ *   seq == pos + 1       committed: a reader may claim it
+ *   seq == pos + nslots  consumed: free again on the next lap
+ *
+ * A claimed slot holds up readers (writers) of that slot - but no
+ * others - until it is committed (released), so keep the time between
+ * mpmc_write_begin()/mpmc_write_end() and mpmc_read_begin()/
+ * mpmc_read_end() short.
+ *
+ * size it with mpmc_ring_size(), initialize with ringheader_init_mpmc().
+ */
+typedef struct {
+    __u32 seq;
+    rrecsize_t size;       // committed record size
+    __u8 data[0];          // RB_ALIGN aligned
+} mpmc_slot_t;
+
+// space used by a slot holding records of up to recsize bytes
+static inline ringsize_t mpmc_slot_size(const ringsize_t recsize)
+{
+    return size_aligned(sizeof(mpmc_slot_t) + recsize);
+}
+
+// ring storage for nslots records of up to recsize bytes, to be passed
+// as 'size' to ring_memsize(). nslots is rounded up to a power of two.
+static inline ringsize_t mpmc_ring_size(const ringsize_t nslots,
+					const ringsize_t recsize)
+{
+    return next_power_of_two(nslots) * mpmc_slot_size(recsize);
+}
+
+// largest record an MPMC ring accepts
+static inline ringsize_t mpmc_record_max(const ringheader_t *h)
+{
+    return h->slot_size - sizeof(mpmc_slot_t);
+}
+
+static inline ringsize_t mpmc_slots(const ringheader_t *h)
+{
+    return h->size_mask + 1;
+}
+
+static inline mpmc_slot_t *_mpmc_slot(const ringbuffer_t *ring,
+				      const __u32 pos)
+{
+    ringheader_t *h = ring->header;
+    return (mpmc_slot_t *) (ring->buf + (pos & h->size_mask) * h->slot_size);
+}
+
+// initialize an MPMC ringbuffer header as allocated with a size of
+// ring_memsize(flags, mpmc_ring_size(nslots, recsize), sp_size)
+// nslots must be at least 1.
+static inline void ringheader_init_mpmc(ringheader_t *ringheader,
+					const int flags,
+					const ringsize_t nslots,
+					const ringsize_t recsize,
+					const ringsize_t sp_size)
+{
+    ringsize_t i, n = next_power_of_two(nslots);
+
+    ringheader_init(ringheader, (flags & ~RINGTYPE_MASK) | RINGTYPE_MPMC,
+		    mpmc_ring_size(n, recsize), sp_size);
+    ringheader->slot_size = mpmc_slot_size(recsize);
+    ringheader->size_mask = n - 1;
+    for (i = 0; i < n; i++)
+	((mpmc_slot_t *) (ringheader->buf + i * ringheader->slot_size))->seq = i;
+}
+
+/* mpmc_write_begin()
+ *
+ * claim a slot for a zero-copy write of up to sz bytes.
+ *
+ * return 0 and the slot's buffer in 'data' on success
+ * return EAGAIN if all slots are in use
+ * return ERANGE if sz exceeds the ring's record size
+ *
+ * The write must be committed with mpmc_write_end().
+ */
+static inline int mpmc_write_begin(ringbuffer_t *ring,
+				   void **data,
+				   const ringsize_t sz)
+{
+    ringtrailer_t *t = ring->trailer;
+    mpmc_slot_t *s;
+    __u32 pos;
+    __s32 dif;
+
+    if (sz > mpmc_record_max(ring->header))
+	return ERANGE;
+
+    pos = rtapi_load_u32(&t->tail);
+    while (1) {
+	s = _mpmc_slot(ring, pos);
+	dif = (__s32) (rtapi_load_u32(&s->seq) - pos);
+	if (dif == 0) {
+	    if (rtapi_cas_u32(&t->tail, pos, pos + 1))
+		break;
+	} else if (dif < 0) {
+	    // slot not yet consumed on the previous lap: full
+	    return EAGAIN;
+	}
+	// another writer claimed it, retry at the new tail
+	pos = rtapi_load_u32(&t->tail);
+    }
+    // the previous reader's copy-out is complete before we write
+    rtapi_smp_mb();
+    *data = s->data;
+    return 0;
+}
+
+/* mpmc_write_end()
+ *
+ * commit a write started by mpmc_write_begin(). 'data' must be the
+ * pointer returned by mpmc_write_begin(), sz not larger than requested.
+ */
+static inline int mpmc_write_end(ringbuffer_t *ring,
+				 void *data,
+				 const ringsize_t sz)
+{
+    mpmc_slot_t *s = (mpmc_slot_t *) data - 1;
+
+    s->size = sz;
+    // record contents before the slot is marked committed
+    rtapi_smp_wmb();
+    rtapi_store_u32(&s->seq, s->seq + 1);
+    _ring_wake_readers(ring);
+    return 0;
+}
+
+/* mpmc_write()
+ *
+ * copying write, return values as for mpmc_write_begin().
+ */
+static inline int mpmc_write(ringbuffer_t *ring,
+			     const void *data,
+			     const ringsize_t sz)
+{
+    void *ptr;
+    int r = mpmc_write_begin(ring, &ptr, sz);
+    if (r) return r;
+    memcpy(ptr, data, sz);
+    return mpmc_write_end(ring, ptr, sz);
+}
+
+/* mpmc_read_begin()
+ *
+ * claim the oldest committed record for a zero-copy read.
+ *
+ * return 0 and the record's address and size in 'data' and 'size'
+ * return EAGAIN if there is no committed record at the head
+ *
+ * unlike record_read(), this consumes the record for all other readers.
+ * The slot must be released with mpmc_read_end().
+ */
+static inline int mpmc_read_begin(ringbuffer_t *ring,
+				  const void **data,
+				  ringsize_t *size)
+{
+    ringheader_t *h = ring->header;
+    mpmc_slot_t *s;
+    __u32 pos;
+    __s32 dif;
+
+    pos = rtapi_load_u32(&h->head);
+    while (1) {
+	s = _mpmc_slot(ring, pos);
+	dif = (__s32) (rtapi_load_u32(&s->seq) - (pos + 1));
+	if (dif == 0) {
+	    if (rtapi_cas_u32(&h->head, pos, pos + 1))
+		break;
+	} else if (dif < 0) {
+	    // empty, or the writer has not committed yet
+	    return EAGAIN;
+	}
+	pos = rtapi_load_u32(&h->head);
+    }
+    // serialize with the writer's commit
+    rtapi_smp_rmb();
+    *data = s->data;
+    *size = s->size;
+    return 0;
+}
+
+/* mpmc_read_end()
+ *
+ * release a slot claimed by mpmc_read_begin() for reuse by writers.
+ */
+static inline int mpmc_read_end(ringbuffer_t *ring,
+				const void *data)
+{
+    mpmc_slot_t *s = (mpmc_slot_t *) data - 1;
+
+    // copy-out completed before the slot is handed to a writer
+    rtapi_smp_mb();
+    rtapi_store_u32(&s->seq, s->seq + ring->header->size_mask);
+    _ring_wake_writers(ring);
+    return 0;
+}
+
+/* mpmc_read()
+ *
+ * copying read of the oldest record into buf, which holds up to
+ * bufsize bytes. The record's size is returned in 'size'.
+ *
+ * return 0 on success
+ * return EAGAIN if there is no committed record at the head
+ * return ERANGE if the record was larger than bufsize; it is
+ *        consumed and truncated to bufsize bytes.
+ */
+static inline int mpmc_read(ringbuffer_t *ring,
+			    void *buf,
+			    const ringsize_t bufsize,
+			    ringsize_t *size)
+{
+    const void *data;
+    int r = mpmc_read_begin(ring, &data, size);
+    if (r) return r;
+    memcpy(buf, data, (*size > bufsize) ? bufsize : *size);
+    mpmc_read_end(ring, data);
+    return (*size > bufsize) ? ERANGE : 0;
+}
+
+/* mpmc_flush()
+ *
+ * consume all committed records, return their number.
+ * may be used concurrently with other readers and writers.
+ */
+static inline int mpmc_flush(ringbuffer_t *ring)
+{
+    const void *data;
+    ringsize_t size;
+    int count = 0;
+
+    while (mpmc_read_begin(ring, &data, &size) == 0) {
+	mpmc_read_end(ring, data);
+	count++;
+    }
+    return count;
+}
+
+// true if a record is committed at the head (readers) or the slot
+// at the tail is free (writers); a concurrent claim also counts.
+static inline int mpmc_read_ready(const ringbuffer_t *ring)
+{
+    __u32 pos = rtapi_load_u32(&ring->header->head);
+    return (__s32) (rtapi_load_u32(&_mpmc_slot(ring, pos)->seq) - (pos + 1)) >= 0;
+}
+
+static inline int mpmc_write_ready(const ringbuffer_t *ring)
+{
+    __u32 pos = rtapi_load_u32(&ring->trailer->tail);
+    return (__s32) (rtapi_load_u32(&_mpmc_slot(ring, pos)->seq) - pos) >= 0;
+}
+
+/* blocking waits
+ *
+ * ring_wait_read():
+ *   wait until there is a record (record, multipart and MPMC rings) or
+ *   data (stream rings) to read.
+ *
+ * ring_wait_write():
+ *   wait until a record of 'size' bytes (record, multipart and MPMC
+ *   rings), or 'size' bytes (stream rings) can be written.
+ *
+ * with several readers or writers on an MPMC ring, a wakeup only means
+ * the operation was possible at that time - another thread may have
+ * gotten there first, so retry on EAGAIN.
+ *
+ * timeout_ms < 0 waits indefinitely, 0 just checks.
+ *
+ * return 0 if the ring is ready
+ * return ETIMEDOUT if the timeout expired
+ * return EINTR if interrupted by a signal
+ * return ERANGE if 'size' exceeds the ring size (ring_wait_write() only)
+ *
+ * these are blocking calls for userland threads; never use them in an
+ * RT thread.
+ */
+typedef int (*_ring_ready_t)(ringbuffer_t *ring, const ringsize_t size);
+
+static inline int _ring_read_ready(ringbuffer_t *ring, const ringsize_t size)
+{
+    if (ring_ismpmc(ring))
+	return mpmc_read_ready(ring) ? 0 : EAGAIN;
+    if (rtapi_load_u32(&ring->trailer->tail) ==
+	rtapi_load_u32(&ring->header->head))
+	return EAGAIN;
+    return 0;
+}
+
+static inline int _ring_write_ready(ringbuffer_t *ring, const ringsize_t size)
+{
+    void *data;
+
+    if (ring_isstream(ring)) {
+	if (size >= ring->header->size)
+	    return ERANGE;
+	return (stream_write_space(ring->header) >= size) ? 0 : EAGAIN;
+    }
+    if (ring_ismpmc(ring)) {
+	if (size > mpmc_record_max(ring->header))
+	    return ERANGE;
+	return mpmc_write_ready(ring) ? 0 : EAGAIN;
+    }
+    return record_write_begin(ring, &data, size);
+}
+
+static inline int _ring_wait(ringbuffer_t *ring,
+			     const ringsize_t size,
+			     _ring_ready_t ready,
+			     __u32 *waitable,
+			     __u32 *waiters,
+			     __u32 *seq,
+			     const int timeout_ms)
+{
+    struct timespec deadline, now, ts;
+    struct timespec *tsp;
+    int r, intr, armed = 0;
+    __u32 s;
+
+    if (!rtapi_load_u32(waitable)) {
+	// first waiter on this side: enable wakeups, see above
+	rtapi_store_u32(waitable, 1);
+	armed = 1;
+    }
+
+    if (timeout_ms > 0) {
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeout_ms / 1000;
+	deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L) {
+	    deadline.tv_sec++;
+	    deadline.tv_nsec -= 1000000000L;
+	}
+    }
+    while (1) {
+	s = rtapi_load_u32(seq);
+	if ((r = ready(ring, size)) != EAGAIN)
+	    return r;
+	if (timeout_ms == 0)
+	    return ETIMEDOUT;
+	if (timeout_ms > 0) {
+	    clock_gettime(CLOCK_MONOTONIC, &now);
+	    ts.tv_sec = deadline.tv_sec - now.tv_sec;
+	    ts.tv_nsec = deadline.tv_nsec - now.tv_nsec;
+	    if (ts.tv_nsec < 0) {
+		ts.tv_sec--;
+		ts.tv_nsec += 1000000000L;
+	    }
+	    if (ts.tv_sec < 0)
+		return ETIMEDOUT;
+	}
+	tsp = (timeout_ms < 0) ? NULL : &ts;
+	if (armed) {
+	    // the other side may not have seen 'waitable' yet
+	    armed = 0;
+	    if ((tsp == NULL) || (ts.tv_sec > 0) ||
+		(ts.tv_nsec > RING_WAIT_ARM_MS * 1000000L)) {
+		ts.tv_sec = 0;
+		ts.tv_nsec = RING_WAIT_ARM_MS * 1000000L;
+		tsp = &ts;
+	    }
+	}
+	// announce ourselves, then recheck: either the other side sees
+	// the waiter count after its index update, or we see the update.
+	rtapi_add_u32(waiters, 1);
+	rtapi_smp_mb();
+	intr = 0;
+	if (ready(ring, size) == EAGAIN)
+	    if (_ring_futex(seq, FUTEX_WAIT, s, tsp) && (errno == EINTR))
+		intr = 1;
+	rtapi_add_u32(waiters, (__u32) -1);
+	if (intr)
+	    return EINTR;
+    }
+}
+
+static inline int ring_wait_read(ringbuffer_t *ring, const int timeout_ms)
+{
+    return _ring_wait(ring, 0, _ring_read_ready,
+		      &ring->header->rwaitable,
+		      &ring->header->rwaiters,
+		      &ring->trailer->rseq, timeout_ms);
+}
+
+static inline int ring_wait_write(ringbuffer_t *ring,
+				  const ringsize_t size,
+				  const int timeout_ms)
+{
+    return _ring_wait(ring, size, _ring_write_ready,
+		      &ring->trailer->wwaitable,
+		      &ring->trailer->wwaiters,
+		      &ring->header->wseq, timeout_ms);
 }
 
 #endif // RING_H
@@ -878,6 +878,7 @@ static int rtapi_request(zloop_t *loop, zsock_t *socket, void *arg)
         args.cpu_id = pbreq.rtapicmd().cpu();
         args.flags = (rtapi_thread_flags_t) pbreq.rtapicmd().flags();
         strncpy(args.cgname, pbreq.rtapicmd().cgname().c_str(), RTAPI_LINELEN-1);
+        args.workers = pbreq.rtapicmd().workers();
 
         retval = create_thread(&args);
         if (retval < 0) {
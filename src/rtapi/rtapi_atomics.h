@@ -274,4 +274,17 @@ static inline int rtapi_cas_s32(hal_s32_t *target, hal_s32_t old_value, hal_s32_
 #define	rtapi_smp_rmb() __sync_synchronize()
 #endif  // !defined(HAVE_CK)
 
+// in busy-wait loops: eases the load on the memory bus, and lets a
+// sibling hyperthread run
+static inline void rtapi_cpu_relax(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__("pause" ::: "memory");
+#elif defined(__aarch64__) || (defined(__arm__) && (__ARM_ARCH >= 7))
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    __asm__ __volatile__("" ::: "memory");
+#endif
+}
+
 #endif // _RTAPI_ATOMICS_H
@@ -71,6 +71,23 @@
 #define MESSAGE_RING_SIZE (4096 * 128)
 #define GLOBAL_HEAP_SIZE  (4096 * 64)
 
+// interned format strings of deferred log messages.
+// an entry is claimed by a CAS of state from MSGFMT_FREE to MSGFMT_BUSY,
+// filled in and then published as MSGFMT_READY. Entries are never
+// released; the table lives as long as the instance.
+#define RTAPI_MSG_FORMATS    256   // power of 2
+#define RTAPI_MSG_FORMATLEN  120   // longer formats are not deferred
+#define RTAPI_MSG_PROBES     16    // linear probes before giving up
+
+enum msgfmt_state { MSGFMT_FREE, MSGFMT_BUSY, MSGFMT_READY };
+
+typedef struct {
+    __u32 state;                   // enum msgfmt_state
+    __s32 pid;                     // process the address refers to
+    __u64 addr;                    // address of the format in that process
+    char fmt[RTAPI_MSG_FORMATLEN];
+} rtapi_msgfmt_t;
+
 // the universally shared global structure
 typedef struct {
     unsigned magic;
@@ -121,6 +138,9 @@ typedef struct {
     // type = *ringheader_t
     int rtapi_messages_ptr;
 
+    // format strings of deferred log messages, see rtapi_msgargs_t
+    rtapi_msgfmt_t msg_format[RTAPI_MSG_FORMATS];
+
     // global heap
     struct rtapi_heap heap;
     //size_t heap_size;
@@ -131,7 +151,7 @@ typedef struct {
 
 extern global_data_t *global_data;
 
-#define GLOBAL_LAYOUT_VERSION 44   // bump on layout changes of global_data_t
+#define GLOBAL_LAYOUT_VERSION 49   // bump on layout changes of global_data_t
 
 // use global_data->magic to reflect rtapi_msgd state
 #define GLOBAL_INITIALIZING  0x0eadbeefU
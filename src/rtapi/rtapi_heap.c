@@ -82,6 +82,8 @@ void  *rtapi_malloc_aligned(struct rtapi_heap *h, size_t nbytes, size_t align)
 	return NULL;
     }
     void *base = _rtapig_malloc(0, h, nbytes + align);
+    if (base == NULL)
+	return NULL;
     void *result = (void *)((size_t)(base + align) & - align);
     size_t slack = result - base;
     if (slack < sizeof(rtapi_malloc_tag_t)) {
@@ -96,11 +98,14 @@ void  *rtapi_malloc_aligned(struct rtapi_heap *h, size_t nbytes, size_t align)
 
     size_t trim = (align-slack)/sizeof(rtapi_malloc_hdr_t);
 
-    if ((h->flags & RTAPIHEAP_TRIM) && (trim > 0)) {
+    rtapi_malloc_hdr_t *this = (rtapi_malloc_hdr_t *) base - 1;
+
+    // slab blocks have a fixed size, leave them alone
+    if ((h->flags & RTAPIHEAP_TRIM) && (trim > 0) &&
+	!(this->s.tag.attr & ATTR_SLAB)) {
 
 	// trim allignment overallocation:
 	// split the block into two allocations
-	rtapi_malloc_hdr_t *this = (rtapi_malloc_hdr_t *) base - 1;
 	rtapi_malloc_hdr_t *new = this + (this->s.tag.size - trim);
 
 	// splice in the new block adjusting sizes
@@ -122,13 +127,11 @@ void  *rtapi_malloc_aligned(struct rtapi_heap *h, size_t nbytes, size_t align)
 
 void rtapi_free(struct rtapi_heap *h, void *);
 
-static void *_rtapig_malloc(const int lock, struct rtapi_heap *h, size_t nbytes)
+// first fit from the arena free list. returns the block header,
+// or NULL if no block of nunits is left.
+static rtapi_malloc_hdr_t *first_fit(struct rtapi_heap *h, size_t nunits)
 {
-    WITH_MUTEX_IF(HEAP_MUTEX(h), lock);
-
     rtapi_malloc_hdr_t *p, *prevp;
-    size_t nunits  = (nbytes + sizeof(rtapi_malloc_hdr_t) - 1) /
-	sizeof(rtapi_malloc_hdr_t) + 1;
 
     // heaps are explicitly initialized, see rtapi_heap_init()
     // if ((prevp = h->freep) == NULL) {	// no free list yet
@@ -149,23 +152,113 @@ static void *_rtapig_malloc(const int lock, struct rtapi_heap *h, size_t nbytes)
 	    }
 	    p->s.tag.attr = 0;
 	    h->free_p = heap_off(h, prevp);
-	    size_t alloced = rtapi_allocsize(h, p+1);
-	    h->requested += nbytes;
-	    h->allocated += alloced;
-	    if (h->flags & RTAPIHEAP_TRACE_MALLOC)
-		heap_print(h, RTAPI_MSG_INFO, "malloc req=%zu actual=%zu at %p\n",
-			   nbytes, alloced, p);
-	    return (void *)(p+1);
+	    return p;
 	}
-	if (p == freep)	{	/* wrapped around free list */
-	    heap_print(h, RTAPI_MSG_INFO, "rtapi_malloc: out of memory"
-		       " (size=%zu arena=%zu)\n", nbytes, h->arena_size);
-	    //if ((p = morecore(nunits)) == NULL)
+	if (p == freep)		/* wrapped around free list */
 	    return NULL;	/* none left */
-	}
     }
 }
 
+// block sizes of the slab classes, in units including the header
+static const __u16 slab_units[RTAPI_HEAP_NCLASSES] = {
+    2, 3, 4, 5, 6, 7, 8, 10, 12, 14, 16, 20, 24, 32, 48, 64
+};
+
+// smallest class holding nunits, or -1 if too large for a slab
+static int slab_class(const size_t nunits)
+{
+    int c;
+
+    if (nunits > slab_units[RTAPI_HEAP_NCLASSES - 1])
+	return -1;
+    for (c = 0; slab_units[c] < nunits; c++)
+	;
+    return c;
+}
+
+// refill an empty class list with a chunk carved from the arena.
+// if a full chunk is not available, settle for fewer blocks.
+static int slab_carve(struct rtapi_heap *h, const int c)
+{
+    rtapi_slab_class_t *sc = &h->slab[c];
+    size_t units = slab_units[c];
+    size_t n = RTAPI_SLAB_CARVE / (units * sizeof(rtapi_malloc_hdr_t));
+    rtapi_malloc_hdr_t *chunk;
+
+    while ((chunk = first_fit(h, n * units)) == NULL) {
+	if (n == 1)
+	    return -ENOMEM;
+	n /= 2;
+    }
+    if (h->flags & RTAPIHEAP_TRACE_MALLOC)
+	heap_print(h, RTAPI_MSG_INFO, "slab: carved %zu blocks of %zu at %p\n",
+		   n, (units - 1) * sizeof(rtapi_malloc_hdr_t), chunk);
+
+    // link in address order
+    while (n--) {
+	rtapi_malloc_hdr_t *b = chunk + n * units;
+	b->s.tag.size = units;
+	b->s.tag.attr = ATTR_SLAB;
+	b->s.next = sc->free;
+	sc->free = heap_off(h, b);
+	sc->carved++;
+    }
+    return 0;
+}
+
+static rtapi_malloc_hdr_t *slab_get(struct rtapi_heap *h, const int c)
+{
+    rtapi_slab_class_t *sc = &h->slab[c];
+
+    if ((sc->free == 0) && slab_carve(h, c))
+	return NULL;
+    rtapi_malloc_hdr_t *p = heap_ptr(h, sc->free);
+    sc->free = p->s.next;
+    p->s.next = 0;
+    sc->inuse++;
+    if (sc->inuse > sc->hiwater)
+	sc->hiwater = sc->inuse;
+    return p;
+}
+
+static void slab_put(struct rtapi_heap *h, rtapi_malloc_hdr_t *bp)
+{
+    rtapi_slab_class_t *sc = &h->slab[slab_class(bp->s.tag.size)];
+
+    bp->s.next = sc->free;
+    sc->free = heap_off(h, bp);
+    sc->inuse--;
+}
+
+static void *_rtapig_malloc(const int lock, struct rtapi_heap *h, size_t nbytes)
+{
+    WITH_MUTEX_IF(HEAP_MUTEX(h), lock);
+
+    rtapi_malloc_hdr_t *p = NULL;
+    size_t nunits  = (nbytes + sizeof(rtapi_malloc_hdr_t) - 1) /
+	sizeof(rtapi_malloc_hdr_t) + 1;
+    int c = (h->flags & RTAPIHEAP_NOSLAB) ? -1 : slab_class(nunits);
+
+    if (c >= 0)
+	p = slab_get(h, c);
+    if (p == NULL)
+	// too large for a slab, or no block of the class could be carved:
+	// the arena may still hold the smaller exact size
+	p = first_fit(h, nunits);
+    if (p == NULL) {
+	heap_print(h, RTAPI_MSG_INFO, "rtapi_malloc: out of memory"
+		   " (size=%zu arena=%zu)\n", nbytes, h->arena_size);
+	return NULL;
+    }
+    size_t alloced = rtapi_allocsize(h, p+1);
+    h->requested += nbytes;
+    h->allocated += alloced;
+    if (h->flags & RTAPIHEAP_TRACE_MALLOC)
+	heap_print(h, RTAPI_MSG_INFO, "malloc req=%zu actual=%zu at %p%s\n",
+		   nbytes, alloced, p, c >= 0 ? " (slab)" : "");
+    return (void *)(p+1);
+}
+
 static void _rtapi_unlocked_free(struct rtapi_heap *h, void *ap)
 {
     rtapi_malloc_hdr_t *bp, *p;
@@ -188,6 +281,16 @@ static void _rtapi_unlocked_free(struct rtapi_heap *h, void *ap)
     bp = (rtapi_malloc_hdr_t *)ap - 1;	// point to block header
     size_t alloc = bp->s.tag.size;
 
+    if (bp->s.tag.attr & ATTR_SLAB) {
+	// back onto its class list, never coalesced
+	if (h->flags & RTAPIHEAP_TRACE_FREE)
+	    heap_print(h, RTAPI_MSG_INFO, "%s: slab block n=%zu\n",
+		       __FUNCTION__, alloc);
+	h->freed += sizeof(rtapi_malloc_hdr_t) * (alloc - 1);
+	slab_put(h, bp);
+	return;
+    }
+
     for (p = freep;
 	 !(bp > p && bp < (rtapi_malloc_hdr_t *)heap_ptr(h,p->s.next));
 	 p = heap_ptr(h,p->s.next))
@@ -327,6 +430,7 @@ int rtapi_heap_init(struct rtapi_heap *heap, const char *name)
     heap->requested = 0;
     heap->allocated = 0;
     heap->freed = 0;
+    memset(heap->slab, 0, sizeof(heap->slab));
     if (name)
 	strncpy(heap->name, name, sizeof(heap->name));
     else {
@@ -358,6 +462,20 @@ size_t rtapi_heap_status(struct rtapi_heap *h,
     hs->total_avail = 0;
     hs->fragments = 0;
     hs->largest = 0;
+    hs->slab_carved = 0;
+    hs->slab_avail = 0;
+
+    int c;
+    for (c = 0; c < RTAPI_HEAP_NCLASSES; c++) {
+	rtapi_slab_class_t *sc = &h->slab[c];
+	struct rtapi_slab_stat *ss = &hs->slab[c];
+	ss->size = (slab_units[c] - 1) * sizeof(rtapi_malloc_hdr_t);
+	ss->carved = sc->carved;
+	ss->inuse = sc->inuse;
+	ss->hiwater = sc->hiwater;
+	hs->slab_carved += sc->carved * slab_units[c] * sizeof(rtapi_malloc_hdr_t);
+	hs->slab_avail += (sc->carved - sc->inuse) * ss->size;
+    }
 
     rtapi_malloc_hdr_t *p, *prevp, *freep = heap_ptr(h, h->free_p);
     prevp = freep;
@@ -20,6 +20,17 @@ RTAPI_BEGIN_DECLS
 #define RTAPIHEAP_TRACE_MALLOC RTAPI_BIT(0)
 #define RTAPIHEAP_TRACE_FREE   RTAPI_BIT(1)
 #define RTAPIHEAP_TRIM         RTAPI_BIT(2)  //  free alignment overallocations
+#define RTAPIHEAP_NOSLAB       RTAPI_BIT(3)  //  serve all requests first-fit
+
+// number of size classes served from slabs
+#define RTAPI_HEAP_NCLASSES 16
+
+struct rtapi_slab_stat {
+    size_t size;      // usable bytes per block
+    size_t carved;    // blocks carved
+    size_t inuse;     // blocks allocated
+    size_t hiwater;   // max blocks allocated
+};
 
 struct rtapi_heap;
 struct rtapi_heap_stat {
@@ -30,6 +41,9 @@ struct rtapi_heap_stat {
     size_t requested;
     size_t allocated;
     size_t freed;
+    size_t slab_carved;  // bytes carved into size class blocks
+    size_t slab_avail;   // bytes of free size class blocks
+    struct rtapi_slab_stat slab[RTAPI_HEAP_NCLASSES];
 };
 
 void  *_rtapi_malloc_aligned(struct rtapi_heap *h, size_t nbytes, size_t align);
@@ -23,6 +23,7 @@
 #endif
 
 #define ATTR_ALIGNED 1
+#define ATTR_SLAB    2  // block belongs to a size class, see below
 
 
 typedef struct rtapi_malloc_align {
@@ -48,6 +49,24 @@ union rtapi_malloc_header {
 
 typedef union rtapi_malloc_header rtapi_malloc_hdr_t;
 
+// size class slabs:
+// small requests are rounded up to one of RTAPI_HEAP_NCLASSES block sizes
+// (in units of rtapi_malloc_hdr_t, header included) and served from a
+// per-class free list. Blocks for a class are carved in bulk from the
+// first-fit arena, about RTAPI_SLAB_CARVE bytes at a time, and are never
+// returned to it - a freed block goes back onto its class list. This keeps
+// churn in descriptors and names from fragmenting the arena, and makes
+// malloc/free of small sizes O(1). If not even one block of a class can be
+// carved, the request is served first-fit at its exact size instead.
+#define RTAPI_SLAB_CARVE 2048
+
+typedef struct rtapi_slab_class {
+    __u32 free;     // heap offset of first free block, 0: empty
+    __u32 carved;   // blocks carved for this class
+    __u32 inuse;    // blocks currently allocated
+    __u32 hiwater;  // max inuse seen
+} rtapi_slab_class_t;
+
 struct rtapi_heap {
     rtapi_malloc_hdr_t base;
     size_t free_p;
@@ -58,6 +77,7 @@ struct rtapi_heap {
     size_t allocated;
     int freed;
     char name[16];
+    rtapi_slab_class_t slab[RTAPI_HEAP_NCLASSES];
 };
 
 static inline void *heap_ptr(struct rtapi_heap *base, size_t offset) {
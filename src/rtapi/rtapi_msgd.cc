@@ -53,6 +53,9 @@
 #include <mk-inifile.h>
 #include <sys/prctl.h>
 #include <sys/resource.h>
+#include <sys/eventfd.h>
+#include <pthread.h>
+#include <semaphore.h>
 
 #include <rtapi.h>
 #include <shmdrv.h>
@@ -149,23 +152,22 @@ static int full, locked;
 static size_t max_msgs, max_bytes; // stats
 static int _msgderrno;
 
-// messages tend to come bunched together, e.g during startup and shutdown
-// poll faster if a message was read, and decay the poll timer up to msg_poll_max
-// if no messages are pending
-// this way we retrieve bunched messages fast without much overhead in idle times
-static int msg_poll_max = 200; // maximum msgq checking interval, mS
-
-#ifdef FASTLOG
-static int msg_poll_min = 5;  // minimum msgq checking interval
-static int msg_poll_inc = 1;  // increment interval if no message read up to msg_poll_max
-static int msg_poll =     10;  // current delay; startup fast
-#else
-static int msg_poll_min = 10;  // minimum msgq checking interval
-static int msg_poll_inc = 5;  // increment interval if no message read up to msg_poll_max
-static int msg_poll =     10;  // current delay; startup fast
-#endif
-
-static int polltimer_id;      // as returned by zloop_timer()
+// message ring wakeup:
+// a helper thread sleeps in ring_wait_read() on the message ring, and
+// writers wake it through the ring futex without blocking. The thread
+// signals the reactor through an eventfd, then waits until the reactor
+// has drained the ring, so each wakeup is handled as one batch.
+// When idle, the thread wakes up every msg_idle_wakeup mS anyway so
+// the reactor can check for rtapi_app exit.
+static int msg_idle_wakeup = 200;
+static int msg_wakeup_fd = -1;
+static sem_t msg_drained;
+static pthread_t msg_waiter;
+static volatile int msg_waiter_run;
+
+// end-to-end latency of log messages, from the writer's timestamp
+// to publication by msgd
+static __u64 latency_max, latency_sum, latency_count; // nsec
 static int shutdowntimer_id;
 
 // zeroMQ related
@@ -513,6 +515,10 @@ cleanup_actions(void)
     syslog_async(LOG_DEBUG,"log buffer hwm: %zu% (%zu msgs, %zu bytes out of %d)",
 		 (max_ringmem*100)/MESSAGE_RING_SIZE,
 		 max_msgs, max_ringmem, MESSAGE_RING_SIZE);
+    if (latency_count)
+	syslog_async(LOG_DEBUG,"log latency: avg %.3f mS, max %.3f mS (%llu msgs)",
+		     latency_sum / 1e6 / latency_count, latency_max / 1e6,
+		     (unsigned long long) latency_count);
 
     if (global_data) {
 	if (global_data->rtapi_app_pid > 0) {
@@ -555,17 +561,17 @@ s_start_shutdown_cb(zloop_t *loop, int  timer_id, void *args)
     return -1; // exit reactor
 }
 
-static int
-message_poll_cb(zloop_t *loop, int  timer_id, void *args)
+// publish all pending messages
+static void
+process_messages(zloop_t *loop)
 {
     rtapi_msgheader_t *msg;
     size_t payload_length;
     int retval;
-    char *cp;
+    char msgbuf[RTAPI_MSG_TEXTLEN];
     machinetalk::Container container;
     machinetalk::LogMessage *logmsg;
     zframe_t *z_pbframe;
-    int current_interval = msg_poll;
 
     if (global_data->error_ring_full > full) {
 	syslog_async(LOG_ERR, "msgd:%d: message ring overrun (full): %d messages lost",
@@ -583,33 +589,42 @@ message_poll_cb(zloop_t *loop, int  timer_id, void *args)
 
     while ((retval = record_read(&rtapi_msg_buffer,
 				 (const void **) &msg, &msg_size)) == 0) {
-	payload_length = msg_size - sizeof(rtapi_msgheader_t);
 	n_msgs++;
 	n_bytes += msg_size;
 
+	char *text = msg->buf;
+
+	if (msg->encoding == MSG_DEFERRED) {
+	    // logged from RT without formatting, do that now
+	    text = msgbuf;
+	    if (rtapi_msg_format(msgbuf, sizeof(msgbuf), msg, msg_size) < 0)
+		snprintf(msgbuf, sizeof(msgbuf),
+			 "<invalid deferred message, size %zu>",
+			 (size_t) msg_size);
+	}
+	payload_length = strlen(text);
+
 	// strip trailing newlines
-	while ((cp = strrchr(msg->buf,'\n')))
-	    *cp = '\0';
+	while (payload_length && (text[payload_length - 1] == '\n'))
+	    text[--payload_length] = '\0';
 	syslog_async(rtapi2syslog(msg->level), "%s:%d:%s %.*s",
 		     msg->tag, msg->pid, origins[msg->origin],
-		     (int) payload_length, msg->buf);
+		     (int) payload_length, text);
 
 
 	if (logpub.socket) {
 	    // publish protobuf-encoded log message
 	    container.set_type(machinetalk::MT_LOG_MESSAGE);
-
-	    struct timespec timestamp;
-	    clock_gettime(CLOCK_REALTIME, &timestamp);
-	    container.set_tv_sec(timestamp.tv_sec);
-	    container.set_tv_nsec(timestamp.tv_nsec);
+	    // time of logging, not of publication
+	    container.set_tv_sec(msg->timestamp / 1000000000ULL);
+	    container.set_tv_nsec(msg->timestamp % 1000000000ULL);
 
 	    logmsg = container.mutable_log_message();
 	    logmsg->set_origin((machinetalk::MsgOrigin)msg->origin);
 	    logmsg->set_pid(msg->pid);
 	    logmsg->set_level((machinetalk::MsgLevel) msg->level);
 	    logmsg->set_tag(msg->tag);
-	    logmsg->set_text(msg->buf, strlen(msg->buf));
+	    logmsg->set_text(text, payload_length);
 
 /* Needed for supporting older versions of Google Protobuf available
  * in Debian Stretch and Ubuntu Bionic */
@@ -635,13 +650,19 @@ message_poll_cb(zloop_t *loop, int  timer_id, void *args)
 		syslog_async(LOG_ERR, "container serialization failed");
 	    }
 	}
+	// msgd runs on the same host, so CLOCK_REALTIME compares
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	__u64 published = now.tv_sec * 1000000000ULL + now.tv_nsec;
+	if (published >= msg->timestamp) {
+	    __u64 latency = published - msg->timestamp;
+	    if (latency > latency_max)
+		latency_max = latency;
+	    latency_sum += latency;
+	    latency_count++;
+	}
 	record_shift(&rtapi_msg_buffer);
-	msg_poll = msg_poll_min; // keep going quick
     }
-    // done - decay the timer
-    msg_poll += msg_poll_inc;
-    if (msg_poll > msg_poll_max)
-	msg_poll = msg_poll_max;
 
     // update stats
     if (n_msgs > max_msgs)
@@ -649,11 +670,6 @@ message_poll_cb(zloop_t *loop, int  timer_id, void *args)
     if (n_bytes > max_bytes)
 	max_bytes = n_bytes;
 
-    if (current_interval != msg_poll) {
-	zloop_timer_end(loop, polltimer_id);
-	polltimer_id = zloop_timer (loop, current_interval, 0, message_poll_cb, NULL);
-    }
-
     // check for rtapi_app exit only after all pending messages are logged:
     if ((global_data->rtapi_app_pid == 0) &&
 	(shutdowntimer_id ==  0)) {
@@ -663,9 +679,74 @@ message_poll_cb(zloop_t *loop, int  timer_id, void *args)
 	shutdowntimer_id = zloop_timer (loop, GRACE_PERIOD, 1,
 					s_start_shutdown_cb, NULL);
     }
+}
+
+static void *
+msg_waiter_thread(void *arg)
+{
+    uint64_t one = 1;
+
+    while (msg_waiter_run) {
+	// a timeout or interruption is passed on just like a message,
+	// the reactor does its housekeeping either way
+	ring_wait_read(&rtapi_msg_buffer, msg_idle_wakeup);
+	if (write(msg_wakeup_fd, &one, sizeof(one)) < 0)
+	    syslog_async(LOG_ERR, "msgd: eventfd write: %s", strerror(errno));
+	while (sem_wait(&msg_drained) && (errno == EINTR))
+	    ;
+    }
+    return NULL;
+}
+
+static int
+message_wakeup_cb(zloop_t *loop, zmq_pollitem_t *poller, void *arg)
+{
+    uint64_t n;
+
+    if (read(poller->fd, &n, sizeof(n)) < 0)
+	syslog_async(LOG_ERR, "msgd: eventfd read: %s", strerror(errno));
+    process_messages(loop);
+    sem_post(&msg_drained);
     return 0;
 }
 
+static int
+start_msg_waiter(zloop_t *loop)
+{
+    int retval;
+
+    if ((msg_wakeup_fd = eventfd(0, EFD_CLOEXEC)) < 0) {
+	syslog_async(LOG_ERR, "msgd: eventfd(): %s", strerror(errno));
+	return -1;
+    }
+    sem_init(&msg_drained, 0, 0);
+    zmq_pollitem_t wakeup_poller =  { 0, msg_wakeup_fd, ZMQ_POLLIN };
+    zloop_poller(loop, &wakeup_poller, message_wakeup_cb, NULL);
+
+    // signals are handled through signal_fd by the reactor; the
+    // thread inherits the signal mask set up by setup_signals()
+    msg_waiter_run = 1;
+    if ((retval = pthread_create(&msg_waiter, NULL, msg_waiter_thread, NULL))) {
+	syslog_async(LOG_ERR, "msgd: pthread_create(): %s", strerror(retval));
+	msg_waiter_run = 0;
+	return -1;
+    }
+    return 0;
+}
+
+static void
+stop_msg_waiter(void)
+{
+    if (!msg_waiter_run)
+	return;
+    // the thread either waits for the reactor, or will
+    // after its ring_wait_read() times out
+    msg_waiter_run = 0;
+    sem_post(&msg_drained);
+    pthread_join(msg_waiter, NULL);
+    close(msg_wakeup_fd);
+}
+
 
 static struct option long_options[] = {
     { "help",  no_argument,          0, 'h'},
@@ -976,7 +1057,8 @@ int main(int argc, char **argv)
         zloop_reader (netopts.z_loop, logpub.socket, logpub_readable_cb, NULL);
     }
 
-    polltimer_id = zloop_timer (netopts.z_loop, msg_poll, 0, message_poll_cb, NULL);
+    if (start_msg_waiter(netopts.z_loop))
+	return -1;
     global_data->rtapi_msgd_pid = getpid();
     global_data->magic = GLOBAL_READY;
 
@@ -984,6 +1066,8 @@ int main(int argc, char **argv)
 	retval = zloop_start(netopts.z_loop);
     } while (!(retval || zsys_interrupted));
 
+    stop_msg_waiter();
+
     // stop the service announcement
     mk_withdraw(&logpub);
 
@@ -38,7 +38,9 @@
 #define RTPRINTBUFFERLEN 256
 
 #include <stdio.h>		/* libc's vsnprintf() */
-#include <stdlib.h>		/* malloc(), free() */
+#include <stdint.h>		/* uintptr_t */
+#include <string.h>
+#include <time.h>		/* clock_gettime() */
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -64,6 +66,366 @@ ringbuffer_t rtapi_message_buffer;   // rtapi_message ring access strcuture
 static char logtag[TAGSIZE];
 static const char *origins[] = { "kernel", "rt", "user", "*invalid*" };
 
+// argument classes of a conversion, see msg_conversion()
+enum { MA_NONE, MA_INT, MA_LONG, MA_LLONG, MA_DOUBLE,
+       MA_STRING, MA_PTR, MA_BAD };
+
+// parse the conversion spec following a '%'. Returns a pointer past it,
+// the class of its argument in *cls, and the number of '*' width and
+// precision arguments preceding that argument in *stars. *prec is the
+// precision: -1 if none, -2 if given by the last '*' argument.
+static const char *msg_conversion(const char *p, int *cls, int *stars,
+				  int *prec)
+{
+    int len = 0; // 0: int, 1: long, 2: long long, 3: long double
+
+    *stars = 0;
+    *prec = -1;
+    while (*p && strchr("-+ #0'", *p))
+	p++;
+    if (*p == '*') {
+	(*stars)++;
+	p++;
+    } else {
+	while (*p >= '0' && *p <= '9')
+	    p++;
+    }
+    if (*p == '.') {
+	p++;
+	if (*p == '*') {
+	    (*stars)++;
+	    *prec = -2;
+	    p++;
+	} else {
+	    *prec = 0;
+	    while (*p >= '0' && *p <= '9') {
+		if (*prec < RTAPI_MSG_MAXSTR)
+		    *prec = *prec * 10 + (*p - '0');
+		p++;
+	    }
+	}
+    }
+    for (;; p++) {
+	if (*p == 'h')
+	    continue;
+	else if (*p == 'l')
+	    len++;
+	else if ((*p == 'q') || (*p == 'j'))
+	    len = 2;
+	else if ((*p == 'z') || (*p == 't'))
+	    len = 1; // size_t and ptrdiff_t are long-sized on Linux
+	else if (*p == 'L')
+	    len = 3;
+	else
+	    break;
+    }
+    switch (*p) {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+	*cls = (len == 0) ? MA_INT : (len == 1) ? MA_LONG :
+	    (len == 2) ? MA_LLONG : MA_BAD;
+	break;
+    case 'e': case 'E': case 'f': case 'F':
+    case 'g': case 'G': case 'a': case 'A':
+	*cls = (len == 3) ? MA_BAD : MA_DOUBLE;
+	break;
+    case 's':
+	*cls = (len == 0) ? MA_STRING : MA_BAD;
+	break;
+    case 'p':
+	*cls = MA_PTR;
+	break;
+    case '%':
+	*cls = MA_NONE;
+	break;
+    default: // %n, %m, wide strings, truncated spec
+	*cls = MA_BAD;
+	return p;
+    }
+    return p + 1;
+}
+
+// reserve a record in the message ring and timestamp it
+static int msg_write_begin(rtapi_msgheader_t **msg, const size_t size)
+{
+    ringheader_t *header = rtapi_message_buffer.header;
+    struct timespec ts;
+    int retval;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    if (header->use_wmutex && rtapi_mutex_try(&header->wmutex)) {
+	global_data->error_ring_locked++;
+	return -EBUSY;
+    }
+    retval = record_write_begin(&rtapi_message_buffer, (void **) msg, size);
+    if (retval) {
+	if (header->use_wmutex)
+	    rtapi_mutex_give(&header->wmutex);
+	if (retval == EAGAIN)
+	    global_data->error_ring_full++;
+	return -retval;
+    }
+    (*msg)->timestamp = ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    return 0;
+}
+
+static void msg_write_end(rtapi_msgheader_t *msg, const size_t size)
+{
+    record_write_end(&rtapi_message_buffer, msg, size);
+    if (rtapi_message_buffer.header->use_wmutex)
+	rtapi_mutex_give(&rtapi_message_buffer.header->wmutex);
+}
+
+// find or intern a format string, returning its index
+// in global_data->msg_format[], or -1 if it cannot be interned.
+static int msg_format_id(const char *format, const pid_t pid)
+{
+    const __u64 addr = (uintptr_t) format;
+    const size_t len = strnlen(format, RTAPI_MSG_FORMATLEN);
+    unsigned hash = ((addr >> 3) * 2654435761U) ^ pid;
+    int i;
+
+    if (len >= RTAPI_MSG_FORMATLEN)
+	return -1;
+    for (i = 0; i < RTAPI_MSG_PROBES; i++) {
+	int id = (hash + i) & (RTAPI_MSG_FORMATS - 1);
+	rtapi_msgfmt_t *f = &global_data->msg_format[id];
+
+	switch (rtapi_load_u32(&f->state)) {
+	case MSGFMT_FREE:
+	    if (!rtapi_cas_u32(&f->state, MSGFMT_FREE, MSGFMT_BUSY)) {
+		i--; // lost the race, look at this entry again
+		continue;
+	    }
+	    f->pid = pid;
+	    f->addr = addr;
+	    memcpy(f->fmt, format, len + 1);
+	    rtapi_smp_wmb();
+	    rtapi_store_u32(&f->state, MSGFMT_READY);
+	    return id;
+
+	case MSGFMT_READY:
+	    // the text is compared too since a module might have been
+	    // replaced by another one using the same address
+	    if ((f->pid == pid) && (f->addr == addr) &&
+		!strcmp(f->fmt, format))
+		return id;
+	    break;
+
+	default:
+	    // being interned, possibly the same format -
+	    // a duplicate entry is harmless
+	    break;
+	}
+    }
+    return -1;
+}
+
+// log without formatting: capture the argument words and strings and
+// write them along with the interned format id.
+// returns -ENOTSUP if the message must be formatted by the caller.
+static int ringlog_deferred(const msg_level_t level,
+			    const pid_t pid,
+			    const msg_origin_t origin,
+			    const char *tag,
+			    const char *format,
+			    va_list ap)
+{
+    __u64 arg[RTAPI_MSG_MAXARGS];
+    char str[RTAPI_MSG_MAXSTR];
+    int i, cls, stars, prec, id, nargs = 0, slen = 0, retval;
+    const char *p = format;
+    rtapi_msgheader_t *msg;
+    rtapi_msgargs_t *ma;
+
+    while ((p = strchr(p, '%')) != NULL) {
+	p = msg_conversion(p + 1, &cls, &stars, &prec);
+	if ((cls == MA_BAD) || (nargs + stars + 1 > RTAPI_MSG_MAXARGS))
+	    return -ENOTSUP;
+	for (i = 0; i < stars; i++)
+	    arg[nargs++] = (__s64) va_arg(ap, int);
+
+	switch (cls) {
+	case MA_INT:
+	    arg[nargs++] = (__s64) va_arg(ap, int);
+	    break;
+	case MA_LONG:
+	    arg[nargs++] = (__s64) va_arg(ap, long);
+	    break;
+	case MA_LLONG:
+	    arg[nargs++] = (__s64) va_arg(ap, long long);
+	    break;
+	case MA_PTR:
+	    arg[nargs++] = (uintptr_t) va_arg(ap, void *);
+	    break;
+	case MA_DOUBLE: {
+	    double d = va_arg(ap, double);
+	    memcpy(&arg[nargs++], &d, sizeof(d));
+	    break;
+	}
+	case MA_STRING: {
+	    const char *s = va_arg(ap, const char *);
+	    size_t room = RTAPI_MSG_MAXSTR - slen, n;
+
+	    // a precision bounds the read: the string need not be
+	    // terminated within it
+	    if (prec == -2)
+		prec = (int) arg[nargs - 1]; // negative: no precision
+	    if (s == NULL)
+		s = "(null)";
+	    if ((prec >= 0) && ((size_t) prec < room))
+		n = strnlen(s, prec);
+	    else if ((n = strnlen(s, room)) == room)
+		return -ENOTSUP;
+	    memcpy(str + slen, s, n);
+	    str[slen + n] = '\0';
+	    arg[nargs++] = slen;
+	    slen += n + 1;
+	    break;
+	}
+	default: // MA_NONE
+	    break;
+	}
+    }
+    if ((id = msg_format_id(format, pid)) < 0)
+	return -ENOTSUP;
+
+    size_t msg_size = sizeof(rtapi_msgheader_t) + sizeof(rtapi_msgargs_t) +
+	nargs * sizeof(__u64) + slen;
+    if ((retval = msg_write_begin(&msg, msg_size)))
+	return retval;
+
+    msg->origin = origin;
+    msg->pid = pid;
+    msg->level = level;
+    msg->encoding = MSG_DEFERRED;
+    strncpy(msg->tag, tag, sizeof(msg->tag));
+    ma = (rtapi_msgargs_t *) msg->buf;
+    ma->fmt_id = id;
+    ma->nargs = nargs;
+    memcpy(ma->arg, arg, nargs * sizeof(__u64));
+    memcpy(&ma->arg[nargs], str, slen);
+
+    msg_write_end(msg, msg_size);
+    return 0;
+}
+
+// format one conversion, passing the '*' arguments if any
+#define MSG_EMIT(value)							\
+    ((stars == 0) ? snprintf(buf + n, size - n, spec, value) :		\
+     (stars == 1) ? snprintf(buf + n, size - n, spec, w[0], value) :	\
+     snprintf(buf + n, size - n, spec, w[0], w[1], value))
+
+int rtapi_msg_format(char *buf, const size_t size,
+		     const rtapi_msgheader_t *msg, const size_t msg_size)
+{
+    const rtapi_msgargs_t *ma = (const rtapi_msgargs_t *) msg->buf;
+    const size_t hdr_size = sizeof(rtapi_msgheader_t) + sizeof(rtapi_msgargs_t);
+    const rtapi_msgfmt_t *f;
+    const char *p, *q, *str;
+    char spec[RTAPI_MSG_FORMATLEN];
+    size_t slen, n = 0;
+    int i, cls, stars, prec, w[2], a = 0;
+    double d;
+
+    if (size == 0)
+	return -EINVAL;
+    buf[0] = '\0';
+    if ((msg_size < hdr_size) ||
+	(ma->fmt_id >= RTAPI_MSG_FORMATS) ||
+	(ma->nargs > RTAPI_MSG_MAXARGS) ||
+	(msg_size < hdr_size + ma->nargs * sizeof(__u64)))
+	return -EINVAL;
+
+    f = &global_data->msg_format[ma->fmt_id];
+    if (rtapi_load_u32(&f->state) != MSGFMT_READY)
+	return -EINVAL;
+    rtapi_smp_rmb();
+
+    str = (const char *) &ma->arg[ma->nargs];
+    slen = msg_size - hdr_size - ma->nargs * sizeof(__u64);
+    if (slen && str[slen - 1])
+	return -EINVAL;
+
+    for (p = f->fmt; *p && (n < size - 1); p = q) {
+	if (*p != '%') {
+	    q = strchrnul(p, '%');
+	    size_t len = q - p;
+	    if (len > size - 1 - n)
+		len = size - 1 - n;
+	    memcpy(buf + n, p, len);
+	    n += len;
+	    buf[n] = '\0';
+	    continue;
+	}
+	q = msg_conversion(p + 1, &cls, &stars, &prec);
+	if ((cls == MA_BAD) ||
+	    (a + stars + (cls != MA_NONE) > ma->nargs))
+	    return -EINVAL;
+	memcpy(spec, p, q - p);
+	spec[q - p] = '\0';
+	for (i = 0; i < stars; i++)
+	    w[i] = (int) ma->arg[a++];
+
+	switch (cls) {
+	case MA_NONE:
+	    i = snprintf(buf + n, size - n, "%%");
+	    break;
+	case MA_INT:
+	    i = MSG_EMIT((int) ma->arg[a]);
+	    break;
+	case MA_LONG:
+	    i = MSG_EMIT((long) ma->arg[a]);
+	    break;
+	case MA_LLONG:
+	    i = MSG_EMIT((long long) ma->arg[a]);
+	    break;
+	case MA_PTR:
+	    i = MSG_EMIT((void *)(uintptr_t) ma->arg[a]);
+	    break;
+	case MA_DOUBLE:
+	    memcpy(&d, &ma->arg[a], sizeof(d));
+	    i = MSG_EMIT(d);
+	    break;
+	case MA_STRING:
+	    if (ma->arg[a] >= slen)
+		return -EINVAL;
+	    i = MSG_EMIT(str + ma->arg[a]);
+	    break;
+	default:
+	    i = 0;
+	}
+	if (cls != MA_NONE)
+	    a++;
+	if (i > 0)
+	    n += i;
+    }
+    return (n < size) ? n : size - 1;
+}
+
+static int ringlog_text(const msg_level_t level,
+			const pid_t pid,
+			const msg_origin_t origin,
+			const char *tag,
+			const char *text,
+			const int n)
+{
+    rtapi_msgheader_t *msg;
+    size_t msg_size = sizeof(rtapi_msgheader_t) + n + 1; // +1:  final \0
+    int retval;
+
+    // formatted beforehand to keep the critical section short
+    if ((retval = msg_write_begin(&msg, msg_size)))
+	return retval;
+    msg->origin = origin;
+    msg->pid = pid;
+    msg->level = level;
+    msg->encoding = MSG_TEXT;
+    strncpy(msg->tag, tag, sizeof(msg->tag));
+    memcpy(msg->buf, text, n + 1);
+    msg_write_end(msg, msg_size);
+    return n;
+}
+
 int vs_ringlogfv(const msg_level_t level,
 		 const pid_t pid,
 		 const msg_origin_t origin,
@@ -72,7 +434,6 @@ int vs_ringlogfv(const msg_level_t level,
 		 va_list ap)
 {
     int n;
-    rtapi_msgheader_t* msg;
     char msgbuf[RTPRINTBUFFERLEN];
 
     if (get_msg_level() == RTAPI_MSG_NONE)
@@ -80,60 +441,51 @@ int vs_ringlogfv(const msg_level_t level,
     if (level > get_msg_level())
 	return 0;
 
-    n = vsnprintf(msgbuf, RTPRINTBUFFERLEN, format, ap);
-
     if (rtapi_message_buffer.header != NULL) {
-
-        size_t msg_size = sizeof(rtapi_msgheader_t) + n + 1; // +1:  final \0
-        msg = malloc(msg_size);
-        msg->origin = origin;
-        msg->pid = pid;
-        msg->level = level;
-        strncpy(msg->tag, tag, sizeof(msg->tag));
-        strncpy(msg->buf, msgbuf, n + 1);
-
-	if (rtapi_message_buffer.header->use_wmutex &&
-	    rtapi_mutex_try(&rtapi_message_buffer.header->wmutex)) {
-	    global_data->error_ring_locked++;
-            free(msg);
-	    return -EBUSY;
+	// RT code runs in rtapi_app: leave the formatting to rtapi_msgd
+	if (pid == global_data->rtapi_app_pid) {
+	    va_list aq;
+	    va_copy(aq, ap);
+	    n = ringlog_deferred(level, pid, origin, tag, format, aq);
+	    va_end(aq);
+	    if (n != -ENOTSUP) // logged, or failed: nothing formatted here
+		return n;
 	}
-	// use copying writer to shorten criticial section
-	record_write(&rtapi_message_buffer, (void *) msg, msg_size);
-	if (rtapi_message_buffer.header->use_wmutex)
-	    rtapi_mutex_give(&rtapi_message_buffer.header->wmutex);
+	n = vsnprintf(msgbuf, RTPRINTBUFFERLEN, format, ap);
+	if (n >= RTPRINTBUFFERLEN)
+	    n = RTPRINTBUFFERLEN - 1;
+	return ringlog_text(level, pid, origin, tag, msgbuf, n);
+    }
 
-        free(msg);
-    } else {
-	// early startup, global_data & log ring not yet initialized
-	// log the message to both stderr and syslog
+    // early startup, global_data & log ring not yet initialized
+    // log the message to both stderr and syslog
+    n = vsnprintf(msgbuf, RTPRINTBUFFERLEN, format, ap);
 
-	static int log_opened;
+    static int log_opened;
+    if (!log_opened) {
+	log_opened = async_log_open();
 	if (!log_opened) {
-	    log_opened = async_log_open();
-	    if (!log_opened) {
-		openlog_async("startup", LOG_NDELAY , SYSLOG_FACILITY);
-		log_opened = 1;
-	    }
+	    openlog_async("startup", LOG_NDELAY , SYSLOG_FACILITY);
+	    log_opened = 1;
 	}
-
-	if (!strchr(msgbuf, '\n'))
-	    strcat(msgbuf,"\n");
-	fprintf(stderr,
-	       "%d:%s:%d:%s %s",
-	       level,
-	       tag,
-	       pid,
-	       origins[origin & 3],
-	       msgbuf);
-        syslog_async(rtapi2syslog(level),
-	       "%d:%s:%d:%s %s",
-	       level,
-	       tag,
-	       pid,
-	       origins[origin & 3],
-	       msgbuf);
     }
+
+    if (!strchr(msgbuf, '\n'))
+	strcat(msgbuf,"\n");
+    fprintf(stderr,
+	    "%d:%s:%d:%s %s",
+	    level,
+	    tag,
+	    pid,
+	    origins[origin & 3],
+	    msgbuf);
+    syslog_async(rtapi2syslog(level),
+		 "%d:%s:%d:%s %s",
+		 level,
+		 tag,
+		 pid,
+		 origins[origin & 3],
+		 msgbuf);
     return n;
 }
 
@@ -0,0 +1,272 @@
+#include "rtapi.h"
+#include "rtapi_heap.h"
+#include "rtapi_heap_private.h"
+#include <setjmp.h>
+#include <cmocka.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Set this to print verbose debug messages
+int debug_tests = 0;
+#define DEBUG(args...)                                         \
+    do { if (debug_tests) fprintf(stderr, args); } while (0)
+
+#define HDR sizeof(rtapi_malloc_hdr_t)
+#define ARENA_SIZE (64 * 1024)
+
+/******************************************************************/
+// Stubs
+
+// heap_print() logs through here, nothing else of rtapi is needed
+int vs_ringlogfv(const msg_level_t level,
+		 const int pid,
+		 const msg_origin_t origin,
+		 const char *tag,
+		 const char *format,
+		 va_list ap)
+{
+    if (debug_tests)
+        vfprintf(stderr, format, ap);
+    return 0;
+}
+
+/******************************************************************/
+// Fixtures
+
+// a heap descriptor followed by its arena, as in a shm segment
+static int heap_setup(void **state)
+{
+    struct rtapi_heap *h = calloc(1, sizeof(struct rtapi_heap) + ARENA_SIZE);
+
+    assert_non_null(h);
+    rtapi_heap_init(h, "test");
+    assert_int_equal(rtapi_heap_addmem(h, h + 1, ARENA_SIZE), 0);
+    *state = h;
+    return 0;
+}
+
+static int heap_teardown(void **state)
+{
+    free(*state);
+    return 0;
+}
+
+static size_t total_avail(struct rtapi_heap *h)
+{
+    struct rtapi_heap_stat hs;
+
+    rtapi_heap_status(h, &hs);
+    return hs.total_avail;
+}
+
+/******************************************************************/
+// Tests
+
+// each class serves the sizes up to its block size, a freed block
+// goes back onto its class list and is handed out again
+static void test_slab_classes(void **state)
+{
+    struct rtapi_heap *h = *state;
+    struct rtapi_heap_stat hs;
+    size_t prev = 0;
+    int c;
+
+    rtapi_heap_status(h, &hs);
+    for (c = 0; c < RTAPI_HEAP_NCLASSES; c++) {
+        size_t size = hs.slab[c].size;
+        DEBUG("class %d: %zu bytes\n", c, size);
+
+        // the smallest and the largest size of the class
+        void *small = rtapi_malloc(h, prev + 1);
+        void *large = rtapi_malloc(h, size);
+        assert_non_null(small);
+        assert_non_null(large);
+        assert_int_equal(rtapi_allocsize(h, small), size);
+        assert_int_equal(rtapi_allocsize(h, large), size);
+
+        struct rtapi_heap_stat s;
+        rtapi_heap_status(h, &s);
+        assert_true(s.slab[c].carved >= 2);
+        assert_int_equal(s.slab[c].inuse, 2);
+
+        rtapi_free(h, large);
+        rtapi_heap_status(h, &s);
+        assert_int_equal(s.slab[c].inuse, 1);
+        assert_int_equal(s.slab[c].hiwater, 2);
+        assert_ptr_equal(rtapi_malloc(h, size), large);
+
+        rtapi_free(h, large);
+        rtapi_free(h, small);
+        rtapi_heap_status(h, &s);
+        assert_int_equal(s.slab[c].inuse, 0);
+        prev = size;
+    }
+
+    // larger requests are served first-fit
+    void *p = rtapi_malloc(h, prev + 1);
+    assert_non_null(p);
+    assert_int_equal(rtapi_allocsize(h, p), prev + HDR);
+    rtapi_free(h, p);
+}
+
+// requested, allocated and freed bytes, and the per-class counters
+static void test_slab_stats(void **state)
+{
+    struct rtapi_heap *h = *state;
+    struct rtapi_heap_stat hs;
+    void *p[100];
+    int i, c;
+
+    rtapi_heap_status(h, &hs);
+    size_t avail = hs.total_avail;
+    for (c = 0; hs.slab[c].size < 30; c++)
+        ;
+    size_t size = hs.slab[c].size;
+
+    for (i = 0; i < 100; i++)
+        assert_non_null(p[i] = rtapi_malloc(h, 30));
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.requested, 100 * 30);
+    assert_int_equal(hs.allocated, 100 * size);
+    assert_int_equal(hs.freed, 0);
+    assert_int_equal(hs.slab[c].inuse, 100);
+    assert_int_equal(hs.slab[c].hiwater, 100);
+    assert_true(hs.slab[c].carved >= 100);
+
+    // carved blocks are accounted for, and taken from the arena
+    size_t carved = hs.slab[c].carved;
+    assert_int_equal(hs.slab_carved, carved * (size + HDR));
+    assert_int_equal(hs.slab_avail, (carved - 100) * size);
+    assert_int_equal(hs.total_avail, avail - hs.slab_carved);
+
+    for (i = 0; i < 50; i++)
+        rtapi_free(h, p[i]);
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.freed, 50 * size);
+    assert_int_equal(hs.slab[c].inuse, 50);
+    assert_int_equal(hs.slab[c].hiwater, 100);
+    assert_int_equal(hs.slab[c].carved, carved);
+    assert_int_equal(hs.slab_avail, (carved - 50) * size);
+
+    // slab blocks never go back to the arena
+    for (i = 50; i < 100; i++)
+        rtapi_free(h, p[i]);
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.freed, 100 * size);
+    assert_int_equal(hs.slab[c].inuse, 0);
+    assert_int_equal(hs.slab_avail, carved * size);
+    assert_int_equal(hs.total_avail, avail - hs.slab_carved);
+}
+
+// a class which cannot carve a block falls back to a first-fit block of
+// the exact size, which is freed back to the arena
+static void test_carve_exhausted(void **state)
+{
+    struct rtapi_heap *h = *state;
+    struct rtapi_heap_stat hs;
+    int c = RTAPI_HEAP_NCLASSES - 1;
+
+    rtapi_heap_status(h, &hs);
+    size_t units = hs.slab[c].size / HDR + 1;
+    size_t want = hs.slab[c - 1].size + HDR;  // smallest of the last class
+    size_t left = want / HDR + 2;             // less than a block of it
+    assert_true(left < units);
+
+    // leave 'left' units in the arena
+    void *fill = rtapi_malloc(h, hs.total_avail - left * HDR - HDR);
+    assert_non_null(fill);
+    assert_int_equal(total_avail(h), left * HDR);
+
+    void *p = rtapi_malloc(h, want);
+    assert_non_null(p);
+    assert_int_equal(rtapi_allocsize(h, p), want);
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.slab[c].carved, 0);
+    assert_int_equal(hs.slab[c].inuse, 0);
+    assert_int_equal(hs.total_avail, HDR);
+
+    // nothing left now
+    assert_null(rtapi_malloc(h, want));
+    assert_null(rtapi_malloc(h, 1));
+
+    rtapi_free(h, p);
+    assert_int_equal(total_avail(h), left * HDR);
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.slab[c].carved, 0);
+
+    // the arena is whole again once everything is freed
+    rtapi_free(h, fill);
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.fragments, 1);
+    assert_int_equal(hs.total_avail, ARENA_SIZE);
+}
+
+// a partial chunk is carved if a full one does not fit
+static void test_carve_partial(void **state)
+{
+    struct rtapi_heap *h = *state;
+    struct rtapi_heap_stat hs;
+    int c = RTAPI_HEAP_NCLASSES - 1;
+
+    rtapi_heap_status(h, &hs);
+    size_t block = hs.slab[c].size + HDR;
+    assert_true(RTAPI_SLAB_CARVE / block > 1);
+
+    void *fill = rtapi_malloc(h, hs.total_avail - block - HDR);
+    assert_non_null(fill);
+    assert_non_null(rtapi_malloc(h, hs.slab[c].size));
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.slab[c].carved, 1);
+    assert_int_equal(hs.slab[c].inuse, 1);
+    assert_int_equal(hs.total_avail, 0);
+}
+
+// RTAPIHEAP_NOSLAB serves every request first-fit at its exact size
+static void test_noslab(void **state)
+{
+    struct rtapi_heap *h = *state;
+    struct rtapi_heap_stat hs;
+    void *p[10];
+    int i, c;
+
+    rtapi_heap_setflags(h, RTAPIHEAP_NOSLAB);
+    for (i = 0; i < 10; i++) {
+        assert_non_null(p[i] = rtapi_malloc(h, 1 + i * 20));
+        assert_int_equal(rtapi_allocsize(h, p[i]),
+                         ((i * 20) / HDR + 1) * HDR);
+    }
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.slab_carved, 0);
+    for (c = 0; c < RTAPI_HEAP_NCLASSES; c++) {
+        assert_int_equal(hs.slab[c].carved, 0);
+        assert_int_equal(hs.slab[c].inuse, 0);
+    }
+
+    for (i = 0; i < 10; i++)
+        rtapi_free(h, p[i]);
+    rtapi_heap_status(h, &hs);
+    assert_int_equal(hs.fragments, 1);
+    assert_int_equal(hs.total_avail, ARENA_SIZE);
+    assert_int_equal(hs.freed, hs.allocated);
+}
+
+/******************************************************************/
+// Main function
+
+int main(void)
+{
+    const struct CMUnitTest tests[] = {
+        cmocka_unit_test_setup_teardown(test_slab_classes,
+                                        heap_setup, heap_teardown),
+        cmocka_unit_test_setup_teardown(test_slab_stats,
+                                        heap_setup, heap_teardown),
+        cmocka_unit_test_setup_teardown(test_carve_exhausted,
+                                        heap_setup, heap_teardown),
+        cmocka_unit_test_setup_teardown(test_carve_partial,
+                                        heap_setup, heap_teardown),
+        cmocka_unit_test_setup_teardown(test_noslab,
+                                        heap_setup, heap_teardown),
+    };
+
+    return cmocka_run_group_tests_name("rtapi_heap tests", tests, NULL, NULL);
+}
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# grouppub: a changed member signal produces a change record in the
+# group's changes ring, and wakes a reader sleeping on the scratchpad.
+# The script plays the reader, see hal_group.h.
+
+import ctypes
+import platform
+import struct
+import subprocess
+import threading
+import time
+from machinekit import hal
+
+SYS_futex = {"x86_64": 202, "aarch64": 98}.get(platform.machine(), 240)
+FUTEX_WAIT = 0
+
+libc = ctypes.CDLL(None, use_errno=True)
+
+class timespec(ctypes.Structure):
+    _fields_ = [("tv_sec", ctypes.c_long), ("tv_nsec", ctypes.c_long)]
+
+def halcmd(arg):
+    return subprocess.check_output("halcmd " + arg, shell=True).decode().strip()
+
+def records():
+    return int(halcmd("getp gp0.records"))
+
+halcmd("newg gpgroup")
+for name, type, value in (("gp.a", "s32", 1),
+                          ("gp.b", "float", 0.5),
+                          ("gp.c", "bit", 0)):
+    halcmd("newsig %s %s" % (name, type))
+    halcmd("sets %s %s" % (name, value))
+    halcmd("newm gpgroup %s" % name)
+
+halcmd("loadrt grouppub")
+halcmd("newinst grouppub gp0 group=gpgroup")
+halcmd("newthread fast 1000000")
+halcmd("addf gp0.funct fast")
+halcmd("start")
+
+ring = hal.Ring("gpgroup.changes")
+sp = ring.scratchpad
+
+# hal_grouppub_t
+ACTIVE, WAITERS, WAKEUP, SERIAL = 0, 4, 8, 12
+
+def get(off):
+    return struct.unpack_from("<I", sp, off)[0]
+
+def put(off, value):
+    struct.pack_into("<I", sp, off, value)
+
+n_members, n_monitored = struct.unpack_from("<ii", sp, 20)
+assert n_members == 3
+assert n_monitored == 3
+
+def read_changes():
+    # hal_group_changes_t: serial, count, then count hal_group_change_t
+    # of index, type and an 8 byte hal_data_u
+    result = []
+    while True:
+        rec = ring.read()
+        if rec is None:
+            return result
+        serial, count = struct.unpack_from("<II", rec, 0)
+        changes = {}
+        for i in range(count):
+            index, type = struct.unpack_from("<II", rec, 8 + 16 * i)
+            if type == hal.HAL_FLOAT:
+                value = struct.unpack_from("<d", rec, 16 + 16 * i)[0]
+            elif type == hal.HAL_S32:
+                value = struct.unpack_from("<i", rec, 16 + 16 * i)[0]
+            else:
+                value = struct.unpack_from("<B", rec, 16 + 16 * i)[0]
+            changes[index] = value
+        result.append((serial, changes))
+        ring.shift()
+
+# nothing is scanned while no reader has the group active
+halcmd("sets gp.a 5")
+time.sleep(0.2)
+assert records() == 0
+assert read_changes() == []
+
+# the change made while inactive shows up once active; members are
+# indexed in name order
+put(ACTIVE, 1)
+time.sleep(0.2)
+assert read_changes() == [(0, {0: 5})]
+assert records() == 1
+assert get(SERIAL) == 1
+
+# unchanged signals produce no records
+time.sleep(0.2)
+assert read_changes() == []
+assert records() == 1
+
+# a reader sleeping on 'wakeup' is woken by the next record
+woken = []
+
+def sleeper():
+    word = ctypes.c_uint32.from_buffer(sp, WAKEUP)
+    expected = word.value
+    ts = timespec(5, 0)
+    start = time.time()
+    r = libc.syscall(SYS_futex, ctypes.addressof(word), FUTEX_WAIT,
+                     expected, ctypes.byref(ts), None, 0)
+    woken.append((r, ctypes.get_errno(), time.time() - start))
+    del word
+
+put(WAITERS, get(WAITERS) + 1)
+t = threading.Thread(target=sleeper)
+t.start()
+time.sleep(0.5)
+assert t.is_alive()
+halcmd("sets gp.b 2.5")
+t.join()
+put(WAITERS, get(WAITERS) - 1)
+
+r, errno, elapsed = woken[0]
+assert r == 0, "futex wait failed, errno %d" % errno
+assert elapsed < 2.0
+assert read_changes() == [(1, {1: 2.5})]
+assert records() == 2
+
+# several changes in one cycle make one record
+put(ACTIVE, 0)
+time.sleep(0.05)
+halcmd("sets gp.a 6")
+halcmd("sets gp.c 1")
+put(ACTIVE, 1)
+time.sleep(0.2)
+assert read_changes() == [(2, {0: 6, 2: 1})]
+
+put(ACTIVE, 0)
+del sp
+del ring
+halcmd("stop")
@@ -0,0 +1,7 @@
+#!/bin/bash
+realtime start
+python3 grouppub.py
+result=$?
+realtime stop
+
+exit $result
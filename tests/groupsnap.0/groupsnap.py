@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# groupsnap: snapshots are taken only while the group is active, and
+# hold the values of the member signals. The script plays the reader
+# through the scratchpad of the snapshot ring, see hal_group.h.
+
+import struct
+import subprocess
+import time
+from machinekit import hal
+
+def halcmd(arg):
+    return subprocess.check_output("halcmd " + arg, shell=True).decode().strip()
+
+def snapshots():
+    return int(halcmd("getp gs0.snapshots"))
+
+values = {"gs.a": 11, "gs.b": -22, "gs.c": 33}
+
+halcmd("newg gsgroup")
+for name, value in values.items():
+    halcmd("newsig %s s32" % name)
+    halcmd("sets %s %d" % (name, value))
+    halcmd("newm gsgroup %s" % name)
+
+halcmd("loadrt groupsnap")
+halcmd("newinst groupsnap gs0 group=gsgroup")
+halcmd("newthread fast 1000000")
+halcmd("addf gs0.funct fast")
+halcmd("start")
+
+ring = hal.Ring("gsgroup.snapshot")
+sp = ring.scratchpad
+active, n_members, every, bufsize = struct.unpack_from("<IiII", sp, 0)
+assert active == 0
+assert n_members == len(values)
+assert every == 1
+
+# hal_groupsnap_t: two cache lines, the counters and the triple buffer
+# flag, followed by the three buffers
+header = ring.scratchpad_size - 3 * bufsize
+tb = header // 2
+
+def set_active(on):
+    struct.pack_into("<I", sp, 0, on)
+    time.sleep(0.01)  # the current cycle may still see the old flag
+
+def latest():
+    # after a flip, bits 2-3 of the flag index the last complete buffer
+    flags = sp[tb]
+    assert flags & 0x40
+    off = header + ((flags >> 2) & 0x3) * bufsize
+    serial, pad, timestamp = struct.unpack_from("<IIq", sp, off)
+    # hal_data_u: 8 bytes per member, s32 in the low word
+    v = [struct.unpack_from("<i", sp, off + 16 + 8 * i)[0]
+         for i in range(n_members)]
+    return serial, timestamp, sorted(v)
+
+# nothing is copied while no reader has the group active
+time.sleep(0.2)
+assert snapshots() == 0
+
+set_active(1)
+time.sleep(0.2)
+set_active(0)
+n = snapshots()
+assert n > 0
+time.sleep(0.2)
+assert snapshots() == n
+
+serial, timestamp, v = latest()
+assert serial == n - 1
+assert v == sorted(values.values())
+
+# changed signals show up in the next snapshots only
+values["gs.b"] = 4711
+halcmd("sets gs.b 4711")
+time.sleep(0.1)
+assert latest() == (serial, timestamp, v)
+
+set_active(1)
+time.sleep(0.2)
+set_active(0)
+m = snapshots()
+assert m > n
+
+serial2, timestamp2, v2 = latest()
+assert serial2 == m - 1
+assert timestamp2 > timestamp
+assert v2 == sorted(values.values())
+
+del ring
+halcmd("stop")
@@ -0,0 +1,7 @@
+#!/bin/bash
+realtime start
+python3 groupsnap.py
+result=$?
+realtime stop
+
+exit $result
@@ -0,0 +1,52 @@
+# sourced by the tests running hm2_eth against hm2_eth_emu.
+#
+# hm2_eth installs an ARP entry for its board, which loopback does not
+# take, so the emulated board sits in a network namespace behind a veth
+# pair. Needs root or passwordless sudo; the skip scripts run emu_check.
+SUDO=
+[ "$(id -u)" = 0 ] || SUDO="sudo -n"
+NS=hm2-eth-emu
+HOST_IF=hm2emu0
+BOARD_IF=hm2emu1
+HOST_IP=10.91.27.1
+BOARD_IP=10.91.27.2
+EMU_LOG=$(pwd)/emu.log
+
+emu_check () {
+    which hm2_eth_emu halrun >/dev/null && $SUDO ip netns list >/dev/null
+}
+
+netns_up () {
+    netns_down
+    $SUDO ip netns add $NS
+    $SUDO ip link add $HOST_IF type veth peer name $BOARD_IF
+    $SUDO ip link set $BOARD_IF netns $NS
+    $SUDO ip addr add $HOST_IP/24 dev $HOST_IF
+    $SUDO ip link set $HOST_IF up
+    $SUDO ip netns exec $NS ip addr add $BOARD_IP/24 dev $BOARD_IF
+    $SUDO ip netns exec $NS ip link set $BOARD_IF up
+    trap netns_down EXIT
+}
+
+netns_down () {
+    emu_stop
+    $SUDO ip link del $HOST_IF 2>/dev/null || true
+    $SUDO ip netns del $NS 2>/dev/null || true
+}
+
+# emu_start [hm2_eth_emu options]: its log goes to $EMU_LOG
+emu_start () {
+    $SUDO ip netns exec $NS $(which hm2_eth_emu) -a $BOARD_IP "$@" \
+	2>$EMU_LOG &
+    EMU=$!
+    sleep 0.5
+}
+
+# stops the emulator, which then logs its counters
+emu_stop () {
+    if [ -n "$EMU" ]; then
+	$SUDO kill $EMU 2>/dev/null || true
+	wait $EMU 2>/dev/null || true
+	EMU=
+    fi
+}
@@ -0,0 +1,22 @@
+#!/bin/sh
+# hm2_eth_bench against hm2_eth_emu on loopback, without and with
+# dropped requests. Only the counts are compared, not the timings.
+PORT=27191
+
+hm2_eth_emu -p $PORT 2>/dev/null &
+EMU=$!
+trap 'kill $EMU 2>/dev/null' EXIT
+sleep 0.5
+hm2_eth_bench -P $PORT -n 2000 -r 256 -w 128 -t 100000 | grep -v usec || exit 1
+kill $EMU
+wait $EMU 2>/dev/null
+
+# every 10th request is lost, on average; the emulator's count of
+# dropped requests follows the benchmark's counts
+hm2_eth_emu -p $PORT -l 10 -s 42 2>emu.log &
+EMU=$!
+sleep 0.5
+hm2_eth_bench -P $PORT -n 200 -t 100000 | grep -v usec || exit 1
+kill $EMU
+wait $EMU 2>/dev/null
+sed -n 's/^hm2_eth_emu: .* \([0-9]*\) dropped$/dropped \1/p' emu.log
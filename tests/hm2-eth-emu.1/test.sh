@@ -0,0 +1,12 @@
+#!/bin/bash -e
+# hm2_eth against the emulated board, without and with 5% of the
+# requests dropped; each run is followed by the emulator's counters
+. ../hm2-eth-emu.0/netns.sh
+netns_up
+for loss in 0 5; do
+    emu_start -l $loss -s 42
+    halrun -f udp.hal
+    emu_stop
+    sed -n 's/^hm2_eth_emu: \([0-9]*\) requests, \([0-9]*\) dropped$/\1 \2/p' \
+	$EMU_LOG
+done
@@ -0,0 +1,14 @@
+#!/bin/bash -e
+# hm2_eth against the emulated board with 64 encoders, writing all
+# registers every cycle and then with tram_refresh=100. Each run is
+# followed by the emulator's counters.
+. ../hm2-eth-emu.0/netns.sh
+netns_up
+for hal in encoders.hal refresh.hal; do
+    emu_start -e 64
+    halrun -f $hal
+    emu_stop
+    sed -n -e 's/^hm2_eth_emu: \([0-9]*\) requests.*$/requests \1/p' \
+	-e 's/^hm2_eth_emu: \([0-9]*\) parse errors, \([0-9]*\) .*$/parse-errors \1 written \2/p' \
+	$EMU_LOG
+done
@@ -0,0 +1,8 @@
+#!/bin/bash -e
+# hm2_eth with transport=ring against the emulated board: outputs are
+# read back over the packet ring, and the replies are not queued on the
+# board's UDP socket as well
+. ../hm2-eth-emu.0/netns.sh
+netns_up
+emu_start
+halrun -f ring.hal
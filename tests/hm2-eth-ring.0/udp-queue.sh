@@ -0,0 +1,4 @@
+#!/bin/sh
+# tx_queue:rx_queue of the UDP socket connected to the board,
+# 10.91.27.2:27181, in the byte order of /proc/net/udp
+awk '$3 == "021B5B0A:6A2D" { print "udp queue " $5 }' /proc/net/udp
@@ -0,0 +1,136 @@
+// HAL object indices: lookup by name and by id must find what a walk
+// of the object list would find, across index resizes, object deletion
+// and reuse of a deleted object's name.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rtapi.h"
+#include "hal.h"
+#include "hal_priv.h"
+
+#define NSIGS 1500
+
+static int ids[NSIGS];
+static int errors;
+
+#define CHECK(cond, fmt, args...)					\
+    do {								\
+	if (!(cond)) {							\
+	    printf("FAIL %s:%d: " fmt "\n", __FILE__, __LINE__, ## args); \
+	    errors++;							\
+	}								\
+    } while (0)
+
+static const char *signame(const int i)
+{
+    static char name[HAL_NAME_LEN + 1];
+    snprintf(name, sizeof(name), "objindex.sig.%d", i);
+    return name;
+}
+
+static hal_sig_t *by_name(const int type, const int i)
+{
+    return halg_find_object_by_name(1, type, signame(i)).sig;
+}
+
+static hal_sig_t *by_id(const int type, const int id)
+{
+    return halg_find_object_by_id(1, type, id).sig;
+}
+
+int main()
+{
+    int i, comp_id;
+    hal_sig_t *sig;
+
+    if ((comp_id = hal_init("objindex_test")) < 0) {
+	printf("hal_init() failed: %d\n", comp_id);
+	exit(1);
+    }
+    hal_ready(comp_id);
+
+    const hal_objindex_t name0 = hal_data->name_index;
+    const hal_objindex_t id0 = hal_data->id_index;
+
+    // insert: enough objects to double both bucket arrays a few times
+    for (i = 0; i < NSIGS; i++)
+	CHECK(hal_signal_new(signame(i), HAL_S32) == 0, "new %s", signame(i));
+    CHECK(hal_data->name_index.entries == name0.entries + NSIGS,
+	  "name entries %u", hal_data->name_index.entries);
+    CHECK(hal_data->id_index.entries == id0.entries + NSIGS,
+	  "id entries %u", hal_data->id_index.entries);
+    CHECK(hal_data->name_index.resizes > name0.resizes, "no name resize");
+    CHECK(hal_data->id_index.resizes > id0.resizes, "no id resize");
+    CHECK(hal_data->name_index.nbuckets >= hal_data->name_index.entries,
+	  "name load factor %u/%u", hal_data->name_index.entries,
+	  hal_data->name_index.nbuckets);
+    CHECK(hal_data->id_index.nbuckets >= hal_data->id_index.entries,
+	  "id load factor %u/%u", hal_data->id_index.entries,
+	  hal_data->id_index.nbuckets);
+    printf("insert: done\n");
+
+    // lookup by name and by id, and the type must match
+    for (i = 0; i < NSIGS; i++) {
+	sig = by_name(HAL_SIGNAL, i);
+	CHECK(sig != NULL, "%s not found by name", signame(i));
+	if (sig == NULL)
+	    continue;
+	ids[i] = ho_id(sig);
+	CHECK(by_id(HAL_SIGNAL, ids[i]) == sig, "%s not found by id", signame(i));
+	CHECK(by_id(0, ids[i]) == sig, "%s not found by untyped id", signame(i));
+	CHECK(by_name(HAL_PIN, i) == NULL, "%s found as pin", signame(i));
+	CHECK(by_id(HAL_PIN, ids[i]) == NULL, "%s found as pin by id",
+	      signame(i));
+    }
+    printf("lookup: done\n");
+
+    // remove: every other signal
+    for (i = 0; i < NSIGS; i += 2)
+	CHECK(hal_signal_delete(signame(i)) == 0, "delete %s", signame(i));
+    CHECK(hal_data->name_index.entries == name0.entries + NSIGS / 2,
+	  "name entries %u", hal_data->name_index.entries);
+    CHECK(hal_data->id_index.entries == id0.entries + NSIGS / 2,
+	  "id entries %u", hal_data->id_index.entries);
+    for (i = 0; i < NSIGS; i++) {
+	sig = by_name(HAL_SIGNAL, i);
+	if (i % 2) {
+	    CHECK(sig != NULL && ho_id(sig) == ids[i],
+		  "%s lost by name", signame(i));
+	    CHECK(by_id(HAL_SIGNAL, ids[i]) == sig, "%s lost by id",
+		  signame(i));
+	} else {
+	    CHECK(sig == NULL, "deleted %s found by name", signame(i));
+	    CHECK(by_id(0, ids[i]) == NULL, "deleted %s found by id",
+		  signame(i));
+	}
+    }
+    printf("remove: done\n");
+
+    // reuse the deleted names: the new objects get new ids
+    for (i = 0; i < NSIGS; i += 2)
+	CHECK(hal_signal_new(signame(i), HAL_FLOAT) == 0, "renew %s",
+	      signame(i));
+    for (i = 0; i < NSIGS; i += 2) {
+	sig = by_name(HAL_SIGNAL, i);
+	CHECK(sig != NULL, "%s not found after reuse", signame(i));
+	if (sig == NULL)
+	    continue;
+	CHECK(sig->type == HAL_FLOAT, "%s: old object found", signame(i));
+	CHECK(ho_id(sig) != ids[i], "%s: id reused", signame(i));
+	CHECK(by_id(HAL_SIGNAL, ho_id(sig)) == sig, "%s: new id not found",
+	      signame(i));
+	CHECK(by_id(0, ids[i]) == NULL, "%s: old id found", signame(i));
+    }
+    printf("reuse: done\n");
+
+    for (i = 0; i < NSIGS; i++)
+	CHECK(hal_signal_delete(signame(i)) == 0, "delete %s", signame(i));
+    CHECK(hal_data->name_index.entries == name0.entries,
+	  "name entries %u after cleanup", hal_data->name_index.entries);
+    CHECK(hal_data->id_index.entries == id0.entries,
+	  "id entries %u after cleanup", hal_data->id_index.entries);
+
+    hal_exit(comp_id);
+    printf("%d errors\n", errors);
+    exit(errors ? 1 : 0);
+}
@@ -0,0 +1,18 @@
+#!/bin/sh
+rm -f objindex_test
+set -e
+gcc -g -DULAPI \
+    -I../../include \
+    objindex_test.c \
+    ../../lib/libmtalk.so \
+    ../../lib/libhalulapi.so \
+    ../../lib/libhal.so \
+    -o objindex_test
+
+realtime start
+set +e
+./objindex_test
+result=$?
+realtime stop
+
+exit $result
@@ -0,0 +1,2 @@
+#!/bin/bash
+pb2json-test